@@ -0,0 +1,59 @@
+#ifndef BENCHMARKUTILS_H
+#define BENCHMARKUTILS_H
+
+#include <chrono>
+#include <cstddef>
+#include <fstream>
+#include <iostream>
+#include <streambuf>
+
+#ifdef __APPLE__
+  #include <mach/mach.h>
+#endif
+
+/**
+ * 基准程序共用的工具：计时、屏蔽日志、读取常驻内存
+ */
+
+// 丢弃所有输出的 streambuf，用于在测量期间屏蔽日志
+class NullBuffer : public std::streambuf {
+ protected:
+  int overflow(int c) override { return c; }
+};
+
+// RAII：作用域内屏蔽 std::cout
+class ScopedSilence {
+ public:
+  ScopedSilence() : m_saved(std::cout.rdbuf(&m_null)) {}
+  ~ScopedSilence() { std::cout.rdbuf(m_saved); }
+
+ private:
+  NullBuffer m_null;
+  std::streambuf* m_saved;
+};
+
+// 获取当前进程的常驻内存（字节）
+inline size_t currentResidentBytes() {
+#ifdef __APPLE__
+  mach_task_basic_info info;
+  mach_msg_type_number_t count = MACH_TASK_BASIC_INFO_COUNT;
+  if (task_info(mach_task_self(), MACH_TASK_BASIC_INFO,
+                reinterpret_cast<task_info_t>(&info), &count) != KERN_SUCCESS) {
+    return 0;
+  }
+  return info.resident_size;
+#else
+  std::ifstream statm("/proc/self/statm");
+  size_t pages = 0, residentPages = 0;
+  statm >> pages >> residentPages;
+  return residentPages * 4096;
+#endif
+}
+
+inline double elapsedMs(std::chrono::steady_clock::time_point start) {
+  return std::chrono::duration<double, std::milli>(
+             std::chrono::steady_clock::now() - start)
+      .count();
+}
+
+#endif  // BENCHMARKUTILS_H
@@ -0,0 +1,115 @@
+#ifndef MOCKVIEWFACTORY_H
+#define MOCKVIEWFACTORY_H
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include "common/ui/RecyclingMountingLayer.h"
+
+/**
+ * MockView - 模拟的平台视图，只保存属性、子视图和 frame
+ */
+struct MockView {
+  std::string viewName;
+  mini_rn::ui::Props props;
+  std::vector<MockView*> children;
+  MockView* parent = nullptr;
+  mini_rn::ui::LayoutFrame frame;
+};
+
+/**
+ * MockViewFactory - 测试用的视图工厂
+ *
+ * 用 MockView 代替平台视图，统计创建、销毁和重置的次数，
+ * 用于在无界面环境下测量视图回收池的效果。
+ */
+class MockViewFactory : public mini_rn::ui::ViewFactory {
+ public:
+  mini_rn::ui::ViewHandle createView(const std::string& viewName) override {
+    MockView* view = new MockView();
+    view->viewName = viewName;
+    allocations_++;
+    liveViews_++;
+    return view;
+  }
+
+  void destroyView(const std::string&,
+                   mini_rn::ui::ViewHandle handle) override {
+    MockView* view = cast(handle);
+    detach(view);
+    delete view;
+    liveViews_--;
+  }
+
+  void resetView(const std::string&, mini_rn::ui::ViewHandle handle) override {
+    MockView* view = cast(handle);
+    detach(view);
+    view->props.clear();
+    view->frame = mini_rn::ui::LayoutFrame();
+    resets_++;
+  }
+
+  void updateProps(mini_rn::ui::ViewHandle handle,
+                   const mini_rn::ui::MountInstructionBuffer& instructions,
+                   const mini_rn::ui::MountInstruction& instruction) override {
+    MockView* view = cast(handle);
+    for (uint32_t i = 0; i < instruction.propsCount; ++i) {
+      const mini_rn::ui::MountProp& prop = instructions.getProp(instruction, i);
+      if (prop.type == mini_rn::ui::PropValue::Type::Null) {
+        view->props.erase(prop.name);
+      } else {
+        view->props.set(prop.name, instructions.getPropValue(prop));
+      }
+    }
+  }
+
+  void insertChild(mini_rn::ui::ViewHandle parent,
+                   mini_rn::ui::ViewHandle child, int index) override {
+    MockView* parentView = cast(parent);
+    MockView* childView = cast(child);
+    parentView->children.insert(parentView->children.begin() + index,
+                                childView);
+    childView->parent = parentView;
+  }
+
+  void removeChild(mini_rn::ui::ViewHandle parent,
+                   mini_rn::ui::ViewHandle child, int index) override {
+    MockView* parentView = cast(parent);
+    parentView->children.erase(parentView->children.begin() + index);
+    cast(child)->parent = nullptr;
+  }
+
+  void updateLayout(mini_rn::ui::ViewHandle handle,
+                    const mini_rn::ui::LayoutFrame& frame) override {
+    cast(handle)->frame = frame;
+  }
+
+  size_t getAllocations() const { return allocations_; }
+  size_t getLiveViews() const { return liveViews_; }
+  size_t getResets() const { return resets_; }
+
+ private:
+  static MockView* cast(mini_rn::ui::ViewHandle handle) {
+    return static_cast<MockView*>(handle);
+  }
+
+  // 移出父视图并移除所有子视图
+  static void detach(MockView* view) {
+    if (view->parent) {
+      auto& siblings = view->parent->children;
+      siblings.erase(std::find(siblings.begin(), siblings.end(), view));
+      view->parent = nullptr;
+    }
+    for (MockView* child : view->children) {
+      child->parent = nullptr;
+    }
+    view->children.clear();
+  }
+
+  size_t allocations_ = 0;
+  size_t liveViews_ = 0;
+  size_t resets_ = 0;
+};
+
+#endif  // MOCKVIEWFACTORY_H
@@ -0,0 +1,441 @@
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <new>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "BenchmarkUtils.h"
+#include "common/bridge/JSExecutor.h"
+#include "common/ui/Props.h"
+#include "common/utils/JSONDocument.h"
+#include "common/utils/JSONParser.h"
+#include "common/utils/MonotonicArena.h"
+
+using mini_rn::utils::JSONDocument;
+using mini_rn::utils::JSONValue;
+using mini_rn::utils::MonotonicArena;
+
+/**
+ * 统计堆分配次数：替换全局 operator new，只在 g_countAllocations 为 true 时计数
+ * （不内联，避免编译器把内联后的 malloc / free 误报为 new / delete 不匹配）
+ */
+namespace {
+bool g_countAllocations = false;
+size_t g_allocations = 0;
+}  // namespace
+
+__attribute__((noinline)) void* operator new(size_t size) {
+  if (g_countAllocations) g_allocations++;
+  if (void* p = std::malloc(size ? size : 1)) return p;
+  throw std::bad_alloc();
+}
+__attribute__((noinline)) void operator delete(void* p) noexcept { std::free(p); }
+__attribute__((noinline)) void operator delete(void* p, size_t) noexcept {
+  std::free(p);
+}
+
+/**
+ * Mini React Native - Bridge 队列解析基准
+ *
+ * 不依赖 JS 引擎：
+ * 1. 正确性自检 - 各结构索引实现输出一致；JSONDocument 解析的队列与
+ *    SimpleBridgeJSONParser 一致，嵌套对象和转义字符串正确，非法输入被拒绝
+ * 2. 结构索引吞吐 - 标量 / SSE2 / AVX2 实现处理同一个队列的速度
+ * 3. 一次刷新的完整解析 - 模拟一个 UI 批次（createView + props 对象）：
+ *    - 旧路径：SimpleBridgeJSONParser 拆出参数文本，模块再用
+ *      splitJSONArray / splitJSONObject 逐层重新解析
+ *    - 新路径：JSONDocument 整个队列解析一次，模块直接遍历值树
+ * 4. 每次刷新的堆分配 - 通过 nativeFlushQueueImmediate 驱动真实的
+ *    JSExecutor 刷新路径（JSONDocument + 竞技场中的 BridgeMessage +
+ *    ModuleRegistry 派发），稳定状态下应当为 0
+ *
+ * 使用方式：
+ * - make bench-bridge
+ * - 或直接运行 ./build/benchmark_bridge
+ */
+
+namespace {
+
+constexpr int kCallsPerFlush = 500;
+constexpr int kFlushes = 400;
+
+bool check(const std::string& name, bool ok) {
+  std::cout << "   " << (ok ? "✓ " : "✗ ") << name << std::endl;
+  return ok;
+}
+
+/**
+ * 生成一个 UI 批次的队列：createView / updateView / setChildren 交替
+ */
+std::string generateUIQueue(int callCount) {
+  std::string moduleIds, methodIds, params, callbackIds;
+  for (int i = 0; i < callCount; ++i) {
+    const char* separator = i > 0 ? "," : "";
+    int tag = i + 2;
+    int method = i % 3;
+    moduleIds += separator + std::to_string(0);
+    methodIds += separator + std::to_string(method);
+    callbackIds += separator + std::string(i % 10 == 0 ? "null" : "-1");
+    params += separator;
+    if (method == 0) {
+      params += "[" + std::to_string(tag) +
+                ",\"RCTView\",1,{\"flex\":1,\"backgroundColor\":\"#ff0000\","
+                "\"style\":{\"width\":100,\"height\":50.5},"
+                "\"testID\":\"row \\\"" +
+                std::to_string(i) + "\\\"\",\"accessible\":true}]";
+    } else if (method == 1) {
+      params += "[" + std::to_string(tag) +
+                ",\"RCTText\",{\"opacity\":0.5,\"text\":\"item " +
+                std::to_string(i) + "\"}]";
+    } else {
+      params += "[" + std::to_string(tag) + ",[" + std::to_string(tag + 1) +
+                "," + std::to_string(tag + 2) + "," + std::to_string(tag + 3) +
+                "]]";
+    }
+  }
+  return "[[" + moduleIds + "],[" + methodIds + "],[" + params + "],[" +
+         callbackIds + "]]";
+}
+
+/**
+ * 旧路径中模块对一次调用参数的处理：逐层拆分并解析属性
+ */
+size_t consumeArgsText(const std::string& args) {
+  std::vector<std::string> values;
+  if (!mini_rn::utils::splitJSONArray(args, values)) return 0;
+
+  size_t consumed = values.size();
+  for (const auto& value : values) {
+    if (value.empty()) continue;
+    if (value[0] == '{') {
+      std::vector<std::pair<std::string, std::string>> fields;
+      mini_rn::utils::splitJSONObject(value, fields);
+      for (const auto& field : fields) {
+        mini_rn::ui::PropValue prop = mini_rn::ui::PropValue::fromJSON(field.second);
+        consumed += prop.getType() != mini_rn::ui::PropValue::Type::Null;
+      }
+    } else if (value[0] == '[') {
+      std::vector<std::string> children;
+      mini_rn::utils::splitJSONArray(value, children);
+      consumed += children.size();
+    }
+  }
+  return consumed;
+}
+
+/**
+ * 新路径中模块对一次调用参数的处理：直接遍历值树
+ */
+size_t consumeArgs(const JSONValue& args) {
+  size_t consumed = args.size();
+  for (JSONValue value : args) {
+    if (value.isObject()) {
+      for (auto it = value.begin(); it != value.end(); ++it) {
+        mini_rn::ui::PropValue prop = mini_rn::ui::PropValue::fromJSON(*it);
+        consumed += prop.getType() != mini_rn::ui::PropValue::Type::Null;
+      }
+    } else if (value.isArray()) {
+      consumed += value.size();
+    }
+  }
+  return consumed;
+}
+
+bool verify() {
+  std::cout << "\n1. Verifying parser..." << std::endl;
+  bool ok = true;
+
+  // 各实现的结构索引一致（包括跨 64 字节块的字符串和转义）
+  std::string queue = generateUIQueue(200);
+  std::vector<std::string> samples = {
+      queue,
+      "[\"" + std::string(70, 'a') + "\\\\\",\"" + std::string(61, 'b') +
+          "\\\"[{\",{\"k\":[1,2,{\"x\":null}]}]",
+      " [ 1 , -2.5e3 ,true,false,null, \"\\u4e2d\\n\" ] ",
+  };
+  bool indexOk = true;
+  for (const auto& sample : samples) {
+    std::vector<uint32_t> scalar, simd;
+    JSONDocument::indexStructurals(sample, scalar, JSONDocument::Scanner::Scalar);
+    for (auto scanner : {JSONDocument::Scanner::SSE2, JSONDocument::Scanner::AVX2}) {
+      JSONDocument::indexStructurals(sample, simd, scanner);
+      indexOk &= simd == scalar;
+    }
+  }
+  ok &= check(std::string("structural index matches scalar scanner (using ") +
+                  JSONDocument::getScannerName(JSONDocument::getScanner()) + ")",
+              indexOk);
+
+  // 与 SimpleBridgeJSONParser 的结果一致
+  JSONDocument document;
+  MonotonicArena arena;
+  mini_rn::bridge::BridgeMessage message(arena);
+  {
+    ScopedSilence silence;
+    mini_rn::utils::SimpleBridgeJSONParser::parseBridgeQueue(queue, message);
+  }
+  bool queueOk = document.parse(queue) && document.root().size() == 4;
+  JSONValue root = document.root();
+  for (size_t i = 0; queueOk && i < message.getCallCount(); ++i) {
+    JSONValue callbackId = root[3][i];
+    queueOk &= root[0][i].asInt() == message.moduleIds[i] &&
+               root[1][i].asInt() == message.methodIds[i] &&
+               (callbackId.isNumber() ? callbackId.asInt() : -1) ==
+                   message.callbackIds[i] &&
+               root[2][i].raw() == message.params[i];
+  }
+  ok &= check("queue matches SimpleBridgeJSONParser", queueOk);
+
+  // 嵌套对象、转义和 Unicode
+  bool treeOk = document.parse(
+      "[3,\"RCTView\",{\"style\":{\"width\":10,\"margin\":[1,2]},"
+      "\"label\":\"say \\\"hi\\\"\\n\\u4e2d\"}]");
+  JSONValue props = document.root()[2];
+  treeOk &= document.root()[0].asInt() == 3 &&
+            document.root()[1].asString() == "RCTView" &&
+            props.get("style").get("width").asNumber() == 10 &&
+            props.get("style").get("margin")[1].asInt() == 2 &&
+            props.get("style").raw() == "{\"width\":10,\"margin\":[1,2]}" &&
+            props.get("label").asString() == "say \"hi\"\n\xe4\xb8\xad" &&
+            !props.get("missing").isValid() &&
+            props.toValue().toJSON() ==
+                "{\"style\":{\"width\":10,\"margin\":[1,2]},"
+                "\"label\":\"say \\\"hi\\\"\\n中\"}";
+  ok &= check("nested objects, escapes and unicode", treeOk);
+
+  bool rejectOk = true;
+  for (const char* invalid :
+       {"", "[1,]", "[1 2]", "{\"a\" 1}", "{a:1}", "\"open", "[1]]", "[tru]",
+        "[\"\\x\"]", "[-]"}) {
+    rejectOk &= !document.parse(invalid) && !document.root().isValid() &&
+                !document.getError().empty();
+  }
+  ok &= check("malformed JSON rejected", rejectOk);
+  return ok;
+}
+
+void benchmarkIndex() {
+  std::string queue = generateUIQueue(kCallsPerFlush);
+  std::cout << "\n2. Structural index (" << queue.length() / 1024
+            << " KB queue)..." << std::endl;
+
+  std::vector<uint32_t> positions;
+  double scalarMs = 0;
+  for (auto scanner : {JSONDocument::Scanner::Scalar, JSONDocument::Scanner::SSE2,
+                       JSONDocument::Scanner::AVX2}) {
+    if (scanner > JSONDocument::getScanner()) continue;
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < kFlushes; ++i) {
+      JSONDocument::indexStructurals(queue, positions, scanner);
+    }
+    double ms = elapsedMs(start);
+    if (scanner == JSONDocument::Scanner::Scalar) scalarMs = ms;
+    double mbPerSecond = queue.length() * double(kFlushes) / (ms / 1000) / 1e6;
+    std::cout << "   " << std::left << std::setw(10)
+              << JSONDocument::getScannerName(scanner) << std::right
+              << std::setw(10) << mbPerSecond << " MB/s | " << std::setw(6)
+              << scalarMs / ms << "x" << std::endl;
+  }
+}
+
+void benchmarkFlush() {
+  std::string queue = generateUIQueue(kCallsPerFlush);
+  std::cout << "\n3. Full flush parse (" << kCallsPerFlush << " calls, "
+            << kFlushes << " flushes)..." << std::endl;
+
+  size_t legacyConsumed = 0;
+  MonotonicArena arena;
+  auto start = std::chrono::steady_clock::now();
+  {
+    ScopedSilence silence;
+    for (int i = 0; i < kFlushes; ++i) {
+      {
+        mini_rn::bridge::BridgeMessage message(arena);
+        mini_rn::utils::SimpleBridgeJSONParser::parseBridgeQueue(queue, message);
+        for (const auto& params : message.params) {
+          legacyConsumed += consumeArgsText(std::string(params));
+        }
+      }
+      arena.reset();
+    }
+  }
+  double legacyMs = elapsedMs(start);
+
+  JSONDocument document;
+  size_t consumed = 0;
+  start = std::chrono::steady_clock::now();
+  for (int i = 0; i < kFlushes; ++i) {
+    document.parse(queue);
+    for (JSONValue args : document.root()[2]) {
+      consumed += consumeArgs(args);
+    }
+  }
+  double documentMs = elapsedMs(start);
+
+  std::cout << "   " << std::left << std::setw(34)
+            << "split + per-module re-parse" << std::right << std::setw(10)
+            << legacyMs / kFlushes * 1000 << " us/flush" << std::endl;
+  std::cout << "   " << std::left << std::setw(34)
+            << "JSONDocument, walk value tree" << std::right << std::setw(10)
+            << documentMs / kFlushes * 1000 << " us/flush | " << std::setw(6)
+            << legacyMs / documentMs << "x"
+            << (consumed == legacyConsumed ? "" : " (result mismatch!)")
+            << std::endl;
+}
+
+/**
+ * 只实现引擎原语空操作的执行器，用于在没有 JS 引擎时驱动 Bridge 逻辑
+ */
+class FlushHarness : public mini_rn::bridge::JSExecutor {
+ public:
+  FlushHarness() { initializeRuntime(); }
+
+  mini_rn::bridge::JSEngineType getEngineType() const override {
+    return mini_rn::bridge::JSEngineType::JavaScriptCore;
+  }
+  const char* getEngineName() const override { return "FlushHarness"; }
+  void loadApplicationScript(const std::string&, const std::string&) override {}
+  void installGlobalFunction(const std::string& name,
+                             mini_rn::bridge::HostFunction function) override {
+    if (name == "nativeFlushQueueImmediate") flush_ = std::move(function);
+  }
+  mini_rn::bridge::JSCallStatus callGlobalMethod(const std::string&,
+                                                 const std::string&,
+                                                 const std::string&,
+                                                 std::string*) override {
+    return mini_rn::bridge::JSCallStatus::NotFound;
+  }
+  bool setGlobalValue(const std::string&, const std::string&, bool) override {
+    return true;
+  }
+  void destroy() override {}
+
+  /**
+   * 模拟 JS 调用 nativeFlushQueueImmediate(queue)
+   */
+  void flush(const mini_rn::bridge::JSArguments& args) { flush_(args); }
+
+ protected:
+  void evaluateSourceBuffer(const char*, size_t, const std::string&) override {}
+
+ private:
+  mini_rn::bridge::HostFunction flush_;
+};
+
+/**
+ * 以 JSON 文本形式交出队列的参数；引擎把 JS 数组转成文本的那次拷贝
+ * 属于引擎边界，不计入 Bridge 的分配
+ */
+class QueueArguments : public mini_rn::bridge::JSArguments {
+ public:
+  explicit QueueArguments(const std::string& queue) : queue_(queue) {}
+
+  size_t size() const override { return 1; }
+  std::string getString(size_t) const override { return getJSONString(0); }
+  double getNumber(size_t) const override { return 0; }
+  std::string getJSONString(size_t) const override {
+    bool counting = g_countAllocations;
+    g_countAllocations = false;
+    std::string json = queue_;
+    g_countAllocations = counting;
+    return json;
+  }
+
+ private:
+  const std::string& queue_;
+};
+
+/**
+ * 接收 UI 批次调用的模块，只遍历参数的值树
+ */
+class SinkModule : public mini_rn::modules::NativeModule {
+ public:
+  std::string getName() const override { return "Sink"; }
+  std::vector<std::string> getMethods() const override {
+    return {"createView", "updateView", "setChildren"};
+  }
+  void invoke(const std::string&, const std::string&, int) override {}
+  void invokeWithArgs(const std::string&, const JSONValue& args,
+                      int) override {
+    consumed_ += args.size();
+  }
+
+  size_t consumed() const { return consumed_; }
+
+ private:
+  size_t consumed_ = 0;
+};
+
+bool benchmarkFlushAllocations() {
+  std::string queue = generateUIQueue(kCallsPerFlush);
+  std::cout << "\n4. Heap allocations per flush (" << kCallsPerFlush
+            << " calls)..." << std::endl;
+
+  std::unique_ptr<FlushHarness> harness;
+  QueueArguments args(queue);
+  std::vector<std::unique_ptr<mini_rn::modules::NativeModule>> modules;
+  auto sink = std::make_unique<SinkModule>();
+  SinkModule* sinkModule = sink.get();
+  modules.push_back(std::move(sink));
+  bool ok = true;
+  {
+    ScopedSilence silence;
+    harness = std::make_unique<FlushHarness>();
+    harness->registerModules(std::move(modules));
+
+    // 第一次刷新让文档和竞技场增长到需要的容量
+    harness->flush(args);
+    ok &= harness->getFlushStats().flushes == 1;
+  }
+  size_t warmupAllocations = harness->getFlushStats().arenaAllocations;
+
+  size_t allocations = 0;
+  auto start = std::chrono::steady_clock::now();
+  {
+    ScopedSilence silence;
+    g_allocations = 0;
+    g_countAllocations = true;
+    for (int i = 0; i < kFlushes; ++i) {
+      harness->flush(args);
+    }
+    g_countAllocations = false;
+    allocations = g_allocations;
+  }
+  double ms = elapsedMs(start);
+
+  const auto& stats = harness->getFlushStats();
+  std::cout << "   " << std::left << std::setw(34) << "executor flush (silenced log)"
+            << std::right << std::setw(10) << ms / kFlushes * 1000
+            << " us/flush" << std::endl;
+  std::cout << "   BridgeMessage arena: " << stats.lastFlushBytes / 1024
+            << " KB/flush, " << warmupAllocations << " block allocation(s) in warm-up"
+            << std::endl;
+  ok &= check("steady-state flush performs no heap allocation (" +
+                  std::to_string(allocations) + " in " +
+                  std::to_string(kFlushes) + " flushes)",
+              allocations == 0);
+  ok &= check("arena reused across flushes",
+              stats.arenaAllocations == warmupAllocations &&
+                  stats.lastFlushArenaAllocations == 0);
+  ok &= check("all calls dispatched",
+              stats.calls == size_t(kCallsPerFlush) * (kFlushes + 1) &&
+                  sinkModule->consumed() > stats.calls);
+  return ok;
+}
+
+}  // namespace
+
+int main() {
+  std::cout << "Mini React Native - Bridge Queue Parsing Benchmark" << std::endl;
+  std::cout << std::fixed << std::setprecision(2);
+
+  bool ok = verify();
+  benchmarkIndex();
+  benchmarkFlush();
+  ok &= benchmarkFlushAllocations();
+
+  return ok ? 0 : 1;
+}
@@ -0,0 +1,601 @@
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "BenchmarkUtils.h"
+#include "common/modules/BlobModule.h"
+#include "common/modules/FileSystemModule.h"
+#include "common/modules/ModuleRegistry.h"
+#include "common/utils/JSONDocument.h"
+#include "common/utils/JSONParser.h"
+
+using mini_rn::modules::BlobModule;
+using mini_rn::modules::FileSystemModule;
+using mini_rn::utils::BlobManager;
+using mini_rn::utils::ByteBuffer;
+using mini_rn::utils::Value;
+
+/**
+ * Mini React Native - 文件读取基准
+ *
+ * 不依赖 JS 引擎：
+ * 1. 正确性自检 - FileSystemModule 的 stat / readDir / readFile / writeFile
+ *    结果正确；小块读取复用缓冲池，大块读取使用写时复制映射（修改 ArrayBuffer
+ *    不影响文件）；分块读取拼接后与文件一致；同时执行的操作数不超过线程数
+ * 2. 读取一个 16 MB 文件交给 JS：
+ *    - 字符串通道：读入 std::string → base64 → JSON 字符串字面量 → JS 侧
+ *      JSON 解析 → base64 解码（二进制数据走现有 params / result 通道的做法）
+ *    - ArrayBuffer：整个文件一次 readFile（映射）、按 64 KB 分块 readFile
+ *      （缓冲池），JS 直接读取 Native 内存
+ *    每种方式都按字节求和，模拟 JS 读取全部内容
+ * 3. Blob 自检与复制：BlobModule 的 createFromParts / slice / read 结果正确，
+ *    FileSystem 与 BlobModule 共享 blob，修改 readAsArrayBuffer 的结果不影响
+ *    blob；由 JS 复制一个 16 MB 文件：
+ *    - 字符串通道：readFile 结果 base64 编码交给 JS，JS 再原样作为 writeFile
+ *      参数传回（JSON 编码 → Native 解析 → 解码 → 写出）
+ *    - Blob：readFileAsBlob 只返回句柄，writeFile 传回句柄，字节不离开 Native
+ *    并对比把 16 MB 的 blob 交给 JS 的两种方式：readAsArrayBuffer 的写时复制
+ *    映射与整块拷贝
+ *
+ * 数据写在临时目录中，结束后删除。
+ *
+ * 使用方式：
+ * - make bench-filesystem
+ * - 或直接运行 ./build/benchmark_filesystem
+ */
+
+namespace {
+
+constexpr size_t kLargeFileBytes = 16 << 20;
+constexpr size_t kChunkBytes = 64 * 1024;
+
+// methodId：stat = 0, readDir = 1, readFile = 2, writeFile = 3
+constexpr int kStat = 0;
+constexpr int kReadDir = 1;
+constexpr int kReadFile = 2;
+constexpr int kWriteFile = 3;
+constexpr int kReadFileAsBlob = 4;
+
+// BlobModule 的 methodId
+constexpr int kCreateFromParts = 0;
+constexpr int kReadAsArrayBuffer = 1;
+constexpr int kReadAsText = 2;
+constexpr int kRelease = 3;
+
+bool check(const std::string& name, bool ok) {
+  std::cout << "   " << (ok ? "✓ " : "✗ ") << name << std::endl;
+  return ok;
+}
+
+std::string makeBytes(size_t length, unsigned seed) {
+  std::mt19937 rng(seed);
+  std::string bytes(length, '\0');
+  for (char& c : bytes) c = static_cast<char>(rng());
+  return bytes;
+}
+
+bool writeWholeFile(const std::string& path, const std::string& bytes) {
+  FILE* file = std::fopen(path.c_str(), "wb");
+  if (!file) return false;
+  bool ok = std::fwrite(bytes.data(), 1, bytes.size(), file) == bytes.size();
+  return std::fclose(file) == 0 && ok;
+}
+
+std::string readWholeFile(const std::string& path) {
+  std::string bytes;
+  int fd = open(path.c_str(), O_RDONLY);
+  if (fd < 0) return bytes;
+  struct stat st;
+  fstat(fd, &st);
+  bytes.resize(static_cast<size_t>(st.st_size));
+  size_t done = 0;
+  while (done < bytes.size()) {
+    ssize_t n = read(fd, &bytes[done], bytes.size() - done);
+    if (n <= 0) break;
+    done += static_cast<size_t>(n);
+  }
+  bytes.resize(done);
+  close(fd);
+  return bytes;
+}
+
+/**
+ * 模拟 JS 读取全部内容
+ */
+uint64_t sumBytes(const uint8_t* data, size_t size) {
+  uint64_t sum = 0;
+  for (size_t i = 0; i < size; ++i) sum += data[i];
+  return sum;
+}
+
+const char kBase64[] =
+    "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+std::string base64Encode(const std::string& bytes) {
+  std::string out;
+  out.reserve((bytes.size() + 2) / 3 * 4);
+  size_t i = 0;
+  for (; i + 2 < bytes.size(); i += 3) {
+    uint32_t n = (uint8_t(bytes[i]) << 16) | (uint8_t(bytes[i + 1]) << 8) |
+                 uint8_t(bytes[i + 2]);
+    out.push_back(kBase64[n >> 18]);
+    out.push_back(kBase64[(n >> 12) & 63]);
+    out.push_back(kBase64[(n >> 6) & 63]);
+    out.push_back(kBase64[n & 63]);
+  }
+  if (i < bytes.size()) {
+    uint32_t n = uint8_t(bytes[i]) << 16;
+    if (i + 1 < bytes.size()) n |= uint8_t(bytes[i + 1]) << 8;
+    out.push_back(kBase64[n >> 18]);
+    out.push_back(kBase64[(n >> 12) & 63]);
+    out.push_back(i + 1 < bytes.size() ? kBase64[(n >> 6) & 63] : '=');
+    out.push_back('=');
+  }
+  return out;
+}
+
+std::string base64Decode(std::string_view text) {
+  static int8_t table[256];
+  static bool initialized = false;
+  if (!initialized) {
+    std::fill(std::begin(table), std::end(table), int8_t(-1));
+    for (int i = 0; i < 64; ++i) table[uint8_t(kBase64[i])] = int8_t(i);
+    initialized = true;
+  }
+  std::string out;
+  out.reserve(text.size() / 4 * 3);
+  uint32_t n = 0;
+  int bits = 0;
+  for (char c : text) {
+    int8_t v = table[uint8_t(c)];
+    if (v < 0) continue;
+    n = (n << 6) | uint32_t(v);
+    bits += 6;
+    if (bits >= 8) {
+      bits -= 8;
+      out.push_back(static_cast<char>((n >> bits) & 0xff));
+    }
+  }
+  return out;
+}
+
+/**
+ * 注册了 FileSystemModule（模块 0）和 BlobModule（模块 1）的 ModuleRegistry，
+ * 两者共享一个 BlobManager，记录每个 callId 的结果
+ */
+class Harness {
+ public:
+  Harness() {
+    ScopedSilence silence;
+    registry_ = std::make_unique<mini_rn::modules::ModuleRegistry>();
+    registry_->setCallbackHandler(
+        [this](int callId, const Value& result, bool isError) {
+          if (static_cast<size_t>(callId) >= results_.size()) {
+            results_.resize(callId + 1);
+          }
+          results_[callId] = {result, isError};
+        });
+    blobs_ = std::make_shared<BlobManager>();
+    auto module = std::make_unique<FileSystemModule>(2, blobs_);
+    module_ = module.get();
+    std::vector<std::unique_ptr<mini_rn::modules::NativeModule>> modules;
+    modules.push_back(std::move(module));
+    modules.push_back(std::make_unique<BlobModule>(blobs_));
+    registry_->registerModules(std::move(modules));
+  }
+
+  int call(int methodId, const std::string& args, int moduleId = 0) {
+    ScopedSilence silence;
+    int callId = nextCallId_++;
+    registry_->callNativeMethod(moduleId, methodId, args, callId);
+    return callId;
+  }
+  int callBlob(int methodId, const std::string& args) {
+    return call(methodId, args, 1);
+  }
+
+  /**
+   * 等待所有操作完成并投递回调（对应 tick）
+   */
+  void flush() { module_->flush(); }
+
+  const Value& result(int callId) const { return results_[callId].first; }
+  bool isError(int callId) const { return results_[callId].second; }
+  const ByteBuffer* buffer(int callId) const {
+    const Value& value = result(callId);
+    return value.isArrayBuffer() ? value.asArrayBuffer().get() : nullptr;
+  }
+  // 丢弃结果，对应 JS 释放 ArrayBuffer
+  void release(int callId) { results_[callId].first = Value(); }
+  void releaseResults() { results_.clear(); }
+
+  FileSystemModule* module() const { return module_; }
+  const BlobManager& blobs() const { return *blobs_; }
+
+ private:
+  std::shared_ptr<BlobManager> blobs_;
+  std::unique_ptr<mini_rn::modules::ModuleRegistry> registry_;
+  FileSystemModule* module_ = nullptr;
+  std::vector<std::pair<Value, bool>> results_;
+  int nextCallId_ = 0;
+};
+
+std::string quote(const std::string& path) {
+  return mini_rn::utils::quoteJSONString(path);
+}
+
+bool verify(const std::string& directory) {
+  std::cout << "\n1. Verifying FileSystemModule..." << std::endl;
+  bool ok = true;
+
+  std::string smallPath = directory + "/small.txt";
+  std::string largePath = directory + "/large.bin";
+  std::string small = "hello, file system\n";
+  std::string large = makeBytes(1 << 20, 3);
+  writeWholeFile(smallPath, small);
+  writeWholeFile(largePath, large);
+
+  Harness harness;
+  int statCall = harness.call(kStat, "[" + quote(largePath) + "]");
+  int dirCall = harness.call(kReadDir, "[" + quote(directory) + "]");
+  int smallCall = harness.call(kReadFile, "[" + quote(smallPath) + "]");
+  int sliceCall = harness.call(kReadFile, "[" + quote(smallPath) + ",7,4]");
+  int pastEndCall = harness.call(kReadFile, "[" + quote(smallPath) + ",100,4]");
+  int largeCall = harness.call(kReadFile, "[" + quote(largePath) + ",0,-1]");
+  int missingCall = harness.call(kReadFile, "[" + quote(directory + "/none") + "]");
+  harness.flush();
+
+  const Value& info = harness.result(statCall);
+  ok &= check("stat reports size and type",
+              info.isObject() && info.get("size") &&
+                  info.get("size")->asNumber() == large.size() &&
+                  info.get("isFile")->asBool() &&
+                  !info.get("isDirectory")->asBool());
+  const Value& names = harness.result(dirCall);
+  ok &= check("readDir lists entries without . and ..",
+              names.isArray() && names.size() == 2 &&
+                  (names.asArray()[0] == Value("small.txt") ||
+                   names.asArray()[1] == Value("small.txt")));
+  const ByteBuffer* smallBuffer = harness.buffer(smallCall);
+  const ByteBuffer* slice = harness.buffer(sliceCall);
+  const ByteBuffer* pastEnd = harness.buffer(pastEndCall);
+  ok &= check("readFile returns ArrayBuffer with exact bytes and slices",
+              smallBuffer && smallBuffer->view() == small && slice &&
+                  slice->view() == "file" && pastEnd && pastEnd->size() == 0);
+  ok &= check("ArrayBuffer encodes as {} in JSON, never as bytes",
+              harness.result(smallCall).toJSON() == "{}");
+
+  // 写时复制映射：修改交给 JS 的内存不会写回文件
+  const ByteBuffer* largeBuffer = harness.buffer(largeCall);
+  bool largeOk = largeBuffer && largeBuffer->view() == large &&
+                 harness.module()->getStats().mappedReads == 1;
+  if (largeBuffer) largeBuffer->data()[0] ^= 0xff;
+  ok &= check("large read is a copy-on-write mapping",
+              largeOk && readWholeFile(largePath) == large);
+  ok &= check("missing file rejects",
+              harness.isError(missingCall) &&
+                  harness.module()->getStats().failures == 1);
+
+  std::string writePath = directory + "/written.txt";
+  int writeCall = harness.call(kWriteFile, "[" + quote(writePath) + ",\"ab\"]");
+  harness.flush();
+  int appendCall =
+      harness.call(kWriteFile, "[" + quote(writePath) + ",\"c\\u4e2d\",true]");
+  harness.flush();
+  int readBackCall = harness.call(kReadFile, "[" + quote(writePath) + "]");
+  harness.flush();
+  const ByteBuffer* readBack = harness.buffer(readBackCall);
+  ok &= check("writeFile and append round-trip UTF-8 text",
+              harness.result(writeCall).isNull() &&
+                  harness.result(appendCall).isNull() && readBack &&
+                  readBack->view() == "abc\xe4\xb8\xad");
+
+  // 分块读取，释放前一批 ArrayBuffer 后缓冲区被复用
+  harness.releaseResults();
+  std::string reassembled;
+  for (size_t offset = 0;; offset += 4 * kChunkBytes) {
+    std::vector<int> calls;
+    for (int i = 0; i < 4; ++i) {
+      calls.push_back(harness.call(
+          kReadFile, "[" + quote(largePath) + "," +
+                         std::to_string(offset + i * kChunkBytes) + "," +
+                         std::to_string(kChunkBytes) + "]"));
+    }
+    harness.flush();
+    size_t got = 0;
+    for (int callId : calls) {
+      const ByteBuffer* chunk = harness.buffer(callId);
+      if (chunk) reassembled.append(chunk->view()), got += chunk->size();
+    }
+    harness.releaseResults();
+    if (got < 4 * kChunkBytes) break;
+  }
+  mini_rn::utils::BufferPool::Stats poolStats =
+      harness.module()->getBufferPool().getStats();
+  ok &= check("chunked reads reassemble the file and reuse pooled buffers (" +
+                  std::to_string(poolStats.reused) + "/" +
+                  std::to_string(poolStats.acquired) + " reused)",
+              reassembled == large && poolStats.reused > 0 &&
+                  poolStats.outstanding == 0);
+  ok &= check("concurrent operations bounded by I/O threads",
+              harness.module()->getWorkerPool().getStats().maxConcurrent <=
+                  harness.module()->getWorkerPool().getThreadCount());
+
+  for (const std::string& path : {smallPath, largePath, writePath}) {
+    std::remove(path.c_str());
+  }
+  return ok;
+}
+
+/**
+ * 句柄对象的 JSON 文本（JS 侧 Blob.data）
+ */
+std::string handleJSON(const Value& handle) { return handle.toJSON(); }
+
+bool verifyBlobs(const std::string& directory) {
+  std::cout << "\n3. Verifying BlobModule..." << std::endl;
+  bool ok = true;
+  Harness harness;
+
+  // JS 生成 blobId，createFromParts 没有回调
+  harness.callBlob(kCreateFromParts,
+                   "[[{\"type\":\"string\",\"data\":\"hello \"},"
+                   "{\"type\":\"string\",\"data\":\"w\\u00f6rld\"}],"
+                   "\"js:1\"]");
+  int textCall = harness.callBlob(
+      kReadAsText, "[{\"blobId\":\"js:1\",\"offset\":0,\"size\":12}]");
+  int sliceCall = harness.callBlob(
+      kReadAsText, "[{\"blobId\":\"js:1\",\"offset\":6,\"size\":6}]");
+  ok &= check("createFromParts concatenates strings; slices read by range",
+              harness.result(textCall) == Value("hello w\xc3\xb6rld") &&
+                  harness.result(sliceCall) == Value("w\xc3\xb6rld"));
+
+  // 单个 blob 部分：与原 blob 共享内存
+  harness.callBlob(kCreateFromParts,
+                   "[[{\"type\":\"blob\",\"blobId\":\"js:1\","
+                   "\"offset\":6,\"size\":6}],\"js:2\"]");
+  std::shared_ptr<ByteBuffer> original = harness.blobs().resolve("js:1");
+  std::shared_ptr<ByteBuffer> shared = harness.blobs().resolve("js:2");
+  ok &= check("single blob part shares memory with its source",
+              original && shared && shared->data() == original->data() + 6 &&
+                  shared->size() == 6);
+  original.reset();
+  shared.reset();
+
+  int missingCall = harness.callBlob(
+      kReadAsArrayBuffer,
+      "[{\"blobId\":\"js:9\",\"offset\":0,\"size\":1}]");
+  int rangeCall = harness.callBlob(
+      kReadAsArrayBuffer,
+      "[{\"blobId\":\"js:1\",\"offset\":8,\"size\":10}]");
+  ok &= check("unknown blob and out-of-range handle reject",
+              harness.isError(missingCall) && harness.isError(rangeCall));
+
+  // 文件 → blob → 文件
+  std::string sourcePath = directory + "/blob_source.bin";
+  std::string copyPath = directory + "/blob_copy.bin";
+  std::string source = makeBytes(512 * 1024, 5);
+  writeWholeFile(sourcePath, source);
+  int blobCall = harness.call(kReadFileAsBlob, "[" + quote(sourcePath) + "]");
+  harness.flush();
+  Value handle = harness.result(blobCall);
+  int bufferCall = harness.callBlob(kReadAsArrayBuffer,
+                                    "[" + handleJSON(handle) + "]");
+  const ByteBuffer* blobBuffer = harness.buffer(bufferCall);
+  ok &= check("readFileAsBlob returns a handle readable as ArrayBuffer",
+              handle.isObject() && handle.get("size") &&
+                  handle.get("size")->asNumber() == source.size() &&
+                  blobBuffer && blobBuffer->view() == source);
+  if (blobBuffer) blobBuffer->data()[0] ^= 0xff;  // 模拟 JS 写 ArrayBuffer
+  std::shared_ptr<ByteBuffer> stored =
+      harness.blobs().resolve(handle.get("blobId")->asString());
+  ok &= check("writing the ArrayBuffer leaves the blob unchanged",
+              stored && stored->view() == source);
+  int writeCall = harness.call(
+      kWriteFile, "[" + quote(copyPath) + "," + handleJSON(handle) + "]");
+  harness.flush();
+  ok &= check("writeFile accepts a blob handle",
+              harness.result(writeCall).isNull() &&
+                  readWholeFile(copyPath) == source);
+
+  for (const char* blobId : {"\"js:1\"", "\"js:2\""}) {
+    harness.callBlob(kRelease, std::string("[") + blobId + "]");
+  }
+  harness.callBlob(kRelease, "[" + quote(handle.get("blobId")->asString()) +
+                                 "]");
+  BlobManager::Stats stats = harness.blobs().getStats();
+  ok &= check("released blobs free their memory",
+              stats.blobs == 0 && stats.bytes == 0 && stats.created == 3 &&
+                  stats.released == 3);
+
+  std::remove(sourcePath.c_str());
+  std::remove(copyPath.c_str());
+  return ok;
+}
+
+/**
+ * 由 JS 复制一个文件：字符串通道对比 blob 句柄
+ */
+void benchmarkCopy(const std::string& directory) {
+  std::cout << "\n4. Copying a " << (kLargeFileBytes >> 20)
+            << " MB file through JS..." << std::endl;
+
+  std::string path = directory + "/copy_source.bin";
+  std::string copyPath = directory + "/copy_target.bin";
+  std::string bytes = makeBytes(kLargeFileBytes, 13);
+  writeWholeFile(path, bytes);
+
+  // 字符串通道：读出编码 → JS 解析 → JS 作为参数传回 → Native 解析解码写出
+  auto start = std::chrono::steady_clock::now();
+  std::string contents = readWholeFile(path);
+  std::string json = "[" + quote(base64Encode(contents)) + "]";
+  mini_rn::utils::JSONDocument document;
+  document.parse(json);
+  std::string args = "[" + quote(copyPath) + "," +
+                     quote(std::string(document.root()[0].asString())) + "]";
+  document.parse(args);
+  writeWholeFile(copyPath, base64Decode(document.root()[1].asString()));
+  double stringMs = elapsedMs(start);
+  bool stringOk = readWholeFile(copyPath) == bytes;
+  contents.clear();
+  json.clear();
+  args.clear();
+  std::remove(copyPath.c_str());
+
+  Harness harness;
+  start = std::chrono::steady_clock::now();
+  int blobCall = harness.call(kReadFileAsBlob, "[" + quote(path) + "]");
+  harness.flush();
+  std::string handle = handleJSON(harness.result(blobCall));
+  harness.call(kWriteFile, "[" + quote(copyPath) + "," + handle + "]");
+  harness.flush();
+  double blobMs = elapsedMs(start);
+  bool blobOk = readWholeFile(copyPath) == bytes;
+
+  // 把 blob 交给 JS：写时复制映射（readAsArrayBuffer）对比整块拷贝
+  start = std::chrono::steady_clock::now();
+  int bufferCall = harness.callBlob(kReadAsArrayBuffer, "[" + handle + "]");
+  double remapMs = elapsedMs(start);
+  const ByteBuffer* remapped = harness.buffer(bufferCall);
+  bool remapOk = remapped && remapped->view() == bytes;
+  std::shared_ptr<ByteBuffer> stored = harness.blobs().resolve(
+      harness.result(blobCall).get("blobId")->asString());
+  start = std::chrono::steady_clock::now();
+  std::shared_ptr<ByteBuffer> copied =
+      ByteBuffer::copy(stored->data(), stored->size());
+  double copyMs = elapsedMs(start);
+
+  std::cout << "   " << std::left << std::setw(32) << "string (base64 + JSON)"
+            << std::right << std::setw(9) << stringMs << " ms"
+            << (stringOk ? "" : " (content mismatch!)") << std::endl;
+  std::cout << "   " << std::left << std::setw(32) << "Blob handle"
+            << std::right << std::setw(9) << blobMs << " ms | "
+            << std::setw(6) << stringMs / blobMs << "x | " << handle.size()
+            << " bytes over the bridge"
+            << (blobOk ? "" : " (content mismatch!)") << std::endl;
+  std::cout << "   " << std::left << std::setw(32)
+            << "Blob -> ArrayBuffer (copy)" << std::right << std::setw(9)
+            << copyMs << " ms" << std::endl;
+  std::cout << "   " << std::left << std::setw(32)
+            << "Blob -> ArrayBuffer (COW map)" << std::right << std::setw(9)
+            << remapMs << " ms | " << std::setw(6) << copyMs / remapMs << "x"
+            << (remapOk ? "" : " (content mismatch!)") << std::endl;
+
+  std::remove(path.c_str());
+  std::remove(copyPath.c_str());
+}
+
+void benchmark(const std::string& directory) {
+  std::cout << "\n2. Loading a " << (kLargeFileBytes >> 20)
+            << " MB file into JS..." << std::endl;
+
+  std::string path = directory + "/asset.bin";
+  std::string bytes = makeBytes(kLargeFileBytes, 11);
+  writeWholeFile(path, bytes);
+  uint64_t expected = sumBytes(reinterpret_cast<const uint8_t*>(bytes.data()),
+                               bytes.size());
+  bytes.clear();
+  bytes.shrink_to_fit();
+
+  // 字符串通道：Native 读入并编码，JS 解析 JSON 再解码
+  auto start = std::chrono::steady_clock::now();
+  std::string contents = readWholeFile(path);
+  std::string json = "[" + quote(base64Encode(contents)) + "]";
+  size_t bridgeBytes = json.size();
+  mini_rn::utils::JSONDocument document;
+  document.parse(json);
+  std::string decoded = base64Decode(document.root()[0].asString());
+  uint64_t stringSum = sumBytes(
+      reinterpret_cast<const uint8_t*>(decoded.data()), decoded.size());
+  double stringMs = elapsedMs(start);
+  contents.clear();
+  json.clear();
+  decoded.clear();
+
+  Harness harness;
+  start = std::chrono::steady_clock::now();
+  int call = harness.call(kReadFile, "[" + quote(path) + "]");
+  harness.flush();
+  const ByteBuffer* whole = harness.buffer(call);
+  uint64_t mappedSum = whole ? sumBytes(whole->data(), whole->size()) : 0;
+  double mappedMs = elapsedMs(start);
+  harness.releaseResults();
+
+  start = std::chrono::steady_clock::now();
+  uint64_t chunkSum = 0;
+  size_t chunks = 0;
+  // 与 ReadStream 相同：保持两个分块在途
+  int inFlight[2];
+  size_t offset = 0;
+  for (int& callId : inFlight) {
+    callId = harness.call(kReadFile, "[" + quote(path) + "," +
+                                         std::to_string(offset) + "," +
+                                         std::to_string(kChunkBytes) + "]");
+    offset += kChunkBytes;
+  }
+  for (size_t next = 0;; next ^= 1) {
+    harness.flush();
+    const ByteBuffer* chunk = harness.buffer(inFlight[next]);
+    if (!chunk || chunk->size() == 0) break;
+    chunkSum += sumBytes(chunk->data(), chunk->size());
+    chunks++;
+    harness.release(inFlight[next]);
+    inFlight[next] = harness.call(kReadFile, "[" + quote(path) + "," +
+                                                 std::to_string(offset) + "," +
+                                                 std::to_string(kChunkBytes) +
+                                                 "]");
+    offset += kChunkBytes;
+  }
+  double chunkMs = elapsedMs(start);
+  mini_rn::utils::BufferPool::Stats poolStats =
+      harness.module()->getBufferPool().getStats();
+
+  bool sumsOk = stringSum == expected && mappedSum == expected &&
+                chunkSum == expected;
+  std::cout << "   " << std::left << std::setw(32) << "string (base64 + JSON)"
+            << std::right << std::setw(9) << stringMs << " ms | "
+            << (bridgeBytes >> 20) << " MB of JSON text" << std::endl;
+  std::cout << "   " << std::left << std::setw(32) << "ArrayBuffer (mapped)"
+            << std::right << std::setw(9) << mappedMs << " ms | "
+            << std::setw(6) << stringMs / mappedMs << "x" << std::endl;
+  std::cout << "   " << std::left << std::setw(32)
+            << "ArrayBuffer (64 KB chunks)" << std::right << std::setw(9)
+            << chunkMs << " ms | " << std::setw(6) << stringMs / chunkMs
+            << "x | " << chunks << " chunks, " << poolStats.reused
+            << " pooled buffers reused"
+            << (sumsOk ? "" : " (content mismatch!)") << std::endl;
+
+  std::remove(path.c_str());
+}
+
+}  // namespace
+
+int main() {
+  std::cout << "Mini React Native - File System Benchmark" << std::endl;
+  std::cout << std::fixed << std::setprecision(2);
+
+  char directoryTemplate[] = "/tmp/mini_rn_filesystem.XXXXXX";
+  if (!mkdtemp(directoryTemplate)) {
+    std::cout << "Failed to create a temporary directory" << std::endl;
+    return 1;
+  }
+  std::string directory = directoryTemplate;
+
+  bool ok = verify(directory);
+  benchmark(directory);
+  ok &= verifyBlobs(directory);
+  benchmarkCopy(directory);
+
+  rmdir(directory.c_str());
+  return ok ? 0 : 1;
+}
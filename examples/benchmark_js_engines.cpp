@@ -0,0 +1,239 @@
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "common/bridge/JSExecutorFactory.h"
+#include "common/utils/Logging.h"
+#include "BenchmarkUtils.h"
+#include "MockModule.h"
+
+using namespace mini_rn::bridge;
+using mini_rn::utils::Value;
+
+/**
+ * Mini React Native - JS 引擎对比基准
+ *
+ * 对每个编译进来的引擎后端（JavaScriptCore / QuickJS）测量：
+ * 1. 启动时间 - 创建执行器、注册模块、执行 bundle 的耗时，
+ *    分别测量无缓存、脚本缓存未命中、进程内命中、仅持久化缓存命中
+ * 2. 单运行时内存 - 同时保留 N 个运行时时常驻内存（RSS）的平均增量
+ * 3. Bridge 吞吐 - JS → Native（nativeFlushQueueImmediate）与
+ *    Native → JS（callGlobalMethod）每秒可完成的跨越次数，
+ *    以及回调结果以 JSON 文本和类型化值（callGlobalMethodWithArgs）传入的对比
+ * 4. 开发 / 发布 bundle - 各 bundle 的体积和启动时间；分别在 Debug 和 Release
+ *    构建中运行即可对比完整的开发与发布配置（make bench-release）
+ *
+ * 测量期间会屏蔽 std::cout，避免日志输出主导结果。
+ *
+ * 使用方式：
+ * - make bench-engines
+ * - 或直接运行 ./build/benchmark_js_engines
+ */
+
+namespace {
+
+constexpr int kRuntimeCount = 20;
+constexpr int kBridgeIterations = 20000;
+constexpr const char* kScriptCacheDirectory = "build/script_cache";
+
+// 创建执行器并完成与集成测试相同的初始化流程
+std::unique_ptr<JSExecutor> createRuntime(
+    JSEngineType type, const std::string& bundlePath,
+    std::shared_ptr<ScriptCache> scriptCache = nullptr) {
+  auto executor = createJSExecutor(type, std::move(scriptCache));
+  std::vector<std::unique_ptr<mini_rn::modules::NativeModule>> modules;
+  modules.push_back(std::make_unique<MockModule>());
+  executor->registerModules(std::move(modules));
+  if (!bundlePath.empty()) {
+    executor->loadApplicationScriptFromFile(bundlePath);
+  }
+  return executor;
+}
+
+void benchmarkEngine(JSEngineType type, const std::string& bundlePath) {
+  std::string engineName;
+  double startupMs = 0;
+  double cacheMissStartupMs = 0;
+  double cacheHitStartupMs = 0;
+  double persistedStartupMs = 0;
+  ScriptCache::Stats cacheStats;
+  double bytesPerRuntime = 0;
+  double jsToNativePerSec = 0;
+  double nativeToJsPerSec = 0;
+  double jsonResultPerSec = 0;
+  double typedResultPerSec = 0;
+
+  {
+    ScopedSilence silence;
+
+    // 1. 启动时间（取 N 次平均，排除第一次的进程级初始化）
+    createRuntime(type, bundlePath);
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < kRuntimeCount; ++i) {
+      createRuntime(type, bundlePath);
+    }
+    startupMs = elapsedMs(start) / kRuntimeCount;
+
+    // 1.1 启用脚本缓存：第一次未命中（解析并写入缓存），之后全部命中
+    std::string cacheDirectory =
+        std::string(kScriptCacheDirectory) + "/" +
+        (type == JSEngineType::QuickJS ? "quickjs" : "jsc");
+    auto scriptCache = std::make_shared<ScriptCache>(cacheDirectory);
+    start = std::chrono::steady_clock::now();
+    createRuntime(type, bundlePath, scriptCache);
+    cacheMissStartupMs = elapsedMs(start);
+
+    start = std::chrono::steady_clock::now();
+    for (int i = 0; i < kRuntimeCount; ++i) {
+      createRuntime(type, bundlePath, scriptCache);
+    }
+    cacheHitStartupMs = elapsedMs(start) / kRuntimeCount;
+
+    // 1.2 模拟新进程：清空进程内缓存，只能依赖缓存目录中的持久化产物
+    scriptCache->clearMemory();
+    start = std::chrono::steady_clock::now();
+    createRuntime(type, bundlePath, scriptCache);
+    persistedStartupMs = elapsedMs(start);
+    cacheStats = scriptCache->getStats();
+
+    // 2. 单运行时内存：同时保留 N 个运行时
+    size_t before = currentResidentBytes();
+    std::vector<std::unique_ptr<JSExecutor>> runtimes;
+    for (int i = 0; i < kRuntimeCount; ++i) {
+      runtimes.push_back(createRuntime(type, bundlePath));
+    }
+    size_t after = currentResidentBytes();
+    bytesPerRuntime =
+        after > before ? static_cast<double>(after - before) / kRuntimeCount
+                       : 0;
+    engineName = runtimes.front()->getEngineName();
+
+    // 3. Bridge 吞吐
+    JSExecutor& executor = *runtimes.front();
+
+    // JS → Native：每次迭代一次 nativeFlushQueueImmediate
+    std::string flushLoop =
+        "for (var i = 0; i < " + std::to_string(kBridgeIterations) +
+        "; i++) { nativeFlushQueueImmediate([[0], [1], [[i]], [null]]); }";
+    start = std::chrono::steady_clock::now();
+    executor.loadApplicationScript(flushLoop, "bench_flush.js");
+    jsToNativePerSec = kBridgeIterations / (elapsedMs(start) / 1000.0);
+
+    // Native → JS：每次迭代一次 callGlobalMethod
+    executor.loadApplicationScript(
+        "global.__bench = { count: 0, tick: function (n) { this.count += n; } };",
+        "bench_setup.js");
+    start = std::chrono::steady_clock::now();
+    for (int i = 0; i < kBridgeIterations; ++i) {
+      executor.callGlobalMethod("__bench", "tick", "[1]");
+    }
+    nativeToJsPerSec = kBridgeIterations / (elapsedMs(start) / 1000.0);
+
+    // 回调结果：同一个结果对象以 JSON 文本（编码 + 引擎解析）
+    // 或类型化参数（直接构造 JS 值）传给 JS
+    executor.loadApplicationScript(
+        "global.__bench.result = function (id, args) { this.count += id; };",
+        "bench_result.js");
+    Value result = Value::object();
+    result.set("first", 120);
+    result.set("last", 140);
+    result.set("offset", 6012.5);
+    result.set("title", "row \"120\"");
+    result.set("ids", Value::array({1, 2, 3, 4}));
+    start = std::chrono::steady_clock::now();
+    for (int i = 0; i < kBridgeIterations; ++i) {
+      Value args = Value::array({i, Value::array({nullptr, result})});
+      executor.callGlobalMethod("__bench", "result", args.toJSON());
+    }
+    jsonResultPerSec = kBridgeIterations / (elapsedMs(start) / 1000.0);
+
+    start = std::chrono::steady_clock::now();
+    for (int i = 0; i < kBridgeIterations; ++i) {
+      Value args = Value::array({i, Value::array({nullptr, result})});
+      executor.callGlobalMethodWithArgs("__bench", "result", args);
+    }
+    typedResultPerSec = kBridgeIterations / (elapsedMs(start) / 1000.0);
+  }
+
+  std::cout << std::fixed << std::setprecision(2);
+  std::cout << "\n[" << engineName << "]" << std::endl;
+  std::cout << "  Startup (create + modules + bundle): " << startupMs << " ms"
+            << std::endl;
+  std::cout << "  Startup, script cache miss:          " << cacheMissStartupMs
+            << " ms" << std::endl;
+  std::cout << "  Startup, script cache hit:           " << cacheHitStartupMs
+            << " ms" << std::endl;
+  std::cout << "  Startup, persisted cache only:       " << persistedStartupMs
+            << " ms" << std::endl;
+  std::cout << "  Script cache (hit/disk/miss/write):  " << cacheStats.hits
+            << "/" << cacheStats.diskHits << "/" << cacheStats.misses << "/"
+            << cacheStats.diskWrites << std::endl;
+  std::cout << "  Memory per runtime (RSS delta):      "
+            << bytesPerRuntime / 1024.0 << " KB" << std::endl;
+  std::cout << "  JS -> Native crossings:              " << jsToNativePerSec
+            << " /s" << std::endl;
+  std::cout << "  Native -> JS crossings:              " << nativeToJsPerSec
+            << " /s" << std::endl;
+  std::cout << "  Callback results, JSON text:         " << jsonResultPerSec
+            << " /s" << std::endl;
+  std::cout << "  Callback results, typed values:      " << typedResultPerSec
+            << " /s" << std::endl;
+}
+
+// 开发 bundle 与发布 bundle（__DEV__ = false、移除调试日志、压缩）的体积和启动时间
+void compareBundles(JSEngineType type) {
+  const char* bundles[] = {"dist/bundle.js", "dist/bundle.release.js",
+                           "dist/bundle.ram", "dist/bundle.release.ram"};
+
+  std::cout << "\n[Bundles, "
+            << (type == JSEngineType::QuickJS ? "QuickJS" : "JavaScriptCore")
+            << ", C++ " << (MINI_RN_DEV ? "debug" : "release")
+            << " build, log level " << MINI_RN_LOG_LEVEL << "]" << std::endl;
+  for (const char* bundlePath : bundles) {
+    std::ifstream file(bundlePath, std::ios::binary | std::ios::ate);
+    if (!file.good()) continue;
+    double sizeKB = static_cast<double>(file.tellg()) / 1024.0;
+
+    double startupMs = 0;
+    {
+      ScopedSilence silence;
+      createRuntime(type, bundlePath);
+      auto start = std::chrono::steady_clock::now();
+      for (int i = 0; i < kRuntimeCount; ++i) {
+        createRuntime(type, bundlePath);
+      }
+      startupMs = elapsedMs(start) / kRuntimeCount;
+    }
+    std::cout << "  " << std::left << std::setw(25) << bundlePath << std::right
+              << std::setw(8) << sizeKB << " KB  startup " << startupMs
+              << " ms" << std::endl;
+  }
+}
+
+}  // namespace
+
+int main() {
+  std::cout << "Mini React Native - JS Engine Benchmark" << std::endl;
+
+  std::string bundlePath = "dist/bundle.js";
+  if (!std::ifstream(bundlePath).good()) {
+    bundlePath.clear();
+    std::cout << "[Warning] dist/bundle.js not found, measuring bare runtimes "
+                 "(run 'make js-build' first for realistic startup numbers)"
+              << std::endl;
+  }
+
+  for (JSEngineType type : availableJSEngines()) {
+    try {
+      benchmarkEngine(type, bundlePath);
+      compareBundles(type);
+    } catch (const std::exception& e) {
+      std::cout << "Benchmark failed: " << e.what() << std::endl;
+    }
+  }
+
+  return 0;
+}
@@ -0,0 +1,240 @@
+#include <chrono>
+#include <cmath>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "BenchmarkUtils.h"
+#include "common/ui/LayoutEngine.h"
+#include "common/ui/ShadowTree.h"
+
+using namespace mini_rn::ui;
+
+/**
+ * Mini React Native - 增量布局基准
+ *
+ * 直接在 ShadowTree 上构建视图树并由 LayoutEngine 计算布局，不依赖 JS 引擎：
+ * 1. 正确性自检 - flex 分配、对齐、padding、绝对定位、文本测量、增量 dirty 范围
+ * 2. 布局吞吐 - 1k / 10k / 100k 节点在以下场景下的耗时与访问节点数：
+ *    首次布局、无变化、单个文本变化、1% 叶子尺寸变化、非布局属性变化、根尺寸变化
+ *
+ * 使用方式：
+ * - make bench-layout
+ * - 或直接运行 ./build/benchmark_layout
+ */
+
+namespace {
+
+constexpr int kRootTag = 1;
+constexpr int kFanout = 10;
+constexpr float kCharWidth = 7;
+constexpr float kLineHeight = 16;
+
+bool check(const std::string& name, bool ok) {
+  std::cout << "   " << (ok ? "✓ " : "✗ ") << name << std::endl;
+  return ok;
+}
+
+bool frameIs(const LayoutEngine& engine, int tag, float x, float y,
+             float width, float height) {
+  const LayoutFrame* frame = engine.getFrame(tag);
+  return frame && *frame == LayoutFrame{x, y, width, height};
+}
+
+// 模拟文本测量：每个字符固定宽度，超出可用宽度时折行
+LayoutSize measureText(const ShadowNode& node, float width,
+                       MeasureMode widthMode, float, MeasureMode) {
+  static const PropId kText = PropNames::intern("text");
+  const PropValue* text = node.props.get(kText);
+  float textWidth = text ? text->asString().size() * kCharWidth : 0;
+  if (widthMode == MeasureMode::Undefined || textWidth <= width) {
+    return {textWidth, kLineHeight};
+  }
+  float lines = std::ceil(textWidth / std::max(width, kCharWidth));
+  return {width, lines * kLineHeight};
+}
+
+bool verifyLayout() {
+  std::cout << "\n1. Verifying layout..." << std::endl;
+
+  ShadowTree tree;
+  LayoutEngine engine(tree);
+  engine.registerMeasureFunction("RCTText", measureText);
+  tree.addRootView(kRootTag);
+  engine.setRootSize(kRootTag, 300, 200);
+
+  tree.updateView(kRootTag, {{"padding", 10}});
+  tree.createView(2, "RCTView", kRootTag, {{"height", 50}});
+  tree.createView(3, "RCTView", kRootTag,
+                  {{"flex", 1},
+                   {"flexDirection", "row"},
+                   {"justifyContent", "space-between"},
+                   {"alignItems", "center"}});
+  tree.createView(4, "RCTView", kRootTag, {{"width", 50}, {"height", 20}});
+  tree.createView(5, "RCTView", kRootTag, {{"width", 100}, {"height", 40}});
+  tree.createView(6, "RCTText", kRootTag,
+                  {{"text", "hello"}, {"flexShrink", 1}});
+  tree.createView(7, "RCTView", kRootTag,
+                  {{"position", "absolute"},
+                   {"right", 0},
+                   {"bottom", 0},
+                   {"width", 20},
+                   {"height", 20}});
+  tree.setChildren(kRootTag, {2, 3, 7});
+  tree.setChildren(3, {4, 5, 6});
+  engine.computeLayout();
+
+  bool ok = true;
+  ok &= check("stretch and fixed height",
+              frameIs(engine, 2, 10, 10, 280, 50));
+  ok &= check("flex: 1 fills remaining space",
+              frameIs(engine, 3, 10, 60, 280, 130));
+  // 剩余空间 280 - 50 - 100 - 35 = 95，两个间隔各 47.5
+  ok &= check("space-between and centered cross axis",
+              frameIs(engine, 4, 0, 55, 50, 20) &&
+                  frameIs(engine, 5, 97.5f, 45, 100, 40) &&
+                  frameIs(engine, 6, 245, 57, 35, 16));
+  ok &= check("absolute child pinned to bottom-right",
+              frameIs(engine, 7, 280, 180, 20, 20));
+
+  // 只改变一个子节点的宽度：只有它到根的路径变 dirty
+  tree.updateView(5, {{"width", 120}});
+  engine.computeLayout();
+  const LayoutEngine::PassStats& stats = engine.getLastPassStats();
+  ok &= check("update dirties only the path to the root",
+              stats.dirtyNodes == 3 && frameIs(engine, 5, 87.5f, 45, 120, 40));
+  ok &= check("unchanged siblings keep their frames",
+              engine.getChangedTags() == std::vector<int>({5}));
+
+  // 非布局属性不触发布局，没有变更时整棵树命中缓存
+  tree.updateView(4, {{"backgroundColor", "red"}});
+  engine.computeLayout();
+  ok &= check("non-layout props and no-op passes hit the root cache",
+              engine.getLastPassStats().dirtyNodes == 0 &&
+                  engine.getLastPassStats().visits == 1);
+
+  // 文本变化重新测量：放不下时按 flexShrink 收缩，折行后高度增加
+  tree.updateView(6, {{"text", "a much longer label"}});
+  engine.computeLayout();
+  ok &= check("text change re-measures, shrinks and wraps",
+              engine.getLastPassStats().measureCalls > 0 &&
+                  frameIs(engine, 6, 170, 49, 110, 32));
+
+  // display: none 的子树尺寸为 0，不参与 flex
+  tree.updateView(2, {{"display", "none"}});
+  engine.computeLayout();
+  ok &= check("display: none collapses the subtree",
+              frameIs(engine, 2, 0, 0, 0, 0) &&
+                  frameIs(engine, 3, 10, 10, 280, 180));
+
+  // 删除子节点后父节点重新布局
+  tree.removeView(5);
+  engine.computeLayout();
+  ok &= check("removing a child re-lays out its parent",
+              frameIs(engine, 4, 0, 80, 50, 20) &&
+                  frameIs(engine, 6, 147, 82, 133, 16));
+
+  return ok;
+}
+
+/**
+ * 生成 N 个节点的树：容器按层交替 row / column，叶子为文本
+ * 返回叶子 tag
+ */
+std::vector<int> buildTree(ShadowTree& tree, int nodeCount) {
+  std::vector<std::vector<int>> children(nodeCount);
+  std::vector<int> depth(nodeCount, 0);
+  for (int i = 1; i < nodeCount; ++i) {
+    int parent = (i - 1) / kFanout;
+    children[parent].push_back(i + 2);
+    depth[i] = depth[parent] + 1;
+  }
+
+  std::vector<int> leaves;
+  for (int i = 0; i < nodeCount; ++i) {
+    int tag = i + 2;
+    if (children[i].empty()) {
+      tree.createView(tag, "RCTText", kRootTag,
+                      {{"text", "item " + std::to_string(i)},
+                       {"margin", 2}});
+      leaves.push_back(tag);
+    } else {
+      tree.createView(
+          tag, "RCTView", kRootTag,
+          {{"flexDirection", depth[i] % 2 ? "row" : "column"},
+           {"padding", 4},
+           {"flexShrink", 1}});
+    }
+  }
+
+  tree.setChildren(kRootTag, {2});
+  for (int i = 0; i < nodeCount; ++i) {
+    if (!children[i].empty()) tree.setChildren(i + 2, children[i]);
+  }
+  return leaves;
+}
+
+void report(const char* scenario, double ms, const LayoutEngine& engine) {
+  const LayoutEngine::PassStats& stats = engine.getLastPassStats();
+  std::cout << "   " << std::left << std::setw(18) << scenario << std::right
+            << std::setw(10) << ms << " ms | dirty " << std::setw(7)
+            << stats.dirtyNodes << " | visits " << std::setw(7)
+            << stats.visits << " | cache hits " << std::setw(7)
+            << stats.cacheHits << " | measured " << std::setw(6)
+            << stats.measureCalls << " | changed " << std::setw(7)
+            << stats.framesChanged << std::endl;
+}
+
+void benchmarkLayout(int nodeCount) {
+  std::cout << "\n   " << nodeCount << " nodes" << std::endl;
+
+  ShadowTree tree;
+  LayoutEngine engine(tree);
+  engine.registerMeasureFunction("RCTText", measureText);
+  tree.addRootView(kRootTag);
+  engine.setRootSize(kRootTag, 1080, 1920);
+  std::vector<int> leaves = buildTree(tree, nodeCount);
+
+  auto timed = [&](const char* scenario) {
+    auto start = std::chrono::steady_clock::now();
+    engine.computeLayout();
+    report(scenario, elapsedMs(start), engine);
+  };
+
+  timed("initial layout");
+  timed("no changes");
+
+  tree.updateView(leaves[leaves.size() / 2], {{"text", "changed label"}});
+  timed("one text change");
+
+  for (size_t i = 0; i < leaves.size(); i += 100) {
+    tree.updateView(leaves[i], {{"width", 40}});
+  }
+  timed("1% leaves resized");
+
+  for (int i = 0; i < nodeCount; ++i) {
+    tree.updateView(i + 2, {{"backgroundColor", "#00ff00"}});
+  }
+  timed("non-layout props");
+
+  engine.setRootSize(kRootTag, 1920, 1080);
+  timed("root resized");
+}
+
+}  // namespace
+
+int main() {
+  std::cout << "Mini React Native - Incremental Layout Benchmark" << std::endl;
+  std::cout << std::fixed << std::setprecision(2);
+
+  bool ok = verifyLayout();
+
+  std::cout << "\n2. Layout throughput (fanout " << kFanout
+            << ", alternating row / column, text leaves)..." << std::endl;
+  for (int nodeCount : {1000, 10000, 100000}) {
+    benchmarkLayout(nodeCount);
+  }
+
+  return ok ? 0 : 1;
+}
@@ -0,0 +1,226 @@
+#include <algorithm>
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "BenchmarkUtils.h"
+#include "common/modules/VirtualizedListModule.h"
+#include "common/ui/VirtualizedListLayout.h"
+
+using namespace mini_rn::ui;
+using mini_rn::modules::VirtualizedListModule;
+
+/**
+ * Mini React Native - 虚拟列表窗口计算基准
+ *
+ * 不依赖 JS 引擎：
+ * 1. 正确性自检 - 随机更新高度、增删 item 后，偏移、查找和窗口与逐项累加的
+ *    参考实现一致；VirtualizedListModule 的同步方法返回正确的 JSON
+ * 2. 滚动吞吐 - 50k 行列表每个滚动事件测量 10 个新 item 并查询一次窗口：
+ *    - 参考实现：与 JS 中的做法一样，每次重新累加全部偏移再查找窗口，O(n)
+ *    - VirtualizedListLayout：树状数组更新和查询，O(log n)
+ *
+ * 使用方式：
+ * - make bench-list
+ * - 或直接运行 ./build/benchmark_list
+ */
+
+namespace {
+
+constexpr double kEstimatedHeight = 50;
+constexpr double kViewport = 800;
+constexpr double kOverscan = 400;
+
+bool check(const std::string& name, bool ok) {
+  std::cout << "   " << (ok ? "✓ " : "✗ ") << name << std::endl;
+  return ok;
+}
+
+/**
+ * 参考实现：保存高度数组，每次查询重新累加偏移
+ */
+struct NaiveList {
+  std::vector<double> heights;
+  std::vector<double> offsets;  // offsets[i] 为 item i 的起始偏移，末尾为总高度
+
+  void recompute() {
+    offsets.assign(heights.size() + 1, 0);
+    for (size_t i = 0; i < heights.size(); ++i) {
+      offsets[i + 1] = offsets[i] + heights[i];
+    }
+  }
+
+  // 与 [start, end) 相交的 item，空列表返回 {0, -1}
+  std::pair<int, int> window(double start, double end) const {
+    int count = static_cast<int>(heights.size());
+    if (count == 0) return {0, -1};
+    int first = 0;
+    while (first < count - 1 && offsets[first + 1] <= start) first++;
+    int last = first;
+    while (last < count - 1 && offsets[last + 1] < end) last++;
+    return {first, last};
+  }
+};
+
+bool verifyAgainstNaive() {
+  std::cout << "\n1. Verifying against naive prefix sums..." << std::endl;
+
+  std::mt19937 rng(42);
+  std::uniform_int_distribution<int> heightDist(20, 200);
+  VirtualizedListLayout list;
+  NaiveList naive;
+  list.reset(1000, kEstimatedHeight);
+  naive.heights.assign(1000, kEstimatedHeight);
+
+  // 整数高度保证浮点累加结果与参考实现完全相同
+  bool offsetsOk = true, findOk = true, windowOk = true;
+  for (int round = 0; round < 200; ++round) {
+    if (round % 50 == 49) {
+      size_t count = std::uniform_int_distribution<size_t>(0, 1500)(rng);
+      list.setItemCount(count);
+      naive.heights.resize(count, kEstimatedHeight);
+    }
+    for (int i = 0; i < 20 && !naive.heights.empty(); ++i) {
+      size_t index = rng() % naive.heights.size();
+      double height = heightDist(rng);
+      list.setItemHeight(index, height);
+      naive.heights[index] = height;
+    }
+    naive.recompute();
+
+    double total = naive.offsets.back();
+    offsetsOk &= list.getTotalHeight() == total &&
+                 list.getItemCount() == naive.heights.size();
+    for (int i = 0; i < 20 && !naive.heights.empty(); ++i) {
+      size_t index = rng() % (naive.heights.size() + 1);
+      offsetsOk &= list.getItemOffset(index) == naive.offsets[index];
+    }
+
+    for (int i = 0; i < 20; ++i) {
+      double offset =
+          std::uniform_real_distribution<double>(-100, total + 100)(rng);
+      auto expected = naive.window(offset, offset);
+      findOk &= naive.heights.empty() ||
+                list.findItemAt(offset) == static_cast<size_t>(expected.first);
+
+      VirtualizedListLayout::Window window =
+          list.getWindow(offset, kViewport, kOverscan);
+      expected = naive.window(offset - kOverscan, offset + kViewport + kOverscan);
+      windowOk &= window.first == expected.first &&
+                  window.last == expected.second;
+      if (window.last >= window.first) {
+        windowOk &= window.offset == naive.offsets[window.first] &&
+                    window.end == naive.offsets[window.last + 1];
+      }
+    }
+
+    // 恰好落在 item 边界上的偏移属于后一个 item
+    if (naive.heights.size() > 10) {
+      windowOk &= list.getWindow(naive.offsets[10], 0).first == 10;
+    }
+  }
+
+  bool ok = true;
+  ok &= check("offsets and total height match after updates and resizes",
+              offsetsOk);
+  ok &= check("findItemAt matches linear search", findOk);
+  ok &= check("render window matches linear search", windowOk);
+
+  VirtualizedListModule module;
+  std::string total;
+  std::string window;
+  bool unknownRejected;
+  {
+    ScopedSilence silence;
+    module.invokeSync("configure", "[7,100,10]");
+    module.invokeSync("setItemHeights", "[7,0,[30,null,20]]");
+    total = module.invokeSync("setItemCount", "[7,50]");
+    window = module.invokeSync("getWindow", "[7,35,10,0]");
+    unknownRejected = module.invokeSync("getWindow", "[8,0,10,0]").empty();
+  }
+  ok &= check("module sync methods return JSON results",
+              total == "530" &&
+                  window ==
+                      "{\"first\":1,\"last\":2,\"offset\":30,\"end\":60,"
+                      "\"totalHeight\":530}" &&
+                  module.getStats().heightUpdates == 2 && unknownRejected);
+  return ok;
+}
+
+/**
+ * 模拟向下滚动：每个事件前进 kStep，新进入窗口的 10 个 item 上报测量高度
+ */
+void benchmarkScroll(size_t itemCount, int events) {
+  constexpr double kStep = 10 * kEstimatedHeight;
+  std::cout << "\n   " << itemCount << " items, " << events
+            << " scroll events (10 measured items + 1 window query each)"
+            << std::endl;
+
+  std::vector<double> measured(itemCount);
+  std::mt19937 rng(7);
+  for (double& height : measured) {
+    height = std::uniform_int_distribution<int>(30, 120)(rng);
+  }
+
+  NaiveList naive;
+  naive.heights.assign(itemCount, kEstimatedHeight);
+  long naiveChecksum = 0;
+  auto start = std::chrono::steady_clock::now();
+  size_t next = 0;
+  for (int event = 0; event < events; ++event) {
+    for (int i = 0; i < 10 && next < itemCount; ++i, ++next) {
+      naive.heights[next] = measured[next];
+    }
+    naive.recompute();
+    double offset = std::min(event * kStep, naive.offsets.back());
+    naiveChecksum +=
+        naive.window(offset - kOverscan, offset + kViewport + kOverscan).first;
+  }
+  double naiveMs = elapsedMs(start);
+
+  VirtualizedListLayout list;
+  long checksum = 0;
+  start = std::chrono::steady_clock::now();
+  list.reset(itemCount, kEstimatedHeight);
+  next = 0;
+  for (int event = 0; event < events; ++event) {
+    for (int i = 0; i < 10 && next < itemCount; ++i, ++next) {
+      list.setItemHeight(next, measured[next]);
+    }
+    double offset = std::min(event * kStep, list.getTotalHeight());
+    checksum += list.getWindow(offset, kViewport, kOverscan).first;
+  }
+  double fenwickMs = elapsedMs(start);
+
+  std::cout << "   " << std::left << std::setw(26) << "naive recompute"
+            << std::right << std::setw(10) << naiveMs << " ms | "
+            << std::setw(8) << naiveMs * 1000 / events << " us/event"
+            << std::endl;
+  std::cout << "   " << std::left << std::setw(26) << "VirtualizedListLayout"
+            << std::right << std::setw(10) << fenwickMs << " ms | "
+            << std::setw(8) << fenwickMs * 1000 / events << " us/event | "
+            << std::setw(6) << naiveMs / fenwickMs << "x"
+            << (checksum == naiveChecksum ? "" : " (window mismatch!)")
+            << std::endl;
+}
+
+}  // namespace
+
+int main() {
+  std::cout << "Mini React Native - Virtualized List Benchmark" << std::endl;
+  std::cout << std::fixed << std::setprecision(2);
+
+  bool ok = verifyAgainstNaive();
+
+  std::cout << "\n2. Scroll throughput (estimated height "
+            << kEstimatedHeight << ", viewport " << kViewport << ", overscan "
+            << kOverscan << ")..." << std::endl;
+  for (size_t itemCount : {1000, 10000, 50000}) {
+    benchmarkScroll(itemCount, 2000);
+  }
+
+  return ok ? 0 : 1;
+}
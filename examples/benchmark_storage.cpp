@@ -0,0 +1,345 @@
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "BenchmarkUtils.h"
+#include "common/modules/AsyncStorageModule.h"
+#include "common/modules/ModuleRegistry.h"
+#include "common/utils/LogStructuredStore.h"
+
+using mini_rn::modules::AsyncStorageModule;
+using mini_rn::utils::LogStructuredStore;
+
+/**
+ * Mini React Native - 持久化键值存储基准
+ *
+ * 不依赖 JS 引擎：
+ * 1. 正确性自检 - 随机写入、删除并多次重新打开后与 std::map 一致；
+ *    未落盘的写入可以立即读到；写到一半的尾部帧在打开时整帧丢弃；
+ *    压缩后数据不变、文件缩小；AsyncStorageModule 的 Promise 结果正确
+ * 2. 写入吞吐 - 2000 个 key（256 字节 value），每次 multiSet 50 个：
+ *    - 每个 key 一个文件：每个 key 一次 open / write / fsync / close
+ *    - LogStructuredStore：每个批次一帧，同一轮的批次合并为一次 fsync
+ * 3. 读取吞吐 - 随机读取：每次打开读取文件 vs 从映射中拷贝
+ *
+ * 数据写在临时目录中，结束后删除。
+ *
+ * 使用方式：
+ * - make bench-storage
+ * - 或直接运行 ./build/benchmark_storage
+ */
+
+namespace {
+
+constexpr int kKeyCount = 2000;
+constexpr int kBatchSize = 50;
+constexpr size_t kValueBytes = 256;
+constexpr int kReads = 20000;
+
+bool check(const std::string& name, bool ok) {
+  std::cout << "   " << (ok ? "✓ " : "✗ ") << name << std::endl;
+  return ok;
+}
+
+std::string makeKey(int i) { return "@app:item:" + std::to_string(i); }
+
+std::string makeValue(std::mt19937& rng, size_t length) {
+  static const char kChars[] =
+      "abcdefghijklmnopqrstuvwxyz0123456789{}[]\":,\\ \n\xe4\xb8\xad";
+  std::string value(length, ' ');
+  for (char& c : value) c = kChars[rng() % (sizeof(kChars) - 1)];
+  return value;
+}
+
+size_t fileSize(const std::string& path) {
+  struct stat st;
+  return stat(path.c_str(), &st) == 0 ? static_cast<size_t>(st.st_size) : 0;
+}
+
+/**
+ * 比较存储内容与参考模型
+ */
+bool matchesModel(const LogStructuredStore& store,
+                  const std::map<std::string, std::string>& model) {
+  if (store.keys().size() != model.size()) return false;
+  std::string value;
+  for (const auto& entry : model) {
+    if (!store.get(entry.first, value) || value != entry.second) return false;
+  }
+  return true;
+}
+
+bool verifyStore(const std::string& directory) {
+  std::cout << "\n1. Verifying store..." << std::endl;
+  bool ok = true;
+  std::string path = directory + "/verify.db";
+  std::mt19937 rng(7);
+  std::map<std::string, std::string> model;
+
+  // 随机写入和删除，每轮之后重新打开
+  bool modelOk = true, pendingOk = true;
+  for (int round = 0; round < 5; ++round) {
+    ScopedSilence silence;
+    LogStructuredStore store(path);
+    modelOk &= store.open() && matchesModel(store, model);
+    for (int batchIndex = 0; batchIndex < 40; ++batchIndex) {
+      LogStructuredStore::WriteBatch batch;
+      for (int i = 0; i < 10; ++i) {
+        std::string key = makeKey(static_cast<int>(rng() % 200));
+        if (rng() % 4 == 0) {
+          batch.push_back({key, std::nullopt});
+          model.erase(key);
+        } else {
+          std::string value = makeValue(rng, rng() % 64);
+          batch.push_back({key, value});
+          model[key] = value;
+        }
+      }
+      store.write(std::move(batch));
+      // 不等待落盘，读取应当立即反映刚才的写入
+      pendingOk &= matchesModel(store, model);
+    }
+  }
+  {
+    LogStructuredStore store(path);
+    modelOk &= store.open() && matchesModel(store, model);
+  }
+  ok &= check("contents match std::map across reopen", modelOk);
+  ok &= check("unflushed writes are readable", pendingOk);
+
+  // 写到一半的尾部帧：截掉最后一个批次的几个字节
+  std::string tornPath = directory + "/torn.db";
+  size_t fullSize = 0;
+  {
+    LogStructuredStore store(tornPath);
+    store.open();
+    store.write({{"a", std::string("1")}, {"b", std::string("2")}});
+    store.flush();
+    store.write({{"a", std::string("3")}, {"c", std::string("4")}});
+    store.flush();
+    fullSize = fileSize(tornPath);
+  }
+  bool tornOk = truncate(tornPath.c_str(), static_cast<off_t>(fullSize - 3)) == 0;
+  {
+    ScopedSilence silence;
+    LogStructuredStore store(tornPath);
+    std::string a, b, c;
+    tornOk &= store.open() && store.get("a", a) && a == "1" && store.get("b", b) &&
+              b == "2" && !store.get("c", c) && store.getStats().recoveredBytes > 0;
+    // 截断后可以继续追加
+    store.write({{"c", std::string("5")}});
+  }
+  {
+    LogStructuredStore store(tornPath);
+    std::string c;
+    tornOk &= store.open() && store.get("c", c) && c == "5" &&
+              store.getStats().recoveredBytes == 0;
+  }
+  ok &= check("torn tail batch dropped atomically on open", tornOk);
+
+  // 反复覆盖同一批 key 触发压缩
+  std::string compactPath = directory + "/compact.db";
+  std::map<std::string, std::string> compactModel;
+  LogStructuredStore::Stats stats;
+  {
+    ScopedSilence silence;
+    LogStructuredStore::Options options;
+    options.compactionMinBytes = 64 * 1024;
+    LogStructuredStore store(compactPath, options);
+    store.open();
+    for (int round = 0; round < 50; ++round) {
+      LogStructuredStore::WriteBatch batch;
+      for (int i = 0; i < 20; ++i) {
+        std::string value = makeValue(rng, 200);
+        batch.push_back({makeKey(i), value});
+        compactModel[makeKey(i)] = value;
+      }
+      store.write(std::move(batch));
+      store.flush();
+    }
+    stats = store.getStats();
+  }
+  {
+    LogStructuredStore store(compactPath);
+    ok &= check("compaction keeps live data and shrinks the log (" +
+                    std::to_string(stats.compactions) + " compactions, " +
+                    std::to_string(fileSize(compactPath) / 1024) + " KB)",
+                stats.compactions > 0 && fileSize(compactPath) < 64 * 1024 &&
+                    store.open() && matchesModel(store, compactModel));
+  }
+  return ok;
+}
+
+bool verifyModule(const std::string& directory) {
+  std::vector<std::pair<int, std::string>> callbacks;
+  bool beforeCommit;
+  {
+    ScopedSilence silence;
+    mini_rn::modules::ModuleRegistry registry;
+    registry.setCallbackHandler(
+        [&](int callId, const mini_rn::utils::Value& result, bool isError) {
+          callbacks.push_back(
+              {callId, (isError ? "error:" : "") + result.toJSON()});
+        });
+    auto storage =
+        std::make_unique<AsyncStorageModule>(directory + "/module.db");
+    AsyncStorageModule* module = storage.get();
+    std::vector<std::unique_ptr<mini_rn::modules::NativeModule>> modules;
+    modules.push_back(std::move(storage));
+    registry.registerModules(std::move(modules));
+
+    // methodId：multiGet = 0, multiSet = 1, multiRemove = 2, getAllKeys = 3
+    registry.callNativeMethod(
+        0, 1, "[[[\"k1\",\"v1\"],[\"k2\",\"say \\\"hi\\\"\"]]]", 1);
+    registry.callNativeMethod(0, 2, "[[\"k1\"]]", 2);
+    registry.callNativeMethod(0, 0, "[[\"k1\",\"k2\"]]", 3);
+    beforeCommit = callbacks.size() == 1 && callbacks[0].first == 3 &&
+                   callbacks[0].second ==
+                       "[[\"k1\",null],[\"k2\",\"say \\\"hi\\\"\"]]";
+    module->flush();
+    registry.callNativeMethod(0, 3, "[]", 4);
+    registry.callNativeMethod(0, 1, "[[[\"k3\",42]]]", 5);
+  }
+
+  bool ok = check("multiGet sees pending writes before they commit",
+                  beforeCommit);
+  ok &= check("multiSet / multiRemove resolve after commit",
+              callbacks.size() == 5 && callbacks[1].second == "null" &&
+                  callbacks[2].second == "null");
+  ok &= check("getAllKeys and invalid values rejected",
+              callbacks.size() == 5 && callbacks[3].second == "[\"k2\"]" &&
+                  callbacks[4].second.rfind("error:", 0) == 0);
+  return ok;
+}
+
+/**
+ * 每个 key 一个文件，与 RN 在 iOS 上存放较大 value 的方式相同
+ */
+void writeFilePerKey(const std::string& directory, const std::string& key,
+                     const std::string& value) {
+  std::string path = directory + "/" + key;
+  int fd = open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+  if (fd < 0) return;
+  if (write(fd, value.data(), value.size()) == ssize_t(value.size())) fsync(fd);
+  close(fd);
+}
+
+bool readFilePerKey(const std::string& directory, const std::string& key,
+                    std::string& value) {
+  std::string path = directory + "/" + key;
+  int fd = open(path.c_str(), O_RDONLY);
+  if (fd < 0) return false;
+  struct stat st;
+  fstat(fd, &st);
+  value.resize(static_cast<size_t>(st.st_size));
+  bool ok = read(fd, &value[0], value.size()) == ssize_t(value.size());
+  close(fd);
+  return ok;
+}
+
+void benchmark(const std::string& directory) {
+  std::cout << "\n2. Writes (" << kKeyCount << " keys x " << kValueBytes
+            << " B, " << kBatchSize << " keys per multiSet)..." << std::endl;
+
+  std::mt19937 rng(1);
+  std::vector<std::string> keys, values;
+  for (int i = 0; i < kKeyCount; ++i) {
+    keys.push_back(makeKey(i));
+    values.push_back(makeValue(rng, kValueBytes));
+  }
+
+  std::string filesDirectory = directory + "/files";
+  mkdir(filesDirectory.c_str(), 0755);
+  auto start = std::chrono::steady_clock::now();
+  for (int i = 0; i < kKeyCount; ++i) {
+    writeFilePerKey(filesDirectory, keys[i], values[i]);
+  }
+  double filesMs = elapsedMs(start);
+
+  LogStructuredStore store(directory + "/bench.db");
+  store.open();
+  start = std::chrono::steady_clock::now();
+  for (int i = 0; i < kKeyCount; i += kBatchSize) {
+    LogStructuredStore::WriteBatch batch;
+    for (int j = i; j < i + kBatchSize && j < kKeyCount; ++j) {
+      batch.push_back({keys[j], values[j]});
+    }
+    store.write(std::move(batch));
+  }
+  store.flush();
+  double storeMs = elapsedMs(start);
+  LogStructuredStore::Stats stats = store.getStats();
+
+  std::cout << "   " << std::left << std::setw(28) << "file per key" << std::right
+            << std::setw(10) << filesMs << " ms | " << kKeyCount << " fsyncs"
+            << std::endl;
+  std::cout << "   " << std::left << std::setw(28) << "log-structured store"
+            << std::right << std::setw(10) << storeMs << " ms | "
+            << stats.groupCommits << " fsyncs for " << stats.batches
+            << " batches | " << std::setw(6) << filesMs / storeMs << "x"
+            << std::endl;
+
+  std::cout << "\n3. Random reads (" << kReads << " gets)..." << std::endl;
+  std::uniform_int_distribution<int> pick(0, kKeyCount - 1);
+  std::string value;
+  size_t bytes = 0;
+  start = std::chrono::steady_clock::now();
+  for (int i = 0; i < kReads; ++i) {
+    if (readFilePerKey(filesDirectory, keys[pick(rng)], value)) bytes += value.size();
+  }
+  filesMs = elapsedMs(start);
+
+  start = std::chrono::steady_clock::now();
+  for (int i = 0; i < kReads; ++i) {
+    if (store.get(keys[pick(rng)], value)) bytes += value.size();
+  }
+  storeMs = elapsedMs(start);
+
+  std::cout << "   " << std::left << std::setw(28) << "file per key" << std::right
+            << std::setw(10) << filesMs * 1000 / kReads << " us/get" << std::endl;
+  std::cout << "   " << std::left << std::setw(28) << "log-structured store"
+            << std::right << std::setw(10) << storeMs * 1000 / kReads
+            << " us/get | " << std::setw(6) << filesMs / storeMs << "x"
+            << (bytes == 2 * kReads * kValueBytes ? "" : " (read mismatch!)")
+            << std::endl;
+
+  for (const auto& key : keys) {
+    std::remove((filesDirectory + "/" + key).c_str());
+  }
+  rmdir(filesDirectory.c_str());
+}
+
+}  // namespace
+
+int main() {
+  std::cout << "Mini React Native - Persistent Key-Value Storage Benchmark"
+            << std::endl;
+  std::cout << std::fixed << std::setprecision(2);
+
+  char directoryTemplate[] = "/tmp/mini_rn_storage.XXXXXX";
+  if (!mkdtemp(directoryTemplate)) {
+    std::cout << "Failed to create a temporary directory" << std::endl;
+    return 1;
+  }
+  std::string directory = directoryTemplate;
+
+  bool ok = verifyStore(directory);
+  ok &= verifyModule(directory);
+  benchmark(directory);
+
+  for (const char* name : {"verify.db", "torn.db", "compact.db", "module.db", "bench.db"}) {
+    std::remove((directory + "/" + name).c_str());
+  }
+  rmdir(directory.c_str());
+  return ok ? 0 : 1;
+}
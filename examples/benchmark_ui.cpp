@@ -0,0 +1,389 @@
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "BenchmarkUtils.h"
+#include "MockViewFactory.h"
+#include "common/modules/UIManagerModule.h"
+#include "common/ui/MountingLayer.h"
+#include "common/ui/RecyclingMountingLayer.h"
+
+using namespace mini_rn::modules;
+using namespace mini_rn::ui;
+
+/**
+ * Mini React Native - 无界面视图树基准
+ *
+ * 不依赖 JS 引擎：按 JS 渲染器发给 UIManager 的调用格式（方法名 + JSON 参数）
+ * 直接驱动 UIManagerModule，由 RecordingMountingLayer 接收提交，测量：
+ * 1. 正确性自检 - 批次原子提交、manageChildren 语义、子树删除、挂载指令最小化
+ * 2. 视图树吞吐 - 1k / 10k / 100k 节点的创建、属性更新、动画式重复更新、删除
+ *    （计时包含参数解析、shadow tree 修改、增量布局和提交）
+ * 3. 视图回收 - 列表滚动时 RecyclingMountingLayer 复用视图的效果，
+ *    由 MockViewFactory 统计平台视图的创建次数
+ *
+ * 使用方式：
+ * - make bench-ui
+ * - 或直接运行 ./build/benchmark_ui
+ */
+
+namespace {
+
+constexpr int kRootTag = 1;
+constexpr int kFanout = 10;
+constexpr int kAnimationFrames = 4;
+constexpr int kListTag = 2;
+constexpr int kVisibleRows = 50;
+constexpr int kScrollSteps = 2000;
+
+using Call = std::pair<std::string, std::string>;  // (方法名, JSON 参数)
+
+bool check(const std::string& name, bool ok) {
+  std::cout << "   " << (ok ? "✓ " : "✗ ") << name << std::endl;
+  return ok;
+}
+
+size_t count(const RecordingMountingLayer& recorder,
+             MountInstruction::Type type) {
+  return recorder.getInstructionCount(type);
+}
+
+std::vector<int> childrenOf(const UIManagerModule& uiManager, int tag) {
+  const ShadowNode* node = uiManager.getShadowTree().getNode(tag);
+  return node ? node->children : std::vector<int>{};
+}
+
+// 正确性自检：小规模树上验证批次语义
+bool verifyUIManager() {
+  std::cout << "\n1. Verifying UIManager semantics..." << std::endl;
+
+  auto recorder = std::make_shared<RecordingMountingLayer>(true);
+  UIManagerModule uiManager(recorder);
+  uiManager.addRootView(kRootTag);
+  bool ok = true;
+
+  // 批次 1：创建 3 个子视图并挂到根视图上
+  {
+    ScopedSilence silence;
+    uiManager.invoke("createView", "[2,\"RCTView\",1,{\"flex\":1}]", -1);
+    uiManager.invoke("createView", "[3,\"RCTText\",1,{\"text\":\"a, b\"}]", -1);
+    uiManager.invoke("createView", "[4,\"RCTView\",1,null]", -1);
+    uiManager.invoke("setChildren", "[1,[2,3,4]]", -1);
+  }
+  ok &= check("mutations are staged until the batch completes",
+              uiManager.getShadowTree().getNodeCount() == 1 &&
+                  recorder->getCommitCount() == 0);
+  uiManager.onBatchComplete();
+  ok &= check("batch committed once as 3 creates and 3 inserts",
+              recorder->getCommitCount() == 1 &&
+                  count(*recorder, MountInstruction::Type::Create) == 3 &&
+                  count(*recorder, MountInstruction::Type::Insert) == 3);
+  ok &= check("children attached in order",
+              childrenOf(uiManager, kRootTag) == std::vector<int>({2, 3, 4}));
+
+  // 批次 2：移动、插入、删除（manageChildren）并更新属性
+  {
+    ScopedSilence silence;
+    uiManager.invoke("createView", "[5,\"RCTImage\",1,{}]", -1);
+    uiManager.invoke("createView", "[6,\"RCTView\",1,{}]", -1);
+    uiManager.invoke("setChildren", "[2,[6]]", -1);
+    // 把下标 2（tag 4）移到下标 0，删除下标 0（tag 2 及其子树），在下标 1 插入 5
+    uiManager.invoke("manageChildren", "[1,[2],[0],[5],[1],[0]]", -1);
+    uiManager.invoke("updateView", "[3,\"RCTText\",{\"text\":\"c\",\"color\":null}]", -1);
+    uiManager.onBatchComplete();
+  }
+  ok &= check("manageChildren moves, inserts and removes",
+              childrenOf(uiManager, kRootTag) == std::vector<int>({4, 5, 3}));
+  ok &= check("removed child deleted with its subtree",
+              !uiManager.getShadowTree().getNode(2) &&
+                  !uiManager.getShadowTree().getNode(6));
+  const ShadowNode* text = uiManager.getShadowTree().getNode(3);
+  const PropValue* value = text ? text->props.get("text") : nullptr;
+  ok &= check("props merged",
+              value && value->asString() == "c" && !text->props.get("color"));
+  // 6 在同一批次内创建又随 2 删除；3 保持不动，只移动 4
+  ok &= check("minimal instructions for moves, deletes and updates",
+              count(*recorder, MountInstruction::Type::Create) == 4 &&
+                  count(*recorder, MountInstruction::Type::Remove) == 2 &&
+                  count(*recorder, MountInstruction::Type::Delete) == 1 &&
+                  count(*recorder, MountInstruction::Type::Insert) == 5 &&
+                  count(*recorder, MountInstruction::Type::UpdateProps) == 1);
+
+  // 批次 3：非法变更被丢弃，同批次其余变更照常提交
+  {
+    ScopedSilence silence;
+    uiManager.invoke("setChildren", "[99,[3]]", -1);
+    uiManager.invoke("removeView", "[5]", -1);
+    uiManager.onBatchComplete();
+  }
+  ok &= check("invalid mutation rejected without blocking the batch",
+              uiManager.getStats().rejected == 1 &&
+                  childrenOf(uiManager, kRootTag) == std::vector<int>({4, 3}));
+  ok &= check("slots of deleted nodes are reused",
+              uiManager.getShadowTree().getCapacity() == 6);
+
+  // 批次 4：属性值没有变化，不产生任何指令，也不提交
+  size_t commits = recorder->getCommitCount();
+  {
+    ScopedSilence silence;
+    uiManager.invoke("updateView", "[3,\"RCTText\",{\"text\":\"c\"}]", -1);
+    uiManager.onBatchComplete();
+  }
+  ok &= check("redundant update skips the commit",
+              recorder->getCommitCount() == commits &&
+                  recorder->getMountedViewCount() == 2 &&
+                  uiManager.getMountedViewCount() == 3);
+
+  // 批次 5：同一视图的多次更新合并，每个属性只应用最终值
+  size_t updates = count(*recorder, MountInstruction::Type::UpdateProps);
+  {
+    ScopedSilence silence;
+    uiManager.invoke("updateView", "[3,\"RCTText\",{\"opacity\":0.1}]", -1);
+    uiManager.invoke("updateView", "[3,\"RCTText\",{\"opacity\":0.2}]", -1);
+    uiManager.invoke("updateView",
+                     "[3,\"RCTText\",{\"opacity\":0.3,\"text\":\"d\"}]", -1);
+    uiManager.onBatchComplete();
+  }
+  const PropValue* opacity = text ? text->props.get("opacity") : nullptr;
+  ok &= check("repeated updates coalesced into one",
+              uiManager.getStats().coalesced == 2 &&
+                  count(*recorder, MountInstruction::Type::UpdateProps) ==
+                      updates + 1 &&
+                  opacity && opacity->asNumber() == 0.3);
+
+  return ok;
+}
+
+// 生成 N 个节点、每个节点最多 kFanout 个子节点的树（广度优先编号）
+std::vector<Call> buildCreateCalls(int nodeCount) {
+  std::vector<Call> calls;
+  calls.reserve(nodeCount * 2);
+  std::vector<std::vector<int>> children(nodeCount);
+
+  for (int i = 0; i < nodeCount; ++i) {
+    int tag = i + 2;
+    calls.emplace_back("createView",
+                       "[" + std::to_string(tag) + ",\"RCTView\"," +
+                           std::to_string(kRootTag) +
+                           ",{\"flex\":1,\"backgroundColor\":\"#ff0000\"}]");
+    if (i > 0) children[(i - 1) / kFanout].push_back(tag);
+  }
+
+  calls.emplace_back("setChildren", "[" + std::to_string(kRootTag) + ",[2]]");
+  for (int i = 0; i < nodeCount; ++i) {
+    if (children[i].empty()) continue;
+    std::string tags;
+    for (int child : children[i]) {
+      if (!tags.empty()) tags += ",";
+      tags += std::to_string(child);
+    }
+    calls.emplace_back("setChildren",
+                       "[" + std::to_string(i + 2) + ",[" + tags + "]]");
+  }
+  return calls;
+}
+
+std::vector<Call> buildUpdateCalls(int nodeCount) {
+  std::vector<Call> calls;
+  calls.reserve(nodeCount);
+  for (int i = 0; i < nodeCount; ++i) {
+    calls.emplace_back("updateView", "[" + std::to_string(i + 2) +
+                                         ",\"RCTView\",{\"opacity\":0.5}]");
+  }
+  return calls;
+}
+
+// 模拟动画：一个批次内对每个节点连续更新 kAnimationFrames 次同一属性
+std::vector<Call> buildAnimationCalls(int nodeCount) {
+  std::vector<Call> calls;
+  calls.reserve(nodeCount * kAnimationFrames);
+  for (int frame = 1; frame <= kAnimationFrames; ++frame) {
+    std::string props = "{\"opacity\":" + std::to_string(frame * 0.1) + "}]";
+    for (int i = 0; i < nodeCount; ++i) {
+      calls.emplace_back("updateView",
+                         "[" + std::to_string(i + 2) + ",\"RCTView\"," + props);
+    }
+  }
+  return calls;
+}
+
+// 执行一个批次，返回耗时（毫秒）
+double runBatch(UIManagerModule& uiManager, const std::vector<Call>& calls) {
+  auto start = std::chrono::steady_clock::now();
+  for (const auto& call : calls) {
+    uiManager.invoke(call.first, call.second, -1);
+  }
+  uiManager.onBatchComplete();
+  return elapsedMs(start);
+}
+
+void benchmarkTree(int nodeCount) {
+  std::vector<Call> createCalls = buildCreateCalls(nodeCount);
+  std::vector<Call> updateCalls = buildUpdateCalls(nodeCount);
+  std::vector<Call> animationCalls = buildAnimationCalls(nodeCount);
+  std::vector<Call> removeCalls = {{"removeView", "[2]"}};
+
+  auto recorder = std::make_shared<RecordingMountingLayer>();
+  UIManagerModule uiManager(recorder);
+  uiManager.addRootView(kRootTag);
+
+  double createMs, updateMs, animateMs, removeMs;
+  size_t nodesAfterCreate;
+  {
+    ScopedSilence silence;
+    createMs = runBatch(uiManager, createCalls);
+    nodesAfterCreate = uiManager.getShadowTree().getNodeCount();
+    updateMs = runBatch(uiManager, updateCalls);
+    animateMs = runBatch(uiManager, animationCalls);
+    removeMs = runBatch(uiManager, removeCalls);
+  }
+
+  auto callsPerSecond = [](size_t calls, double ms) {
+    return ms > 0 ? calls / ms * 1000.0 : 0.0;
+  };
+
+  std::cout << std::setw(8) << nodeCount << " nodes | create "
+            << std::setw(9) << createMs << " ms (" << std::setw(10)
+            << callsPerSecond(createCalls.size(), createMs)
+            << " calls/s) | update " << std::setw(9) << updateMs << " ms ("
+            << std::setw(10) << callsPerSecond(updateCalls.size(), updateMs)
+            << " calls/s) | animate x" << kAnimationFrames << " "
+            << std::setw(9) << animateMs << " ms | remove subtree "
+            << std::setw(8) << removeMs << " ms" << std::endl;
+
+  // 动画批次的重复更新合并后，每个节点只有一条 UpdateProps
+  if (nodesAfterCreate != static_cast<size_t>(nodeCount) + 1 ||
+      uiManager.getShadowTree().getNodeCount() != 1 ||
+      recorder->getCommitCount() != 4 ||
+      recorder->getInstructionCount(MountInstruction::Type::UpdateProps) !=
+          static_cast<size_t>(nodeCount) * 2) {
+    std::cout << "   ✗ Unexpected tree state after benchmark" << std::endl;
+  }
+}
+
+// 列表的一行：容器 + 图片 + 文本，共 3 个视图
+int rowTag(int row) { return 100 + row * 3; }
+
+void appendRowCalls(int row, std::vector<Call>& calls) {
+  std::string tag = std::to_string(rowTag(row));
+  std::string text = std::to_string(rowTag(row) + 1);
+  std::string image = std::to_string(rowTag(row) + 2);
+  calls.emplace_back("createView",
+                     "[" + tag +
+                         ",\"RCTView\",1,{\"height\":44,\"flexDirection\":\"row\"}]");
+  calls.emplace_back("createView", "[" + text + ",\"RCTText\",1,{\"text\":\"row " +
+                                       std::to_string(row) + "\"}]");
+  calls.emplace_back("createView", "[" + image + ",\"RCTImage\",1,{\"width\":44}]");
+  calls.emplace_back("setChildren",
+                     "[" + tag + ",[" + image + "," + text + "]]");
+}
+
+struct ScrollResult {
+  double ms = 0;
+  size_t allocations = 0;
+  RecyclingMountingLayer::Stats stats;
+  bool consistent = false;
+};
+
+/**
+ * 模拟列表滚动：每一步移除顶部一行、在底部追加一行（各一个批次）
+ * @param poolCapacity 每种视图类型的回收池容量，0 表示不回收
+ */
+ScrollResult runScroll(size_t poolCapacity) {
+  MockView root;  // 平台创建的根视图，必须比 mounting layer 活得久
+  auto factory = std::make_shared<MockViewFactory>();
+  auto layer = std::make_shared<RecyclingMountingLayer>(factory);
+  layer->setDefaultPoolCapacity(poolCapacity);
+  layer->registerRootView(kRootTag, &root);
+
+  UIManagerModule uiManager(layer);
+  uiManager.addRootView(kRootTag, 400, 800);
+
+  ScopedSilence silence;
+  std::vector<Call> calls;
+  std::string rows;
+  calls.emplace_back("createView", "[2,\"RCTScrollView\",1,{\"flex\":1}]");
+  for (int row = 0; row < kVisibleRows; ++row) {
+    appendRowCalls(row, calls);
+    rows += (row > 0 ? "," : "") + std::to_string(rowTag(row));
+  }
+  calls.emplace_back("setChildren", "[2,[" + rows + "]]");
+  calls.emplace_back("setChildren", "[1,[2]]");
+  runBatch(uiManager, calls);
+
+  ScrollResult result;
+  for (int step = 0; step < kScrollSteps; ++step) {
+    int row = kVisibleRows + step;
+    calls.clear();
+    appendRowCalls(row, calls);
+    calls.emplace_back("manageChildren",
+                       "[2,[],[],[" + std::to_string(rowTag(row)) + "],[" +
+                           std::to_string(kVisibleRows - 1) + "],[0]]");
+    result.ms += runBatch(uiManager, calls);
+  }
+
+  const MockView* list =
+      static_cast<const MockView*>(layer->getView(kListTag));
+  const MockView* lastRow = static_cast<const MockView*>(
+      layer->getView(rowTag(kVisibleRows + kScrollSteps - 1)));
+  result.allocations = factory->getAllocations();
+  result.stats = layer->getStats();
+  result.consistent =
+      root.children.size() == 1 && list &&
+      list->children.size() == static_cast<size_t>(kVisibleRows) && lastRow &&
+      list->children.back() == lastRow && lastRow->children.size() == 2 &&
+      factory->getLiveViews() ==
+          layer->getMountedViewCount() - 1 + layer->getPooledViewCount();
+  return result;
+}
+
+bool benchmarkRecycling() {
+  bool ok = true;
+  ScrollResult results[2];
+  size_t capacities[2] = {0, RecyclingMountingLayer::kDefaultPoolCapacity};
+  for (int i = 0; i < 2; ++i) {
+    const ScrollResult& result = results[i] = runScroll(capacities[i]);
+    std::cout << "   pool capacity " << std::setw(3) << capacities[i] << " | "
+              << std::setw(8) << result.ms << " ms | views allocated "
+              << std::setw(6) << result.allocations << " | hits "
+              << std::setw(6) << result.stats.hits << " | misses "
+              << std::setw(6) << result.stats.misses << " | recycled "
+              << std::setw(6) << result.stats.recycled << " | destroyed "
+              << std::setw(6) << result.stats.destroyed << std::endl;
+    ok &= check("mounted views match the shadow tree", result.consistent);
+  }
+
+  // 启用回收后只有首屏分配视图：滚出的行在同一批次内被新行复用
+  size_t initialViews = 1 + kVisibleRows * 3;
+  ok &= check("scrolling reuses recycled views",
+              results[0].allocations == initialViews + kScrollSteps * 3 &&
+                  results[1].allocations == initialViews &&
+                  results[1].stats.hits == kScrollSteps * 3);
+  return ok;
+}
+
+}  // namespace
+
+int main() {
+  std::cout << "Mini React Native - Headless UIManager Benchmark" << std::endl;
+  std::cout << std::fixed << std::setprecision(2);
+
+  bool ok = verifyUIManager();
+
+  std::cout << "\n2. View tree throughput (one batch per phase, fanout "
+            << kFanout << ")..." << std::endl;
+  for (int nodeCount : {1000, 10000, 100000}) {
+    benchmarkTree(nodeCount);
+  }
+
+  std::cout << "\n3. View recycling (" << kVisibleRows << " visible rows, "
+            << kScrollSteps << " scroll steps, one batch per step)..."
+            << std::endl;
+  ok &= benchmarkRecycling();
+
+  return ok ? 0 : 1;
+}
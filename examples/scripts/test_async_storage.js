@@ -0,0 +1,65 @@
+/**
+ * test_async_storage.js - 持久化键值存储集成测试
+ *
+ * 配合 examples/test_integration.cpp 使用：
+ * 1. 本脚本注册可调用模块 StorageTest
+ * 2. C++ 通过 callFunction('StorageTest', 'run') 发起写入和读取
+ * 3. C++ 等待写入落盘、驱动 tick 后调用 __verifyStorageTest() 校验结果
+ */
+
+'use strict'
+
+console.log('🔥 AsyncStorage Integration Test Starting...')
+
+const AsyncStorage = global.AsyncStorage
+
+const results = {
+  pendingRead: undefined,
+  written: false,
+  removed: false,
+  keys: null,
+  rejected: null,
+}
+
+const StorageTest = {
+  run() {
+    AsyncStorage.multiSet([['user', 'ada'], ['theme', 'dark'], ['draft', 'x']]).then(() => {
+      results.written = true
+    })
+    AsyncStorage.removeItem('draft').then(() => {
+      results.removed = true
+    })
+    // 写入尚未落盘，读取仍应看到新值
+    AsyncStorage.getItem('user').then((value) => {
+      results.pendingRead = value
+    })
+    AsyncStorage.getAllKeys().then((keys) => {
+      results.keys = keys.sort()
+    })
+    // value 必须是字符串
+    AsyncStorage.setItem('count', 1).catch((error) => {
+      results.rejected = !!error
+    })
+  },
+}
+
+global.__verifyStorageTest = function () {
+  const check = (name, actual, expected) => {
+    const ok = JSON.stringify(actual) === JSON.stringify(expected)
+    console.log(`  ${ok ? '✅' : '❌'} ${name}: ${JSON.stringify(actual)}${ok ? '' : ` (expected ${JSON.stringify(expected)})`}`)
+  }
+
+  console.log('📊 AsyncStorage results:')
+  check('getItem sees unflushed write', results.pendingRead, 'ada')
+  check('getAllKeys after remove', results.keys, ['theme', 'user'])
+  check('multiSet resolved after commit', results.written, true)
+  check('removeItem resolved after commit', results.removed, true)
+  check('non-string value rejected', results.rejected, true)
+}
+
+if (!AsyncStorage || !AsyncStorage.isAvailable()) {
+  console.log('❌ AsyncStorage not found in NativeModules')
+} else {
+  global.__fbBatchedBridge.registerCallableModule('StorageTest', StorageTest)
+  console.log('✅ StorageTest registered')
+}
@@ -0,0 +1,78 @@
+/**
+ * test_backpressure.js - Bridge 背压集成测试
+ *
+ * 配合 examples/test_integration.cpp 使用：
+ * 1. 本脚本注册可调用模块 BackpressureTest
+ * 2. C++ 把背压水位设为 4 / 1 个调用后调用 callFunction('BackpressureTest', 'run', [path])，
+ *    生产者连续发起 12 次 FileSystem.stat，每次之前 await whenDrained()
+ * 3. FileSystem 的结果在 tick 中投递，C++ 驱动 tick 直到生产者完成，
+ *    再调用 __verifyBackpressureTest() 校验：在途调用不超过高水位，
+ *    背压期间的 Background 调用被丢弃
+ */
+
+'use strict'
+
+console.log('🔥 Backpressure Integration Test Starting...')
+
+const TOTAL = 12
+
+const results = {
+  completed: 0,
+  inflight: 0,
+  maxInflight: 0,
+  waits: 0,
+  dropped: null,
+  finished: false,
+}
+
+async function produce(path) {
+  const bridge = global.__fbBatchedBridge
+  for (let i = 0; i < TOTAL; i++) {
+    if (bridge.isBackpressured()) {
+      results.waits++
+      if (results.dropped === null) {
+        // 背压期间的 Background 调用不进入队列，直接失败
+        bridge
+          .withPriority(global.MessageQueue.Priority.Background, () => global.FileSystem.stat(path))
+          .then(
+            () => (results.dropped = false),
+            (error) => (results.dropped = error.message),
+          )
+      }
+    }
+    await bridge.whenDrained()
+
+    results.inflight++
+    results.maxInflight = Math.max(results.maxInflight, results.inflight)
+    global.FileSystem.stat(path).then(() => {
+      results.inflight--
+      results.completed++
+    })
+  }
+  results.finished = true
+}
+
+const BackpressureTest = {
+  run(path) {
+    produce(path)
+  },
+}
+
+global.__verifyBackpressureTest = function () {
+  const check = (name, ok, detail) => {
+    console.log(`  ${ok ? '✅' : '❌'} ${name}: ${JSON.stringify(detail)}`)
+  }
+
+  console.log('📊 Backpressure results:')
+  check('producer finished', results.finished && results.completed === TOTAL, results.completed)
+  check('in-flight calls bounded by the high watermark', results.maxInflight <= 4, results.maxInflight)
+  check('producer waited for drain', results.waits > 0, results.waits)
+  check('background call dropped under backpressure', results.dropped === 'Call dropped: backpressure', results.dropped)
+}
+
+if (typeof global.__fbBatchedBridge.whenDrained !== 'function') {
+  console.log('❌ MessageQueue.whenDrained not available')
+} else {
+  global.__fbBatchedBridge.registerCallableModule('BackpressureTest', BackpressureTest)
+  console.log('✅ BackpressureTest registered')
+}
@@ -0,0 +1,102 @@
+/**
+ * test_blob.js - Blob 集成测试
+ *
+ * 配合 examples/test_integration.cpp 使用：
+ * 1. 本脚本注册可调用模块 BlobTest
+ * 2. C++ 通过 callFunction('BlobTest', 'run', [path, copyPath]) 发起测试，
+ *    path 是一个内容为 i & 0xff 的测试文件
+ * 3. C++ 驱动 tick 直到操作完成，再调用 __verifyBlobTest() 校验结果
+ */
+
+'use strict'
+
+console.log('🔥 Blob Integration Test Starting...')
+
+const BlobManager = global.BlobManager
+const FileSystem = global.FileSystem
+
+const results = {
+  createdSize: null,
+  text: null,
+  sliceText: null,
+  fileBlobSize: null,
+  fileSliceOk: false,
+  writeIsolated: false,
+  copySize: null,
+  copyOk: false,
+}
+
+function expectPattern(bytes, offset) {
+  for (let i = 0; i < bytes.length; i++) {
+    if (bytes[i] !== ((offset + i) & 0xff)) return false
+  }
+  return true
+}
+
+const BlobTest = {
+  run(path, copyPath) {
+    // 由字符串创建：size 在 JS 侧同步计算（UTF-8 字节数）
+    const blob = BlobManager.createFromParts(['héllo ', 'wörld'])
+    results.createdSize = blob.size
+    blob.text().then((text) => {
+      results.text = text
+    })
+    const slice = blob.slice(7, -1)
+    slice.text().then((text) => {
+      results.sliceText = text
+      slice.close()
+      blob.close()
+    })
+
+    // 文件 → Blob → 文件：字节不进入 JS
+    FileSystem.readFileAsBlob(path)
+      .then((fileBlob) => {
+        results.fileBlobSize = fileBlob.size
+        const part = fileBlob.slice(1000, 2000)
+        part
+          .arrayBuffer()
+          .then((buffer) => {
+            results.fileSliceOk = buffer.byteLength === 1000 && expectPattern(new Uint8Array(buffer), 1000)
+            // ArrayBuffer 是拷贝：写入它不影响 blob
+            new Uint8Array(buffer).fill(0)
+            return part.arrayBuffer()
+          })
+          .then((buffer) => {
+            results.writeIsolated = expectPattern(new Uint8Array(buffer), 1000)
+            part.close()
+          })
+        return FileSystem.writeFile(copyPath, fileBlob).then(() => {
+          fileBlob.close()
+          return FileSystem.readFile(copyPath)
+        })
+      })
+      .then((copy) => {
+        results.copySize = copy.byteLength
+        results.copyOk = expectPattern(new Uint8Array(copy), 0)
+      })
+  },
+}
+
+global.__verifyBlobTest = function () {
+  const check = (name, actual, expected) => {
+    const ok = JSON.stringify(actual) === JSON.stringify(expected)
+    console.log(`  ${ok ? '✅' : '❌'} ${name}: ${JSON.stringify(actual)}${ok ? '' : ` (expected ${JSON.stringify(expected)})`}`)
+  }
+
+  console.log('📊 Blob results:')
+  check('blob size is UTF-8 length', results.createdSize, 13)
+  check('blob text', results.text, 'héllo wörld')
+  check('slice text', results.sliceText, 'wörl')
+  check('file blob size', results.fileBlobSize, results.copySize)
+  check('file blob slice content', results.fileSliceOk, true)
+  check('ArrayBuffer writes do not change the blob', results.writeIsolated, true)
+  check('blob written back to file', results.copyOk, true)
+  check('all blobs closed', Object.keys(BlobManager.BlobRegistry.counts).length, 0)
+}
+
+if (!BlobManager || !BlobManager.isAvailable()) {
+  console.log('❌ BlobModule not found in NativeModules')
+} else {
+  global.__fbBatchedBridge.registerCallableModule('BlobTest', BlobTest)
+  console.log('✅ BlobTest registered')
+}
@@ -0,0 +1,56 @@
+/**
+ * test_events.js - Native → JS 事件推送集成测试
+ *
+ * 配合 examples/test_integration.cpp 使用：
+ * 1. 本脚本注册监听器并记录收到的事件
+ * 2. C++ 通过 EventEmitterModule::emit 产生大量事件并驱动 tick
+ * 3. C++ 调用 __verifyEventTest() 校验合并、限频和 target 过滤的结果
+ */
+
+'use strict'
+
+console.log('🔥 Event Emitter Integration Test Starting...')
+
+const DeviceEventEmitter = global.DeviceEventEmitter
+
+if (!DeviceEventEmitter) {
+  console.log('❌ DeviceEventEmitter not found in global')
+} else {
+  const received = {
+    progress: [],
+    sensor: [],
+    scroll: [],
+    batches: 0,
+  }
+
+  // 统计 receiveEvents 调用次数（每个 tick 最多一次跨 Bridge 调用）
+  const originalReceiveEvents = DeviceEventEmitter.receiveEvents
+  DeviceEventEmitter.receiveEvents = function (events) {
+    received.batches++
+    return originalReceiveEvents.call(this, events)
+  }
+
+  DeviceEventEmitter.addListener('progress', (body) => received.progress.push(body.loaded))
+  DeviceEventEmitter.addListener('sensor', (body) => received.sensor.push(body.value))
+  // 只关心 target 为 7 的视图的滚动事件
+  DeviceEventEmitter.addListener('scroll', (body) => received.scroll.push(body.y), 7)
+
+  // 没有 JS 监听器时 Native 应当直接丢弃
+  const temporary = DeviceEventEmitter.addListener('ignored', () => {})
+  temporary.remove()
+
+  global.__verifyEventTest = function () {
+    const check = (name, actual, expected) => {
+      const ok = JSON.stringify(actual) === JSON.stringify(expected)
+      console.log(`  ${ok ? '✅' : '❌'} ${name}: ${JSON.stringify(actual)}${ok ? '' : ` (expected ${JSON.stringify(expected)})`}`)
+    }
+
+    console.log('📊 Event delivery results:')
+    check('progress coalesced to latest value', received.progress, [99])
+    check('sensor throttled to 100ms', received.sensor, [0, 50])
+    check('scroll filtered by target', received.scroll, [70])
+    check('receiveEvents batches', received.batches, 2)
+  }
+
+  console.log('✅ Event listeners registered')
+}
@@ -0,0 +1,88 @@
+/**
+ * test_filesystem.js - 文件系统访问集成测试
+ *
+ * 配合 examples/test_integration.cpp 使用：
+ * 1. 本脚本注册可调用模块 FileSystemTest
+ * 2. C++ 通过 callFunction('FileSystemTest', 'run', [path]) 发起读取，
+ *    path 是一个不小于映射阈值的测试文件，内容为 i & 0xff
+ * 3. C++ 驱动 tick 直到读取完成，再调用 __verifyFileSystemTest() 校验结果
+ */
+
+'use strict'
+
+console.log('🔥 FileSystem Integration Test Starting...')
+
+const FileSystem = global.FileSystem
+
+const results = {
+  size: null,
+  isArrayBuffer: false,
+  byteLength: null,
+  contentOk: false,
+  streamBytes: 0,
+  streamChunks: 0,
+  rejected: null,
+}
+
+function expectPattern(bytes, offset) {
+  for (let i = 0; i < bytes.length; i++) {
+    if (bytes[i] !== ((offset + i) & 0xff)) return false
+  }
+  return true
+}
+
+const FileSystemTest = {
+  run(path) {
+    FileSystem.stat(path).then((info) => {
+      results.size = info.size
+    })
+
+    // 整个文件一次读取：Native 映射区直接作为 ArrayBuffer
+    FileSystem.readFile(path).then((buffer) => {
+      results.isArrayBuffer = buffer instanceof ArrayBuffer
+      results.byteLength = buffer.byteLength
+      results.contentOk = expectPattern(new Uint8Array(buffer), 0)
+    })
+
+    // 分块读取：每块来自 Native 缓冲池
+    const stream = FileSystem.createReadStream(path, { chunkSize: 64 * 1024 })
+    let offset = 0
+    const next = () =>
+      stream.read().then((chunk) => {
+        if (!chunk) return
+        if (expectPattern(new Uint8Array(chunk), offset)) {
+          results.streamBytes += chunk.byteLength
+        }
+        offset += chunk.byteLength
+        results.streamChunks++
+        return next()
+      })
+    next()
+
+    FileSystem.readFile(path + '.missing').catch((error) => {
+      results.rejected = !!error
+    })
+  },
+}
+
+global.__verifyFileSystemTest = function () {
+  const check = (name, actual, expected) => {
+    const ok = JSON.stringify(actual) === JSON.stringify(expected)
+    console.log(`  ${ok ? '✅' : '❌'} ${name}: ${JSON.stringify(actual)}${ok ? '' : ` (expected ${JSON.stringify(expected)})`}`)
+  }
+
+  console.log('📊 FileSystem results:')
+  check('readFile resolves an ArrayBuffer', results.isArrayBuffer, true)
+  check('ArrayBuffer length matches stat', results.byteLength, results.size)
+  check('ArrayBuffer content', results.contentOk, true)
+  check('stream covers the file', results.streamBytes, results.size)
+  check('stream chunk count', results.streamChunks, Math.ceil(results.size / (64 * 1024)))
+  check('missing file rejected', results.rejected, true)
+}
+
+if (!FileSystem || !FileSystem.isAvailable()) {
+  console.log('❌ FileSystem not found in NativeModules')
+} else {
+  global.__fbBatchedBridge.registerCallableModule('FileSystemTest', FileSystemTest)
+  console.log('✅ FileSystemTest registered')
+}
@@ -0,0 +1,53 @@
+/**
+ * test_memory.js - JS 堆统计与内存压力集成测试
+ *
+ * 配合 examples/test_integration.cpp 使用：
+ * 1. 本脚本注册可调用模块 MemoryTest
+ * 2. C++ 通过 callFunction('MemoryTest', 'run', [path]) 读取一个文件，
+ *    得到的 ArrayBuffer 引用 Native 内存，用完后不再持有
+ * 3. C++ 调用 handleMemoryPressure(Critical)，再调用 __verifyMemoryTest() 校验
+ *    nativeGetMemoryStats() 的结果
+ */
+
+'use strict'
+
+console.log('🔥 Memory Integration Test Starting...')
+
+const results = {
+  byteLength: null,
+  whileHeld: null,
+}
+
+const MemoryTest = {
+  run(path) {
+    global.FileSystem.readFile(path).then((buffer) => {
+      results.byteLength = buffer.byteLength
+      // ArrayBuffer 还被引用时，Native 内存计入 externalBytes
+      results.whileHeld = global.nativeGetMemoryStats()
+    })
+  },
+}
+
+global.__verifyMemoryTest = function () {
+  const check = (name, ok, detail) => {
+    console.log(`  ${ok ? '✅' : '❌'} ${name}: ${JSON.stringify(detail)}`)
+  }
+
+  const stats = global.nativeGetMemoryStats()
+  const held = results.whileHeld || {}
+  console.log('📊 Memory results:')
+  check('ArrayBuffer counted as external memory while held', held.externalBytes >= results.byteLength, held.externalBytes)
+  check('external memory reported to the engine', stats.externalBytesReported >= results.byteLength, stats.externalBytesReported)
+  check('heap size reported', stats.heapSize > 0, stats.heapSize)
+  check('memory pressure forced a GC', stats.explicitCollections >= 1 && stats.memoryPressureEvents === 1, {
+    explicitCollections: stats.explicitCollections,
+    memoryPressureEvents: stats.memoryPressureEvents,
+  })
+}
+
+if (typeof global.nativeGetMemoryStats !== 'function') {
+  console.log('❌ nativeGetMemoryStats not installed')
+} else {
+  global.__fbBatchedBridge.registerCallableModule('MemoryTest', MemoryTest)
+  console.log('✅ MemoryTest registered')
+}
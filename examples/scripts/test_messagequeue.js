@@ -161,10 +161,36 @@ if (callbackExecuted && callbackResult === 'success_result') {
   console.log('✗ Callback management test FAILED')
 }
 
+// 5. 测试回调注册表：槽位复用、过期ID、待处理计数
+console.log('\n5. Testing callback registry...')
+
+var registryQueue = new MessageQueue()
+registryQueue._flushQueue = function () {}
+var noop = function () {}
+
+registryQueue.enqueueNativeCall(1, 1, [], noop, noop)
+registryQueue.enqueueNativeCall(1, 1, [], noop, noop)
+var firstID = registryQueue._queue[3][0]
+console.log('Pending after 2 calls:', registryQueue.getQueueStatus().callbackCount)
+
+registryQueue.invokeCallbackAndReturnFlushedQueue(firstID, [null, 'ok'])
+registryQueue.enqueueNativeCall(1, 1, [], noop, noop)
+var reusedID = registryQueue._queue[3][0]
+var slotReused = (reusedID & 0xfffff) === (firstID & 0xfffff) && reusedID !== firstID
+var staleRejected = registryQueue._callbacks.lookup(firstID) === -1
+var pendingCount = registryQueue.getQueueStatus().callbackCount
+
+if (slotReused && staleRejected && pendingCount === 2) {
+  console.log('✓ Callback registry test PASSED')
+} else {
+  console.log('✗ Callback registry test FAILED', slotReused, staleRejected, pendingCount)
+}
+
 console.log('\n=== MessageQueue Comprehensive Tests Completed ===')
 console.log('✓ MessageQueue 基础功能正常')
 console.log('✓ RN 兼容的消息格式验证通过')
 console.log('✓ Native 调用工作流程正确')
 console.log('✓ 回调管理机制工作正常')
+console.log('✓ 回调注册表槽位复用正常')
 console.log('✓ 子任务 2.1 全面验证完成')
 console.log('✓ 准备进入子任务 2.2 - Native Bridge 集成')
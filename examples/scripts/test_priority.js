@@ -0,0 +1,91 @@
+/**
+ * test_priority.js - Bridge 调用优先级通道集成测试
+ *
+ * 配合 examples/test_integration.cpp 使用：
+ * 1. 本脚本注册可调用模块 PriorityTest
+ * 2. C++ 调用 callFunction('PriorityTest', 'run')：在同一批次中依次以
+ *    Background、Normal、UserBlocking、Immediate 调用 DeviceInfo.getUniqueId，
+ *    Native 应按 Immediate → UserBlocking → Normal 派发，Background 在 tick 中派发
+ * 3. C++ 把 Background 积压上限设为 2 后调用 callFunction('PriorityTest', 'flood')，
+ *    四个 Background 调用中最旧的两个被丢弃
+ * 4. C++ 调用 callFunction('PriorityTest', 'nested')：回调中的 Immediate 调用同步刷新，
+ *    Native 同步 resolve 时嵌套调入 JS；返回后外层仍处于回调中，之后的调用继续批量
+ * 5. C++ 驱动 tick 后调用 __verifyPriorityTest() 校验
+ */
+
+'use strict'
+
+console.log('🔥 Priority Lanes Integration Test Starting...')
+
+const results = {
+  order: [],
+  flood: { resolved: 0, dropped: [] },
+  nested: null,
+}
+
+function call(priority, label) {
+  const bridge = global.__fbBatchedBridge
+  return bridge
+    .withPriority(priority, () => global.DeviceInfo.getUniqueId())
+    .then(() => label)
+}
+
+const PriorityTest = {
+  run() {
+    const { Priority } = global.MessageQueue
+    // resolve 的顺序就是 Native 派发的顺序
+    const record = (label) => results.order.push(label)
+    call(Priority.Background, 'background').then(record)
+    call(Priority.Normal, 'normal').then(record)
+    call(Priority.UserBlocking, 'userBlocking').then(record)
+    call(Priority.Immediate, 'immediate').then(record)
+  },
+
+  nested() {
+    const { Priority } = global.MessageQueue
+    const bridge = global.__fbBatchedBridge
+    call(Priority.Immediate, 'immediate')
+    const afterImmediate = bridge.getQueueStatus()
+    call(Priority.Normal, 'normal')
+    const afterNormal = bridge.getQueueStatus()
+    results.nested = {
+      isInCallback: afterImmediate.isInCallback,
+      queueLength: afterNormal.queueLength,
+    }
+  },
+
+  flood() {
+    const { Priority } = global.MessageQueue
+    for (let i = 0; i < 4; i++) {
+      call(Priority.Background, i).then(
+        () => results.flood.resolved++,
+        (error) => results.flood.dropped.push({ index: i, message: error.message }),
+      )
+    }
+  },
+}
+
+global.__verifyPriorityTest = function () {
+  const check = (name, ok, detail) => {
+    console.log(`  ${ok ? '✅' : '❌'} ${name}: ${JSON.stringify(detail)}`)
+  }
+
+  const expected = ['immediate', 'userBlocking', 'normal', 'background']
+  const dropped = results.flood.dropped
+  console.log('📊 Priority results:')
+  check('calls dispatched by lane', JSON.stringify(results.order) === JSON.stringify(expected), results.order)
+  check(
+    'calls after a nested Immediate flush still batched',
+    results.nested && results.nested.isInCallback && results.nested.queueLength === 1,
+    results.nested,
+  )
+  check('oldest background calls dropped when the lane is full', dropped.length === 2 && dropped[0].index === 0, dropped)
+  check('remaining background calls dispatched on tick', results.flood.resolved === 2, results.flood.resolved)
+}
+
+if (typeof global.__fbBatchedBridge.withPriority !== 'function') {
+  console.log('❌ MessageQueue.withPriority not available')
+} else {
+  global.__fbBatchedBridge.registerCallableModule('PriorityTest', PriorityTest)
+  console.log('✅ PriorityTest registered')
+}
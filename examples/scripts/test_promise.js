@@ -0,0 +1,53 @@
+/**
+ * test_promise.js - Promise 跨 Bridge resolve 的集成测试（QuickJS 后端）
+ *
+ * QuickJS 不会自动执行微任务，Promise 回调依赖执行器在每次调用 JS 之后
+ * 执行挂起的任务（QuickJSExecutor::drainPendingJobs）。
+ * 配合 examples/test_integration.cpp 使用：
+ * 1. 本脚本注册可调用模块 PromiseTest
+ * 2. C++ 调用 callFunction('PromiseTest', 'run')：一个纯 JS 的微任务，以及
+ *    AsyncStorage 的 setItem → getItem 链（第二个调用在第一个 resolve 之后才发起）
+ * 3. C++ 等待写入落盘、驱动 tick 后调用 __verifyPromiseTest() 校验
+ */
+
+'use strict'
+
+console.log('🔥 Promise Integration Test Starting...')
+
+const results = {
+  microtask: false,
+  value: null,
+  rejected: null,
+}
+
+const PromiseTest = {
+  run() {
+    Promise.resolve().then(() => {
+      results.microtask = true
+    })
+
+    const AsyncStorage = global.AsyncStorage
+    AsyncStorage.setItem('promise-test', 'resolved')
+      .then(() => AsyncStorage.getItem('promise-test'))
+      .then((value) => {
+        results.value = value
+      })
+    AsyncStorage.getItem(42).catch((error) => {
+      results.rejected = error.message
+    })
+  },
+}
+
+global.__verifyPromiseTest = function () {
+  const check = (name, ok, detail) => {
+    console.log(`  ${ok ? '✅' : '❌'} ${name}: ${JSON.stringify(detail)}`)
+  }
+
+  console.log('📊 Promise results:')
+  check('microtask executed', results.microtask, results.microtask)
+  check('chained native promises resolved', results.value === 'resolved', results.value)
+  check('native promise rejected', typeof results.rejected === 'string', results.rejected)
+}
+
+global.__fbBatchedBridge.registerCallableModule('PromiseTest', PromiseTest)
+console.log('✅ PromiseTest registered')
@@ -0,0 +1,62 @@
+/**
+ * test_timers.js - 定时器与帧回调集成测试
+ *
+ * 配合 examples/test_integration.cpp 使用：
+ * 1. 本脚本创建定时器和帧回调，按触发顺序记录
+ * 2. C++ 以 5ms 步长驱动 tick（脚本加载时的时间为 200ms，帧间隔 1000/60ms）
+ * 3. C++ 调用 __verifyTimerTest() 校验触发顺序
+ *
+ * 预期时间线：
+ * - 205ms: D、E（0ms 定时器同批触发）、第 1 帧
+ * - 220ms: C 第 1 次、第 2 帧      - 235ms: 第 3 帧
+ * - 240ms: C 第 2 次               - 250ms: A
+ * - 260ms: C 第 3 次（随后被清除）
+ */
+
+'use strict'
+
+console.log('🔥 Timer Integration Test Starting...')
+
+const order = []
+
+setTimeout(() => order.push('A'), 50)
+
+const cancelled = setTimeout(() => order.push('B'), 10)
+clearTimeout(cancelled)
+
+let intervalCount = 0
+const interval = setInterval(() => {
+  order.push('C')
+  if (++intervalCount === 3) {
+    clearInterval(interval)
+  }
+}, 20)
+
+setTimeout(() => order.push('D'), 0)
+setTimeout((label) => order.push(label), 0, 'E')
+
+let frames = 0
+function onFrame() {
+  order.push('frame')
+  if (++frames < 3) {
+    requestAnimationFrame(onFrame)
+  }
+}
+requestAnimationFrame(onFrame)
+
+// 取消的帧回调不应执行
+const cancelledFrame = requestAnimationFrame(() => order.push('cancelled frame'))
+cancelAnimationFrame(cancelledFrame)
+
+global.__verifyTimerTest = function () {
+  const check = (name, actual, expected) => {
+    const ok = JSON.stringify(actual) === JSON.stringify(expected)
+    console.log(`  ${ok ? '✅' : '❌'} ${name}: ${JSON.stringify(actual)}${ok ? '' : ` (expected ${JSON.stringify(expected)})`}`)
+  }
+
+  console.log('📊 Timer results:')
+  check('firing order', order, ['D', 'E', 'frame', 'C', 'frame', 'frame', 'C', 'A', 'C'])
+  check('active timers', global.JSTimers.getActiveTimerCount(), 0)
+}
+
+console.log('✅ Timers scheduled')
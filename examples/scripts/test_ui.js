@@ -0,0 +1,46 @@
+/**
+ * test_ui.js - 无界面 UIManager 集成测试
+ *
+ * 配合 examples/test_integration.cpp 使用：
+ * 1. 本脚本注册可调用模块 UITest
+ * 2. C++ 通过 callFunction('UITest', 'render') / ('UITest', 'update') 驱动渲染
+ * 3. 渲染期间的 UIManager 调用随 callFunction 的返回值作为一个批次回到 Native，
+ *    C++ 校验每次渲染只产生一次 mounting layer 提交
+ */
+
+'use strict'
+
+console.log('🔥 UIManager Integration Test Starting...')
+
+const NativeModules = global.NativeModules
+const UIManager = NativeModules && NativeModules.get('UIManager')
+
+const ROOT_TAG = 1
+
+const UITest = {
+  // 根视图下挂一个容器，容器内 3 个文本
+  render() {
+    UIManager.createView(2, 'RCTView', ROOT_TAG, { flex: 1 })
+    const children = []
+    for (let i = 0; i < 3; i++) {
+      const tag = 3 + i
+      UIManager.createView(tag, 'RCTText', ROOT_TAG, { text: `item ${i}` })
+      children.push(tag)
+    }
+    UIManager.setChildren(2, children)
+    UIManager.setChildren(ROOT_TAG, [2])
+  },
+
+  // 更新第一项文本，删除最后一项
+  update() {
+    UIManager.updateView(3, 'RCTText', { text: 'updated' })
+    UIManager.manageChildren(2, [], [], [], [], [2])
+  },
+}
+
+if (!UIManager) {
+  console.log('❌ UIManager not found in NativeModules')
+} else {
+  global.__fbBatchedBridge.registerCallableModule('UITest', UITest)
+  console.log('✅ UITest registered')
+}
@@ -0,0 +1,56 @@
+/**
+ * test_virtualized_list.js - 虚拟列表窗口计算集成测试
+ *
+ * 配合 examples/test_integration.cpp 使用：
+ * 1. 本脚本注册可调用模块 ListTest
+ * 2. C++ 通过 callFunction('ListTest', 'run') 执行测试
+ * 3. 所有 VirtualizedList 调用都是同步调用，结果在 JS 中直接校验，
+ *    C++ 再通过 VirtualizedListModule 检查 Native 侧的偏移表
+ */
+
+'use strict'
+
+console.log('🔥 VirtualizedList Integration Test Starting...')
+
+const VirtualizedList = global.VirtualizedList
+
+function check(name, ok) {
+  console.log(`   ${ok ? '✓' : '✗'} ${name}`)
+}
+
+const ListTest = {
+  // 1000 个估计高度为 50 的 item，前 10 个测量为 100
+  run() {
+    const list = VirtualizedList.create(1000, 50)
+    check('configure returns estimated total height', list.totalHeight === 50000)
+
+    const heights = []
+    for (let i = 0; i < 10; i++) heights.push(100)
+    check('setItemHeights updates total height', list.setItemHeights(0, heights) === 50500)
+    check('item offset accounts for measured heights', list.getItemOffset(12) === 1100)
+
+    // [950, 1250) 与 item 9（900~1000）到 item 14（1200~1250）相交
+    const window = list.getWindow(950, 300)
+    check(
+      'window covers the viewport',
+      window.first === 9 && window.last === 14 && window.offset === 900 && window.end === 1250
+    )
+
+    const overscanned = list.getWindow(950, 300, 100)
+    check('overscan extends the window', overscanned.first === 8 && overscanned.last === 16)
+
+    check('setItemCount truncates the list', list.setItemCount(20) === 1500)
+    const tail = list.getWindow(1400, 500)
+    check('window is clamped to the last item', tail.first === 18 && tail.last === 19)
+
+    // 保留列表 ID 供 C++ 检查
+    global.__listTestId = list.listId
+  },
+}
+
+if (!VirtualizedList || !VirtualizedList.isAvailable()) {
+  console.log('❌ VirtualizedList not found in NativeModules')
+} else {
+  global.__fbBatchedBridge.registerCallableModule('ListTest', ListTest)
+  console.log('✅ ListTest registered')
+}
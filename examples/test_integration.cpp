@@ -1,15 +1,27 @@
+#include <cstdio>
 #include <fstream>
 #include <iostream>
 #include <memory>
-#include <sstream>
 #include <vector>
 
 #include "common/bridge/JSCExecutor.h"
+#ifdef MINI_RN_ENABLE_QUICKJS
+#include "common/bridge/QuickJSExecutor.h"
+#endif
+#include "common/modules/AsyncStorageModule.h"
+#include "common/modules/BlobModule.h"
 #include "common/modules/DeviceInfoModule.h"
+#include "common/modules/EventEmitterModule.h"
+#include "common/modules/FileSystemModule.h"
 #include "common/modules/ModuleRegistry.h"
+#include "common/modules/TimingModule.h"
+#include "common/modules/UIManagerModule.h"
+#include "common/modules/VirtualizedListModule.h"
+#include "common/ui/MountingLayer.h"
 
 using namespace mini_rn::bridge;
 using namespace mini_rn::modules;
+using namespace mini_rn::ui;
 
 /**
  * Mini React Native - 端到端集成测试
@@ -22,6 +34,18 @@ using namespace mini_rn::modules;
  * - Native 模块注册和配置注入
  * - Bridge 双向通信
  * - 具体模块功能验证
+ * - 索引 RAM bundle 的按需模块加载（nativeRequire）
+ * - Native → JS 事件推送（callFunction + 合并 / 限频 / 按 tick 批量投递）
+ * - Native 定时器与帧回调（每个 tick 一次 JSTimers.callTimers）
+ * - 无界面 UIManager（一次 JS 渲染对应一次 shadow tree 提交）
+ * - 虚拟列表窗口计算（同步方法 nativeCallSyncHook）
+ * - 持久化键值存储（I/O 线程组提交，落盘后在 tick 中 resolve）
+ * - 文件读取（Native 内存直接作为 ArrayBuffer，I/O 线程池读取）
+ * - Blob（Native 内存中的二进制数据，Bridge 上只传句柄）
+ * - JS 堆统计与内存压力（外部内存计数、模块缓存释放、强制 GC）
+ * - 调用优先级通道（按通道派发，Background 延后到 tick、积压时丢弃）
+ * - 背压（未完成调用超过高水位时通知 JS，生产者等待排空）
+ * - QuickJS 后端（启用时）：Promise 跨 Bridge resolve（宿主执行微任务）
  *
  * 使用方式：
  * - make test-integration
@@ -29,37 +53,392 @@ using namespace mini_rn::modules;
  */
 
 /**
- * 读取文件内容到字符串
- * @param filePath 文件路径
- * @return 文件内容字符串，如果失败返回空字符串
+ * 事件推送测试：模拟高频 Native 事件源，驱动 tick 后交给 JS 校验
+ * 期望 JS 只收到两次 receiveEvents 调用（见 examples/scripts/test_events.js）
  */
-std::string readFile(const std::string& filePath) {
-  try {
-    std::ifstream file(filePath);
-    if (!file.is_open()) {
-      std::cout << "[File Reader] Error: Cannot open file: " << filePath
-                << std::endl;
-      return "";
-    }
+void testEvents(JSCExecutor& executor, EventEmitterModule* events) {
+  if (!executor.loadApplicationScriptFromFile("examples/scripts/test_events.js")) {
+    std::cout << "[Error] Failed to load examples/scripts/test_events.js"
+              << std::endl;
+    return;
+  }
 
-    std::ostringstream buffer;
-    buffer << file.rdbuf();
-    file.close();
+  // 100 个进度事件在同一 tick 内合并为最新的一个
+  for (int i = 0; i < 100; ++i) {
+    events->emit("progress", "{\"loaded\":" + std::to_string(i) + "}");
+  }
+  // 传感器事件限频为每 100ms 一次
+  events->setRateLimit("sensor", 100);
+  events->emit("sensor", "{\"value\":0}");
+  // 不同 target 的滚动事件互不合并，JS 侧按 target 过滤
+  events->emit("scroll", "{\"y\":70}", 7);
+  events->emit("scroll", "{\"y\":80}", 8);
+  // JS 没有监听的事件直接丢弃
+  events->emit("ignored", "{}");
+  executor.tick(0);
 
-    std::string content = buffer.str();
-    std::cout << "[File Reader] Successfully read file: " << filePath
-              << " (size: " << content.length() << " bytes)" << std::endl;
+  events->emit("sensor", "{\"value\":10}");
+  executor.tick(10);  // 未到间隔，暂缓投递
+  events->emit("sensor", "{\"value\":50}");
+  executor.tick(50);  // 仍未到间隔，且覆盖 value=10
+  executor.tick(100);
 
-    return content;
-  } catch (const std::exception& e) {
-    std::cout << "[File Reader] Exception reading file " << filePath << ": "
-              << e.what() << std::endl;
-    return "";
+  const EventEmitterModule::Stats& stats = events->getStats();
+  std::cout << "   Emitted: " << stats.emitted
+            << ", coalesced: " << stats.coalesced
+            << ", dropped: " << stats.dropped
+            << ", delivered: " << stats.delivered
+            << ", JS calls: " << stats.batches << std::endl;
+
+  executor.loadApplicationScript("__verifyEventTest()", "verify_events.js");
+}
+
+/**
+ * 定时器测试：以 5ms 步长驱动 tick，到期定时器与帧回调按 tick 批量回调
+ * 期望触发顺序见 examples/scripts/test_timers.js
+ */
+void testTimers(JSCExecutor& executor, TimingModule* timing) {
+  // 定时器以最近一次 tick 的时间为基准
+  executor.tick(200);
+  if (!executor.loadApplicationScriptFromFile("examples/scripts/test_timers.js")) {
+    std::cout << "[Error] Failed to load examples/scripts/test_timers.js"
+              << std::endl;
+    return;
   }
+
+  for (int now = 205; now <= 300; now += 5) {
+    executor.tick(now);
+  }
+
+  const TimingModule::Stats& stats = timing->getStats();
+  std::cout << "   Timers created: " << stats.created
+            << ", fired: " << stats.fired << ", frames: " << stats.frames
+            << ", JS calls: " << stats.batches << " (20 ticks)" << std::endl;
+
+  executor.loadApplicationScript("__verifyTimerTest()", "verify_timers.js");
 }
 
-void testIntegration() {
-  std::cout << "\n=== Mini React Native Integration Test ===" << std::endl;
+/**
+ * UIManager 测试：JS 渲染产生的视图变更按批次应用到 shadow tree
+ * 每次 callFunction 期间的 UIManager 调用应当只产生一次提交
+ */
+void testUIManager(JSCExecutor& executor, UIManagerModule* uiManager,
+                   RecordingMountingLayer* recorder) {
+  if (!executor.loadApplicationScriptFromFile("examples/scripts/test_ui.js")) {
+    std::cout << "[Error] Failed to load examples/scripts/test_ui.js"
+              << std::endl;
+    return;
+  }
+
+  auto check = [](const std::string& name, bool ok) {
+    std::cout << "   " << (ok ? "✓ " : "✗ ") << name << std::endl;
+  };
+
+  executor.callFunction("UITest", "render", "[]");
+  const ShadowTree& tree = uiManager->getShadowTree();
+  const ShadowNode* container = tree.getNode(2);
+  check("render committed as a single batch",
+        recorder->getCommitCount() == 1 &&
+            recorder->getInstructionCount(MountInstruction::Type::Create) == 4 &&
+            recorder->getInstructionCount(MountInstruction::Type::Insert) == 4);
+  check("shadow tree has root, container and 3 children",
+        tree.getNodeCount() == 5 && container &&
+            container->children == std::vector<int>({3, 4, 5}));
+
+  executor.callFunction("UITest", "update", "[]");
+  const ShadowNode* first = tree.getNode(3);
+  const PropValue* text = first ? first->props.get("text") : nullptr;
+  check("update committed as a single batch",
+        recorder->getCommitCount() == 2 &&
+            recorder->getInstructionCount(
+                MountInstruction::Type::UpdateProps) == 1 &&
+            recorder->getInstructionCount(MountInstruction::Type::Remove) == 1 &&
+            recorder->getInstructionCount(MountInstruction::Type::Delete) == 1);
+  check("props updated and last child removed",
+        text && text->asString() == "updated" && !tree.getNode(5) &&
+            tree.getNodeCount() == 4);
+}
+
+/**
+ * 虚拟列表测试：JS 通过同步方法上报高度并查询窗口（见
+ * examples/scripts/test_virtualized_list.js），C++ 检查 Native 侧的偏移表
+ */
+void testVirtualizedList(JSCExecutor& executor, VirtualizedListModule* lists) {
+  if (!executor.loadApplicationScriptFromFile(
+          "examples/scripts/test_virtualized_list.js")) {
+    std::cout << "[Error] Failed to load examples/scripts/test_virtualized_list.js"
+              << std::endl;
+    return;
+  }
+
+  executor.callFunction("ListTest", "run", "[]");
+
+  const VirtualizedListLayout* list = lists->getList(1);
+  bool ok = list && list->getItemCount() == 20 &&
+            list->getTotalHeight() == 1500 &&
+            lists->getStats().heightUpdates == 10 &&
+            lists->getStats().windowQueries == 3;
+  std::cout << "   " << (ok ? "✓ " : "✗ ")
+            << "native offset table matches JS updates" << std::endl;
+}
+
+/**
+ * AsyncStorage 测试：JS 在一个批次内写入并读取（见
+ * examples/scripts/test_async_storage.js），写入落盘后由 tick 投递回调
+ */
+void testAsyncStorage(JSCExecutor& executor, AsyncStorageModule* storage) {
+  if (!executor.loadApplicationScriptFromFile(
+          "examples/scripts/test_async_storage.js")) {
+    std::cout << "[Error] Failed to load examples/scripts/test_async_storage.js"
+              << std::endl;
+    return;
+  }
+
+  executor.callFunction("StorageTest", "run", "[]");
+  // 等待 I/O 线程提交；正常运行时由下一次 tick 投递
+  storage->flush();
+  executor.tick();
+
+  const AsyncStorageModule::Stats& stats = storage->getStats();
+  const auto storeStats = storage->getStore().getStats();
+  std::cout << "   Keys written: " << stats.writes
+            << ", batches: " << stats.batches
+            << ", fsyncs: " << storeStats.groupCommits << std::endl;
+
+  executor.loadApplicationScript("__verifyStorageTest()",
+                                 "verify_async_storage.js");
+}
+
+/**
+ * 文件系统测试：JS 整体读取和分块读取一个 512 KB 的文件（见
+ * examples/scripts/test_filesystem.js），结果以 ArrayBuffer 到达 JS
+ */
+void testFileSystem(JSCExecutor& executor, FileSystemModule* fileSystem) {
+  const std::string path = "/tmp/mini_rn_integration_file.bin";
+  {
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    for (int i = 0; i < 512 * 1024; ++i) file.put(static_cast<char>(i & 0xff));
+  }
+
+  if (!executor.loadApplicationScriptFromFile(
+          "examples/scripts/test_filesystem.js")) {
+    std::cout << "[Error] Failed to load examples/scripts/test_filesystem.js"
+              << std::endl;
+    return;
+  }
+
+  executor.callFunction("FileSystemTest", "run", "[\"" + path + "\"]");
+  // 分块读取每完成一块，JS 才发起下一块的读取：每轮等待 I/O 完成后投递，
+  // 回调中发起的读取随 callback 返回的队列立即交给 Native
+  for (int i = 0; i < 32; ++i) {
+    fileSystem->flush();
+    executor.tick();
+  }
+
+  const FileSystemModule::Stats& stats = fileSystem->getStats();
+  std::cout << "   Reads: " << stats.reads << " (" << stats.mappedReads
+            << " mapped), bytes: " << stats.bytesRead
+            << ", failures: " << stats.failures << std::endl;
+
+  executor.loadApplicationScript("__verifyFileSystemTest()",
+                                 "verify_filesystem.js");
+  std::remove(path.c_str());
+}
+
+/**
+ * Blob 测试：字符串 Blob、slice，以及文件 → Blob → 文件（字节不进入 JS）
+ */
+void testBlob(JSCExecutor& executor, FileSystemModule* fileSystem,
+              const std::shared_ptr<mini_rn::utils::BlobManager>& blobs) {
+  const std::string path = "/tmp/mini_rn_integration_blob.bin";
+  const std::string copyPath = "/tmp/mini_rn_integration_blob_copy.bin";
+  {
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    for (int i = 0; i < 300 * 1024; ++i) file.put(static_cast<char>(i & 0xff));
+  }
+
+  if (!executor.loadApplicationScriptFromFile("examples/scripts/test_blob.js")) {
+    std::cout << "[Error] Failed to load examples/scripts/test_blob.js"
+              << std::endl;
+    return;
+  }
+
+  executor.callFunction("BlobTest", "run",
+                        "[\"" + path + "\", \"" + copyPath + "\"]");
+  for (int i = 0; i < 8; ++i) {
+    fileSystem->flush();
+    executor.tick();
+  }
+
+  mini_rn::utils::BlobManager::Stats stats = blobs->getStats();
+  std::cout << "   Blobs created: " << stats.created
+            << ", released: " << stats.released << ", live: " << stats.blobs
+            << std::endl;
+
+  executor.loadApplicationScript("__verifyBlobTest()", "verify_blob.js");
+  std::remove(path.c_str());
+  std::remove(copyPath.c_str());
+}
+
+/**
+ * 内存测试：ArrayBuffer 计入外部内存，内存压力释放模块缓存并强制 GC
+ */
+void testMemory(JSCExecutor& executor, FileSystemModule* fileSystem) {
+  const std::string path = "/tmp/mini_rn_integration_memory.bin";
+  {
+    // 小于映射阈值，读入缓冲池，被回收后缓冲区留在池中
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    for (int i = 0; i < 64 * 1024; ++i) file.put(static_cast<char>(i & 0xff));
+  }
+
+  if (!executor.loadApplicationScriptFromFile(
+          "examples/scripts/test_memory.js")) {
+    std::cout << "[Error] Failed to load examples/scripts/test_memory.js"
+              << std::endl;
+    return;
+  }
+
+  executor.callFunction("MemoryTest", "run", "[\"" + path + "\"]");
+  for (int i = 0; i < 4; ++i) {
+    fileSystem->flush();
+    executor.tick();
+  }
+
+  executor.handleMemoryPressure(MemoryPressureLevel::Critical);
+  JSExecutor::MemoryStats stats = executor.getMemoryStats();
+  std::cout << "   Heap: " << stats.heapSize << " / " << stats.heapCapacity
+            << " bytes, external: " << stats.externalBytes
+            << " bytes, explicit GCs: " << stats.explicitCollections << " ("
+            << stats.lastExplicitPauseMs << " ms)" << std::endl;
+  std::cout << "   Buffer pool cached after pressure: "
+            << fileSystem->getBufferPool().getStats().cachedBytes << " bytes"
+            << std::endl;
+  // 泄漏报告：此时所有调用都应该已经回调
+  executor.reportOutstandingCalls();
+
+  executor.loadApplicationScript("__verifyMemoryTest()", "verify_memory.js");
+  std::remove(path.c_str());
+}
+
+/**
+ * 优先级通道测试：同一批次的调用按通道派发，Background 在 tick 中派发，
+ * 积压超过上限时丢弃最旧的（见 examples/scripts/test_priority.js）
+ */
+void testPriority(JSCExecutor& executor) {
+  if (!executor.loadApplicationScriptFromFile(
+          "examples/scripts/test_priority.js")) {
+    std::cout << "[Error] Failed to load examples/scripts/test_priority.js"
+              << std::endl;
+    return;
+  }
+
+  executor.callFunction("PriorityTest", "run", "[]");
+  executor.tick();
+  executor.callFunction("PriorityTest", "nested", "[]");
+
+  executor.setBackgroundLaneLimits(2, 16);
+  executor.callFunction("PriorityTest", "flood", "[]");
+  executor.tick();
+  executor.setBackgroundLaneLimits(256, 16);
+
+  JSExecutor::LaneStats stats = executor.getLaneStats();
+  std::cout << "   Dispatched per lane (immediate/userBlocking/normal/"
+               "background): "
+            << stats.dispatched[0] << "/" << stats.dispatched[1] << "/"
+            << stats.dispatched[2] << "/" << stats.dispatched[3]
+            << ", deferred: " << stats.backgroundDeferred
+            << ", dropped: " << stats.backgroundDropped
+            << ", waiting: " << stats.backgroundDepth << std::endl;
+
+  executor.loadApplicationScript("__verifyPriorityTest()",
+                                 "verify_priority.js");
+}
+
+/**
+ * 背压测试：水位设为 4 / 1 个调用，JS 生产者每次调用前等待排空，
+ * 在途调用不应超过高水位（见 examples/scripts/test_backpressure.js）
+ */
+void testBackpressure(JSCExecutor& executor, FileSystemModule* fileSystem) {
+  if (!executor.loadApplicationScriptFromFile(
+          "examples/scripts/test_backpressure.js")) {
+    std::cout << "[Error] Failed to load examples/scripts/test_backpressure.js"
+              << std::endl;
+    return;
+  }
+
+  JSExecutor::BackpressureLimits defaults;
+  JSExecutor::BackpressureLimits limits;
+  limits.highWatermarkCalls = 4;
+  limits.lowWatermarkCalls = 1;
+  executor.setBackpressureLimits(limits);
+
+  executor.callFunction("BackpressureTest", "run",
+                        "[\"examples/scripts/test_backpressure.js\"]");
+  for (int i = 0; i < 16; ++i) {
+    fileSystem->flush();
+    executor.tick();
+  }
+  executor.setBackpressureLimits(defaults);
+
+  JSExecutor::BackpressureStats stats = executor.getBackpressureStats();
+  std::cout << "   Backpressure activations: " << stats.activations
+            << ", pending calls: " << stats.pendingCalls << " ("
+            << stats.pendingBytes << " bytes)" << std::endl;
+
+  executor.loadApplicationScript("__verifyBackpressureTest()",
+                                 "verify_backpressure.js");
+}
+
+#ifdef MINI_RN_ENABLE_QUICKJS
+/**
+ * QuickJS Promise 测试：QuickJS 不自动执行微任务，验证 Native 的 Promise
+ * 方法在 QuickJS 后端上能 resolve / reject（见 examples/scripts/test_promise.js）
+ */
+void testQuickJSPromises(const std::string& bundlePath) {
+  std::cout << "\n=== QuickJS Promise Test (" << bundlePath << ") ==="
+            << std::endl;
+
+  QuickJSExecutor executor;
+  executor.setJSExceptionHandler([](const std::string& error) {
+    std::cout << "[JS Exception] " << error << std::endl;
+  });
+
+  const std::string storagePath = "/tmp/mini_rn_integration_promise.db";
+  std::remove(storagePath.c_str());
+  auto asyncStorageModule = std::make_unique<AsyncStorageModule>(storagePath);
+  AsyncStorageModule* storage = asyncStorageModule.get();
+  std::vector<std::unique_ptr<mini_rn::modules::NativeModule>> modules;
+  modules.push_back(std::move(asyncStorageModule));
+  executor.registerModules(std::move(modules));
+
+  if (!executor.loadApplicationScriptFromFile(bundlePath) ||
+      !executor.loadApplicationScriptFromFile(
+          "examples/scripts/test_promise.js")) {
+    std::cout << "[Error] Failed to load " << bundlePath
+              << " or examples/scripts/test_promise.js" << std::endl;
+    return;
+  }
+
+  executor.callFunction("PromiseTest", "run", "[]");
+  // setItem 落盘后 resolve，getItem 在 resolve 之后才发起
+  for (int i = 0; i < 2; ++i) {
+    storage->flush();
+    executor.tick();
+  }
+
+  executor.loadApplicationScript("__verifyPromiseTest()", "verify_promise.js");
+  std::remove(storagePath.c_str());
+}
+#endif
+
+/**
+ * 使用指定的 bundle 运行集成测试
+ * @param bundlePath 普通 bundle（dist/bundle.js）或索引 RAM bundle
+ *                   （dist/bundle.ram，模块由 nativeRequire 按需执行）
+ */
+void testIntegration(const std::string& bundlePath) {
+  std::cout << "\n=== Mini React Native Integration Test (" << bundlePath
+            << ") ===" << std::endl;
 
   try {
     // 创建 JSCExecutor
@@ -70,41 +449,68 @@ void testIntegration() {
       std::cout << "[JS Exception] " << error << std::endl;
     });
 
-    // 注册 DeviceInfo 模块（自动注入配置）
-    std::cout << "\n1. Registering DeviceInfo module and injecting configuration..."
+    // 注册 DeviceInfo、EventEmitter、Timing、UIManager、VirtualizedList、
+    // AsyncStorage、FileSystem 和 BlobModule 模块
+    // （自动注入配置）
+    std::cout << "\n1. Registering native modules and injecting configuration..."
               << std::endl;
+    auto eventEmitter = std::make_unique<EventEmitterModule>();
+    EventEmitterModule* events = eventEmitter.get();
+    auto timingModule = std::make_unique<TimingModule>();
+    TimingModule* timing = timingModule.get();
+    auto recorder = std::make_shared<RecordingMountingLayer>();
+    auto uiManagerModule = std::make_unique<UIManagerModule>(recorder);
+    UIManagerModule* uiManager = uiManagerModule.get();
+    uiManager->addRootView(1);
+    auto virtualizedListModule = std::make_unique<VirtualizedListModule>();
+    VirtualizedListModule* lists = virtualizedListModule.get();
+    // 每次运行都从空存储开始
+    const std::string storagePath = "/tmp/mini_rn_integration_storage.db";
+    std::remove(storagePath.c_str());
+    auto asyncStorageModule = std::make_unique<AsyncStorageModule>(storagePath);
+    AsyncStorageModule* storage = asyncStorageModule.get();
+    // BlobModule 与 FileSystem 共享 blob 存储
+    auto blobs = std::make_shared<mini_rn::utils::BlobManager>();
+    auto fileSystemModule = std::make_unique<FileSystemModule>(2, blobs);
+    FileSystemModule* fileSystem = fileSystemModule.get();
     std::vector<std::unique_ptr<mini_rn::modules::NativeModule>> modules;
     modules.push_back(std::make_unique<DeviceInfoModule>());
+    modules.push_back(std::move(eventEmitter));
+    modules.push_back(std::move(timingModule));
+    modules.push_back(std::move(uiManagerModule));
+    modules.push_back(std::move(virtualizedListModule));
+    modules.push_back(std::move(asyncStorageModule));
+    modules.push_back(std::move(fileSystemModule));
+    modules.push_back(std::make_unique<BlobModule>(blobs));
     executor.registerModules(std::move(modules));
 
     // 加载打包后的 JavaScript bundle
     std::cout << "\n2. Loading JavaScript bundle..." << std::endl;
 
-    std::string bundlePath = "dist/bundle.js";
-    std::string bundleScript = readFile(bundlePath);
-
-    if (bundleScript.empty()) {
+    // 通过 mmap 直接交给引擎，不在 C++ 侧持有 bundle 副本
+    if (!executor.loadApplicationScriptFromFile(bundlePath)) {
       std::cout << "[Error] Failed to load JavaScript bundle: " << bundlePath
                 << std::endl;
       std::cout << "        Make sure you have run 'make js-build' first."
                 << std::endl;
       return;
     }
-
-    std::cout << "   ✓ Bundle loaded successfully (" << bundleScript.length()
-              << " bytes)" << std::endl;
-
-    // 执行打包后的 JavaScript bundle
-    executor.loadApplicationScript(bundleScript, bundlePath);
     std::cout << "   ✓ Bundle executed successfully" << std::endl;
 
+    // RAM bundle：非法的 moduleId 只记录 [Bridge] Error，不执行任何模块
+    executor.loadApplicationScript(
+        "if (typeof nativeRequire === 'function') {"
+        "  [-1, NaN, 1.5, 2 ** 40].forEach((id) => nativeRequire(id))"
+        "}",
+        "invalid_require.js");
+
     // 加载测试文件
     std::cout << "\n3. Loading DeviceInfo integration test..." << std::endl;
 
     std::string testPath = "examples/scripts/test_deviceinfo.js";
-    std::string testScript = readFile(testPath);
+    std::cout << "   ✓ Executing DeviceInfo integration test..." << std::endl;
 
-    if (testScript.empty()) {
+    if (!executor.loadApplicationScriptFromFile(testPath)) {
       std::cout << "[Error] Failed to load test file: " << testPath
                 << std::endl;
       std::cout << "        Make sure the file exists and is readable."
@@ -112,12 +518,45 @@ void testIntegration() {
       return;
     }
 
-    std::cout << "   ✓ Test file loaded successfully" << std::endl;
-    std::cout << "   ✓ Executing DeviceInfo integration test..." << std::endl;
+    // Native → JS 事件推送
+    std::cout << "\n4. Testing native event emitter..." << std::endl;
+    testEvents(executor, events);
+
+    // 定时器与帧回调
+    std::cout << "\n5. Testing native timers..." << std::endl;
+    testTimers(executor, timing);
+
+    // JS 渲染驱动的 shadow tree
+    std::cout << "\n6. Testing headless UIManager..." << std::endl;
+    testUIManager(executor, uiManager, recorder.get());
+
+    // 虚拟列表窗口计算
+    std::cout << "\n7. Testing virtualized list windowing..." << std::endl;
+    testVirtualizedList(executor, lists);
+
+    // 持久化键值存储
+    std::cout << "\n8. Testing AsyncStorage..." << std::endl;
+    testAsyncStorage(executor, storage);
+
+    // 零拷贝文件读取
+    std::cout << "\n9. Testing file system ArrayBuffer reads..." << std::endl;
+    testFileSystem(executor, fileSystem);
+
+    std::cout << "\n10. Testing blobs shared between native modules..."
+              << std::endl;
+    testBlob(executor, fileSystem, blobs);
+
+    std::cout << "\n11. Testing heap statistics and memory pressure..."
+              << std::endl;
+    testMemory(executor, fileSystem);
+
+    std::cout << "\n12. Testing bridge call priority lanes..." << std::endl;
+    testPriority(executor);
 
-    executor.loadApplicationScript(testScript, testPath);
+    std::cout << "\n13. Testing bridge backpressure..." << std::endl;
+    testBackpressure(executor, fileSystem);
 
-    std::cout << "\n4. Bundle-based JavaScript Test Completed!" << std::endl;
+    std::cout << "\n14. Bundle-based JavaScript Test Completed!" << std::endl;
     std::cout
         << "   Check the JavaScript output above for detailed test results."
         << std::endl;
@@ -132,8 +571,12 @@ int main() {
   std::cout << "Mini React Native - Integration Test" << std::endl;
   std::cout << "This test verifies the complete JavaScript ↔ Native communication using bundled JavaScript" << std::endl;
 
-  // 运行集成测试
-  testIntegration();
+  // 运行集成测试：普通 bundle 与 RAM bundle 应得到相同的结果
+  testIntegration("dist/bundle.js");
+  testIntegration("dist/bundle.ram");
+#ifdef MINI_RN_ENABLE_QUICKJS
+  testQuickJSPromises("dist/bundle.js");
+#endif
 
   return 0;
 }
\ No newline at end of file
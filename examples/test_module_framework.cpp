@@ -1,3 +1,4 @@
+#include <chrono>
 #include <iostream>
 #include <memory>
 #include <vector>
@@ -15,6 +16,10 @@
  * 3. 模块方法调用
  * 4. 回调机制
  * 5. JSCExecutor 与 ModuleRegistry 的集成
+ * 6. 回调结果以类型化值直接传入 JS（含特殊字符的错误信息）
+ * 7. 未完成调用跟踪：泄漏报告、按方法超时、丢弃超时后的迟到回调
+ * 8. 可缓存方法：结果缓存、在途调用合并、同步方法缓存
+ * 9. 合并调用超时：合并的调用一起以超时结束，之后的相同调用重新调用模块
  */
 
 void testModuleRegistration() {
@@ -55,10 +60,10 @@ void testModuleMethodCall() {
     auto registry = std::make_unique<mini_rn::modules::ModuleRegistry>();
 
     // 设置回调处理器
-    registry->setCallbackHandler([](int callId, const std::string& result, bool isError) {
+    registry->setCallbackHandler([](int callId, const mini_rn::utils::Value& result, bool isError) {
         std::cout << "[Test] Registry callback - CallId: " << callId
                   << ", IsError: " << (isError ? "true" : "false")
-                  << ", Result: " << result << std::endl;
+                  << ", Result: " << result.toJSON() << std::endl;
     });
 
     // 创建并注册测试模块
@@ -135,16 +140,56 @@ void testJSCExecutorIntegration() {
     }
 }
 
+void testTypedCallbackResults() {
+    std::cout << "\n=== 测试类型化回调结果 ===" << std::endl;
+
+    try {
+        auto executor = std::make_unique<mini_rn::bridge::JSCExecutor>();
+        auto* registry = executor->getModuleRegistry();
+
+        // 记录 JS 收到的回调参数
+        executor->loadApplicationScript(
+            "var __fbBatchedBridge = {"
+            "  calls: [],"
+            "  invokeCallbackAndReturnFlushedQueue: function (id, args) {"
+            "    this.calls.push([id, args]); return null;"
+            "  },"
+            "  getCalls: function () { return this.calls; }"
+            "};",
+            "callback_recorder.js");
+
+        mini_rn::utils::Value window = mini_rn::utils::Value::object();
+        window.set("first", 3);
+        window.set("last", 12);
+        window.set("title", "row \"3\"\n");
+        registry->sendSuccessCallback(4001, window);
+        registry->sendErrorCallback(4002, "bad \"quote\" \\ path");
+
+        std::string calls;
+        executor->callGlobalMethod("__fbBatchedBridge", "getCalls", "[]", &calls);
+        const std::string expected =
+            "[[4001,[null,{\"first\":3,\"last\":12,\"title\":\"row \\\"3\\\"\\n\"}]],"
+            "[4002,[{\"message\":\"bad \\\"quote\\\" \\\\ path\"}]]]";
+        std::cout << "JS 收到的回调参数: " << calls << std::endl;
+        std::cout << (calls == expected ? "类型化回调结果正确"
+                                        : "错误: 回调参数与预期不符")
+                  << std::endl;
+
+    } catch (const std::exception& e) {
+        std::cout << "类型化回调结果测试失败: " << e.what() << std::endl;
+    }
+}
+
 void testErrorHandling() {
     std::cout << "\n=== 测试错误处理 ===" << std::endl;
 
     auto registry = std::make_unique<mini_rn::modules::ModuleRegistry>();
 
     // 设置回调处理器
-    registry->setCallbackHandler([](int callId, const std::string& result, bool isError) {
+    registry->setCallbackHandler([](int callId, const mini_rn::utils::Value& result, bool isError) {
         std::cout << "[Test] Error handling callback - CallId: " << callId
                   << ", IsError: " << (isError ? "true" : "false")
-                  << ", Result: " << result << std::endl;
+                  << ", Result: " << result.toJSON() << std::endl;
     });
 
     // 测试无效的模块ID
@@ -163,6 +208,180 @@ void testErrorHandling() {
     std::cout << "错误处理测试完成" << std::endl;
 }
 
+void testPendingCallTracking() {
+    std::cout << "\n=== 测试未完成调用跟踪 ===" << std::endl;
+
+    auto registry = std::make_unique<mini_rn::modules::ModuleRegistry>();
+    std::vector<std::pair<int, bool>> received;
+    registry->setCallbackHandler([&received](int callId, const mini_rn::utils::Value& result, bool isError) {
+        std::cout << "[Test] Tracking callback - CallId: " << callId
+                  << ", IsError: " << (isError ? "true" : "false")
+                  << ", Result: " << result.toJSON() << std::endl;
+        received.emplace_back(callId, isError);
+    });
+
+    // MockModule 通过自己的处理器回调，注册器看到的是从不回调的模块
+    std::vector<std::unique_ptr<mini_rn::modules::NativeModule>> modules;
+    modules.push_back(std::make_unique<MockModule>());
+    registry->registerModules(std::move(modules));
+    registry->setMethodTimeout("MockModule", "asyncMethod", 50);
+
+    registry->callNativeMethod(0, 0, "{}", 5001);  // testMethod，不超时
+    registry->callNativeMethod(0, 3, "{}", 5002);  // asyncMethod，50 ms 超时
+    registry->callNativeMethod(0, 1, "{}", -1);    // 没有回调，不跟踪
+    std::cout << "未完成调用数: " << registry->getPendingCallCount() << std::endl;
+
+    auto now = std::chrono::steady_clock::now().time_since_epoch();
+    double nowMs = std::chrono::duration<double, std::milli>(now).count();
+    for (const auto& call : registry->getOldestPendingCalls(10, nowMs + 1000)) {
+        std::cout << "  " << call.moduleName << "." << call.methodName
+                  << " (Call ID: " << call.callId << ") pending for "
+                  << static_cast<long long>(call.ageMs) << " ms" << std::endl;
+    }
+
+    // 超时的调用以错误回调结束，之后模块迟到的回调被丢弃
+    size_t expired = registry->expireTimedOutCalls(nowMs + 100);
+    registry->sendSuccessCallback(5002, "late");
+    registry->sendSuccessCallback(5001, "done");
+
+    const auto& stats = registry->getCallTrackingStats();
+    bool ok = expired == 1 && received.size() == 2 &&
+              received[0] == std::make_pair(5002, true) &&
+              received[1] == std::make_pair(5001, false) &&
+              registry->getPendingCallCount() == 0 && stats.tracked == 2 &&
+              stats.timedOut == 1 && stats.lateReplies == 1 &&
+              stats.completed == 1;
+    std::cout << (ok ? "未完成调用跟踪正确" : "错误: 调用跟踪结果与预期不符")
+              << std::endl;
+}
+
+/**
+ * 记录调用次数的可缓存模块：异步方法不立即回调，由测试决定何时完成
+ */
+class CountingModule : public mini_rn::modules::NativeModule {
+public:
+    std::string getName() const override { return "CountingModule"; }
+    std::vector<std::string> getMethods() const override {
+        return {"lookup", "version"};
+    }
+    std::vector<std::string> getSyncMethods() const override { return {"version"}; }
+    std::map<std::string, double> getCacheableMethods() const override {
+        return {{"lookup", kCacheForever}, {"version", kCacheForever}};
+    }
+    void invoke(const std::string&, const std::string& args, int callId) override {
+        invocations++;
+        lastCallId = callId;
+        lastArgs = args;
+    }
+    std::string invokeSync(const std::string&, const std::string&) override {
+        invocations++;
+        return "\"1.0\"";
+    }
+    void complete(const std::string& result) { sendSuccessCallback(lastCallId, result); }
+    void fail() { sendErrorCallback(lastCallId, "lookup failed"); }
+
+    int invocations = 0;
+    int lastCallId = -1;
+    std::string lastArgs;
+};
+
+void testResultCache() {
+    std::cout << "\n=== 测试可缓存方法 ===" << std::endl;
+
+    auto registry = std::make_unique<mini_rn::modules::ModuleRegistry>();
+    std::vector<std::pair<int, std::string>> received;
+    registry->setCallbackHandler([&received](int callId, const mini_rn::utils::Value& result, bool isError) {
+        received.emplace_back(callId, isError ? "error" : result.toJSON());
+    });
+
+    auto owned = std::make_unique<CountingModule>();
+    CountingModule* module = owned.get();
+    std::vector<std::unique_ptr<mini_rn::modules::NativeModule>> modules;
+    modules.push_back(std::move(owned));
+    registry->registerModules(std::move(modules));
+
+    // 参数相同的在途调用合并为一次调用，结果分发给所有 callId
+    registry->callNativeMethod(0, 0, "[\"a\"]", 6001);
+    registry->callNativeMethod(0, 0, "[\"a\"]", 6002);
+    registry->callNativeMethod(0, 0, "[\"a\"]", 6003);
+    bool collapsed = module->invocations == 1 && received.empty();
+    module->complete("A");
+    bool fannedOut = received.size() == 3 && received[0].first == 6001 &&
+                     received[2].first == 6003 && received[2].second == "\"A\"";
+
+    // 之后的调用直接由缓存返回；参数不同的调用照常调用模块
+    registry->callNativeMethod(0, 0, "[\"a\"]", 6004);
+    bool cached = module->invocations == 1 && received.size() == 4 &&
+                  received[3].second == "\"A\"";
+
+    // 错误分发给合并的调用，但不缓存
+    registry->callNativeMethod(0, 0, "[\"b\"]", 6005);
+    registry->callNativeMethod(0, 0, "[\"b\"]", 6006);
+    module->fail();
+    registry->callNativeMethod(0, 0, "[\"b\"]", 6007);
+    bool errorsNotCached = module->invocations == 3 && received.size() == 6 &&
+                           received[5].second == "error";
+    module->complete("B");
+
+    // 同步方法只调用一次
+    std::string first = registry->callSerializableNativeHook(0, 1, "[]");
+    std::string second = registry->callSerializableNativeHook(0, 1, "[]");
+    bool syncCached = first == "\"1.0\"" && second == first && module->invocations == 4;
+
+    // 内存压力时清空缓存
+    registry->onMemoryPressure(mini_rn::modules::MemoryPressureLevel::Moderate);
+    registry->callSerializableNativeHook(0, 1, "[]");
+
+    auto stats = registry->getCacheStats();
+    std::cout << "缓存命中: " << stats.hits << ", 未命中: " << stats.misses
+              << ", 合并: " << stats.collapsed << ", 条目: " << stats.entries << std::endl;
+    bool ok = collapsed && fannedOut && cached && errorsNotCached && syncCached &&
+              module->invocations == 5 && stats.hits == 2 && stats.misses == 5 &&
+              stats.collapsed == 3 && registry->getPendingCallCount() == 0;
+    std::cout << (ok ? "可缓存方法正确" : "错误: 缓存结果与预期不符") << std::endl;
+}
+
+void testCachedCallTimeout() {
+    std::cout << "\n=== 测试合并调用超时 ===" << std::endl;
+
+    auto registry = std::make_unique<mini_rn::modules::ModuleRegistry>();
+    std::vector<std::pair<int, std::string>> received;
+    registry->setCallbackHandler([&received](int callId, const mini_rn::utils::Value& result, bool isError) {
+        received.emplace_back(callId, isError ? "error" : result.toJSON());
+    });
+
+    auto owned = std::make_unique<CountingModule>();
+    CountingModule* module = owned.get();
+    std::vector<std::unique_ptr<mini_rn::modules::NativeModule>> modules;
+    modules.push_back(std::move(owned));
+    registry->registerModules(std::move(modules));
+    registry->setMethodTimeout("CountingModule", "lookup", 50);
+
+    // 模块一直不回调：primary 超时时合并在它上面的调用一起结束
+    registry->callNativeMethod(0, 0, "[\"t\"]", 7001);
+    registry->callNativeMethod(0, 0, "[\"t\"]", 7002);
+    auto now = std::chrono::steady_clock::now().time_since_epoch();
+    double nowMs = std::chrono::duration<double, std::milli>(now).count();
+    size_t expired = registry->expireTimedOutCalls(nowMs + 100);
+    bool allTimedOut = expired == 2 && received.size() == 2 && received[0].second == "error" &&
+                       received[1].second == "error" && received[0].first + received[1].first == 7001 + 7002 &&
+                       registry->getPendingCallCount() == 0;
+
+    // 之后的相同调用不再合并到超时的调用上，而是重新调用模块
+    registry->callNativeMethod(0, 0, "[\"t\"]", 7003);
+    bool reinvoked = module->invocations == 2 && module->lastCallId == 7003;
+    module->complete("T");
+    registry->sendSuccessCallback(7001, "late");  // 第一次调用迟到的结果被丢弃
+    registry->callNativeMethod(0, 0, "[\"t\"]", 7004);
+
+    bool ok = allTimedOut && reinvoked && received.size() == 4 &&
+              received[2] == std::make_pair(7003, std::string("\"T\"")) &&
+              received[3] == std::make_pair(7004, std::string("\"T\"")) &&
+              module->invocations == 2 && registry->getPendingCallCount() == 0 &&
+              registry->getCallTrackingStats().lateReplies == 1;
+    std::cout << (ok ? "合并调用超时正确" : "错误: 合并调用超时结果与预期不符") << std::endl;
+}
+
 int main() {
     std::cout << "开始模块框架测试..." << std::endl;
 
@@ -170,7 +389,11 @@ int main() {
         testModuleRegistration();
         testModuleMethodCall();
         testJSCExecutorIntegration();
+        testTypedCallbackResults();
         testErrorHandling();
+        testPendingCallTracking();
+        testResultCache();
+        testCachedCallTimeout();
 
         std::cout << "\n=== 所有测试完成 ===" << std::endl;
         std::cout << "模块框架基础功能正常工作！" << std::endl;
@@ -1,10 +1,67 @@
 import { nodeResolve } from '@rollup/plugin-node-resolve';
 import commonjs from '@rollup/plugin-commonjs';
+import { createRequire } from 'module';
+
+// BUILD=release：发布构建（npm run build:release）
+// - __DEV__ 替换为常量 false，if (__DEV__) 中的调试日志在打包时被移除
+// - if (false) 分支由 rollup 的 tree-shaking 删除，不依赖压缩；输出中仍有残留时构建失败
+// - 更激进的 tree-shaking，再用 terser 压缩；terser 是发布构建的必需依赖，加载失败时构建失败
+// - 输出到 dist/bundle.release.js，与开发 bundle 并存，便于对比体积和启动时间
+const isRelease = process.env.BUILD === 'release';
+
+const DEV_PATTERN = /(?<![.\w$])__DEV__(?![\w$])/g;
+
+const DEAD_BRANCH_PATTERN = /^(?!\s*(\/\/|\*)).*\bif\s*\(\s*false\b/m;
+
+// 把 __DEV__ 替换为等长的 `false  `：代码位置不变，原有 sourcemap 继续有效（map: null）
+function defineDev() {
+  return {
+    name: 'define-dev',
+    transform(code) {
+      if (!code.includes('__DEV__')) return null;
+      return { code: code.replace(DEV_PATTERN, 'false  '), map: null };
+    },
+    // 压缩之前检查：调试分支必须已被 tree-shaking 删除
+    renderChunk(code) {
+      const match = code.match(DEAD_BRANCH_PATTERN);
+      if (match) {
+        this.error(`dead branch left in release bundle: ${match[0].trim()}`);
+      }
+      return null;
+    }
+  };
+}
+
+function requiredTerser() {
+  let terser;
+  try {
+    terser = createRequire(import.meta.url)('terser');
+  } catch (e) {
+    throw new Error('terser is required for release builds, run `pnpm install` first');
+  }
+  return {
+    name: 'terser',
+    async renderChunk(code) {
+      const result = await terser.minify(code, {
+        compress: {
+          passes: 2,
+          dead_code: true
+        },
+        format: {
+          // 保留 banner
+          comments: /Mini React Native/
+        },
+        sourceMap: true
+      });
+      return { code: result.code, map: result.map };
+    }
+  };
+}
 
 export default {
   input: 'src/js/index.js',
   output: {
-    file: 'dist/bundle.js',
+    file: isRelease ? 'dist/bundle.release.js' : 'dist/bundle.js',
     format: 'iife',
     name: 'MiniReactNative',
     sourcemap: true,
@@ -19,8 +76,11 @@ export default {
     commonjs({
       // 转换 CommonJS 模块
       transformMixedEsModules: true
-    })
+    }),
+    isRelease && defineDev(),
+    isRelease && requiredTerser()
   ],
+  treeshake: isRelease ? 'recommended' : true,
   // 确保全局变量在打包后仍然可用
   external: [],
   // 不处理外部依赖
@@ -29,4 +89,4 @@ export default {
     if (warning.code === 'THIS_IS_UNDEFINED') return;
     warn(warning);
   }
-};
\ No newline at end of file
+};
@@ -0,0 +1,283 @@
+#!/usr/bin/env node
+/**
+ * build-ram-bundle.js - 生成索引 RAM bundle（对齐 React Native Indexed RAM Bundle）
+ *
+ * 普通 bundle（dist/bundle.js）启动时需要整体解析和执行；
+ * RAM bundle 把每个模块单独存放，启动时只执行 startup code，
+ * 其余模块在第一次 require 时由 Native 的 nativeRequire(moduleId) 按需执行。
+ *
+ * 文件格式（小端序，与 RN JSIndexedRAMBundle 一致）：
+ *
+ *   uint32 magic            0xFB0BD1E5
+ *   uint32 entryCount       模块表项数（模块 ID 即表项下标）
+ *   uint32 startupCodeSize  startup code 长度（含结尾 '\0'）
+ *   { uint32 offset, uint32 length } × entryCount
+ *                           offset 相对于模块表之后的代码区起点；length 含结尾 '\0'
+ *   startup code '\0'       模块系统 prelude + __r(0)
+ *   module code '\0' ...    __d(function (global, require, module, exports) {...}, id)
+ *
+ * 模块 ID 按从入口开始的依赖遍历顺序分配，入口模块 ID 为 0。
+ * 只处理相对路径的 CommonJS require('./xxx')，与 src/js 的写法一致。
+ *
+ * 使用方式：
+ *   node scripts/build-ram-bundle.js [entry] [output] [--release [--no-minify]]
+ *   默认：src/js/index.js → dist/bundle.ram
+ *
+ * --release：与 rollup 的发布构建一致，把 __DEV__ 替换为 false，
+ * 删除 if (false) / if (false && ...) 分支（不依赖压缩器），再用 terser 逐个压缩模块代码。
+ * 发布构建要求 terser（devDependencies），加载失败或仍有未删除的分支时构建失败；
+ * --no-minify 只删除分支不压缩，不需要 terser，用于对比删除调试代码本身的收益。
+ */
+
+'use strict'
+
+const fs = require('fs')
+const path = require('path')
+
+const MAGIC_NUMBER = 0xfb0bd1e5
+const HEADER_SIZE = 12
+const ENTRY_SIZE = 8
+
+const REQUIRE_PATTERN = /\brequire\(\s*(['"])(\.{1,2}\/[^'"]+)\1\s*\)/g
+
+/**
+ * 模块系统 prelude（对应 Metro 的 require polyfill）
+ * - __d(factory, moduleId)：定义模块，由各模块代码调用
+ * - __r(moduleId)：执行并返回模块导出；模块尚未定义时调用 nativeRequire 按需加载
+ */
+const PRELUDE = `(function (global) {
+  var modules = Object.create(null)
+
+  function define(factory, moduleId) {
+    if (modules[moduleId] !== undefined) return
+    modules[moduleId] = { factory: factory, isInitialized: false, module: { exports: {} } }
+  }
+
+  function require(moduleId) {
+    var record = modules[moduleId]
+    if (record === undefined) {
+      nativeRequire(moduleId)
+      record = modules[moduleId]
+      if (record === undefined) {
+        throw new Error('Requiring unknown module "' + moduleId + '"')
+      }
+    }
+    if (!record.isInitialized) {
+      // 先标记再执行，循环依赖时返回部分初始化的 exports（与 CommonJS 语义一致）
+      record.isInitialized = true
+      var module = record.module
+      record.factory.call(module.exports, global, require, module, module.exports)
+      record.factory = undefined
+    }
+    return record.module.exports
+  }
+
+  global.__d = define
+  global.__r = require
+})(typeof globalThis !== 'undefined' ? globalThis : this)
+`
+
+function resolveModule(fromFile, request) {
+  const base = path.resolve(path.dirname(fromFile), request)
+  const candidates = [base, base + '.js', path.join(base, 'index.js')]
+  const resolved = candidates.find((file) => fs.existsSync(file) && fs.statSync(file).isFile())
+  if (!resolved) {
+    throw new Error(`Cannot resolve '${request}' from ${fromFile}`)
+  }
+  return resolved
+}
+
+/**
+ * 从入口开始遍历依赖图，按发现顺序分配模块 ID
+ */
+function collectModules(entryFile) {
+  const ids = new Map()
+  const order = []
+
+  function visit(file) {
+    if (ids.has(file)) return
+    ids.set(file, order.length)
+    const source = fs.readFileSync(file, 'utf8')
+    const record = { file, source, dependencies: [] }
+    order.push(record)
+
+    for (const match of source.matchAll(REQUIRE_PATTERN)) {
+      const dependency = resolveModule(file, match[2])
+      record.dependencies.push(dependency)
+      visit(dependency)
+    }
+  }
+
+  visit(path.resolve(entryFile))
+  return { ids, order }
+}
+
+function wrapModule(record, ids) {
+  const body = record.source.replace(REQUIRE_PATTERN, (_, quote, request) => {
+    const id = ids.get(resolveModule(record.file, request))
+    return `require(${id} /* ${request} */)`
+  })
+  const id = ids.get(record.file)
+  return `__d(function (global, require, module, exports) {\n${body}\n}, ${id});\n`
+}
+
+const DEV_PATTERN = /(?<![.\w$])__DEV__(?![\w$])/g
+
+const DEAD_BRANCH_PATTERN = /\bif\s*\(\s*false\b/
+
+function requireTerser() {
+  try {
+    return require('terser')
+  } catch (e) {
+    throw new Error('terser is required for release builds, run `pnpm install` first')
+  }
+}
+
+/**
+ * 跳过从 index 开始的字符串、模板字符串、注释或正则字面量，返回其后的位置；
+ * index 处不是这些字面量时返回 -1。括号匹配时据此忽略字面量中的 ( ) { }
+ */
+function skipLiteral(code, index) {
+  const char = code[index]
+  const next = code[index + 1]
+  if (char === '/' && next === '/') {
+    const end = code.indexOf('\n', index)
+    return end === -1 ? code.length : end
+  }
+  if (char === '/' && next === '*') {
+    return code.indexOf('*/', index + 2) + 2
+  }
+  if (char === "'" || char === '"' || char === '`' || (char === '/' && isRegexStart(code, index))) {
+    let i = index + 1
+    let inClass = false
+    while (i < code.length) {
+      if (code[i] === '\\') {
+        i += 2
+        continue
+      }
+      if (char === '`' && code[i] === '$' && code[i + 1] === '{') {
+        i = matchBracket(code, i + 1) + 1
+        continue
+      }
+      if (char === '/' && code[i] === '[') inClass = true
+      else if (char === '/' && code[i] === ']') inClass = false
+      else if (code[i] === char && !inClass) return i + 1
+      i++
+    }
+    throw new Error(`Unterminated literal at offset ${index}`)
+  }
+  return -1
+}
+
+function isRegexStart(code, index) {
+  let i = index - 1
+  while (i >= 0 && /\s/.test(code[i])) i--
+  return i < 0 || '(,=:[!&|?{};+-*%<>~^'.includes(code[i]) || /\breturn$/.test(code.slice(Math.max(0, i - 5), i + 1))
+}
+
+/**
+ * 返回与 index 处的 ( 或 { 配对的右括号位置
+ */
+function matchBracket(code, index) {
+  let depth = 0
+  for (let i = index; i < code.length; i++) {
+    const end = skipLiteral(code, i)
+    if (end !== -1) {
+      i = end - 1
+      continue
+    }
+    if (code[i] === '(' || code[i] === '{' || code[i] === '[') depth++
+    else if (code[i] === ')' || code[i] === '}' || code[i] === ']') {
+      depth--
+      if (depth === 0) return i
+    }
+  }
+  throw new Error(`Unbalanced bracket at offset ${index}`)
+}
+
+/**
+ * 删除条件为 false 或 false && ... 的 if 块，有 else 时只保留 else 分支。
+ * 只处理花括号块（src/js 中的 if (__DEV__) 都是这种写法），遇到其他写法时报错，
+ * 保证发布构建中不残留调试分支
+ */
+function stripDeadBranches(code) {
+  let output = ''
+  let i = 0
+  while (i < code.length) {
+    const end = skipLiteral(code, i)
+    if (end !== -1) {
+      output += code.slice(i, end)
+      i = end
+      continue
+    }
+    const match = code[i] === 'i' && DEAD_BRANCH_PATTERN.exec(code.slice(i, i + 32))
+    if (match && match.index === 0 && !/[\w$.]/.test(code[i - 1] || '')) {
+      const conditionEnd = matchBracket(code, code.indexOf('(', i))
+      const condition = code.slice(code.indexOf('(', i) + 1, conditionEnd)
+      let bodyStart = conditionEnd + 1
+      while (/\s/.test(code[bodyStart])) bodyStart++
+      if (/^\s*false\s*(&&|$)/.test(condition) && code[bodyStart] === '{') {
+        i = matchBracket(code, bodyStart) + 1
+        const elseMatch = /^\s*else\b\s*/.exec(code.slice(i))
+        if (elseMatch) i += elseMatch[0].length
+        continue
+      }
+      throw new Error(`Cannot strip dead branch: ${code.slice(i, code.indexOf('\n', i)).trim()}`)
+    }
+    output += code[i]
+    i++
+  }
+  return output
+}
+
+/**
+ * 发布构建：常量化 __DEV__，删除调试分支，再压缩；每个模块单独处理，模块边界保持不变
+ */
+async function releaseModuleCode(code, terser) {
+  const stripped = stripDeadBranches(code.replace(DEV_PATTERN, 'false'))
+  if (!terser) return stripped
+  const result = await terser.minify(stripped, { compress: { passes: 2, dead_code: true }, mangle: true })
+  return result.code + '\n'
+}
+
+async function buildRAMBundle(entryFile, outputFile, release, noMinify) {
+  const { ids, order } = collectModules(entryFile)
+
+  const terser = release && !noMinify ? requireTerser() : null
+  const sources = order.map((record) => wrapModule(record, ids))
+  const moduleSources = release ? await Promise.all(sources.map((code) => releaseModuleCode(code, terser))) : sources
+
+  const startupCode = Buffer.from(`${PRELUDE}\n__r(0);\n\0`, 'utf8')
+  const moduleCodes = moduleSources.map((code) => Buffer.from(code + '\0', 'utf8'))
+
+  const tableSize = order.length * ENTRY_SIZE
+  const header = Buffer.alloc(HEADER_SIZE + tableSize)
+  header.writeUInt32LE(MAGIC_NUMBER, 0)
+  header.writeUInt32LE(order.length, 4)
+  header.writeUInt32LE(startupCode.length, 8)
+
+  // 代码区从 startup code 开始，模块代码紧随其后
+  let offset = startupCode.length
+  moduleCodes.forEach((code, id) => {
+    header.writeUInt32LE(offset, HEADER_SIZE + id * ENTRY_SIZE)
+    header.writeUInt32LE(code.length, HEADER_SIZE + id * ENTRY_SIZE + 4)
+    offset += code.length
+  })
+
+  fs.mkdirSync(path.dirname(outputFile), { recursive: true })
+  fs.writeFileSync(outputFile, Buffer.concat([header, startupCode, ...moduleCodes]))
+
+  console.log(`RAM bundle written to ${outputFile}`)
+  order.forEach((record, id) => {
+    console.log(`  [${id}] ${path.relative(process.cwd(), record.file)}`)
+  })
+}
+
+const args = process.argv.slice(2)
+const release = args.includes('--release')
+const noMinify = args.includes('--no-minify')
+const [entry = 'src/js/index.js', output = 'dist/bundle.ram'] = args.filter((arg) => !arg.startsWith('--'))
+buildRAMBundle(entry, output, release, noMinify).catch((error) => {
+  console.error(error)
+  process.exit(1)
+})
@@ -1,8 +1,44 @@
 #include "JSCExecutor.h"
 
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
 #include <iostream>
-
-#include "../utils/JSONParser.h"
+#include <stdexcept>
+#include <utility>
+
+#include "../utils/Logging.h"
+
+// JavaScriptCore 导出但未在公开头文件中声明的接口（JSStringRefPrivate.h）：
+// 创建直接引用调用方 UTF-16 缓冲区的字符串，缓冲区必须比字符串活得更久
+extern "C" JSStringRef JSStringCreateWithCharactersNoCopy(const JSChar *chars,
+                                                         size_t numChars);
+
+// 可复用的已编译脚本（JSScriptRefPrivate.h）：创建时完成解析，
+// 同一个上下文组（VM）内重复执行时共享 VM 的代码缓存
+typedef struct OpaqueJSScript *JSScriptRef;
+extern "C" JSScriptRef JSScriptCreateFromString(JSContextGroupRef contextGroup,
+                                                JSStringRef url,
+                                                int startingLineNumber,
+                                                JSStringRef source,
+                                                JSStringRef *errorMessage,
+                                                int *errorLine);
+extern "C" void JSScriptRelease(JSScriptRef script);
+extern "C" JSValueRef JSScriptEvaluate(JSContextRef context, JSScriptRef script,
+                                       JSValueRef thisValue,
+                                       JSValueRef *exception);
+
+// 内存相关的导出接口（JSBasePrivate.h）：报告 JS 对象持有的外部内存，
+// 以及返回 {heapSize, heapCapacity, extraMemorySize, objectCount, ...} 的堆统计
+extern "C" void JSReportExtraMemoryCost(JSContextRef ctx, size_t size);
+extern "C" JSObjectRef JSGetMemoryUsageStatistics(JSContextRef ctx);
 
 // 统一的 JSValue 转换工具函数
 // 这个函数被静态回调函数和成员函数共同使用，避免代码重复
@@ -24,41 +60,236 @@ static std::string convertJSValueToString(JSContextRef ctx, JSValueRef value) {
 namespace mini_rn {
 namespace bridge {
 
-// 静态实例指针定义
-JSCExecutor *JSCExecutor::s_currentInstance = nullptr;
+using mini_rn::utils::MappedFile;
 
-JSCExecutor::JSCExecutor() : m_context(nullptr), m_globalObject(nullptr) {
-  // 注册当前实例（简化的实例管理）
-  s_currentInstance = this;
+namespace {
 
-  // 初始化模块注册器
-  m_moduleRegistry = std::make_unique<mini_rn::modules::ModuleRegistry>();
+/**
+ * JSCArguments - JSArguments 的 JavaScriptCore 实现
+ * 包装宿主函数收到的 JSValueRef 参数数组，按需转换
+ */
+class JSCArguments : public JSArguments {
+ public:
+  JSCArguments(JSContextRef ctx, size_t argumentCount,
+               const JSValueRef arguments[])
+      : m_ctx(ctx), m_argumentCount(argumentCount), m_arguments(arguments) {}
 
-  // 设置模块回调处理器
-  bool callbackSet = m_moduleRegistry->setCallbackHandler(
-      [this](int callId, const std::string &result, bool isError) {
-        this->invokeCallback(callId, result, isError);
-      });
+  size_t size() const override { return m_argumentCount; }
 
-  if (!callbackSet) {
-    throw std::runtime_error(
-        "Failed to set callback handler in ModuleRegistry");
+  std::string getString(size_t index) const override {
+    if (index >= m_argumentCount) return "";
+    return convertJSValueToString(m_ctx, m_arguments[index]);
   }
 
-  initializeJSContext();
+  double getNumber(size_t index) const override {
+    if (index >= m_argumentCount) return 0;
+    return JSValueToNumber(m_ctx, m_arguments[index], nullptr);
+  }
+
+  std::string getJSONString(size_t index) const override {
+    if (index >= m_argumentCount) return "";
+    JSStringRef jsonRef =
+        JSValueCreateJSONString(m_ctx, m_arguments[index], 0, nullptr);
+    if (!jsonRef) return "";
+
+    size_t bufferSize = JSStringGetMaximumUTF8CStringSize(jsonRef);
+    std::string result(bufferSize, '\0');
+    size_t written = JSStringGetUTF8CString(jsonRef, &result[0], bufferSize);
+    // written 包含结尾的 '\0'
+    result.resize(written > 0 ? written - 1 : 0);
+    JSStringRelease(jsonRef);
+    return result;
+  }
+
+ private:
+  JSContextRef m_ctx;
+  size_t m_argumentCount;
+  const JSValueRef *m_arguments;
+};
+
+// 宿主函数对象被调用时的入口：取出私有数据中的 HostFunction 并执行
+JSValueRef hostFunctionCallAsFunction(JSContextRef ctx, JSObjectRef function,
+                                      JSObjectRef thisObject,
+                                      size_t argumentCount,
+                                      const JSValueRef arguments[],
+                                      JSValueRef *exception) {
+  // 避免未使用参数的警告
+  (void)thisObject;
+  (void)exception;
+
+  auto *hostFunction = static_cast<HostFunction *>(JSObjectGetPrivate(function));
+  if (!hostFunction) {
+    return JSValueMakeUndefined(ctx);
+  }
+
+  JSCArguments args(ctx, argumentCount, arguments);
+  std::string resultJson = (*hostFunction)(args);
+  if (resultJson.empty()) {
+    return JSValueMakeUndefined(ctx);
+  }
+
+  JSStringRef resultStr = JSStringCreateWithUTF8CString(resultJson.c_str());
+  JSValueRef result = JSValueMakeFromJSONString(ctx, resultStr);
+  JSStringRelease(resultStr);
+  return result ? result : JSValueMakeUndefined(ctx);
+}
+
+// 宿主函数对象被 GC 回收时释放 HostFunction
+void hostFunctionFinalize(JSObjectRef object) {
+  delete static_cast<HostFunction *>(JSObjectGetPrivate(object));
+}
+
+/**
+ * UTF-16 镜像文件头
+ * 镜像 = 文件头 + 源文件逐字节展宽后的 JSChar 数组（本机字节序）
+ * 按源文件内容（大小 + FNV-1a 哈希）校验，不依赖修改时间：
+ * 时间精度内的修改也会让镜像失效
+ */
+struct WidenedImageHeader {
+  uint32_t magic;
+  uint32_t version;
+  uint64_t sourceSize;
+  uint64_t sourceHash;
+};
+
+constexpr uint32_t kWidenedImageMagic = 0x3631524D;  // "MR16"
+constexpr uint32_t kWidenedImageVersion = 2;
+constexpr const char *kWidenedImageSuffix = ".utf16";
+
+// 镜像缓存的默认目录：按用户区分，不写到 bundle 旁边（bundle 所在目录
+// 可能只读，也可能在源码树里）
+std::string defaultImageCacheDirectory() {
+  const char *tmpdir = std::getenv("TMPDIR");
+  std::string base = tmpdir && *tmpdir ? tmpdir : "/tmp";
+  if (base.back() == '/') base.pop_back();
+  return base + "/mini_rn_jsc_images-" +
+         std::to_string(static_cast<unsigned long>(geteuid()));
+}
+
+// 创建（0700）并检查镜像目录：必须是当前用户拥有的真实目录，且其他用户
+// 不能写入，否则别人可以预先放入或替换镜像
+bool preparePrivateDirectory(const std::string &directory) {
+  if (mkdir(directory.c_str(), 0700) != 0 && errno != EEXIST) return false;
+  struct stat st;
+  return lstat(directory.c_str(), &st) == 0 && S_ISDIR(st.st_mode) &&
+         st.st_uid == geteuid() && (st.st_mode & 022) == 0;
+}
+
+// 镜像文件路径：以源文件内容的哈希和大小命名，内容相同的 bundle 共用镜像
+std::string widenedImagePath(const std::string &directory,
+                             uint64_t sourceHash, size_t sourceSize) {
+  char name[48];
+  std::snprintf(name, sizeof(name), "%016llx-%llu",
+                static_cast<unsigned long long>(sourceHash),
+                static_cast<unsigned long long>(sourceSize));
+  return directory + "/" + name + kWidenedImageSuffix;
 }
 
-JSCExecutor::~JSCExecutor() {
-  // 清理实例指针
-  if (s_currentInstance == this) {
-    s_currentInstance = nullptr;
+bool isASCII(const char *data, size_t size) {
+  const unsigned char *bytes = reinterpret_cast<const unsigned char *>(data);
+  unsigned char combined = 0;
+  for (size_t i = 0; i < size; ++i) {
+    combined |= bytes[i];
   }
-  destroy();
+  return (combined & 0x80) == 0;
+}
+
+// 打开并校验镜像缓存，校验失败时 image 保持关闭状态
+bool openWidenedImage(const MappedFile &source, uint64_t sourceHash,
+                      const std::string &imagePath, MappedFile &image) {
+  if (!image.open(imagePath)) return false;
+
+  WidenedImageHeader header;
+  bool valid =
+      image.size() == sizeof(header) + source.size() * sizeof(JSChar);
+  if (valid) {
+    std::memcpy(&header, image.data(), sizeof(header));
+    valid = header.magic == kWidenedImageMagic &&
+            header.version == kWidenedImageVersion &&
+            header.sourceSize == source.size() &&
+            header.sourceHash == sourceHash;
+  }
+
+  if (!valid) image.close();
+  return valid;
+}
+
+// 生成镜像缓存：先写临时文件再 rename，避免并发启动读到半个镜像
+bool writeWidenedImage(const MappedFile &source, uint64_t sourceHash,
+                       const std::string &imagePath) {
+  std::string tempPath =
+      imagePath + "." + std::to_string(static_cast<long>(getpid())) + ".tmp";
+  std::ofstream out(tempPath, std::ios::binary | std::ios::trunc);
+  if (!out.is_open()) return false;
+
+  WidenedImageHeader header{kWidenedImageMagic, kWidenedImageVersion,
+                            source.size(), sourceHash};
+  out.write(reinterpret_cast<const char *>(&header), sizeof(header));
+
+  // 分块展宽，避免为整个 bundle 分配临时缓冲区
+  constexpr size_t kChunkSize = 64 * 1024;
+  std::vector<JSChar> chunk(kChunkSize);
+  const unsigned char *bytes =
+      reinterpret_cast<const unsigned char *>(source.data());
+  for (size_t offset = 0; offset < source.size(); offset += kChunkSize) {
+    size_t count = std::min(kChunkSize, source.size() - offset);
+    for (size_t i = 0; i < count; ++i) {
+      chunk[i] = bytes[offset + i];
+    }
+    out.write(reinterpret_cast<const char *>(chunk.data()), count * sizeof(JSChar));
+  }
+
+  out.close();
+  if (!out || std::rename(tempPath.c_str(), imagePath.c_str()) != 0) {
+    std::remove(tempPath.c_str());
+    return false;
+  }
+  return true;
+}
+
+}  // namespace
+
+JSCExecutor::JSCExecutor(std::shared_ptr<ScriptCache> scriptCache)
+    : JSExecutor(std::move(scriptCache)),
+      m_context(nullptr),
+      m_globalObject(nullptr),
+      m_imageCacheDirectory(defaultImageCacheDirectory()) {
+  initializeJSContext();
+}
+
+JSCExecutor::~JSCExecutor() { destroy(); }
+
+std::shared_ptr<void> JSCExecutor::getCacheContextGroup() const {
+  return m_scriptCache->getEngineState("jsc", [] {
+    return std::shared_ptr<void>(
+        const_cast<OpaqueJSContextGroup *>(JSContextGroupCreate()),
+        [](void *group) {
+          JSContextGroupRelease(static_cast<JSContextGroupRef>(group));
+        });
+  });
+}
+
+JSClassRef JSCExecutor::getHostFunctionClass() {
+  static JSClassRef hostFunctionClass = [] {
+    JSClassDefinition definition = kJSClassDefinitionEmpty;
+    definition.className = "HostFunction";
+    definition.callAsFunction = hostFunctionCallAsFunction;
+    definition.finalize = hostFunctionFinalize;
+    return JSClassCreate(&definition);
+  }();
+  return hostFunctionClass;
 }
 
 void JSCExecutor::initializeJSContext() {
   // 创建 JavaScript 执行上下文
-  m_context = JSGlobalContextCreate(nullptr);
+  // 启用脚本缓存时加入缓存的上下文组：JSScriptRef 只能在创建它的组内执行
+  // （上下文持有组的引用）
+  m_context = m_scriptCache
+                  ? JSGlobalContextCreateInGroup(
+                        static_cast<JSContextGroupRef>(
+                            getCacheContextGroup().get()),
+                        nullptr)
+                  : JSGlobalContextCreate(nullptr);
   if (!m_context) {
     throw std::runtime_error("Failed to create JavaScript context");
   }
@@ -69,14 +300,11 @@ void JSCExecutor::initializeJSContext() {
   // 设置标准的全局对象
   setupGlobalObjects();
 
-  // 注入 Bridge 通信函数
-  installBridgeFunctions();
-
-  // 注意：模块配置注入延迟到模块注册后
-  // injectModuleConfig() 将在 ModuleRegistry::registerModules() 后调用
+  // 搭建 Bridge 运行环境（__DEV__ 标志、Bridge 通信函数）
+  initializeRuntime();
 
-  std::cout << "[JSCExecutor] JavaScript context initialized successfully"
-            << std::endl;
+  MINI_RN_LOG(INFO,
+              "[JSCExecutor] JavaScript context initialized successfully");
 }
 
 void JSCExecutor::setupGlobalObjects() {
@@ -85,180 +313,131 @@ void JSCExecutor::setupGlobalObjects() {
   JSObjectSetProperty(m_context, m_globalObject, globalName, m_globalObject,
                       kJSPropertyAttributeNone, nullptr);
   JSStringRelease(globalName);
-
-  // 设置 __DEV__ 标志（开发模式标识）
-  JSStringRef devName = JSStringCreateWithUTF8CString("__DEV__");
-  // TODO: 生产模式需要设置为 false
-  JSValueRef devValue = JSValueMakeBoolean(m_context, true);
-  JSObjectSetProperty(m_context, m_globalObject, devName, devValue,
-                      kJSPropertyAttributeReadOnly, nullptr);
-  JSStringRelease(devName);
-
-  // Console 对象现在通过 JavaScript 端的 console.js 提供
-  // 使用 nativeLoggingHook 进行实际的日志输出
-}
-
-
-void JSCExecutor::installBridgeFunctions() {
-  // 注入关键的 Bridge 通信函数
-  // 这个函数是 React Native MessageQueue 调用 Native 的核心接口
-  // 完全对齐 RN 实现：nativeFlushQueueImmediate(queue)，其中 queue =
-  // [moduleIds, methodIds, params, callbackIds]
-  installGlobalFunction(
-      "nativeFlushQueueImmediate",
-      [](JSContextRef ctx, JSObjectRef function, JSObjectRef thisObject,
-         size_t argumentCount, const JSValueRef arguments[],
-         JSValueRef *exception) -> JSValueRef {
-        // 避免未使用参数的警告
-        (void)function;
-        (void)thisObject;
-        (void)exception;
-        (void)ctx;
-
-        std::cout << "[Bridge] nativeFlushQueueImmediate called with "
-                  << argumentCount
-                  << " arguments (RN-compatible single parameter)" << std::endl;
-
-        try {
-          // 获取JSCExecutor实例（对齐RN架构）
-          auto *executor = JSCExecutor::getCurrentInstance();
-          if (!executor) {
-            std::cout << "[Bridge] Error: No JSCExecutor instance available"
-                      << std::endl;
-            return JSValueMakeUndefined(ctx);
-          }
-
-          // 验证参数数量（对齐RN：单个queue参数）
-          if (argumentCount != 1) {
-            std::cout
-                << "[Bridge] Error: Expected 1 argument (queue array), got "
-                << argumentCount << std::endl;
-            return JSValueMakeUndefined(ctx);
-          }
-
-          // 调用实例方法（对齐RN架构）
-          executor->nativeFlushQueueImmediate(arguments[0]);
-
-        } catch (const std::exception &e) {
-          std::cout << "[Bridge] Exception in static callback: " << e.what()
-                    << std::endl;
-        } catch (...) {
-          std::cout << "[Bridge] Unknown exception in static callback"
-                    << std::endl;
-        }
-
-        return JSValueMakeUndefined(ctx);
-      });
-
-  // 注入日志函数
-  installGlobalFunction(
-      "nativeLoggingHook",
-      [](JSContextRef ctx, JSObjectRef function, JSObjectRef thisObject,
-         size_t argumentCount, const JSValueRef arguments[],
-         JSValueRef *exception) -> JSValueRef {
-        // 避免未使用参数的警告
-        (void)function;
-        (void)thisObject;
-        (void)exception;
-        (void)ctx;
-
-        try {
-          // 获取JSCExecutor实例（对齐RN架构）
-          auto *executor = JSCExecutor::getCurrentInstance();
-          if (!executor) {
-            std::cout << "[Bridge] Error: No JSCExecutor instance available "
-                         "for logging"
-                      << std::endl;
-            return JSValueMakeUndefined(ctx);
-          }
-
-          if (argumentCount >= 2) {
-            // 调用实例方法（对齐RN架构）
-            executor->nativeLoggingHook(arguments[0], arguments[1]);
-          } else {
-            std::cout << "[Bridge] Warning: nativeLoggingHook called with "
-                         "insufficient arguments"
-                      << std::endl;
-          }
-
-        } catch (const std::exception &e) {
-          std::cout << "[Bridge] Exception in logging callback: " << e.what()
-                    << std::endl;
-        }
-
-        return JSValueMakeUndefined(ctx);
-      });
-
-  // 注入同步调用函数 (React Native 标准)
-  installGlobalFunction(
-      "nativeCallSyncHook",
-      [](JSContextRef ctx, JSObjectRef function, JSObjectRef thisObject,
-         size_t argumentCount, const JSValueRef arguments[],
-         JSValueRef *exception) -> JSValueRef {
-        // 避免未使用参数的警告
-        (void)function;
-        (void)thisObject;
-        (void)exception;
-
-        std::cout << "[Bridge] nativeCallSyncHook called with " << argumentCount
-                  << " arguments" << std::endl;
-
-        try {
-          // 获取JSCExecutor实例
-          auto *executor = JSCExecutor::getCurrentInstance();
-          if (!executor) {
-            std::cout << "[Bridge] Error: No JSCExecutor instance available"
-                      << std::endl;
-            return JSValueMakeUndefined(ctx);
-          }
-
-          // 验证参数数量：moduleID, methodID, args
-          if (argumentCount != 3) {
-            std::cout << "[Bridge] Error: Expected 3 arguments (moduleID, "
-                         "methodID, args), got "
-                      << argumentCount << std::endl;
-            return JSValueMakeUndefined(ctx);
-          }
-
-          // 调用实例方法处理同步调用
-          return executor->nativeCallSyncHook(arguments[0], arguments[1],
-                                              arguments[2]);
-
-        } catch (const std::exception &e) {
-          std::cout << "[Bridge] Exception in sync callback: " << e.what()
-                    << std::endl;
-        }
-
-        return JSValueMakeUndefined(ctx);
-      });
 }
 
 void JSCExecutor::loadApplicationScript(const std::string &script,
                                         const std::string &sourceURL) {
-  JSStringRef scriptStr = JSStringCreateWithUTF8CString(script.c_str());
-  JSStringRef sourceURLStr =
-      sourceURL.empty() ? nullptr
-                        : JSStringCreateWithUTF8CString(sourceURL.c_str());
+  evaluateSourceBuffer(script.c_str(), script.length(), sourceURL);
+}
+
+void JSCExecutor::evaluateSourceBuffer(const char *source, size_t length,
+                                       const std::string &sourceURL) {
+  if (m_scriptCache) {
+    evaluateCachedScript(source, length, sourceURL);
+    return;
+  }
+
+  // JSC 按 C 字符串读取 UTF-8 源码，解码到引擎内部的 UTF-16 缓冲区
+  JSStringRef scriptStr = JSStringCreateWithUTF8CString(source);
+  evaluateScript(scriptStr, sourceURL);
+  JSStringRelease(scriptStr);
+}
+
+void JSCExecutor::evaluateCachedScript(const char *source, size_t length,
+                                       const std::string &sourceURL) {
+  std::string key = ScriptCache::makeKey("jsc", source, length);
+  std::shared_ptr<void> handle = m_scriptCache->findCompiledScript(key);
+  bool cacheHit = handle != nullptr;
+
+  if (!handle) {
+    // 未命中：解析源码生成 JSScriptRef，JSC 持有源码的独立副本，
+    // 因此缓存项不依赖调用方缓冲区（如 bundle 映射）的生命周期
+    JSStringRef sourceStr = JSStringCreateWithUTF8CString(source);
+    JSStringRef sourceURLStr =
+        JSStringCreateWithUTF8CString(sourceURL.c_str());
+    JSStringRef errorMessage = nullptr;
+    int errorLine = 0;
+    JSScriptRef script =
+        JSScriptCreateFromString(JSContextGetGroup(m_context), sourceURLStr, 1,
+                                 sourceStr, &errorMessage, &errorLine);
+    JSStringRelease(sourceURLStr);
+    JSStringRelease(sourceStr);
+
+    if (!script) {
+      std::string message = "SyntaxError";
+      if (errorMessage) {
+        message = jsValueToString(JSValueMakeString(m_context, errorMessage));
+        JSStringRelease(errorMessage);
+      }
+      reportJSException(message + " (" + sourceURL + ":" +
+                            std::to_string(errorLine) + ")",
+                        "");
+      return;
+    }
+
+    // 缓存项持有上下文组：组内已经没有上下文时脚本仍然可以释放
+    handle = std::shared_ptr<void>(
+        script, [group = getCacheContextGroup()](void *p) {
+          JSScriptRelease(static_cast<JSScriptRef>(p));
+        });
+    m_scriptCache->storeCompiledScript(key, handle);
+  }
 
   JSValueRef exception = nullptr;
-  JSValueRef result = JSEvaluateScript(m_context, scriptStr, nullptr,
-                                       sourceURLStr, 0, &exception);
+  JSScriptEvaluate(m_context, static_cast<JSScriptRef>(handle.get()), nullptr,
+                   &exception);
 
   if (exception) {
     handleJSException(exception);
   } else {
-    // 避免未使用变量的警告
-    (void)result;
-    std::cout << "[JSCExecutor] Script executed successfully" << std::endl;
+    MINI_RN_LOG(DEBUG, "[JSCExecutor] Script executed successfully"
+                << (cacheHit ? " (script cache hit)" : ""));
   }
+}
 
+void JSCExecutor::loadMappedScript(const MappedFile &file,
+                                   const std::string &sourceURL) {
+  // 启用脚本缓存时以内容哈希查找编译结果，命中后不再需要源码字符串
+  if (m_scriptCache || file.size() == 0 ||
+      !isASCII(file.data(), file.size())) {
+    // 含非 ASCII 字符：由 JSC 做 UTF-8 → UTF-16 解码（引擎内部一次拷贝）
+    JSExecutor::loadMappedScript(file, sourceURL);
+    return;
+  }
+
+  // 纯 ASCII：每个字节就是一个 UTF-16 码元，使用预先展宽的 UTF-16 镜像，
+  // JSC 直接引用镜像内存，不再做任何拷贝或解码
+  const JSChar *chars = acquireWidenedImage(file);
+  JSStringRef scriptStr = JSStringCreateWithCharactersNoCopy(chars, file.size());
+  evaluateScript(scriptStr, sourceURL);
   JSStringRelease(scriptStr);
-  if (sourceURLStr) JSStringRelease(sourceURLStr);
 }
 
-void JSCExecutor::setJSExceptionHandler(
-    std::function<void(const std::string &)> handler) {
-  m_exceptionHandler = handler;
+const JSChar *JSCExecutor::acquireWidenedImage(const MappedFile &source) {
+  // 1. 优先使用磁盘上的镜像缓存：映射后由文件背书，内存紧张时可被内核丢弃
+  auto image = std::make_unique<MappedFile>();
+  if (!m_imageCacheDirectory.empty() &&
+      preparePrivateDirectory(m_imageCacheDirectory)) {
+    uint64_t sourceHash = ScriptCache::hashSource(source.data(), source.size());
+    std::string imagePath =
+        widenedImagePath(m_imageCacheDirectory, sourceHash, source.size());
+    if (!openWidenedImage(source, sourceHash, imagePath, *image) &&
+        writeWidenedImage(source, sourceHash, imagePath)) {
+      openWidenedImage(source, sourceHash, imagePath, *image);
+    }
+  }
+
+  if (image->isOpen()) {
+    const JSChar *chars = reinterpret_cast<const JSChar *>(
+        image->data() + sizeof(WidenedImageHeader));
+    m_scriptImages.push_back(std::move(image));
+    return chars;
+  }
+
+  // 2. 没有可用的缓存目录（不存在、不安全）或写入失败（如磁盘已满）：
+  //    退化为在堆上展宽一次
+  if (!m_imageCacheDirectory.empty()) {
+    std::cout << "[JSCExecutor] Warning: Cannot cache widened image in "
+              << m_imageCacheDirectory << ", widening in memory" << std::endl;
+  }
+  std::unique_ptr<JSChar[]> buffer(new JSChar[source.size()]);
+  const unsigned char *bytes =
+      reinterpret_cast<const unsigned char *>(source.data());
+  for (size_t i = 0; i < source.size(); ++i) {
+    buffer[i] = bytes[i];
+  }
+  m_scriptBuffers.push_back(std::move(buffer));
+  return m_scriptBuffers.back().get();
 }
 
 void JSCExecutor::installGlobalFunction(
@@ -274,7 +453,246 @@ void JSCExecutor::installGlobalFunction(
 
   JSStringRelease(funcName);
 
-  std::cout << "[JSCExecutor] Installed global function: " << name << std::endl;
+  MINI_RN_LOG(DEBUG, "[JSCExecutor] Installed global function: " << name);
+}
+
+void JSCExecutor::installGlobalFunction(const std::string &name,
+                                        HostFunction function) {
+  // 宿主函数对象持有 HostFunction 的堆拷贝，随对象被 GC 回收时释放
+  JSObjectRef func = JSObjectMake(m_context, getHostFunctionClass(),
+                                  new HostFunction(std::move(function)));
+
+  JSStringRef funcName = JSStringCreateWithUTF8CString(name.c_str());
+  JSObjectSetProperty(m_context, m_globalObject, funcName, func,
+                      kJSPropertyAttributeNone, nullptr);
+  JSStringRelease(funcName);
+
+  MINI_RN_LOG(DEBUG, "[JSCExecutor] Installed global function: " << name);
+}
+
+JSCallStatus JSCExecutor::callGlobalMethod(const std::string &objectName,
+                                           const std::string &methodName,
+                                           const std::string &argsJson,
+                                           std::string *resultJson) {
+  JSObjectRef object = nullptr;
+  JSObjectRef method = nullptr;
+  JSCallStatus status = findGlobalMethod(objectName, methodName, &object, &method);
+  if (status != JSCallStatus::Ok) return status;
+
+  // 解析 JSON 参数数组
+  JSStringRef argsStr = JSStringCreateWithUTF8CString(argsJson.c_str());
+  JSValueRef argsValue = JSValueMakeFromJSONString(m_context, argsStr);
+  JSStringRelease(argsStr);
+
+  if (!argsValue || !JSValueIsArray(m_context, argsValue)) {
+    return JSCallStatus::InvalidArguments;
+  }
+
+  JSObjectRef argsArray = JSValueToObject(m_context, argsValue, nullptr);
+  JSStringRef lengthName = JSStringCreateWithUTF8CString("length");
+  size_t argumentCount = static_cast<size_t>(JSValueToNumber(
+      m_context, JSObjectGetProperty(m_context, argsArray, lengthName, nullptr),
+      nullptr));
+  JSStringRelease(lengthName);
+
+  std::vector<JSValueRef> arguments;
+  arguments.reserve(argumentCount);
+  for (size_t i = 0; i < argumentCount; ++i) {
+    arguments.push_back(JSObjectGetPropertyAtIndex(
+        m_context, argsArray, static_cast<unsigned>(i), nullptr));
+  }
+
+  return callMethod(object, method, arguments, resultJson);
+}
+
+JSCallStatus JSCExecutor::callGlobalMethodWithArgs(
+    const std::string &objectName, const std::string &methodName,
+    const mini_rn::utils::Value &args, std::string *resultJson) {
+  if (!args.isArray()) return JSCallStatus::InvalidArguments;
+
+  JSObjectRef object = nullptr;
+  JSObjectRef method = nullptr;
+  JSCallStatus status = findGlobalMethod(objectName, methodName, &object, &method);
+  if (status != JSCallStatus::Ok) return status;
+
+  // 参数直接构造为 JS 值，不经过 JSON；
+  // 参数数组留在栈上，保证调用前各参数不会被 GC 回收
+  JSObjectRef argsArray =
+      JSValueToObject(m_context, valueToJSValue(args), nullptr);
+  std::vector<JSValueRef> arguments;
+  arguments.reserve(args.size());
+  for (size_t i = 0; i < args.size(); ++i) {
+    arguments.push_back(JSObjectGetPropertyAtIndex(
+        m_context, argsArray, static_cast<unsigned>(i), nullptr));
+  }
+
+  return callMethod(object, method, arguments, resultJson);
+}
+
+JSCallStatus JSCExecutor::findGlobalMethod(const std::string &objectName,
+                                           const std::string &methodName,
+                                           JSObjectRef *object,
+                                           JSObjectRef *method) {
+  // 获取全局对象，如 __fbBatchedBridge
+  JSStringRef objectNameStr = JSStringCreateWithUTF8CString(objectName.c_str());
+  JSValueRef objectValue =
+      JSObjectGetProperty(m_context, m_globalObject, objectNameStr, nullptr);
+  JSStringRelease(objectNameStr);
+
+  if (!JSValueIsObject(m_context, objectValue)) {
+    return JSCallStatus::NotFound;
+  }
+
+  *object = JSValueToObject(m_context, objectValue, nullptr);
+
+  // 获取方法
+  JSStringRef methodNameStr = JSStringCreateWithUTF8CString(methodName.c_str());
+  JSValueRef methodValue =
+      JSObjectGetProperty(m_context, *object, methodNameStr, nullptr);
+  JSStringRelease(methodNameStr);
+
+  if (!JSValueIsObject(m_context, methodValue)) {
+    return JSCallStatus::NotFound;
+  }
+
+  *method = JSValueToObject(m_context, methodValue, nullptr);
+  if (!JSObjectIsFunction(m_context, *method)) {
+    return JSCallStatus::NotFound;
+  }
+  return JSCallStatus::Ok;
+}
+
+JSCallStatus JSCExecutor::callMethod(JSObjectRef object, JSObjectRef method,
+                                     const std::vector<JSValueRef> &arguments,
+                                     std::string *resultJson) {
+  // 调用 JavaScript 方法
+  JSValueRef exception = nullptr;
+  JSValueRef result = JSObjectCallAsFunction(
+      m_context, method, object, arguments.size(),
+      arguments.empty() ? nullptr : arguments.data(), &exception);
+
+  if (exception) {
+    handleJSException(exception);
+    return JSCallStatus::Exception;
+  }
+
+  if (resultJson) {
+    *resultJson = (result && !JSValueIsUndefined(m_context, result))
+                      ? jsValueToJSONString(result)
+                      : "";
+  }
+
+  return JSCallStatus::Ok;
+}
+
+JSValueRef JSCExecutor::valueToJSValue(const mini_rn::utils::Value &value) {
+  using mini_rn::utils::Value;
+
+  switch (value.getType()) {
+    case Value::Type::Null:
+      return JSValueMakeNull(m_context);
+    case Value::Type::Bool:
+      return JSValueMakeBoolean(m_context, value.asBool());
+    case Value::Type::Number:
+      return JSValueMakeNumber(m_context, value.asNumber());
+    case Value::Type::String:
+      return stringToJSValue(value.asString());
+    case Value::Type::Array: {
+      // 逐个写入已创建的数组：元素一创建就被数组引用，不会在构造期间被回收
+      JSObjectRef array = JSObjectMakeArray(m_context, 0, nullptr, nullptr);
+      const auto &elements = value.asArray();
+      for (size_t i = 0; i < elements.size(); ++i) {
+        JSObjectSetPropertyAtIndex(m_context, array, static_cast<unsigned>(i),
+                                   valueToJSValue(elements[i]), nullptr);
+      }
+      return array;
+    }
+    case Value::Type::Object: {
+      JSObjectRef object = JSObjectMake(m_context, nullptr, nullptr);
+      for (const auto &field : value.asObject()) {
+        JSStringRef name = JSStringCreateWithUTF8CString(field.first.c_str());
+        JSObjectSetProperty(m_context, object, name,
+                            valueToJSValue(field.second),
+                            kJSPropertyAttributeNone, nullptr);
+        JSStringRelease(name);
+      }
+      return object;
+    }
+    case Value::Type::ArrayBuffer: {
+      // 独占的 Native 内存直接交给 ArrayBuffer，不拷贝；
+      // 引用随 ArrayBuffer 一起由 GC 释放
+      std::shared_ptr<mini_rn::utils::ByteBuffer> buffer =
+          value.asArrayBuffer();
+      if (!buffer) return JSValueMakeNull(m_context);
+      if (!buffer->ownsMemory()) {
+        // 与其他缓冲区共享的内存：JS 的写入不能影响共享方，
+        // 换成写时复制映射（不支持时拷贝）
+        buffer = mini_rn::utils::ByteBuffer::copyOnWrite(buffer);
+      }
+      ExternalBuffer *holder = retainExternalBuffer(buffer);
+      JSValueRef exception = nullptr;
+      JSObjectRef arrayBuffer = JSObjectMakeArrayBufferWithBytesNoCopy(
+          m_context, buffer->data(), buffer->size(),
+          [](void * /* bytes */, void *context) {
+            releaseExternalBuffer(context);
+          },
+          holder, &exception);
+      if (!arrayBuffer || exception) {
+        releaseExternalBuffer(holder);
+        return JSValueMakeNull(m_context);
+      }
+      return arrayBuffer;
+    }
+  }
+  return JSValueMakeUndefined(m_context);
+}
+
+bool JSCExecutor::setGlobalValue(const std::string &name,
+                                 const std::string &json, bool readOnly) {
+  // 转换过程：JSON 文本 -> JSValueRef (JS世界)
+  JSStringRef jsonStr = JSStringCreateWithUTF8CString(json.c_str());
+  JSValueRef value = JSValueMakeFromJSONString(m_context, jsonStr);
+  JSStringRelease(jsonStr);
+
+  if (!value) {
+    std::cout << "[JSCExecutor] Error: Invalid JSON for global '" << name
+              << "'" << std::endl;
+    return false;
+  }
+
+  JSStringRef propertyName = JSStringCreateWithUTF8CString(name.c_str());
+  JSObjectSetProperty(
+      m_context, m_globalObject, propertyName, value,
+      readOnly ? kJSPropertyAttributeReadOnly : kJSPropertyAttributeNone,
+      nullptr);
+  JSStringRelease(propertyName);
+  return true;
+}
+
+void JSCExecutor::performGarbageCollection() {
+  if (m_context) JSGarbageCollect(m_context);
+}
+
+void JSCExecutor::queryHeapUsage(MemoryStats &stats) const {
+  if (!m_context) return;
+  JSObjectRef statistics = JSGetMemoryUsageStatistics(m_context);
+  if (!statistics) return;
+
+  auto readField = [this, statistics](const char *field) -> size_t {
+    JSStringRef name = JSStringCreateWithUTF8CString(field);
+    JSValueRef value =
+        JSObjectGetProperty(m_context, statistics, name, nullptr);
+    JSStringRelease(name);
+    double number = JSValueToNumber(m_context, value, nullptr);
+    return number > 0 ? static_cast<size_t>(number) : 0;
+  };
+  stats.heapSize = readField("heapSize");
+  stats.heapCapacity = readField("heapCapacity");
+  stats.protectedValues = readField("protectedObjectCount");
+}
+
+void JSCExecutor::reportExtraMemoryCost(size_t bytes) {
+  if (m_context) JSReportExtraMemoryCost(m_context, bytes);
 }
 
 void JSCExecutor::destroy() {
@@ -282,13 +700,37 @@ void JSCExecutor::destroy() {
     JSGlobalContextRelease(m_context);
     m_context = nullptr;
     m_globalObject = nullptr;
-    std::cout << "[JSCExecutor] JavaScript context destroyed" << std::endl;
+    // 上下文释放后引擎不再引用脚本源码，此时才能解除映射
+    m_scriptImages.clear();
+    m_scriptBuffers.clear();
+    MINI_RN_LOG(INFO, "[JSCExecutor] JavaScript context destroyed");
+  }
+}
+
+void JSCExecutor::evaluateScript(JSStringRef script,
+                                 const std::string &sourceURL) {
+  JSStringRef sourceURLStr =
+      sourceURL.empty() ? nullptr
+                        : JSStringCreateWithUTF8CString(sourceURL.c_str());
+
+  JSValueRef exception = nullptr;
+  JSValueRef result = JSEvaluateScript(m_context, script, nullptr,
+                                       sourceURLStr, 0, &exception);
+
+  if (exception) {
+    handleJSException(exception);
+  } else {
+    // 避免未使用变量的警告
+    (void)result;
+    MINI_RN_LOG(DEBUG, "[JSCExecutor] Script executed successfully");
   }
+
+  if (sourceURLStr) JSStringRelease(sourceURLStr);
 }
 
 void JSCExecutor::handleJSException(JSValueRef exception) {
   std::string errorMsg = jsValueToString(exception);
-  std::cout << "[JSCExecutor] JavaScript Exception: " << errorMsg << std::endl;
+  std::string stackTrace;
 
   // 尝试提取堆栈跟踪信息
   try {
@@ -304,19 +746,7 @@ void JSCExecutor::handleJSException(JSValueRef exception) {
 
       if (stackValue != nullptr && !JSValueIsUndefined(m_context, stackValue) &&
           !JSValueIsNull(m_context, stackValue)) {
-        std::string stackTrace = jsValueToString(stackValue);
-        if (!stackTrace.empty()) {
-          std::cout << "Stack Trace:" << std::endl;
-          std::cout << stackTrace << std::endl;
-
-          // 如果有异常处理器，将堆栈信息也包含在内
-          if (m_exceptionHandler) {
-            std::string fullErrorMsg =
-                errorMsg + "\nStack Trace:\n" + stackTrace;
-            m_exceptionHandler(fullErrorMsg);
-            return;
-          }
-        }
+        stackTrace = jsValueToString(stackValue);
       } else {
         std::cout << "[JSCExecutor] No stack trace available for this exception"
                   << std::endl;
@@ -331,10 +761,8 @@ void JSCExecutor::handleJSException(JSValueRef exception) {
               << e.what() << std::endl;
   }
 
-  // 调用原有的异常处理器（如果没有堆栈信息的话）
-  if (m_exceptionHandler) {
-    m_exceptionHandler(errorMsg);
-  }
+  // 交给 JSExecutor 统一输出并调用异常处理器
+  reportJSException(errorMsg, stackTrace);
 }
 
 std::string JSCExecutor::jsValueToString(JSValueRef value) {
@@ -402,8 +830,9 @@ std::string JSCExecutor::jsValueToJSONString(JSValueRef value) {
     // 将结果转换为 C++ 字符串
     std::string jsonString = jsValueToString(result);
 
-    std::cout << "[JSCExecutor] JSValue -> JSON conversion successful, length: "
-              << jsonString.length() << std::endl;
+    MINI_RN_LOG(DEBUG,
+                "[JSCExecutor] JSValue -> JSON conversion successful, length: "
+                    << jsonString.length());
 
     return jsonString;
 
@@ -418,345 +847,5 @@ std::string JSCExecutor::jsValueToJSONString(JSValueRef value) {
   }
 }
 
-// === Bridge 成员方法实现（对齐RN架构）===
-
-JSCExecutor *JSCExecutor::getCurrentInstance() { return s_currentInstance; }
-
-void JSCExecutor::nativeFlushQueueImmediate(JSValueRef queue) {
-  std::cout
-      << "[JSCExecutor] nativeFlushQueueImmediate called (instance method)"
-      << std::endl;
-
-  try {
-    // Step 1: JSValue -> JSON字符串 (对齐RN: queue.toJSONString())
-    std::string queueStr = jsValueToJSONString(queue);
-    std::cout << "[JSCExecutor] JSON serialization successful, length: "
-              << queueStr.length() << std::endl;
-
-    // Step 2: JSON字符串 -> BridgeMessage (替代 folly::parseJson)
-    std::cout << "[JSCExecutor] Parsing JSON with SimpleBridgeJSONParser..."
-              << std::endl;
-    mini_rn::bridge::BridgeMessage message =
-        mini_rn::utils::SimpleBridgeJSONParser::parseBridgeQueue(queueStr);
-
-    // Step 3: 处理消息 (替代 m_delegate->callNativeModules)
-    std::cout << "[JSCExecutor] Processing parsed message..." << std::endl;
-    processBridgeMessage(message);
-
-  } catch (const std::exception &e) {
-    std::cout << "[JSCExecutor] Error in nativeFlushQueueImmediate: "
-              << e.what() << std::endl;
-  }
-}
-
-void JSCExecutor::nativeLoggingHook(JSValueRef level, JSValueRef message) {
-  std::cout << "[JSCExecutor] nativeLoggingHook called (instance method)"
-            << std::endl;
-
-  try {
-    std::string levelStr = jsValueToString(level);
-    std::string messageStr = jsValueToString(message);
-    std::cout << "[" << levelStr << "] " << messageStr << std::endl;
-  } catch (const std::exception &e) {
-    std::cout << "[JSCExecutor] Error in nativeLoggingHook: " << e.what()
-              << std::endl;
-  }
-}
-
-JSValueRef JSCExecutor::nativeCallSyncHook(JSValueRef moduleID,
-                                           JSValueRef methodID,
-                                           JSValueRef args) {
-  std::cout << "[JSCExecutor] nativeCallSyncHook called (instance method)"
-            << std::endl;
-
-  try {
-    // 将JSValue参数转换为C++类型
-    double moduleIdDouble = JSValueToNumber(m_context, moduleID, nullptr);
-    double methodIdDouble = JSValueToNumber(m_context, methodID, nullptr);
-    unsigned int moduleIdInt = static_cast<unsigned int>(moduleIdDouble);
-    unsigned int methodIdInt = static_cast<unsigned int>(methodIdDouble);
-
-    std::cout << "[JSCExecutor] Sync call - Module: " << moduleIdInt
-              << ", Method: " << methodIdInt << std::endl;
-
-    // 将参数转换为JSON字符串
-    std::string argsJson = jsValueToJSONString(args);
-
-    // 检查模块注册器是否可用
-    if (!m_moduleRegistry) {
-      std::cout
-          << "[JSCExecutor] Error: ModuleRegistry not available for sync call"
-          << std::endl;
-      return JSValueMakeNull(m_context);
-    }
-
-    // 对于同步调用，我们需要立即获取结果
-    // 这里我们使用一个简化的实现：直接调用模块方法并等待结果
-
-    // 检查模块是否存在
-    if (!m_moduleRegistry->hasModule(moduleIdInt)) {
-      std::cout << "[JSCExecutor] Error: Module " << moduleIdInt
-                << " not found for sync call" << std::endl;
-      return JSValueMakeNull(m_context);
-    }
-
-    // 获取模块名称用于调试
-    std::string moduleName = m_moduleRegistry->getModuleName(moduleIdInt);
-    std::cout << "[JSCExecutor] Sync call to module: " << moduleName
-              << std::endl;
-
-    // 调用真实的模块实现（替换之前的 Mock 代码）
-    std::string result = m_moduleRegistry->callSerializableNativeHook(
-        moduleIdInt, methodIdInt, argsJson);
-
-    if (!result.empty()) {
-      std::cout << "[JSCExecutor] Sync method returned: " << result
-                << std::endl;
-      return stringToJSValue(result);
-    }
-
-    // 对于其他方法，返回错误
-    std::cout << "[JSCExecutor] Warning: Sync call not supported for "
-              << moduleName << "." << methodIdInt << std::endl;
-    return JSValueMakeNull(m_context);
-
-  } catch (const std::exception &e) {
-    std::cout << "[JSCExecutor] Error in nativeCallSyncHook: " << e.what()
-              << std::endl;
-    return JSValueMakeNull(m_context);
-  }
-}
-
-void JSCExecutor::processBridgeMessage(
-    const mini_rn::bridge::BridgeMessage &message) {
-  std::cout << "[JSCExecutor] Processing Bridge message with "
-            << message.getCallCount() << " calls" << std::endl;
-
-  // 验证消息格式
-  if (!message.isValid()) {
-    std::cout << "[JSCExecutor] Error: Invalid bridge message format"
-              << std::endl;
-    return;
-  }
-
-  // 处理每个模块调用
-  for (size_t i = 0; i < message.getCallCount(); i++) {
-    unsigned int moduleId = static_cast<unsigned int>(message.moduleIds[i]);
-    unsigned int methodId = static_cast<unsigned int>(message.methodIds[i]);
-    const std::string &params = message.params[i];
-    int callId = message.callbackIds[i];
-
-    std::cout << "[JSCExecutor] Call " << (i + 1) << "/"
-              << message.getCallCount() << ": Module=" << moduleId
-              << ", Method=" << methodId << ", Params=" << params
-              << ", CallId=" << callId << std::endl;
-
-    // 通过 ModuleRegistry 调用 Native 模块方法
-    if (m_moduleRegistry) {
-      m_moduleRegistry->callNativeMethod(moduleId, methodId, params, callId);
-    } else {
-      std::cout << "[JSCExecutor] Error: ModuleRegistry not initialized"
-                << std::endl;
-    }
-  }
-
-  std::cout << "[JSCExecutor] Bridge message processing completed" << std::endl;
-}
-
-void JSCExecutor::invokeCallback(int callId, const std::string &result,
-                                 bool isError) {
-  std::cout << "[JSCExecutor] Handling module callback - CallId: " << callId
-            << ", IsError: " << (isError ? "true" : "false")
-            << ", Result: " << result << std::endl;
-
-  try {
-    // 实现将结果返回给 JavaScript 的机制
-    // 调用 JavaScript 的 invokeCallbackAndReturnFlushedQueue 方法
-
-    // 获取全局 __fbBatchedBridge 对象
-    JSStringRef bridgeName = JSStringCreateWithUTF8CString("__fbBatchedBridge");
-    JSValueRef bridgeValue =
-        JSObjectGetProperty(m_context, m_globalObject, bridgeName, nullptr);
-    JSStringRelease(bridgeName);
-
-    if (!JSValueIsObject(m_context, bridgeValue)) {
-      std::cout << "[JSCExecutor] Warning: __fbBatchedBridge not available"
-                << std::endl;
-      return;
-    }
-
-    JSObjectRef bridgeObject = JSValueToObject(m_context, bridgeValue, nullptr);
-
-    // 获取 invokeCallbackAndReturnFlushedQueue 方法
-    JSStringRef methodName =
-        JSStringCreateWithUTF8CString("invokeCallbackAndReturnFlushedQueue");
-    JSValueRef methodValue =
-        JSObjectGetProperty(m_context, bridgeObject, methodName, nullptr);
-    JSStringRelease(methodName);
-
-    if (!JSValueIsObject(m_context, methodValue)) {
-      std::cout << "[JSCExecutor] Warning: invokeCallbackAndReturnFlushedQueue "
-                   "not available"
-                << std::endl;
-      return;
-    }
-
-    // 准备回调参数
-    // React Native 回调约定：第一个参数是错误，后续参数是结果
-    std::string argsJson;
-    if (isError) {
-      // 错误情况：[error]
-      argsJson = "[\"" + result + "\"]";
-    } else {
-      // 成功情况：[null, result]
-      // result 已经是 JSON 格式，不需要再加引号
-      argsJson = "[null, " + result + "]";
-    }
-
-    // 创建参数数组
-    JSValueRef arguments[2];
-    arguments[0] = JSValueMakeNumber(m_context, callId);  // callbackID
-
-    // 解析 JSON 参数
-    std::cout << "[JSCExecutor] Preparing callback args JSON: " << argsJson
-              << std::endl;
-    JSStringRef argsStr = JSStringCreateWithUTF8CString(argsJson.c_str());
-    JSValueRef argsValue = JSValueMakeFromJSONString(m_context, argsStr);
-    JSStringRelease(argsStr);
-
-    if (!argsValue) {
-      // JSON 解析失败，创建简单数组
-      std::cout << "[JSCExecutor] JSON parsing failed, creating simple array"
-                << std::endl;
-      JSValueRef simpleArgs[1];
-      simpleArgs[0] = stringToJSValue(result);
-      argsValue = JSObjectMakeArray(m_context, 1, simpleArgs, nullptr);
-    } else {
-      std::cout << "[JSCExecutor] JSON parsing successful" << std::endl;
-    }
-
-    arguments[1] = argsValue;  // args
-
-    // 调用 JavaScript 回调方法
-    JSValueRef exception = nullptr;
-    JSValueRef callResult =
-        JSObjectCallAsFunction(m_context, (JSObjectRef)methodValue,
-                               bridgeObject,  // thisObject
-                               2,             // argumentCount
-                               arguments,     // arguments
-                               &exception);
-
-    if (exception) {
-      handleJSException(exception);
-      std::cout << "[JSCExecutor] Error calling JavaScript callback"
-                << std::endl;
-    } else {
-      // 避免未使用变量的警告
-      (void)callResult;
-      std::cout << "[JSCExecutor] JavaScript callback executed successfully"
-                << std::endl;
-    }
-
-  } catch (const std::exception &e) {
-    std::cout << "[JSCExecutor] Error in handleModuleCallback: " << e.what()
-              << std::endl;
-  }
-}
-
-void JSCExecutor::injectModuleConfig() {
-  std::cout << "[JSCExecutor] Injecting module configuration..." << std::endl;
-
-  try {
-    // 获取所有注册的模块配置
-    if (!m_moduleRegistry) {
-      std::cout << "[JSCExecutor] Warning: ModuleRegistry not available"
-                << std::endl;
-      return;
-    }
-
-    // 创建 __fbBatchedBridgeConfig 对象
-    JSObjectRef bridgeConfig = JSObjectMake(m_context, nullptr, nullptr);
-
-    // 获取所有模块名称
-    auto moduleNames = m_moduleRegistry->moduleNames();
-
-    // 使用 ModuleRegistry::getConfig 获取每个模块的配置
-    std::vector<JSValueRef> moduleConfigs;
-    moduleConfigs.reserve(moduleNames.size());
-
-    for (const auto &moduleName : moduleNames) {
-      // 调用新的 getConfig 接口
-      mini_rn::modules::ModuleConfig config =
-          m_moduleRegistry->getConfig(moduleName, m_context);
-
-      if (config.index != SIZE_MAX && config.config != nullptr) {
-        moduleConfigs.push_back(config.config);
-        std::cout << "[JSCExecutor] Added config for module: " << moduleName
-                  << std::endl;
-      } else {
-        std::cout << "[JSCExecutor] Warning: Failed to get config for module: "
-                  << moduleName << std::endl;
-      }
-    }
-
-    // 创建 remoteModuleConfig 数组
-    JSValueRef remoteModuleConfigArray = JSObjectMakeArray(
-        m_context, moduleConfigs.size(),
-        moduleConfigs.empty() ? nullptr : moduleConfigs.data(), nullptr);
-
-    // 设置 remoteModuleConfig 属性
-    JSStringRef remoteModuleConfigKey =
-        JSStringCreateWithUTF8CString("remoteModuleConfig");
-    JSObjectSetProperty(m_context, bridgeConfig, remoteModuleConfigKey,
-                        remoteModuleConfigArray, kJSPropertyAttributeNone,
-                        nullptr);
-    JSStringRelease(remoteModuleConfigKey);
-
-    // 将 bridgeConfig 设置为 global.__fbBatchedBridgeConfig
-    JSStringRef bridgeConfigKey =
-        JSStringCreateWithUTF8CString("__fbBatchedBridgeConfig");
-    JSObjectSetProperty(m_context, m_globalObject, bridgeConfigKey,
-                        bridgeConfig, kJSPropertyAttributeNone, nullptr);
-    JSStringRelease(bridgeConfigKey);
-
-    std::cout << "[JSCExecutor] Module configuration injected successfully "
-                 "using ModuleRegistry::getConfig"
-              << std::endl;
-
-  } catch (const std::exception &e) {
-    std::cout << "[JSCExecutor] Error in injectModuleConfig: " << e.what()
-              << std::endl;
-  }
-}
-
-void JSCExecutor::refreshModuleConfig() {
-  std::cout << "[JSCExecutor] Refreshing module configuration..." << std::endl;
-
-  // 简单实现：重新注入模块配置
-  injectModuleConfig();
-
-  std::cout << "[JSCExecutor] Module configuration refreshed successfully"
-            << std::endl;
-}
-
-void JSCExecutor::registerModules(
-    std::vector<std::unique_ptr<mini_rn::modules::NativeModule>> modules) {
-  std::cout << "[JSCExecutor] Registering " << modules.size() << " module(s)..."
-            << std::endl;
-
-  if (!m_moduleRegistry) {
-    throw std::runtime_error("ModuleRegistry not initialized");
-  }
-
-  // 注册模块
-  m_moduleRegistry->registerModules(std::move(modules));
-
-  // 自动注入模块配置
-  injectModuleConfig();
-
-  std::cout << "[JSCExecutor] All modules registered and config injected"
-            << std::endl;
-}
-
 }  // namespace bridge
 }  // namespace mini_rn
\ No newline at end of file
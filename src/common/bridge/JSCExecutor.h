@@ -4,10 +4,10 @@
 #include <functional>
 #include <memory>
 #include <string>
-#include <unordered_map>
 #include <vector>
 
-#include "../modules/ModuleRegistry.h"
+#include "../utils/MappedFile.h"
+#include "JSExecutor.h"
 
 // 跨平台 JavaScript 引擎支持
 #ifdef __APPLE__
@@ -24,60 +24,22 @@ namespace mini_rn {
 namespace bridge {
 
 /**
- * Bridge 消息队列数据结构
- * 严格遵循 React Native 的消息格式：[moduleIds, methodIds, params, callbackIds]
- */
-struct BridgeMessage {
-  std::vector<int> moduleIds;       // 模块ID数组
-  std::vector<int> methodIds;       // 方法ID数组
-  std::vector<std::string> params;  // 参数数组（JSON字符串格式）
-  std::vector<int> callbackIds;     // 回调ID数组
-
-  // 获取调用数量
-  size_t getCallCount() const { return moduleIds.size(); }
-
-  // 验证消息格式是否正确
-  bool isValid() const {
-    return moduleIds.size() == methodIds.size() &&
-           methodIds.size() == params.size() &&
-           params.size() == callbackIds.size();
-  }
-};
-
-/**
- * 回调信息结构
- */
-struct CallbackInfo {
-  int callbackId;
-  // 为后续扩展预留字段
-  // std::function<void(const std::string&)> callback;
-};
-
-/**
- * 模块调用信息结构
- */
-struct ModuleCall {
-  int moduleId;
-  int methodId;
-  std::string params;  // JSON格式参数
-  int callbackId;
-};
-
-/**
- * JSCExecutor - JavaScript 执行器
+ * JSCExecutor - 基于 JavaScriptCore 的 JavaScript 执行器
  *
- * 这是 React Native Bridge 架构的核心组件，负责：
+ * 这是 JSExecutor 接口的 JavaScriptCore 后端，负责：
  * 1. JavaScript 环境管理 - 创建和维护 JavaScript 执行上下文
  * 2. 代码执行 - 执行 JavaScript 代码（应用代码、框架代码）
- * 3. Bridge 函数注入 - 向 JavaScript 环境注入 Native 通信函数
- * 4. 异常处理 - 捕获和处理 JavaScript 执行错误
+ * 3. 引擎原语 - 全局函数注入、函数调用、JSON 与 JSValue 之间的转换
+ * 4. 异常处理 - 捕获 JavaScript 异常并提取堆栈信息
+ *
+ * Bridge 逻辑（消息队列刷新、模块配置注入、回调返回）由 JSExecutor 基类实现。
  *
  * 设计原则：
  * - 严格遵循 React Native JSCExecutor 的接口设计
  * - 保持与 RN 的架构思路一致，实现细节可以简化
  * - 专注核心功能，暂时忽略复杂的优化
  */
-class JSCExecutor {
+class JSCExecutor : public JSExecutor {
  private:
   /**
    * JSXXX 都是 JavaScriptCore 的 API，一些是类型（如
@@ -91,86 +53,104 @@ class JSCExecutor {
   JSGlobalContextRef m_context;
   // JS 运行环境的全局对象 global
   JSObjectRef m_globalObject;
-  // 异常处理回调函数
-  std::function<void(const std::string &)> m_exceptionHandler;
-  // Native 模块注册器
-  std::unique_ptr<mini_rn::modules::ModuleRegistry> m_moduleRegistry;
+  // 以 NoCopy 方式交给引擎的脚本源码（UTF-16 镜像映射 / 堆上展宽缓冲区）
+  // 引擎可能在执行后继续引用源码（惰性编译、Function.prototype.toString），
+  // 必须保持到上下文销毁
+  std::vector<std::unique_ptr<mini_rn::utils::MappedFile>> m_scriptImages;
+  std::vector<std::unique_ptr<JSChar[]>> m_scriptBuffers;
+  // UTF-16 镜像缓存所在目录，为空时只在内存中展宽
+  std::string m_imageCacheDirectory;
 
  public:
-  JSCExecutor();
-  ~JSCExecutor();
-
-  // 禁用拷贝构造和赋值
-  JSCExecutor(const JSCExecutor &) = delete;
-  JSCExecutor &operator=(const JSCExecutor &) = delete;
-
   /**
-   * 加载并执行 JavaScript 应用代码
-   * @param script JavaScript 代码内容
-   * @param sourceURL 代码来源 URL（用于调试）
+   * @param scriptCache 预编译脚本缓存：启用后以 JSScriptRef 缓存解析结果。
+   *        JSScriptRef 只能在创建它的上下文组（VM）内执行，所以共享同一个
+   *        ScriptCache 的执行器加入该缓存的上下文组，共享一个 VM：
+   *        复用编译结果，代价是共用堆和 GC（一个执行器的垃圾回收会停顿
+   *        所有执行器），且 VM 的锁让它们在不同线程上也不能同时执行 JS。
+   *        需要隔离的执行器使用各自的 ScriptCache（或不启用缓存）。
+   *        JSC 的 C API 不提供字节码序列化，缓存目录对本后端不生效
    */
+  explicit JSCExecutor(std::shared_ptr<ScriptCache> scriptCache = nullptr);
+  ~JSCExecutor() override;
+
+  // JSExecutor 引擎原语实现
+  JSEngineType getEngineType() const override {
+    return JSEngineType::JavaScriptCore;
+  }
+  const char *getEngineName() const override { return "JavaScriptCore"; }
+
   void loadApplicationScript(const std::string &script,
-                             const std::string &sourceURL = "");
+                             const std::string &sourceURL = "") override;
 
-  /**
-   * 设置 JavaScript 异常处理器
-   * @param handler 异常处理回调函数
-   */
-  void setJSExceptionHandler(std::function<void(const std::string &)> handler);
+  void installGlobalFunction(const std::string &name,
+                             HostFunction function) override;
+
+  JSCallStatus callGlobalMethod(const std::string &objectName,
+                                const std::string &methodName,
+                                const std::string &argsJson,
+                                std::string *resultJson = nullptr) override;
+
+  JSCallStatus callGlobalMethodWithArgs(
+      const std::string &objectName, const std::string &methodName,
+      const mini_rn::utils::Value &args,
+      std::string *resultJson = nullptr) override;
+
+  bool setGlobalValue(const std::string &name, const std::string &json,
+                      bool readOnly = false) override;
+
+  void destroy() override;
 
   /**
-   * 向 JavaScript 环境注入全局函数
+   * 向 JavaScript 环境注入原生 JavaScriptCore 回调函数（用于高级操作）
    * @param name 函数名称
    * @param callback Native 回调函数
    */
   void installGlobalFunction(const std::string &name,
                              JSObjectCallAsFunctionCallback callback);
 
-  /**
-   * 销毁 JavaScript 执行环境
-   */
-  void destroy();
-
   /**
    * 获取 JavaScript 上下文（用于高级操作）
    */
   JSGlobalContextRef getContext() const { return m_context; }
 
   /**
-   * 获取模块注册器
-   * 用于注册 Native 模块和管理模块调用
-   * @return 模块注册器指针
+   * 设置 UTF-16 镜像缓存的目录（默认 $TMPDIR/mini_rn_jsc_images-<uid>），
+   * 应用可以改为自己的缓存目录；为空时不写磁盘，每次在内存中展宽。
+   * 目录不属于当前用户或其他用户可写时不使用（同样在内存中展宽）
    */
-  mini_rn::modules::ModuleRegistry *getModuleRegistry() {
-    return m_moduleRegistry.get();
+  void setImageCacheDirectory(std::string directory) {
+    m_imageCacheDirectory = std::move(directory);
   }
 
+ protected:
+  void evaluateSourceBuffer(const char *source, size_t length,
+                            const std::string &sourceURL) override;
+
   /**
-   * 重新注入模块配置
-   * 在模块注册完成后调用，更新 JavaScript 环境中的模块配置
+   * 从映射区加载 bundle（零拷贝路径）
+   * - 纯 ASCII bundle：在镜像缓存目录生成 UTF-16 镜像并映射，
+   *   通过 JSStringCreateWithCharactersNoCopy 直接交给引擎
+   * - 其他 bundle：交给 JSStringCreateWithUTF8CString 解码
    */
-  void refreshModuleConfig();
+  void loadMappedScript(const mini_rn::utils::MappedFile &file,
+                        const std::string &sourceURL) override;
 
   /**
-   * 注册模块并自动注入配置
-   * @param modules 要注册的模块列表
+   * JSGarbageCollect；启用脚本缓存时上下文组共享一个 VM，回收整个 VM
    */
-  void registerModules(std::vector<std::unique_ptr<mini_rn::modules::NativeModule>> modules);
+  void performGarbageCollection() override;
 
   /**
-   * 注入模块配置到 JavaScript 环境
-   * 创建 __fbBatchedBridgeConfig 全局对象，包含所有已注册模块的配置信息
+   * 通过 JSGetMemoryUsageStatistics 读取 heapSize / heapCapacity /
+   * protectedObjectCount（JSValueProtect 保护的对象，整个 VM 的计数）
    */
-  void injectModuleConfig();
+  void queryHeapUsage(MemoryStats &stats) const override;
 
   /**
-   * 处理模块调用回调
-   * 将 Native 模块的执行结果返回给 JavaScript
-   * @param callId 调用标识符
-   * @param result 执行结果（JSON格式）
-   * @param isError 是否为错误结果
+   * JSReportExtraMemoryCost：ArrayBuffer 引用的 Native 内存计入 GC 的分配量
    */
-  void invokeCallback(int callId, const std::string &result, bool isError);
+  void reportExtraMemoryCost(size_t bytes) override;
 
  private:
   /**
@@ -183,81 +163,76 @@ class JSCExecutor {
    */
   void setupGlobalObjects();
 
-
   /**
-   * 给 JS 注入 React Native Bridge 的核心函数
+   * 通过脚本缓存执行：命中时直接执行缓存的 JSScriptRef，跳过解析
    */
-  void installBridgeFunctions();
+  void evaluateCachedScript(const char *source, size_t length,
+                            const std::string &sourceURL);
 
   /**
-   * 处理 JavaScript 异常
+   * 执行已创建好的脚本字符串
    */
-  void handleJSException(JSValueRef exception);
+  void evaluateScript(JSStringRef script, const std::string &sourceURL);
 
   /**
-   * JSValue 和 C++ 类型之间的转换工具
+   * 获取 bundle 的 UTF-16 镜像（磁盘缓存优先，目录不可用或写入失败时
+   * 在堆上展宽）
+   * 返回的缓冲区由本执行器持有，直到 destroy()
    */
-  std::string jsValueToString(JSValueRef value);
-  JSValueRef stringToJSValue(const std::string &str);
+  const JSChar *acquireWidenedImage(const mini_rn::utils::MappedFile &source);
 
   /**
-   * JSValue 到 JSON 字符串转换（对齐 React Native 实现）
-   * 这个方法模拟 RN 中的 JSValueToJSONString 功能
-   * @param value JavaScript 值（通常是数组或对象）
-   * @return JSON 格式的字符串表示
+   * 查找 global[objectName][methodName]，不存在或不是函数时返回 NotFound
    */
-  std::string jsValueToJSONString(JSValueRef value);
+  JSCallStatus findGlobalMethod(const std::string &objectName,
+                                const std::string &methodName,
+                                JSObjectRef *object, JSObjectRef *method);
 
   /**
-   * Native Bridge 函数实现（对齐RN架构）
-   * 这些方法对应RN中JSCExecutor的Bridge函数，从静态回调中调用
+   * 以 object 为 this 调用 method，异常时上报并返回 Exception
    */
+  JSCallStatus callMethod(JSObjectRef object, JSObjectRef method,
+                          const std::vector<JSValueRef> &arguments,
+                          std::string *resultJson);
 
   /**
-   * 处理来自JavaScript的队列刷新请求
-   * 对齐React Native实现：JSCExecutor::nativeFlushQueueImmediate
-   * @param queue JavaScript传递的队列数组 [moduleIds, methodIds, params,
-   * callbackIds]
+   * 处理 JavaScript 异常
    */
-  void nativeFlushQueueImmediate(JSValueRef queue);
+  void handleJSException(JSValueRef exception);
 
   /**
-   * 处理来自JavaScript的日志请求
-   * 对齐React Native实现：JSCExecutor::nativeLoggingHook
-   * @param level 日志级别
-   * @param message 日志消息
+   * JSValue 和 C++ 类型之间的转换工具
    */
-  void nativeLoggingHook(JSValueRef level, JSValueRef message);
+  std::string jsValueToString(JSValueRef value);
+  JSValueRef stringToJSValue(const std::string &str);
 
   /**
-   * 处理来自JavaScript的同步调用请求
-   * 对齐React Native实现：JSCExecutor::nativeCallSyncHook
-   * @param moduleID 模块ID
-   * @param methodID 方法ID
-   * @param args 参数数组
-   * @return 同步调用的结果
+   * 类型化值直接构造为 JS 值（JSValueMakeNumber、JSObjectMakeArray……）
    */
-  JSValueRef nativeCallSyncHook(JSValueRef moduleID, JSValueRef methodID,
-                                JSValueRef args);
+  JSValueRef valueToJSValue(const mini_rn::utils::Value &value);
 
   /**
-   * 静态实例管理（用于静态回调访问实例方法）
+   * JSValue 到 JSON 字符串转换（对齐 React Native 实现）
+   * 这个方法模拟 RN 中的 JSValueToJSONString 功能
+   * @param value JavaScript 值（通常是数组或对象）
+   * @return JSON 格式的字符串表示
    */
-  static JSCExecutor *getCurrentInstance();
+  std::string jsValueToJSONString(JSValueRef value);
 
   /**
-   * 静态实例指针（简化的实例管理）
+   * 宿主函数的 JSClass（callAsFunction + finalize），
+   * 通过对象私有数据保存 HostFunction，所有实例共享
    */
-  static JSCExecutor *s_currentInstance;
+  static JSClassRef getHostFunctionClass();
 
   /**
-   * 处理Bridge消息（从JSON解析后的消息）
-   * @param message 解析后的Bridge消息
+   * 脚本缓存绑定的上下文组，共享该缓存的执行器在同一个组内创建上下文
+   * 返回的引用同时持有组；JSScriptRef 的删除器持有它，组在脚本之后释放
    */
-  void processBridgeMessage(const mini_rn::bridge::BridgeMessage &message);
+  std::shared_ptr<void> getCacheContextGroup() const;
 };
 
 }  // namespace bridge
 }  // namespace mini_rn
 
-#endif  // JSCEXECUTOR_H
\ No newline at end of file
+#endif  // JSCEXECUTOR_H
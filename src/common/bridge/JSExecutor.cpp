@@ -0,0 +1,909 @@
+#include "JSExecutor.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <iostream>
+#include <iterator>
+#include <stdexcept>
+
+#include "../utils/JSONParser.h"
+#include "../utils/Logging.h"
+#include "../utils/MappedFile.h"
+
+namespace mini_rn {
+namespace bridge {
+
+JSExecutor::JSExecutor(std::shared_ptr<ScriptCache> scriptCache)
+    : m_scriptCache(std::move(scriptCache)) {
+  // 初始化模块注册器
+  m_moduleRegistry = std::make_unique<mini_rn::modules::ModuleRegistry>();
+
+  // 设置模块回调处理器
+  bool callbackSet = m_moduleRegistry->setCallbackHandler(
+      [this](int callId, const mini_rn::utils::Value &result, bool isError) {
+        this->invokeCallback(callId, result, isError);
+      });
+
+  if (!callbackSet) {
+    throw std::runtime_error(
+        "Failed to set callback handler in ModuleRegistry");
+  }
+
+  // 设置 JS 函数调用处理器（模块主动推送事件）
+  m_moduleRegistry->setJSCallHandler(
+      [this](const std::string &module, const std::string &method,
+             const std::string &argsJson) {
+        this->callFunction(module, method, argsJson);
+      });
+}
+
+bool JSExecutor::loadApplicationScriptFromFile(const std::string &path) {
+  mini_rn::utils::MappedFile file;
+  if (!file.open(path)) {
+    std::cout << "[JSExecutor] Error: Cannot open script file: " << path
+              << std::endl;
+    return false;
+  }
+
+  if (RAMBundle::isRAMBundle(file)) {
+    return loadRAMBundle(std::move(file), path);
+  }
+
+  loadMappedScript(file, path);
+  return true;
+}
+
+void JSExecutor::loadMappedScript(const mini_rn::utils::MappedFile &file,
+                                  const std::string &sourceURL) {
+  if (file.isNullTerminated()) {
+    evaluateSourceBuffer(file.data(), file.size(), sourceURL);
+  } else {
+    // 文件长度恰好是页大小整数倍（或为空）时，补一份结尾符
+    std::string script(file.data() ? file.data() : "", file.size());
+    evaluateSourceBuffer(script.c_str(), script.length(), sourceURL);
+  }
+}
+
+bool JSExecutor::loadRAMBundle(mini_rn::utils::MappedFile file,
+                               const std::string &sourceURL) {
+  try {
+    m_ramBundle = std::make_unique<RAMBundle>(std::move(file));
+  } catch (const std::exception &e) {
+    std::cout << "[JSExecutor] Error: Invalid RAM bundle " << sourceURL << ": "
+              << e.what() << std::endl;
+    return false;
+  }
+
+  MINI_RN_LOG(INFO, "[JSExecutor] Loaded RAM bundle with "
+              << m_ramBundle->getModuleCount() << " modules");
+
+  // 按需加载入口，对齐 RN：JS 端 require 未定义的模块时调用
+  if (!m_nativeRequireInstalled) {
+    installGlobalFunction(
+        "nativeRequire", [this](const JSArguments &args) -> std::string {
+          if (args.size() != 1) {
+            std::cout << "[Bridge] Error: Expected 1 argument (moduleId), got "
+                      << args.size() << std::endl;
+            return "";
+          }
+          // 任何脚本都能调用：NaN、负数、小数或超出 uint32 的值直接拒绝，
+          // 不能转换为 uint32_t
+          double moduleId = args.getNumber(0);
+          if (!std::isfinite(moduleId) || moduleId < 0 ||
+              moduleId > static_cast<double>(UINT32_MAX) ||
+              std::floor(moduleId) != moduleId) {
+            std::cout << "[Bridge] Error: Invalid moduleId for nativeRequire: "
+                      << moduleId << std::endl;
+            return "";
+          }
+          nativeRequire(static_cast<uint32_t>(moduleId));
+          return "";
+        });
+    m_nativeRequireInstalled = true;
+  }
+
+  RAMBundle::Code startupCode = m_ramBundle->getStartupCode();
+  evaluateSourceBuffer(startupCode.data, startupCode.length, sourceURL);
+  return true;
+}
+
+void JSExecutor::nativeRequire(uint32_t moduleId) {
+  if (!m_ramBundle) {
+    std::cout << "[JSExecutor] Error: nativeRequire called without RAM bundle"
+              << std::endl;
+    return;
+  }
+
+  try {
+    RAMBundle::Code code = m_ramBundle->getModule(moduleId);
+    // 与 RN 一致，按需加载的模块以 "<moduleId>.js" 作为 sourceURL
+    evaluateSourceBuffer(code.data, code.length,
+                         std::to_string(moduleId) + ".js");
+  } catch (const std::exception &e) {
+    // 模块未定义时由 JS 端的 require 抛出 "Requiring unknown module"
+    std::cout << "[JSExecutor] Error in nativeRequire: " << e.what()
+              << std::endl;
+  }
+}
+
+void JSExecutor::initializeRuntime() {
+  // 设置 __DEV__ 标志（开发模式标识），由构建类型决定，见 utils/Logging.h
+  setGlobalValue("__DEV__", MINI_RN_DEV ? "true" : "false", true);
+
+  // Console 对象现在通过 JavaScript 端的 console.js 提供
+  // 使用 nativeLoggingHook 进行实际的日志输出
+
+  // 注入 Bridge 通信函数
+  installBridgeFunctions();
+
+  // 注意：模块配置注入延迟到模块注册后
+  // injectModuleConfig() 将在 ModuleRegistry::registerModules() 后调用
+}
+
+void JSExecutor::installBridgeFunctions() {
+  // 注入关键的 Bridge 通信函数
+  // 这个函数是 React Native MessageQueue 调用 Native 的核心接口
+  // 完全对齐 RN 实现：nativeFlushQueueImmediate(queue)，其中 queue =
+  // [moduleIds, methodIds, params, callbackIds]
+  installGlobalFunction(
+      "nativeFlushQueueImmediate",
+      [this](const JSArguments &args) -> std::string {
+        MINI_RN_LOG(DEBUG, "[Bridge] nativeFlushQueueImmediate called with "
+                    << args.size()
+                    << " arguments (RN-compatible single parameter)");
+
+        try {
+          // 验证参数数量（对齐RN：单个queue参数）
+          if (args.size() != 1) {
+            std::cout
+                << "[Bridge] Error: Expected 1 argument (queue array), got "
+                << args.size() << std::endl;
+            return "";
+          }
+
+          // Step 1: JSValue -> JSON字符串 (对齐RN: queue.toJSONString())
+          nativeFlushQueueImmediate(args.getJSONString(0));
+
+        } catch (const std::exception &e) {
+          std::cout << "[Bridge] Exception in host function: " << e.what()
+                    << std::endl;
+        } catch (...) {
+          std::cout << "[Bridge] Unknown exception in host function"
+                    << std::endl;
+        }
+
+        return "";
+      });
+
+  // 注入日志函数
+  installGlobalFunction(
+      "nativeLoggingHook", [this](const JSArguments &args) -> std::string {
+        try {
+          if (args.size() >= 2) {
+            nativeLoggingHook(args.getString(0), args.getString(1));
+          } else {
+            std::cout << "[Bridge] Warning: nativeLoggingHook called with "
+                         "insufficient arguments"
+                      << std::endl;
+          }
+
+        } catch (const std::exception &e) {
+          std::cout << "[Bridge] Exception in logging callback: " << e.what()
+                    << std::endl;
+        }
+
+        return "";
+      });
+
+  // 注入同步调用函数 (React Native 标准)
+  installGlobalFunction(
+      "nativeCallSyncHook", [this](const JSArguments &args) -> std::string {
+        MINI_RN_LOG(DEBUG, "[Bridge] nativeCallSyncHook called with "
+                    << args.size() << " arguments");
+
+        try {
+          // 验证参数数量：moduleID, methodID, args
+          if (args.size() != 3) {
+            std::cout << "[Bridge] Error: Expected 3 arguments (moduleID, "
+                         "methodID, args), got "
+                      << args.size() << std::endl;
+            return "";
+          }
+
+          // 将参数转换为C++类型
+          unsigned int moduleId =
+              static_cast<unsigned int>(args.getNumber(0));
+          unsigned int methodId =
+              static_cast<unsigned int>(args.getNumber(1));
+
+          // 调用实例方法处理同步调用
+          return nativeCallSyncHook(moduleId, methodId, args.getJSONString(2));
+
+        } catch (const std::exception &e) {
+          std::cout << "[Bridge] Exception in sync callback: " << e.what()
+                    << std::endl;
+        }
+
+        return "";
+      });
+
+  // 注入内存统计查询函数（同步返回 MemoryStats 对象）
+  installGlobalFunction(
+      "nativeGetMemoryStats",
+      [this](const JSArguments & /* args */) -> std::string {
+        return nativeGetMemoryStats();
+      });
+}
+
+void JSExecutor::setJSExceptionHandler(
+    std::function<void(const std::string &)> handler) {
+  m_exceptionHandler = handler;
+}
+
+void JSExecutor::reportJSException(const std::string &message,
+                                   const std::string &stackTrace) {
+  std::cout << "[JSExecutor] JavaScript Exception: " << message << std::endl;
+
+  if (!stackTrace.empty()) {
+    std::cout << "Stack Trace:" << std::endl;
+    std::cout << stackTrace << std::endl;
+  }
+
+  if (m_exceptionHandler) {
+    // 如果有堆栈信息，将堆栈信息也包含在内
+    m_exceptionHandler(stackTrace.empty()
+                           ? message
+                           : message + "\nStack Trace:\n" + stackTrace);
+  }
+}
+
+// === Bridge 成员方法实现（对齐RN架构）===
+
+void JSExecutor::nativeFlushQueueImmediate(const std::string &queueJson) {
+  MINI_RN_LOG(DEBUG,
+              "[JSExecutor] nativeFlushQueueImmediate called, JSON length: "
+                  << queueJson.length());
+
+  try {
+    // Step 2: JSON字符串 -> 值树 (替代 folly::parseJson)
+    // Step 3: 处理消息 (替代 m_delegate->callNativeModules)
+    processQueue(queueJson);
+
+  } catch (const std::exception &e) {
+    std::cout << "[JSExecutor] Error in nativeFlushQueueImmediate: "
+              << e.what() << std::endl;
+  }
+}
+
+void JSExecutor::nativeLoggingHook(const std::string &level,
+                                   const std::string &message) {
+  std::cout << "[" << level << "] " << message << std::endl;
+}
+
+std::string JSExecutor::nativeCallSyncHook(unsigned int moduleId,
+                                           unsigned int methodId,
+                                           const std::string &argsJson) {
+  MINI_RN_LOG(DEBUG, "[JSExecutor] Sync call - Module: " << moduleId
+              << ", Method: " << methodId);
+
+  // 检查模块注册器是否可用
+  if (!m_moduleRegistry) {
+    std::cout
+        << "[JSExecutor] Error: ModuleRegistry not available for sync call"
+        << std::endl;
+    return "null";
+  }
+
+  // 检查模块是否存在
+  if (!m_moduleRegistry->hasModule(moduleId)) {
+    std::cout << "[JSExecutor] Error: Module " << moduleId
+              << " not found for sync call" << std::endl;
+    return "null";
+  }
+
+  // 获取模块名称用于调试
+  std::string moduleName = m_moduleRegistry->getModuleName(moduleId);
+  MINI_RN_LOG(DEBUG, "[JSExecutor] Sync call to module: " << moduleName);
+
+  std::string result =
+      m_moduleRegistry->callSerializableNativeHook(moduleId, methodId, argsJson);
+
+  if (!result.empty()) {
+    MINI_RN_LOG(DEBUG, "[JSExecutor] Sync method returned: " << result);
+    // 同步方法直接返回 JSON 文本，由引擎解析为 JS 值
+    return result;
+  }
+
+  // 对于其他方法，返回错误
+  std::cout << "[JSExecutor] Warning: Sync call not supported for "
+            << moduleName << "." << methodId << std::endl;
+  return "null";
+}
+
+void JSExecutor::processQueue(const std::string &queueJson) {
+  if (m_queueDepth == m_queueSlots.size()) {
+    m_queueSlots.push_back(std::make_unique<QueueSlot>());
+  }
+  QueueSlot &slot = *m_queueSlots[m_queueDepth];
+  if (!slot.document.parse(queueJson)) {
+    std::cout << "[JSExecutor] Error: Invalid bridge queue JSON: "
+              << slot.document.getError() << std::endl;
+    return;
+  }
+
+  size_t blockAllocations = slot.arena.getStats().blockAllocations;
+  {
+    BridgeMessage message(slot.arena);
+    if (!buildBridgeMessage(slot.document.root(), message)) {
+      std::cout << "[JSExecutor] Error: Invalid bridge message format"
+                << std::endl;
+      slot.arena.reset();
+      return;
+    }
+
+    m_flushStats.flushes++;
+    m_flushStats.calls += message.getCallCount();
+    m_flushStats.lastFlushBytes = slot.arena.getStats().used;
+    m_flushStats.lastFlushArenaAllocations =
+        slot.arena.getStats().blockAllocations - blockAllocations;
+    m_flushStats.arenaAllocations += m_flushStats.lastFlushArenaAllocations;
+
+    // 处理期间模块调用可能嵌套刷新队列，内层使用下一层的存储
+    struct DepthGuard {
+      size_t &depth;
+      explicit DepthGuard(size_t &value) : depth(value) { depth++; }
+      ~DepthGuard() { depth--; }
+    } guard(m_queueDepth);
+    processBridgeMessage(message);
+  }
+  slot.arena.reset();
+}
+
+bool JSExecutor::buildBridgeMessage(const mini_rn::utils::JSONValue &queue,
+                                    BridgeMessage &message) {
+  using mini_rn::utils::JSONValue;
+
+  JSONValue moduleIds = queue[0];
+  JSONValue methodIds = queue[1];
+  JSONValue params = queue[2];
+  JSONValue callbackIds = queue[3];
+  JSONValue priorities = queue[4];
+  size_t callCount = moduleIds.size();
+
+  // 验证消息格式：四个等长的数组
+  if (!moduleIds.isArray() || !methodIds.isArray() || !params.isArray() ||
+      !callbackIds.isArray() || methodIds.size() != callCount ||
+      params.size() != callCount || callbackIds.size() != callCount) {
+    return false;
+  }
+
+  // 调用数已知，每个数组只分配一次
+  message.moduleIds.reserve(callCount);
+  message.methodIds.reserve(callCount);
+  message.params.reserve(callCount);
+  message.callbackIds.reserve(callCount);
+  message.args.reserve(callCount);
+
+  for (JSONValue moduleId : moduleIds) {
+    message.moduleIds.push_back(moduleId.asInt());
+  }
+  for (JSONValue methodId : methodIds) {
+    message.methodIds.push_back(methodId.asInt());
+  }
+  for (JSONValue args : params) {
+    message.params.push_back(args.raw());
+    message.args.push_back(args);
+  }
+  for (JSONValue callbackId : callbackIds) {
+    // callbackId 为 null 表示没有回调
+    message.callbackIds.push_back(callbackId.isNumber() ? callbackId.asInt()
+                                                        : -1);
+  }
+  // 可选的优先级数组，长度不符时忽略（所有调用使用默认通道）
+  if (priorities.isArray() && priorities.size() == callCount) {
+    message.priorities.reserve(callCount);
+    for (JSONValue priority : priorities) {
+      message.priorities.push_back(priority.isNumber() ? priority.asInt() : -1);
+    }
+  }
+  return true;
+}
+
+void JSExecutor::processBridgeMessage(const BridgeMessage &message) {
+  using mini_rn::modules::CallPriority;
+  using mini_rn::modules::kCallPriorityCount;
+
+  size_t callCount = message.getCallCount();
+  MINI_RN_LOG(DEBUG, "[JSExecutor] Processing Bridge message with "
+              << callCount << " calls");
+
+  if (!m_moduleRegistry) {
+    std::cout << "[JSExecutor] Error: ModuleRegistry not initialized"
+              << std::endl;
+    return;
+  }
+
+  // 没有任何优先级时所有调用都在 Normal 通道，按入队顺序直接派发
+  if (message.priorities.empty() && !m_moduleRegistry->hasMethodPriorities()) {
+    for (size_t i = 0; i < callCount; i++) {
+      dispatchCall(message, i);
+    }
+    m_laneStats.dispatched[static_cast<size_t>(CallPriority::Normal)] +=
+        callCount;
+    std::fill(std::begin(m_laneStats.lastFlushDepth),
+              std::end(m_laneStats.lastFlushDepth), 0);
+    m_laneStats.lastFlushDepth[static_cast<size_t>(CallPriority::Normal)] =
+        callCount;
+  } else {
+    // 每个调用的通道：显式优先级优先，否则用方法的默认通道
+    mini_rn::utils::ArenaVector<uint8_t> lanes(
+        message.moduleIds.get_allocator());
+    lanes.reserve(callCount);
+    size_t depth[kCallPriorityCount] = {};
+    for (size_t i = 0; i < callCount; i++) {
+      int priority = message.priorities.empty() ? -1 : message.priorities[i];
+      if (priority < 0 || priority >= static_cast<int>(kCallPriorityCount)) {
+        priority = static_cast<int>(m_moduleRegistry->getMethodPriority(
+            static_cast<unsigned int>(message.moduleIds[i]),
+            static_cast<unsigned int>(message.methodIds[i])));
+      }
+      lanes.push_back(static_cast<uint8_t>(priority));
+      depth[priority]++;
+    }
+    std::copy(std::begin(depth), std::end(depth),
+              std::begin(m_laneStats.lastFlushDepth));
+
+    size_t background = static_cast<size_t>(CallPriority::Background);
+    for (size_t lane = 0; lane < background; lane++) {
+      if (depth[lane] == 0) continue;
+      for (size_t i = 0; i < callCount; i++) {
+        if (lanes[i] == lane) dispatchCall(message, i);
+      }
+      m_laneStats.dispatched[lane] += depth[lane];
+    }
+
+    if (depth[background] > 0) {
+      for (size_t i = 0; i < callCount; i++) {
+        if (lanes[i] != background) continue;
+        m_backgroundCalls.push_back(
+            DeferredCall{static_cast<unsigned int>(message.moduleIds[i]),
+                         static_cast<unsigned int>(message.methodIds[i]),
+                         std::string(message.params[i]),
+                         message.callbackIds[i]});
+        m_backgroundBytes += message.params[i].size();
+      }
+      m_laneStats.backgroundDeferred += depth[background];
+    }
+  }
+
+  for (size_t lane = 0; lane < kCallPriorityCount; lane++) {
+    m_laneStats.maxFlushDepth[lane] = std::max(
+        m_laneStats.maxFlushDepth[lane], m_laneStats.lastFlushDepth[lane]);
+  }
+
+  // 批次结束，让需要原子提交的模块统一提交
+  m_moduleRegistry->onBatchComplete();
+
+  dropBackgroundCalls(m_maxBackgroundCalls, "background lane is full");
+  updateBackpressure();
+
+  MINI_RN_LOG(DEBUG, "[JSExecutor] Bridge message processing completed");
+}
+
+void JSExecutor::dispatchCall(const BridgeMessage &message, size_t index) {
+  unsigned int moduleId = static_cast<unsigned int>(message.moduleIds[index]);
+  unsigned int methodId = static_cast<unsigned int>(message.methodIds[index]);
+  int callId = message.callbackIds[index];
+
+  MINI_RN_LOG(DEBUG, "[JSExecutor] Call " << (index + 1) << "/"
+              << message.getCallCount() << ": Module=" << moduleId
+              << ", Method=" << methodId << ", Params=" << message.params[index]
+              << ", CallId=" << callId);
+
+  // 通过 ModuleRegistry 调用 Native 模块方法
+  if (!message.args.empty()) {
+    m_moduleRegistry->callNativeMethod(moduleId, methodId, message.args[index],
+                                       callId);
+  } else {
+    m_moduleRegistry->callNativeMethod(
+        moduleId, methodId, std::string(message.params[index]), callId);
+  }
+}
+
+void JSExecutor::drainBackgroundCalls(size_t limit) {
+  if (m_backgroundCalls.empty() || !m_moduleRegistry) return;
+
+  size_t count = std::min(limit, m_backgroundCalls.size());
+  for (size_t i = 0; i < count && !m_backgroundCalls.empty(); i++) {
+    // 先出队再调用：模块回调可能再次刷新队列并追加 Background 调用
+    DeferredCall call = std::move(m_backgroundCalls.front());
+    m_backgroundCalls.pop_front();
+    m_backgroundBytes -= call.params.size();
+    MINI_RN_LOG(DEBUG, "[JSExecutor] Background call: Module="
+                << call.moduleId << ", Method=" << call.methodId
+                << ", CallId=" << call.callId);
+    m_moduleRegistry->callNativeMethod(call.moduleId, call.methodId,
+                                       call.params, call.callId);
+    m_laneStats.dispatched[static_cast<size_t>(
+        mini_rn::modules::CallPriority::Background)]++;
+  }
+  m_moduleRegistry->onBatchComplete();
+}
+
+void JSExecutor::dropBackgroundCalls(size_t maxQueued, const char *reason) {
+  while (m_backgroundCalls.size() > maxQueued) {
+    DeferredCall call = std::move(m_backgroundCalls.front());
+    m_backgroundCalls.pop_front();
+    m_backgroundBytes -= call.params.size();
+    m_laneStats.backgroundDropped++;
+    if (call.callId >= 0 && m_moduleRegistry) {
+      m_moduleRegistry->sendErrorCallback(
+          call.callId, std::string("Call dropped: ") + reason);
+    }
+  }
+}
+
+void JSExecutor::updateBackpressure() {
+  BackpressureStats stats = getBackpressureStats();
+  const BackpressureLimits &limits = m_backpressureLimits;
+  bool active = m_backpressure;
+  if (!active) {
+    active = stats.pendingCalls >= limits.highWatermarkCalls ||
+             stats.pendingBytes >= limits.highWatermarkBytes;
+  } else {
+    active = stats.pendingCalls > limits.lowWatermarkCalls ||
+             stats.pendingBytes > limits.lowWatermarkBytes;
+  }
+  if (active == m_backpressure) return;
+
+  // 先更新状态再通知：JS 处理通知时可能再次进入这里
+  m_backpressure = active;
+  if (active) {
+    m_backpressureActivations++;
+    std::cout << "[JSExecutor] Warning: backpressure on, "
+              << stats.pendingCalls << " calls / " << stats.pendingBytes
+              << " bytes pending" << std::endl;
+  } else {
+    MINI_RN_LOG(INFO, "[JSExecutor] Backpressure off, "
+                << stats.pendingCalls << " calls / " << stats.pendingBytes
+                << " bytes pending");
+  }
+  callGlobalMethodWithArgs("__fbBatchedBridge", "setBackpressure",
+                           mini_rn::utils::Value::array({active}));
+}
+
+void JSExecutor::setBackpressureLimits(const BackpressureLimits &limits) {
+  m_backpressureLimits = limits;
+  updateBackpressure();
+}
+
+JSExecutor::BackpressureStats JSExecutor::getBackpressureStats() const {
+  BackpressureStats stats;
+  stats.active = m_backpressure;
+  stats.activations = m_backpressureActivations;
+  stats.pendingCalls = m_backgroundCalls.size();
+  stats.pendingBytes = m_backgroundBytes;
+  if (m_moduleRegistry) {
+    stats.pendingCalls += m_moduleRegistry->getPendingCallCount();
+    stats.pendingBytes += m_moduleRegistry->getPendingCallBytes();
+  }
+  return stats;
+}
+
+JSExecutor::LaneStats JSExecutor::getLaneStats() const {
+  LaneStats stats = m_laneStats;
+  stats.backgroundDepth = m_backgroundCalls.size();
+  return stats;
+}
+
+void JSExecutor::setBackgroundLaneLimits(size_t maxQueued, size_t maxPerTick) {
+  m_maxBackgroundCalls = maxQueued;
+  m_backgroundCallsPerTick = maxPerTick;
+  dropBackgroundCalls(m_maxBackgroundCalls, "background lane is full");
+}
+
+void JSExecutor::invokeCallback(int callId,
+                                const mini_rn::utils::Value &result,
+                                bool isError) {
+  MINI_RN_LOG(DEBUG, "[JSExecutor] Handling module callback - CallId: "
+              << callId << ", IsError: " << (isError ? "true" : "false"));
+
+  // React Native 回调约定：第一个参数是错误，后续参数是结果
+  // 错误：[error]，成功：[null, result]
+  using mini_rn::utils::Value;
+  Value callbackArgs =
+      isError ? Value::array({result}) : Value::array({nullptr, result});
+
+  // 调用 JavaScript 的 invokeCallbackAndReturnFlushedQueue(callbackID, args)
+  std::string resultJson;
+  JSCallStatus status = callGlobalMethodWithArgs(
+      "__fbBatchedBridge", "invokeCallbackAndReturnFlushedQueue",
+      Value::array({callId, std::move(callbackArgs)}), &resultJson);
+
+  switch (status) {
+    case JSCallStatus::Ok:
+      MINI_RN_LOG(DEBUG,
+                  "[JSExecutor] JavaScript callback executed successfully");
+      // 回调中产生的 Native 调用随返回的队列一起带回
+      processFlushedQueue(resultJson);
+      break;
+    case JSCallStatus::NotFound:
+      std::cout << "[JSExecutor] Warning: "
+                   "__fbBatchedBridge.invokeCallbackAndReturnFlushedQueue "
+                   "not available"
+                << std::endl;
+      break;
+    default:
+      std::cout << "[JSExecutor] Error calling JavaScript callback"
+                << std::endl;
+      break;
+  }
+
+  // 回调完成后未完成调用减少，可能回落到低水位
+  if (m_backpressure) {
+    updateBackpressure();
+  }
+}
+
+JSCallStatus JSExecutor::callGlobalMethodWithArgs(
+    const std::string &objectName, const std::string &methodName,
+    const mini_rn::utils::Value &args, std::string *resultJson) {
+  if (!args.isArray()) return JSCallStatus::InvalidArguments;
+  return callGlobalMethod(objectName, methodName, args.toJSON(), resultJson);
+}
+
+void JSExecutor::callFunction(const std::string &module,
+                              const std::string &method,
+                              const std::string &argsJson) {
+  std::string resultJson;
+  JSCallStatus status = callGlobalMethod(
+      "__fbBatchedBridge", "callFunctionReturnFlushedQueue",
+      "[" + mini_rn::utils::quoteJSONString(module) + "," +
+          mini_rn::utils::quoteJSONString(method) + "," + argsJson + "]",
+      &resultJson);
+
+  switch (status) {
+    case JSCallStatus::Ok:
+      processFlushedQueue(resultJson);
+      break;
+    case JSCallStatus::NotFound:
+      std::cout << "[JSExecutor] Warning: "
+                   "__fbBatchedBridge.callFunctionReturnFlushedQueue "
+                   "not available"
+                << std::endl;
+      break;
+    case JSCallStatus::InvalidArguments:
+      std::cout << "[JSExecutor] Error: Invalid arguments JSON for " << module
+                << "." << method << ": " << argsJson << std::endl;
+      break;
+    default:
+      std::cout << "[JSExecutor] Error calling " << module << "." << method
+                << std::endl;
+      break;
+  }
+}
+
+void JSExecutor::tick(double nowMs) {
+  drainBackgroundCalls(m_backgroundCallsPerTick);
+  if (m_moduleRegistry) {
+    m_moduleRegistry->onTick(nowMs);
+  }
+  if (m_gcScheduled) {
+    collectGarbage();
+  }
+  updateBackpressure();
+}
+
+void JSExecutor::tick() {
+  auto now = std::chrono::steady_clock::now().time_since_epoch();
+  tick(std::chrono::duration<double, std::milli>(now).count());
+}
+
+JSExecutor::MemoryStats JSExecutor::getMemoryStats() const {
+  MemoryStats stats = m_memoryStats;
+  queryHeapUsage(stats);
+  stats.externalBytes = m_externalBytes->load(std::memory_order_relaxed);
+  if (m_moduleRegistry) {
+    stats.pendingCalls = m_moduleRegistry->getPendingCallCount();
+  }
+  return stats;
+}
+
+size_t JSExecutor::reportOutstandingCalls(size_t limit) {
+  MemoryStats stats = getMemoryStats();
+  std::cout << "[JSExecutor] Outstanding native calls: " << stats.pendingCalls
+            << ", protected JS values: " << stats.protectedValues << std::endl;
+  if (!m_moduleRegistry) return 0;
+
+  auto now = std::chrono::steady_clock::now().time_since_epoch();
+  double nowMs = std::chrono::duration<double, std::milli>(now).count();
+  for (const auto &call : m_moduleRegistry->getOldestPendingCalls(limit, nowMs)) {
+    std::cout << "  " << call.moduleName << "." << call.methodName
+              << " (Call ID: " << call.callId << ") pending for "
+              << static_cast<long long>(call.ageMs) << " ms" << std::endl;
+  }
+  return stats.pendingCalls;
+}
+
+void JSExecutor::collectGarbage() {
+  m_gcScheduled = false;
+  auto start = std::chrono::steady_clock::now();
+  performGarbageCollection();
+  double elapsedMs = std::chrono::duration<double, std::milli>(
+                         std::chrono::steady_clock::now() - start)
+                         .count();
+
+  m_memoryStats.explicitCollections++;
+  m_memoryStats.lastExplicitPauseMs = elapsedMs;
+  m_memoryStats.totalExplicitPauseMs += elapsedMs;
+  if (elapsedMs > m_memoryStats.maxExplicitPauseMs) {
+    m_memoryStats.maxExplicitPauseMs = elapsedMs;
+  }
+}
+
+void JSExecutor::scheduleGarbageCollection() { m_gcScheduled = true; }
+
+void JSExecutor::handleMemoryPressure(
+    mini_rn::modules::MemoryPressureLevel level) {
+  bool critical = level == mini_rn::modules::MemoryPressureLevel::Critical;
+  std::cout << "[JSExecutor] Memory pressure: "
+            << (critical ? "critical" : "moderate") << std::endl;
+  m_memoryStats.memoryPressureEvents++;
+
+  if (m_moduleRegistry) {
+    m_moduleRegistry->onMemoryPressure(level);
+  }
+
+  if (critical) {
+    dropBackgroundCalls(0, "memory pressure");
+    updateBackpressure();
+  }
+
+  // 没有正在处理的队列时，释放各层队列保留的解析文档和竞技场
+  if (m_queueDepth == 0) {
+    m_queueSlots.clear();
+  }
+
+  if (critical) {
+    collectGarbage();
+  } else {
+    scheduleGarbageCollection();
+  }
+}
+
+JSExecutor::ExternalBuffer *JSExecutor::retainExternalBuffer(
+    const std::shared_ptr<mini_rn::utils::ByteBuffer> &buffer) {
+  size_t size = buffer->size();
+  m_externalBytes->fetch_add(size, std::memory_order_relaxed);
+  m_memoryStats.externalBytesReported += size;
+  reportExtraMemoryCost(size);
+  return new ExternalBuffer{buffer, m_externalBytes};
+}
+
+void JSExecutor::releaseExternalBuffer(void *holder) {
+  auto *external = static_cast<ExternalBuffer *>(holder);
+  external->liveBytes->fetch_sub(external->buffer->size(),
+                                 std::memory_order_relaxed);
+  delete external;
+}
+
+std::string JSExecutor::nativeGetMemoryStats() const {
+  MemoryStats stats = getMemoryStats();
+  mini_rn::utils::Value result = mini_rn::utils::Value::object();
+  result.set("heapSize", static_cast<double>(stats.heapSize));
+  result.set("heapCapacity", static_cast<double>(stats.heapCapacity));
+  result.set("externalBytes", static_cast<double>(stats.externalBytes));
+  result.set("externalBytesReported",
+             static_cast<double>(stats.externalBytesReported));
+  result.set("explicitCollections",
+             static_cast<double>(stats.explicitCollections));
+  result.set("lastExplicitPauseMs", stats.lastExplicitPauseMs);
+  result.set("maxExplicitPauseMs", stats.maxExplicitPauseMs);
+  result.set("totalExplicitPauseMs", stats.totalExplicitPauseMs);
+  result.set("memoryPressureEvents",
+             static_cast<double>(stats.memoryPressureEvents));
+  result.set("pendingCalls", static_cast<double>(stats.pendingCalls));
+  result.set("protectedValues", static_cast<double>(stats.protectedValues));
+  return result.toJSON();
+}
+
+void JSExecutor::processFlushedQueue(const std::string &queueJson) {
+  // MessageQueue 在入队时立即刷新，返回的队列通常为空：[[],[],[],[]]
+  if (queueJson.empty() || queueJson == "null" ||
+      queueJson.compare(0, 3, "[[]") == 0) {
+    return;
+  }
+
+  try {
+    processQueue(queueJson);
+  } catch (const std::exception &e) {
+    std::cout << "[JSExecutor] Error processing flushed queue: " << e.what()
+              << std::endl;
+  }
+}
+
+void JSExecutor::injectModuleConfig() {
+  MINI_RN_LOG(INFO, "[JSExecutor] Injecting module configuration...");
+
+  try {
+    // 获取所有注册的模块配置
+    if (!m_moduleRegistry) {
+      std::cout << "[JSExecutor] Warning: ModuleRegistry not available"
+                << std::endl;
+      return;
+    }
+
+    // 获取所有模块名称
+    auto moduleNames = m_moduleRegistry->moduleNames();
+
+    // 使用 ModuleRegistry::getConfig 获取每个模块的配置，
+    // 拼接为 { "remoteModuleConfig": [config, ...] }
+    std::string bridgeConfig = "{\"remoteModuleConfig\":[";
+    bool first = true;
+
+    for (const auto &moduleName : moduleNames) {
+      mini_rn::modules::ModuleConfig config =
+          m_moduleRegistry->getConfig(moduleName);
+
+      if (config.index != SIZE_MAX && !config.config.empty()) {
+        if (!first) bridgeConfig += ",";
+        bridgeConfig += config.config;
+        first = false;
+        MINI_RN_LOG(DEBUG, "[JSExecutor] Added config for module: "
+                    << moduleName);
+      } else {
+        std::cout << "[JSExecutor] Warning: Failed to get config for module: "
+                  << moduleName << std::endl;
+      }
+    }
+
+    bridgeConfig += "]}";
+
+    // 将 bridgeConfig 设置为 global.__fbBatchedBridgeConfig
+    if (!setGlobalValue("__fbBatchedBridgeConfig", bridgeConfig)) {
+      std::cout << "[JSExecutor] Error: Failed to set __fbBatchedBridgeConfig"
+                << std::endl;
+      return;
+    }
+
+    MINI_RN_LOG(INFO,
+                "[JSExecutor] Module configuration injected successfully "
+                "using ModuleRegistry::getConfig");
+
+  } catch (const std::exception &e) {
+    std::cout << "[JSExecutor] Error in injectModuleConfig: " << e.what()
+              << std::endl;
+  }
+}
+
+void JSExecutor::refreshModuleConfig() {
+  MINI_RN_LOG(INFO, "[JSExecutor] Refreshing module configuration...");
+
+  // 简单实现：重新注入模块配置
+  injectModuleConfig();
+
+  MINI_RN_LOG(INFO, "[JSExecutor] Module configuration refreshed successfully");
+}
+
+void JSExecutor::registerModules(
+    std::vector<std::unique_ptr<mini_rn::modules::NativeModule>> modules) {
+  MINI_RN_LOG(INFO, "[JSExecutor] Registering " << modules.size()
+              << " module(s)...");
+
+  if (!m_moduleRegistry) {
+    throw std::runtime_error("ModuleRegistry not initialized");
+  }
+
+  // 注册模块
+  m_moduleRegistry->registerModules(std::move(modules));
+
+  // 自动注入模块配置
+  injectModuleConfig();
+
+  MINI_RN_LOG(INFO, "[JSExecutor] All modules registered and config injected");
+}
+
+}  // namespace bridge
+}  // namespace mini_rn
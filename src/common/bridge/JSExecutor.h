@@ -0,0 +1,679 @@
+#ifndef JSEXECUTOR_H
+#define JSEXECUTOR_H
+
+#include <atomic>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "../modules/ModuleRegistry.h"
+#include "../utils/JSONDocument.h"
+#include "../utils/MappedFile.h"
+#include "../utils/MonotonicArena.h"
+#include "../utils/Value.h"
+#include "RAMBundle.h"
+#include "ScriptCache.h"
+
+namespace mini_rn {
+namespace bridge {
+
+/**
+ * Bridge 消息队列数据结构
+ * 严格遵循 React Native 的消息格式：[moduleIds, methodIds, params, callbackIds]，
+ * JS 显式指定过优先级时队列带第五个数组 priorities（见 CallPriority）
+ *
+ * 所有数组都从同一个 MonotonicArena 分配：JSExecutor 每次刷新队列时在自己持有的
+ * 竞技场中构造消息，处理完后整体 reset，稳定状态下刷新不再分配堆内存。
+ * params 是参数在原始队列文本中的片段，不复制；消息本身不可拷贝，
+ * 在竞技场 reset 之前有效。
+ */
+struct BridgeMessage {
+  explicit BridgeMessage(mini_rn::utils::MonotonicArena &arena)
+      : moduleIds(mini_rn::utils::ArenaAllocator<int>(arena)),
+        methodIds(mini_rn::utils::ArenaAllocator<int>(arena)),
+        params(mini_rn::utils::ArenaAllocator<std::string_view>(arena)),
+        callbackIds(mini_rn::utils::ArenaAllocator<int>(arena)),
+        priorities(mini_rn::utils::ArenaAllocator<int>(arena)),
+        args(mini_rn::utils::ArenaAllocator<mini_rn::utils::JSONValue>(arena)) {}
+
+  BridgeMessage(const BridgeMessage &) = delete;
+  BridgeMessage &operator=(const BridgeMessage &) = delete;
+
+  mini_rn::utils::ArenaVector<int> moduleIds;  // 模块ID数组
+  mini_rn::utils::ArenaVector<int> methodIds;  // 方法ID数组
+  mini_rn::utils::ArenaVector<std::string_view> params;  // 参数数组（JSON文本片段）
+  mini_rn::utils::ArenaVector<int> callbackIds;  // 回调ID数组，没有回调为 -1
+  // 显式优先级（CallPriority 的数值，-1 表示用方法的默认通道），队列不带时为空
+  mini_rn::utils::ArenaVector<int> priorities;
+  // 参数的值树（由 JSONDocument 构造时与 params 一一对应，否则为空）
+  mini_rn::utils::ArenaVector<mini_rn::utils::JSONValue> args;
+
+  // 获取调用数量
+  size_t getCallCount() const { return moduleIds.size(); }
+
+  // 验证消息格式是否正确
+  bool isValid() const {
+    return moduleIds.size() == methodIds.size() &&
+           methodIds.size() == params.size() &&
+           params.size() == callbackIds.size() &&
+           (priorities.empty() || priorities.size() == params.size()) &&
+           (args.empty() || args.size() == params.size());
+  }
+};
+
+/**
+ * 回调信息结构
+ */
+struct CallbackInfo {
+  int callbackId;
+  // 为后续扩展预留字段
+  // std::function<void(const std::string&)> callback;
+};
+
+/**
+ * 模块调用信息结构
+ */
+struct ModuleCall {
+  int moduleId;
+  int methodId;
+  std::string params;  // JSON格式参数
+  int callbackId;
+};
+
+/**
+ * JS 引擎类型
+ */
+enum class JSEngineType {
+  JavaScriptCore,  // 系统 JavaScriptCore（macOS/iOS 内置）
+  QuickJS,         // 可嵌入的轻量级解释器
+};
+
+/**
+ * 调用 JavaScript 函数的结果状态
+ */
+enum class JSCallStatus {
+  Ok,                // 调用成功
+  InvalidArguments,  // 参数 JSON 无法解析，调用未执行
+  NotFound,          // 目标对象或方法不存在
+  Exception,         // JavaScript 抛出异常
+};
+
+/**
+ * JSArguments - 引擎无关的函数参数访问接口
+ *
+ * 由各引擎后端实现，Native 宿主函数通过它按需转换参数，
+ * 避免 Bridge 逻辑直接依赖 JSValueRef / JSValue 等引擎类型。
+ */
+class JSArguments {
+ public:
+  virtual ~JSArguments() = default;
+
+  // 参数个数
+  virtual size_t size() const = 0;
+
+  // 按字符串读取参数（等价于 String(arg)）
+  virtual std::string getString(size_t index) const = 0;
+
+  // 按数字读取参数（等价于 Number(arg)）
+  virtual double getNumber(size_t index) const = 0;
+
+  // 按 JSON 读取参数（等价于 JSON.stringify(arg)）
+  virtual std::string getJSONString(size_t index) const = 0;
+};
+
+/**
+ * Native 宿主函数类型
+ * 返回值为 JSON 文本，由引擎转换为 JS 值；返回空字符串表示 undefined
+ */
+using HostFunction = std::function<std::string(const JSArguments &args)>;
+
+/**
+ * JSExecutor - 引擎无关的 JavaScript 执行器接口
+ *
+ * 把 Bridge 逻辑和具体 JS 引擎解耦，对应 React Native 中 JSExecutor 与
+ * JSCExecutor 的分层关系：
+ * 1. 引擎原语（纯虚函数）- 脚本加载、全局函数注入、函数调用、值转换，
+ *    由 JSCExecutor、QuickJSExecutor 等后端实现
+ * 2. Bridge 逻辑（本类实现）- 消息队列刷新、模块配置注入、回调返回，
+ *    只通过引擎原语访问 JavaScript，与引擎类型无关
+ *
+ * 值转换约定：跨越接口的复杂值一般使用 JSON 文本表示，与
+ * BridgeMessage::params 的约定保持一致；Native 模块的回调结果是类型化的
+ * utils::Value，通过 callGlobalMethodWithArgs 直接转换为 JS 值。
+ *
+ * 内存：后端把 Native 缓冲区交给 JS（ArrayBuffer）时通过 retainExternalBuffer
+ * 向引擎报告外部内存，大块 Native 内存同样形成 GC 压力；宿主可以主动 GC、
+ * 查询堆统计，并在内存紧张时调用 handleMemoryPressure 释放模块缓存。
+ *
+ * 生命周期约定：后端在构造函数中创建好引擎上下文后，
+ * 必须调用 initializeRuntime() 完成 Bridge 环境的搭建。
+ */
+class JSExecutor {
+ public:
+  virtual ~JSExecutor() = default;
+
+  // 禁用拷贝构造和赋值
+  JSExecutor(const JSExecutor &) = delete;
+  JSExecutor &operator=(const JSExecutor &) = delete;
+
+  // === 引擎原语 ===
+
+  /**
+   * 获取引擎类型与名称（用于日志和性能对比）
+   */
+  virtual JSEngineType getEngineType() const = 0;
+  virtual const char *getEngineName() const = 0;
+
+  /**
+   * 加载并执行 JavaScript 应用代码
+   * @param script JavaScript 代码内容
+   * @param sourceURL 代码来源 URL（用于调试）
+   */
+  virtual void loadApplicationScript(const std::string &script,
+                                     const std::string &sourceURL = "") = 0;
+
+  /**
+   * 从文件加载并执行 JavaScript 应用代码（推荐用于 bundle）
+   *
+   * 通过 mmap 映射文件，避免 ifstream → ostringstream → std::string
+   * 的多次堆拷贝，具体交给引擎的方式由 loadMappedScript 决定。
+   * 文件为索引 RAM bundle（见 RAMBundle）时，只执行 startup code，
+   * 其余模块由 JS 通过 nativeRequire(moduleId) 按需执行。
+   *
+   * @param path bundle 文件路径，同时作为 sourceURL
+   * @return 文件无法打开或 RAM bundle 格式错误时返回 false
+   *         （脚本异常通过异常处理器上报）
+   */
+  bool loadApplicationScriptFromFile(const std::string &path);
+
+  /**
+   * 向 JavaScript 环境注入全局函数
+   * @param name 函数名称
+   * @param function Native 宿主函数
+   */
+  virtual void installGlobalFunction(const std::string &name,
+                                     HostFunction function) = 0;
+
+  /**
+   * 调用全局对象上的方法：global[objectName][methodName](...args)
+   * @param objectName 全局对象名称，如 "__fbBatchedBridge"
+   * @param methodName 方法名称
+   * @param argsJson 参数数组的 JSON 文本，如 "[1, [null, \"ok\"]]"
+   * @param resultJson 输出参数：返回值的 JSON 文本（可为 nullptr）
+   * @return 调用状态
+   */
+  virtual JSCallStatus callGlobalMethod(const std::string &objectName,
+                                        const std::string &methodName,
+                                        const std::string &argsJson,
+                                        std::string *resultJson = nullptr) = 0;
+
+  /**
+   * 以类型化参数调用全局对象上的方法
+   * 参数由后端直接构造为 JS 值，不生成也不解析 JSON 文本；
+   * 默认实现编码为 JSON 后调用 callGlobalMethod，后端可以覆盖
+   *
+   * @param args 参数数组（Array 类型的 Value）
+   * @param resultJson 输出参数：返回值的 JSON 文本（可为 nullptr）
+   * @return 调用状态，args 不是数组时返回 InvalidArguments
+   */
+  virtual JSCallStatus callGlobalMethodWithArgs(
+      const std::string &objectName, const std::string &methodName,
+      const mini_rn::utils::Value &args, std::string *resultJson = nullptr);
+
+  /**
+   * 将 JSON 文本转换为 JS 值并设置为全局属性
+   * @param name 属性名称
+   * @param json 属性值的 JSON 文本
+   * @param readOnly 是否为只读属性
+   * @return JSON 解析成功并设置完成返回 true
+   */
+  virtual bool setGlobalValue(const std::string &name, const std::string &json,
+                              bool readOnly = false) = 0;
+
+  /**
+   * 销毁 JavaScript 执行环境
+   */
+  virtual void destroy() = 0;
+
+  // === Bridge 逻辑 ===
+
+  /**
+   * 设置 JavaScript 异常处理器
+   * @param handler 异常处理回调函数
+   */
+  void setJSExceptionHandler(std::function<void(const std::string &)> handler);
+
+  /**
+   * 获取模块注册器
+   * 用于注册 Native 模块和管理模块调用
+   * @return 模块注册器指针
+   */
+  mini_rn::modules::ModuleRegistry *getModuleRegistry() {
+    return m_moduleRegistry.get();
+  }
+
+  /**
+   * 重新注入模块配置
+   * 在模块注册完成后调用，更新 JavaScript 环境中的模块配置
+   */
+  void refreshModuleConfig();
+
+  /**
+   * 注册模块并自动注入配置
+   * @param modules 要注册的模块列表
+   */
+  void registerModules(
+      std::vector<std::unique_ptr<mini_rn::modules::NativeModule>> modules);
+
+  /**
+   * 注入模块配置到 JavaScript 环境
+   * 创建 __fbBatchedBridgeConfig 全局对象，包含所有已注册模块的配置信息
+   */
+  void injectModuleConfig();
+
+  /**
+   * 处理模块调用回调
+   * 将 Native 模块的执行结果返回给 JavaScript
+   * @param callId 调用标识符
+   * @param result 执行结果，错误时为错误对象
+   * @param isError 是否为错误结果
+   */
+  void invokeCallback(int callId, const mini_rn::utils::Value &result,
+                      bool isError);
+
+  /**
+   * 调用 JavaScript 可调用模块的方法（Native → JS 主动调用）
+   * 对齐React Native实现：JSCExecutor::callFunction，
+   * 通过 __fbBatchedBridge.callFunctionReturnFlushedQueue 执行，
+   * 并处理 JS 在本次调用中产生、随返回值带回的 Native 调用
+   *
+   * @param module 通过 registerCallableModule 注册的模块名，如
+   *               "RCTDeviceEventEmitter"
+   * @param method 方法名称
+   * @param argsJson 参数数组的 JSON 文本
+   */
+  void callFunction(const std::string &module, const std::string &method,
+                    const std::string &argsJson);
+
+  /**
+   * 驱动一次事件循环 tick
+   * 由宿主在每帧（或每轮事件循环）调用一次，按模块 ID 顺序通知所有模块
+   * （NativeModule::onTick），模块在此批量投递积攒的事件
+   *
+   * @param nowMs 当前时间（毫秒，单调时钟）
+   */
+  void tick(double nowMs);
+
+  /**
+   * 以 steady_clock 的当前时间驱动一次 tick
+   */
+  void tick();
+
+  /**
+   * 获取预编译脚本缓存（未启用时返回 nullptr）
+   */
+  ScriptCache *getScriptCache() const { return m_scriptCache.get(); }
+
+  /**
+   * 队列刷新统计
+   */
+  struct FlushStats {
+    size_t flushes = 0;                  // 处理过的队列数
+    size_t calls = 0;                    // 派发的模块调用数
+    size_t arenaAllocations = 0;         // 竞技场向系统申请块的累计次数
+    size_t lastFlushArenaAllocations = 0;  // 最近一次刷新中申请块的次数
+    size_t lastFlushBytes = 0;           // 最近一次刷新的 BridgeMessage 用量
+  };
+
+  /**
+   * 获取队列刷新统计；稳定状态下 lastFlushArenaAllocations 应为 0
+   */
+  const FlushStats &getFlushStats() const { return m_flushStats; }
+
+  /**
+   * 优先级通道统计，数组按 CallPriority 的数值索引
+   */
+  struct LaneStats {
+    size_t dispatched[mini_rn::modules::kCallPriorityCount] = {};  // 已派发
+    // 最近一次刷新中各通道的调用数 / 单次刷新的最大值
+    size_t lastFlushDepth[mini_rn::modules::kCallPriorityCount] = {};
+    size_t maxFlushDepth[mini_rn::modules::kCallPriorityCount] = {};
+    size_t backgroundDepth = 0;     // 当前等待派发的 Background 调用数
+    size_t backgroundDeferred = 0;  // 累计延后到 tick 的调用数
+    size_t backgroundDropped = 0;   // 累计因积压或内存压力丢弃的调用数
+  };
+
+  /**
+   * 获取优先级通道统计
+   */
+  LaneStats getLaneStats() const;
+
+  /**
+   * 设置 Background 通道的上限
+   * @param maxQueued 最多积压的调用数，超出时丢弃最旧的（以错误回调结束）
+   * @param maxPerTick 每个 tick 最多派发的调用数
+   */
+  void setBackgroundLaneLimits(size_t maxQueued, size_t maxPerTick);
+
+  /**
+   * 背压水位：未完成的 Native 调用（已派发未回调的调用加上等待派发的
+   * Background 调用）的个数和参数字节数。任一项达到高水位时进入背压，
+   * 两项都回落到低水位以下时解除；状态变化时调用 JS 的
+   * __fbBatchedBridge.setBackpressure(active)，JS 侧可以等待排空或丢弃
+   * Background 调用（见 MessageQueue.whenDrained）
+   */
+  struct BackpressureLimits {
+    size_t highWatermarkCalls = 1024;
+    size_t lowWatermarkCalls = 512;
+    size_t highWatermarkBytes = 8 << 20;
+    size_t lowWatermarkBytes = 4 << 20;
+  };
+
+  struct BackpressureStats {
+    bool active = false;      // 当前是否处于背压
+    size_t pendingCalls = 0;  // 未完成的调用数
+    size_t pendingBytes = 0;  // 未完成调用的参数字节数
+    size_t activations = 0;   // 累计进入背压的次数
+  };
+
+  /**
+   * 设置背压水位（低水位应小于高水位），立即按新水位重新判断
+   */
+  void setBackpressureLimits(const BackpressureLimits &limits);
+
+  /**
+   * 获取背压状态与统计
+   */
+  BackpressureStats getBackpressureStats() const;
+
+  /**
+   * JS 堆与 GC 统计
+   *
+   * GC 次数和停顿只统计经过 collectGarbage 的显式回收（内存压力、调度的 GC）：
+   * JSC 和 QuickJS 都没有公开引擎自己触发的回收的通知，这部分不计入，
+   * 不能当作引擎全部的 GC 开销。
+   */
+  struct MemoryStats {
+    size_t heapSize = 0;      // JS 堆已使用的字节数（引擎不提供时为 0）
+    size_t heapCapacity = 0;  // JS 堆占用的字节数（引擎不提供时为 0）
+    size_t externalBytes = 0;  // 当前被 JS ArrayBuffer 引用的 Native 内存
+    size_t externalBytesReported = 0;  // 累计向引擎报告的外部内存
+    size_t explicitCollections = 0;    // collectGarbage 执行次数
+    double lastExplicitPauseMs = 0;    // 最近一次显式 GC 的耗时（毫秒）
+    double maxExplicitPauseMs = 0;     // 单次显式 GC 的最长耗时
+    double totalExplicitPauseMs = 0;   // 显式 GC 累计耗时
+    size_t memoryPressureEvents = 0;   // handleMemoryPressure 调用次数
+    size_t pendingCalls = 0;     // 尚未回调的 Native 调用数
+    size_t protectedValues = 0;  // 引擎中被保护（不会被 GC）的值的个数
+  };
+
+  /**
+   * 获取 JS 堆与 GC 统计（堆大小在调用时向引擎查询）
+   * JS 侧通过同步函数 nativeGetMemoryStats() 得到同样的对象
+   */
+  MemoryStats getMemoryStats() const;
+
+  /**
+   * 立即执行一次垃圾回收并计入统计
+   */
+  void collectGarbage();
+
+  /**
+   * 在下一个 tick 的末尾（所有模块 onTick 之后）执行垃圾回收，
+   * 多次请求合并为一次
+   */
+  void scheduleGarbageCollection();
+
+  /**
+   * 处理宿主的内存压力通知：通知所有模块释放缓存（NativeModule::onMemoryPressure），
+   * 释放队列处理保留的存储，然后回收 JS 堆；Critical 时丢弃积压的 Background 调用
+   * - Moderate：垃圾回收安排在下一个 tick
+   * - Critical：立即垃圾回收
+   */
+  void handleMemoryPressure(mini_rn::modules::MemoryPressureLevel level);
+
+  /**
+   * 输出泄漏报告：未完成调用数、等待最久的 limit 个调用（模块、方法、
+   * 等待时间）以及引擎中被保护的值的个数；长时间运行时定期调用，
+   * 持续增长的条目通常就是泄漏的来源
+   * @return 未完成的调用数
+   */
+  size_t reportOutstandingCalls(size_t limit = 10);
+
+ protected:
+  /**
+   * @param scriptCache 预编译脚本缓存，为空时每次都从源码解析
+   */
+  explicit JSExecutor(std::shared_ptr<ScriptCache> scriptCache = nullptr);
+
+  /**
+   * 搭建 Bridge 运行环境：设置全局标志并注入 Bridge 核心函数
+   * 由后端在引擎上下文创建完成后调用
+   */
+  void initializeRuntime();
+
+  /**
+   * 执行以 '\0' 结尾的 UTF-8 源码缓冲区（引擎原语）
+   * 缓冲区直接来自映射区，后端不应假设其生命周期长于本次调用
+   * @param source 源码，要求 source[length] == '\0'
+   * @param length 源码长度（不含结尾 '\0'）
+   * @param sourceURL 代码来源 URL（用于调试）
+   */
+  virtual void evaluateSourceBuffer(const char *source, size_t length,
+                                    const std::string &sourceURL) = 0;
+
+  /**
+   * 执行映射好的脚本文件
+   * 默认实现：映射区末尾由内核补零时直接执行，否则拷贝一次补结尾符；
+   * 后端可以覆盖以使用引擎特有的零拷贝方式
+   */
+  virtual void loadMappedScript(const mini_rn::utils::MappedFile &file,
+                                const std::string &sourceURL);
+
+  /**
+   * 执行一次完整的垃圾回收（引擎原语），默认不做任何事
+   */
+  virtual void performGarbageCollection() {}
+
+  /**
+   * 查询 JS 堆的使用量、占用量和被保护的值的个数（引擎原语），
+   * 填写 stats 中对应的字段，默认不提供
+   */
+  virtual void queryHeapUsage(MemoryStats & /* stats */) const {}
+
+  /**
+   * 告知引擎有 bytes 字节的 Native 内存由 JS 对象持有，
+   * 引擎据此提前触发 GC（引擎原语），默认不做任何事
+   */
+  virtual void reportExtraMemoryCost(size_t /* bytes */) {}
+
+  /**
+   * 交给 JS ArrayBuffer 的 Native 缓冲区的持有者，
+   * 后端把它作为 ArrayBuffer 释放回调的上下文
+   */
+  struct ExternalBuffer {
+    std::shared_ptr<mini_rn::utils::ByteBuffer> buffer;
+    // 所属执行器的外部内存计数，执行器先于 ArrayBuffer 销毁时仍然有效
+    std::shared_ptr<std::atomic<size_t>> liveBytes;
+  };
+
+  /**
+   * 创建持有者并向引擎报告外部内存
+   */
+  ExternalBuffer *retainExternalBuffer(
+      const std::shared_ptr<mini_rn::utils::ByteBuffer> &buffer);
+
+  /**
+   * ArrayBuffer 被回收时调用（可能在 GC 线程上），释放持有者
+   */
+  static void releaseExternalBuffer(void *holder);
+
+  /**
+   * 上报 JavaScript 异常（由后端在捕获到异常后调用）
+   * @param message 异常消息
+   * @param stackTrace 堆栈信息，可以为空
+   */
+  void reportJSException(const std::string &message,
+                         const std::string &stackTrace);
+
+  // 异常处理回调函数
+  std::function<void(const std::string &)> m_exceptionHandler;
+  // Native 模块注册器
+  std::unique_ptr<mini_rn::modules::ModuleRegistry> m_moduleRegistry;
+  // 预编译脚本缓存（可为空，可在多个执行器之间共享）
+  std::shared_ptr<ScriptCache> m_scriptCache;
+
+ private:
+  /**
+   * 给 JS 注入 React Native Bridge 的核心函数
+   */
+  void installBridgeFunctions();
+
+  /**
+   * 处理来自JavaScript的队列刷新请求
+   * 对齐React Native实现：JSCExecutor::nativeFlushQueueImmediate
+   * @param queueJson 队列数组的 JSON 文本 [moduleIds, methodIds, params,
+   * callbackIds]
+   */
+  void nativeFlushQueueImmediate(const std::string &queueJson);
+
+  /**
+   * 处理来自JavaScript的日志请求
+   * 对齐React Native实现：JSCExecutor::nativeLoggingHook
+   * @param level 日志级别
+   * @param message 日志消息
+   */
+  void nativeLoggingHook(const std::string &level, const std::string &message);
+
+  /**
+   * 处理来自JavaScript的同步调用请求
+   * 对齐React Native实现：JSCExecutor::nativeCallSyncHook
+   * @param moduleId 模块ID
+   * @param methodId 方法ID
+   * @param argsJson 参数数组的 JSON 文本
+   * @return 同步调用结果的 JSON 文本
+   */
+  std::string nativeCallSyncHook(unsigned int moduleId, unsigned int methodId,
+                                 const std::string &argsJson);
+
+  /**
+   * 接管 RAM bundle：注入 nativeRequire 并执行 startup code
+   */
+  bool loadRAMBundle(mini_rn::utils::MappedFile file,
+                     const std::string &sourceURL);
+
+  /**
+   * 处理来自JavaScript的按需模块加载请求
+   * 对齐React Native实现：JSCExecutor::nativeRequire
+   * @param moduleId RAM bundle 中的模块ID
+   */
+  void nativeRequire(uint32_t moduleId);
+
+  /**
+   * 处理来自JavaScript的内存统计查询
+   * @return MemoryStats 的 JSON 文本
+   */
+  std::string nativeGetMemoryStats() const;
+
+  /**
+   * 解析队列 JSON（整个队列只解析一次），在本层竞技场中构造 BridgeMessage
+   * 并处理其中的调用，处理完后回收竞技场
+   * @param queueJson 队列的 JSON 文本：[moduleIds, methodIds, params, callbackIds]
+   */
+  void processQueue(const std::string &queueJson);
+
+  /**
+   * 从解析后的队列值树构造 BridgeMessage（数组分配在 message 的竞技场中）
+   * @return 不是四个等长数组时返回 false
+   */
+  static bool buildBridgeMessage(const mini_rn::utils::JSONValue &queue,
+                                 BridgeMessage &message);
+
+  /**
+   * 处理Bridge消息，参数以值树直接交给模块
+   * 有优先级时按通道派发：Immediate、UserBlocking、Normal 依次派发（通道内保持
+   * 入队顺序），Background 复制到延后队列，在之后的 tick 中派发
+   * @param message 本层竞技场中构造的消息
+   */
+  void processBridgeMessage(const BridgeMessage &message);
+
+  /**
+   * 派发消息中的第 index 个调用
+   */
+  void dispatchCall(const BridgeMessage &message, size_t index);
+
+  /**
+   * 派发最多 limit 个延后的 Background 调用
+   */
+  void drainBackgroundCalls(size_t limit);
+
+  /**
+   * 丢弃最旧的 Background 调用直到积压不超过 maxQueued
+   */
+  void dropBackgroundCalls(size_t maxQueued, const char *reason);
+
+  /**
+   * 按当前的未完成调用重新判断背压，状态变化时通知 JS
+   * 在批次处理、回调投递和 tick 之后调用
+   */
+  void updateBackpressure();
+
+  /**
+   * 处理 *ReturnFlushedQueue 系列方法返回的队列
+   * @param queueJson 队列的 JSON 文本，为空或空队列时直接返回
+   */
+  void processFlushedQueue(const std::string &queueJson);
+
+  /**
+   * 一层队列处理所用的存储：解析文档和 BridgeMessage 的竞技场，
+   * 两者都在刷新之间复用容量
+   */
+  struct QueueSlot {
+    mini_rn::utils::JSONDocument document;
+    mini_rn::utils::MonotonicArena arena;
+  };
+
+  // 按嵌套层数复用：模块调用期间可能再次刷新队列，
+  // 内层使用自己的存储，外层的消息和参数在内层处理期间保持有效
+  std::vector<std::unique_ptr<QueueSlot>> m_queueSlots;
+  size_t m_queueDepth = 0;
+  FlushStats m_flushStats;
+
+  /**
+   * 延后的 Background 调用（参数复制出竞技场）
+   */
+  struct DeferredCall {
+    unsigned int moduleId;
+    unsigned int methodId;
+    std::string params;
+    int callId;
+  };
+  std::deque<DeferredCall> m_backgroundCalls;
+  size_t m_backgroundBytes = 0;  // 积压调用的参数字节数
+  size_t m_maxBackgroundCalls = 256;
+  size_t m_backgroundCallsPerTick = 16;
+  LaneStats m_laneStats;
+
+  BackpressureLimits m_backpressureLimits;
+  bool m_backpressure = false;
+  size_t m_backpressureActivations = 0;
+
+  MemoryStats m_memoryStats;
+  // 当前被 JS 引用的外部内存，ArrayBuffer 释放时在任意线程减少
+  std::shared_ptr<std::atomic<size_t>> m_externalBytes =
+      std::make_shared<std::atomic<size_t>>(0);
+  bool m_gcScheduled = false;
+
+  // 当前加载的 RAM bundle（持有映射，模块代码按需从中取出）
+  std::unique_ptr<RAMBundle> m_ramBundle;
+  bool m_nativeRequireInstalled = false;
+};
+
+}  // namespace bridge
+}  // namespace mini_rn
+
+#endif  // JSEXECUTOR_H
@@ -0,0 +1,40 @@
+#include "JSExecutorFactory.h"
+
+#include <stdexcept>
+#include <utility>
+
+#include "JSCExecutor.h"
+#ifdef MINI_RN_ENABLE_QUICKJS
+  #include "QuickJSExecutor.h"
+#endif
+
+namespace mini_rn {
+namespace bridge {
+
+std::unique_ptr<JSExecutor> createJSExecutor(
+    JSEngineType type, std::shared_ptr<ScriptCache> scriptCache) {
+  switch (type) {
+    case JSEngineType::JavaScriptCore:
+      return std::make_unique<JSCExecutor>(std::move(scriptCache));
+    case JSEngineType::QuickJS:
+#ifdef MINI_RN_ENABLE_QUICKJS
+      return std::make_unique<QuickJSExecutor>(std::move(scriptCache));
+#else
+      throw std::runtime_error(
+          "QuickJS backend not built, reconfigure with "
+          "-DMINI_RN_ENABLE_QUICKJS=ON");
+#endif
+  }
+  throw std::runtime_error("Unknown JS engine type");
+}
+
+std::vector<JSEngineType> availableJSEngines() {
+  std::vector<JSEngineType> engines = {JSEngineType::JavaScriptCore};
+#ifdef MINI_RN_ENABLE_QUICKJS
+  engines.push_back(JSEngineType::QuickJS);
+#endif
+  return engines;
+}
+
+}  // namespace bridge
+}  // namespace mini_rn
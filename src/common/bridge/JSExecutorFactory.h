@@ -0,0 +1,33 @@
+#ifndef JSEXECUTORFACTORY_H
+#define JSEXECUTORFACTORY_H
+
+#include <memory>
+#include <vector>
+
+#include "JSExecutor.h"
+
+namespace mini_rn {
+namespace bridge {
+
+/**
+ * 按引擎类型创建 JavaScript 执行器
+ * 上层代码（测试、基准程序）只依赖 JSExecutor 接口，引擎在这里选择
+ *
+ * @param type 引擎类型
+ * @param scriptCache 预编译脚本缓存（可选，可在多个执行器之间共享）
+ * @return 执行器实例
+ * @throws std::runtime_error 当引擎未编译进当前构建时抛出
+ */
+std::unique_ptr<JSExecutor> createJSExecutor(
+    JSEngineType type, std::shared_ptr<ScriptCache> scriptCache = nullptr);
+
+/**
+ * 获取当前构建中可用的引擎列表
+ * JavaScriptCore 总是可用；QuickJS 需要开启 MINI_RN_ENABLE_QUICKJS
+ */
+std::vector<JSEngineType> availableJSEngines();
+
+}  // namespace bridge
+}  // namespace mini_rn
+
+#endif  // JSEXECUTORFACTORY_H
@@ -0,0 +1,484 @@
+#include "QuickJSExecutor.h"
+
+#include <iostream>
+#include <stdexcept>
+#include <utility>
+
+#include "../utils/Logging.h"
+
+namespace mini_rn {
+namespace bridge {
+
+namespace {
+
+#ifndef MINI_RN_QUICKJS_BUILD_ID
+#define MINI_RN_QUICKJS_BUILD_ID "unknown"
+#endif
+
+// 字节码缓存的引擎标签：字节码格式随 QuickJS 版本（和构建）变化，
+// 标签不同的缓存项不会被交给 JS_ReadObject
+#ifdef QJS_VERSION_STRING
+constexpr const char *kBytecodeCacheTag =
+    "qjs_" QJS_VERSION_STRING "_" MINI_RN_QUICKJS_BUILD_ID;
+#else
+constexpr const char *kBytecodeCacheTag = "qjs_" MINI_RN_QUICKJS_BUILD_ID;
+#endif
+
+// QuickJS 字符串转换：JSValue -> const char* -> std::string
+std::string convertJSValueToString(JSContext *ctx, JSValueConst value) {
+  size_t length = 0;
+  const char *str = JS_ToCStringLen(ctx, &length, value);
+  if (!str) return "";
+
+  std::string result(str, length);
+  JS_FreeCString(ctx, str);
+  return result;
+}
+
+/**
+ * QuickJSArguments - JSArguments 的 QuickJS 实现
+ */
+class QuickJSArguments : public JSArguments {
+ public:
+  QuickJSArguments(JSContext *ctx, int argc, JSValueConst *argv)
+      : m_ctx(ctx), m_argc(argc), m_argv(argv) {}
+
+  size_t size() const override { return static_cast<size_t>(m_argc); }
+
+  std::string getString(size_t index) const override {
+    if (index >= size()) return "";
+    return convertJSValueToString(m_ctx, m_argv[index]);
+  }
+
+  double getNumber(size_t index) const override {
+    double result = 0;
+    if (index < size()) {
+      JS_ToFloat64(m_ctx, &result, m_argv[index]);
+    }
+    return result;
+  }
+
+  std::string getJSONString(size_t index) const override {
+    if (index >= size()) return "";
+    JSValue json =
+        JS_JSONStringify(m_ctx, m_argv[index], JS_UNDEFINED, JS_UNDEFINED);
+    std::string result = JS_IsException(json) || JS_IsUndefined(json)
+                             ? ""
+                             : convertJSValueToString(m_ctx, json);
+    JS_FreeValue(m_ctx, json);
+    return result;
+  }
+
+ private:
+  JSContext *m_ctx;
+  int m_argc;
+  JSValueConst *m_argv;
+};
+
+}  // namespace
+
+QuickJSExecutor::QuickJSExecutor(std::shared_ptr<ScriptCache> scriptCache)
+    : JSExecutor(std::move(scriptCache)),
+      m_runtime(nullptr),
+      m_context(nullptr) {
+  // 每个执行器独占一个运行时，保证运行时之间完全隔离
+  m_runtime = JS_NewRuntime();
+  if (!m_runtime) {
+    throw std::runtime_error("Failed to create QuickJS runtime");
+  }
+
+  m_context = JS_NewContext(m_runtime);
+  if (!m_context) {
+    JS_FreeRuntime(m_runtime);
+    m_runtime = nullptr;
+    throw std::runtime_error("Failed to create QuickJS context");
+  }
+
+  // 宿主函数通过上下文私有数据找回执行器实例
+  JS_SetContextOpaque(m_context, this);
+
+  // 设置 global 对象（React Native 标准）
+  JSValue globalObject = JS_GetGlobalObject(m_context);
+  JS_SetPropertyStr(m_context, globalObject, "global",
+                    JS_DupValue(m_context, globalObject));
+  JS_FreeValue(m_context, globalObject);
+
+  // 搭建 Bridge 运行环境（__DEV__ 标志、Bridge 通信函数）
+  initializeRuntime();
+
+  MINI_RN_LOG(INFO,
+              "[QuickJSExecutor] JavaScript context initialized successfully");
+}
+
+QuickJSExecutor::~QuickJSExecutor() { destroy(); }
+
+void QuickJSExecutor::loadApplicationScript(const std::string &script,
+                                            const std::string &sourceURL) {
+  // JS_Eval 要求 input[input_len] 为 '\0'，std::string 可以保证
+  evaluateSourceBuffer(script.c_str(), script.length(),
+                       sourceURL.empty() ? "<eval>" : sourceURL);
+}
+
+void QuickJSExecutor::evaluateSourceBuffer(const char *source, size_t length,
+                                           const std::string &sourceURL) {
+  if (m_scriptCache) {
+    evaluateCachedScript(source, length, sourceURL);
+    return;
+  }
+
+  m_jsDepth++;
+  JSValue result = JS_Eval(m_context, source, length, sourceURL.c_str(),
+                           JS_EVAL_TYPE_GLOBAL);
+  m_jsDepth--;
+
+  if (JS_IsException(result)) {
+    handleJSException();
+  } else {
+    MINI_RN_LOG(DEBUG, "[QuickJSExecutor] Script executed successfully");
+  }
+
+  JS_FreeValue(m_context, result);
+  drainPendingJobs();
+}
+
+void QuickJSExecutor::evaluateCachedScript(const char *source, size_t length,
+                                           const std::string &sourceURL) {
+  std::string key = ScriptCache::makeKey(kBytecodeCacheTag, source, length);
+  JSValue function = JS_UNDEFINED;
+  bool cacheHit = false;
+
+  // 1. 命中：反序列化字节码，跳过词法/语法分析和字节码生成
+  auto bytecode = m_scriptCache->findSerializedScript(key);
+  if (bytecode) {
+    function = JS_ReadObject(
+        m_context, reinterpret_cast<const uint8_t *>(bytecode->data()),
+        bytecode->size(), JS_READ_OBJ_BYTECODE);
+    if (JS_IsException(function)) {
+      // 键已经区分 QuickJS 版本，这里只是最后的保护：丢弃并重新编译
+      JS_FreeValue(m_context, JS_GetException(m_context));
+      function = JS_UNDEFINED;
+    } else {
+      cacheHit = true;
+    }
+  }
+
+  // 2. 未命中：只编译不执行，序列化后写回缓存
+  if (JS_IsUndefined(function)) {
+    function = JS_Eval(m_context, source, length, sourceURL.c_str(),
+                       JS_EVAL_TYPE_GLOBAL | JS_EVAL_FLAG_COMPILE_ONLY);
+    if (JS_IsException(function)) {
+      handleJSException();
+      return;
+    }
+
+    size_t size = 0;
+    uint8_t *buffer =
+        JS_WriteObject(m_context, &size, function, JS_WRITE_OBJ_BYTECODE);
+    if (buffer) {
+      m_scriptCache->storeSerializedScript(
+          key, std::string(reinterpret_cast<const char *>(buffer), size));
+      js_free(m_context, buffer);
+    }
+  }
+
+  // JS_EvalFunction 会释放 function
+  m_jsDepth++;
+  JSValue result = JS_EvalFunction(m_context, function);
+  m_jsDepth--;
+  if (JS_IsException(result)) {
+    handleJSException();
+  } else {
+    MINI_RN_LOG(DEBUG, "[QuickJSExecutor] Script executed successfully"
+                << (cacheHit ? " (bytecode cache hit)" : ""));
+  }
+
+  JS_FreeValue(m_context, result);
+  drainPendingJobs();
+}
+
+JSValue QuickJSExecutor::hostFunctionTrampoline(JSContext *ctx,
+                                                JSValueConst thisVal, int argc,
+                                                JSValueConst *argv, int magic,
+                                                JSValue *funcData) {
+  // 避免未使用参数的警告
+  (void)thisVal;
+  (void)magic;
+
+  auto *executor = static_cast<QuickJSExecutor *>(JS_GetContextOpaque(ctx));
+  int32_t index = -1;
+  JS_ToInt32(ctx, &index, funcData[0]);
+
+  if (!executor || index < 0 ||
+      static_cast<size_t>(index) >= executor->m_hostFunctions.size()) {
+    return JS_UNDEFINED;
+  }
+
+  QuickJSArguments args(ctx, argc, argv);
+  std::string resultJson = (*executor->m_hostFunctions[index])(args);
+  if (resultJson.empty()) {
+    return JS_UNDEFINED;
+  }
+
+  JSValue result =
+      JS_ParseJSON(ctx, resultJson.c_str(), resultJson.length(), "<host>");
+  if (JS_IsException(result)) {
+    JS_FreeValue(ctx, JS_GetException(ctx));
+    return JS_UNDEFINED;
+  }
+  return result;
+}
+
+void QuickJSExecutor::installGlobalFunction(const std::string &name,
+                                            HostFunction function) {
+  int32_t index = static_cast<int32_t>(m_hostFunctions.size());
+  m_hostFunctions.push_back(
+      std::make_unique<HostFunction>(std::move(function)));
+
+  JSValue data = JS_NewInt32(m_context, index);
+  JSValue func =
+      JS_NewCFunctionData(m_context, hostFunctionTrampoline, 0, 0, 1, &data);
+
+  JSValue globalObject = JS_GetGlobalObject(m_context);
+  JS_SetPropertyStr(m_context, globalObject, name.c_str(), func);
+  JS_FreeValue(m_context, globalObject);
+
+  MINI_RN_LOG(DEBUG, "[QuickJSExecutor] Installed global function: " << name);
+}
+
+JSCallStatus QuickJSExecutor::callGlobalMethod(const std::string &objectName,
+                                               const std::string &methodName,
+                                               const std::string &argsJson,
+                                               std::string *resultJson) {
+  // 解析 JSON 参数数组
+  JSValue argsArray =
+      JS_ParseJSON(m_context, argsJson.c_str(), argsJson.length(), "<args>");
+  if (JS_IsException(argsArray) || !JS_IsArray(m_context, argsArray)) {
+    if (JS_IsException(argsArray)) {
+      JS_FreeValue(m_context, JS_GetException(m_context));
+    }
+    JS_FreeValue(m_context, argsArray);
+    return JSCallStatus::InvalidArguments;
+  }
+
+  JSCallStatus status =
+      callWithArgsArray(objectName, methodName, argsArray, resultJson);
+  JS_FreeValue(m_context, argsArray);
+  return status;
+}
+
+JSCallStatus QuickJSExecutor::callGlobalMethodWithArgs(
+    const std::string &objectName, const std::string &methodName,
+    const mini_rn::utils::Value &args, std::string *resultJson) {
+  if (!args.isArray()) return JSCallStatus::InvalidArguments;
+
+  // 参数直接构造为 JS 值，不经过 JSON
+  JSValue argsArray = valueToJSValue(args);
+  JSCallStatus status =
+      callWithArgsArray(objectName, methodName, argsArray, resultJson);
+  JS_FreeValue(m_context, argsArray);
+  return status;
+}
+
+JSCallStatus QuickJSExecutor::callWithArgsArray(const std::string &objectName,
+                                                const std::string &methodName,
+                                                JSValueConst argsArray,
+                                                std::string *resultJson) {
+  JSValue globalObject = JS_GetGlobalObject(m_context);
+  JSValue object = JS_GetPropertyStr(m_context, globalObject, objectName.c_str());
+  JS_FreeValue(m_context, globalObject);
+
+  if (!JS_IsObject(object)) {
+    JS_FreeValue(m_context, object);
+    return JSCallStatus::NotFound;
+  }
+
+  JSValue method = JS_GetPropertyStr(m_context, object, methodName.c_str());
+  if (!JS_IsFunction(m_context, method)) {
+    JS_FreeValue(m_context, method);
+    JS_FreeValue(m_context, object);
+    return JSCallStatus::NotFound;
+  }
+
+  JSValue lengthValue = JS_GetPropertyStr(m_context, argsArray, "length");
+  int32_t argumentCount = 0;
+  JS_ToInt32(m_context, &argumentCount, lengthValue);
+  JS_FreeValue(m_context, lengthValue);
+
+  std::vector<JSValue> arguments;
+  arguments.reserve(argumentCount);
+  for (int32_t i = 0; i < argumentCount; ++i) {
+    arguments.push_back(JS_GetPropertyUint32(m_context, argsArray, i));
+  }
+
+  // 调用 JavaScript 方法
+  m_jsDepth++;
+  JSValue result =
+      JS_Call(m_context, method, object, argumentCount,
+              arguments.empty() ? nullptr : arguments.data());
+  m_jsDepth--;
+
+  JSCallStatus status = JSCallStatus::Ok;
+  if (JS_IsException(result)) {
+    handleJSException();
+    status = JSCallStatus::Exception;
+  } else if (resultJson) {
+    *resultJson = JS_IsUndefined(result) ? "" : jsValueToJSONString(result);
+  }
+
+  JS_FreeValue(m_context, result);
+  for (JSValue &argument : arguments) {
+    JS_FreeValue(m_context, argument);
+  }
+  JS_FreeValue(m_context, method);
+  JS_FreeValue(m_context, object);
+  drainPendingJobs();
+  return status;
+}
+
+JSValue QuickJSExecutor::valueToJSValue(const mini_rn::utils::Value &value) {
+  using mini_rn::utils::Value;
+
+  switch (value.getType()) {
+    case Value::Type::Null:
+      return JS_NULL;
+    case Value::Type::Bool:
+      return JS_NewBool(m_context, value.asBool());
+    case Value::Type::Number:
+      return JS_NewFloat64(m_context, value.asNumber());
+    case Value::Type::String:
+      return JS_NewStringLen(m_context, value.asString().data(),
+                             value.asString().size());
+    case Value::Type::Array: {
+      JSValue array = JS_NewArray(m_context);
+      const auto &elements = value.asArray();
+      for (size_t i = 0; i < elements.size(); ++i) {
+        // JS_SetPropertyUint32 接管元素的引用
+        JS_SetPropertyUint32(m_context, array, static_cast<uint32_t>(i),
+                             valueToJSValue(elements[i]));
+      }
+      return array;
+    }
+    case Value::Type::Object: {
+      JSValue object = JS_NewObject(m_context);
+      for (const auto &field : value.asObject()) {
+        JS_SetPropertyStr(m_context, object, field.first.c_str(),
+                          valueToJSValue(field.second));
+      }
+      return object;
+    }
+    case Value::Type::ArrayBuffer: {
+      // 独占的 Native 内存直接交给 ArrayBuffer，不拷贝；
+      // 引用随 ArrayBuffer 一起由 GC 释放
+      std::shared_ptr<mini_rn::utils::ByteBuffer> buffer =
+          value.asArrayBuffer();
+      if (!buffer) return JS_NULL;
+      if (!buffer->ownsMemory()) {
+        // 与其他缓冲区共享的内存：JS 的写入不能影响共享方，
+        // 换成写时复制映射（不支持时拷贝）；交给 QuickJS 的始终是独占的内存
+        buffer = mini_rn::utils::ByteBuffer::copyOnWrite(buffer);
+      }
+      ExternalBuffer *holder = retainExternalBuffer(buffer);
+      return JS_NewArrayBuffer(
+          m_context, buffer->data(), buffer->size(),
+          [](JSRuntime * /* runtime */, void *opaque, void * /* ptr */) {
+            releaseExternalBuffer(opaque);
+          },
+          holder, false);
+    }
+  }
+  return JS_UNDEFINED;
+}
+
+bool QuickJSExecutor::setGlobalValue(const std::string &name,
+                                     const std::string &json, bool readOnly) {
+  JSValue value =
+      JS_ParseJSON(m_context, json.c_str(), json.length(), name.c_str());
+  if (JS_IsException(value)) {
+    JS_FreeValue(m_context, JS_GetException(m_context));
+    std::cout << "[QuickJSExecutor] Error: Invalid JSON for global '" << name
+              << "'" << std::endl;
+    return false;
+  }
+
+  JSValue globalObject = JS_GetGlobalObject(m_context);
+  // 只读属性：不可写、不可配置，与 kJSPropertyAttributeReadOnly 语义对齐
+  JS_DefinePropertyValueStr(m_context, globalObject, name.c_str(), value,
+                            readOnly ? JS_PROP_ENUMERABLE : JS_PROP_C_W_E);
+  JS_FreeValue(m_context, globalObject);
+  return true;
+}
+
+void QuickJSExecutor::performGarbageCollection() {
+  if (m_runtime) JS_RunGC(m_runtime);
+}
+
+void QuickJSExecutor::queryHeapUsage(MemoryStats &stats) const {
+  if (!m_runtime) return;
+  JSMemoryUsage usage;
+  JS_ComputeMemoryUsage(m_runtime, &usage);
+  stats.heapSize = static_cast<size_t>(usage.memory_used_size);
+  stats.heapCapacity = static_cast<size_t>(usage.malloc_size);
+}
+
+void QuickJSExecutor::destroy() {
+  if (m_context) {
+    JS_FreeContext(m_context);
+    m_context = nullptr;
+  }
+  if (m_runtime) {
+    JS_FreeRuntime(m_runtime);
+    m_runtime = nullptr;
+    m_hostFunctions.clear();
+    MINI_RN_LOG(INFO, "[QuickJSExecutor] JavaScript context destroyed");
+  }
+}
+
+void QuickJSExecutor::handleJSException() {
+  JSValue exception = JS_GetException(m_context);
+  std::string errorMsg = convertJSValueToString(m_context, exception);
+  std::string stackTrace;
+
+  // 尝试提取堆栈跟踪信息
+  if (JS_IsError(m_context, exception)) {
+    JSValue stack = JS_GetPropertyStr(m_context, exception, "stack");
+    if (!JS_IsUndefined(stack) && !JS_IsNull(stack)) {
+      stackTrace = convertJSValueToString(m_context, stack);
+    }
+    JS_FreeValue(m_context, stack);
+  }
+
+  JS_FreeValue(m_context, exception);
+
+  // 交给 JSExecutor 统一输出并调用异常处理器
+  reportJSException(errorMsg, stackTrace);
+}
+
+void QuickJSExecutor::drainPendingJobs() {
+  if (m_jsDepth > 0 || !m_runtime) return;
+
+  // 任务中的 Native 调用可能再次调用 JS，这些调用不再嵌套执行任务
+  m_jsDepth++;
+  JSContext *jobContext = nullptr;
+  int status;
+  while ((status = JS_ExecutePendingJob(m_runtime, &jobContext)) != 0) {
+    // 出错的任务已出队，上报后继续执行剩余的任务
+    if (status < 0) handleJSException();
+  }
+  m_jsDepth--;
+}
+
+std::string QuickJSExecutor::jsValueToJSONString(JSValueConst value) {
+  JSValue json = JS_JSONStringify(m_context, value, JS_UNDEFINED, JS_UNDEFINED);
+  if (JS_IsException(json)) {
+    handleJSException();
+    return "";
+  }
+
+  std::string result =
+      JS_IsUndefined(json) ? "" : convertJSValueToString(m_context, json);
+  JS_FreeValue(m_context, json);
+  return result;
+}
+
+}  // namespace bridge
+}  // namespace mini_rn
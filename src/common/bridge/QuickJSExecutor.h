@@ -0,0 +1,143 @@
+#ifndef QUICKJSEXECUTOR_H
+#define QUICKJSEXECUTOR_H
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "JSExecutor.h"
+
+// QuickJS 引擎（可选后端，由 CMake 选项 MINI_RN_ENABLE_QUICKJS 启用）
+#include <quickjs.h>
+
+namespace mini_rn {
+namespace bridge {
+
+/**
+ * QuickJSExecutor - 基于 QuickJS 的 JavaScript 执行器
+ *
+ * JSExecutor 接口的第二个后端，用于和 JavaScriptCore 做对比：
+ * - QuickJS 是单文件可嵌入的解释器，没有 JIT，启动快、常驻内存小
+ * - 每个执行器独占一个 JSRuntime，运行时之间完全隔离，
+ *   适合"大量小而短命的运行时"的部署场景
+ *
+ * Bridge 逻辑全部复用 JSExecutor 基类，本类只实现引擎原语。
+ */
+class QuickJSExecutor : public JSExecutor {
+ private:
+  // QuickJS 运行时（堆、GC、原子表）
+  JSRuntime *m_runtime;
+  // QuickJS 执行上下文（全局对象、内置对象）
+  JSContext *m_context;
+  // 已注入的宿主函数，JS 端通过函数数据中的索引找到对应项
+  std::vector<std::unique_ptr<HostFunction>> m_hostFunctions;
+  // 正在执行的 JS 调用层数（JS → Native → JS 嵌套时大于 1），
+  // 只有最外层返回后才执行挂起的任务
+  int m_jsDepth = 0;
+
+ public:
+  /**
+   * @param scriptCache 预编译脚本缓存：启用后以字节码形式缓存编译结果，
+   *        配置了缓存目录时跨进程复用
+   */
+  explicit QuickJSExecutor(std::shared_ptr<ScriptCache> scriptCache = nullptr);
+  ~QuickJSExecutor() override;
+
+  // JSExecutor 引擎原语实现
+  JSEngineType getEngineType() const override { return JSEngineType::QuickJS; }
+  const char *getEngineName() const override { return "QuickJS"; }
+
+  void loadApplicationScript(const std::string &script,
+                             const std::string &sourceURL = "") override;
+
+  void installGlobalFunction(const std::string &name,
+                             HostFunction function) override;
+
+  JSCallStatus callGlobalMethod(const std::string &objectName,
+                                const std::string &methodName,
+                                const std::string &argsJson,
+                                std::string *resultJson = nullptr) override;
+
+  JSCallStatus callGlobalMethodWithArgs(
+      const std::string &objectName, const std::string &methodName,
+      const mini_rn::utils::Value &args,
+      std::string *resultJson = nullptr) override;
+
+  bool setGlobalValue(const std::string &name, const std::string &json,
+                      bool readOnly = false) override;
+
+  void destroy() override;
+
+  /**
+   * 获取 JavaScript 上下文（用于高级操作）
+   */
+  JSContext *getContext() const { return m_context; }
+
+ protected:
+  // QuickJS 直接解析 UTF-8 源码，映射区可以原地执行
+  void evaluateSourceBuffer(const char *source, size_t length,
+                            const std::string &sourceURL) override;
+
+  /**
+   * JS_RunGC：引用计数之外的循环垃圾回收
+   */
+  void performGarbageCollection() override;
+
+  /**
+   * 通过 JS_ComputeMemoryUsage 读取运行时的已用 / 已分配字节数
+   * QuickJS 按引用计数立即释放 ArrayBuffer，外部内存不需要报告给引擎；
+   * 没有保护值的概念，protectedValues 为 0
+   */
+  void queryHeapUsage(MemoryStats &stats) const override;
+
+ private:
+  /**
+   * 通过脚本缓存执行：命中时直接加载字节码，未命中时编译并写回缓存
+   */
+  void evaluateCachedScript(const char *source, size_t length,
+                            const std::string &sourceURL);
+
+  /**
+   * 宿主函数调用入口（JSCFunctionData），func_data[0] 为宿主函数索引
+   */
+  static JSValue hostFunctionTrampoline(JSContext *ctx, JSValueConst thisVal,
+                                        int argc, JSValueConst *argv,
+                                        int magic, JSValue *funcData);
+
+  /**
+   * 以 JS 数组中的元素为参数调用 global[objectName][methodName]
+   */
+  JSCallStatus callWithArgsArray(const std::string &objectName,
+                                 const std::string &methodName,
+                                 JSValueConst argsArray,
+                                 std::string *resultJson);
+
+  /**
+   * 类型化值直接构造为 JS 值（JS_NewFloat64、JS_NewArray……），
+   * 返回的值由调用方释放
+   */
+  JSValue valueToJSValue(const mini_rn::utils::Value &value);
+
+  /**
+   * 处理当前挂起的 JavaScript 异常
+   */
+  void handleJSException();
+
+  /**
+   * 执行所有挂起的任务（Promise 回调等微任务），任务抛出的异常与脚本错误
+   * 一样上报。JSC 在最外层调用返回时自动执行微任务，QuickJS 需要宿主调用
+   * JS_ExecutePendingJob；每次顶层执行脚本和 Bridge 调用 JS 之后调用，
+   * 嵌套在其他 JS 调用中时不执行
+   */
+  void drainPendingJobs();
+
+  /**
+   * JSValue 到 JSON 字符串转换（JSON.stringify）
+   */
+  std::string jsValueToJSONString(JSValueConst value);
+};
+
+}  // namespace bridge
+}  // namespace mini_rn
+
+#endif  // QUICKJSEXECUTOR_H
@@ -0,0 +1,82 @@
+#include "RAMBundle.h"
+
+#include <stdexcept>
+#include <utility>
+
+namespace mini_rn {
+namespace bridge {
+
+namespace {
+
+constexpr size_t kHeaderSize = 3 * sizeof(uint32_t);
+constexpr size_t kEntrySize = 2 * sizeof(uint32_t);
+
+// 文件格式固定为小端序，逐字节读取避免未对齐访问和字节序问题
+uint32_t readUInt32LE(const char *data) {
+  const unsigned char *bytes = reinterpret_cast<const unsigned char *>(data);
+  return static_cast<uint32_t>(bytes[0]) |
+         static_cast<uint32_t>(bytes[1]) << 8 |
+         static_cast<uint32_t>(bytes[2]) << 16 |
+         static_cast<uint32_t>(bytes[3]) << 24;
+}
+
+}  // namespace
+
+bool RAMBundle::isRAMBundle(const mini_rn::utils::MappedFile &file) {
+  return file.size() >= kHeaderSize &&
+         readUInt32LE(file.data()) == kMagicNumber;
+}
+
+RAMBundle::RAMBundle(mini_rn::utils::MappedFile file)
+    : m_file(std::move(file)),
+      m_entryCount(0),
+      m_table(nullptr),
+      m_codeBase(nullptr),
+      m_codeSize(0),
+      m_startupCode{nullptr, 0} {
+  if (!isRAMBundle(m_file)) {
+    throw std::runtime_error("Not an indexed RAM bundle");
+  }
+
+  m_entryCount = readUInt32LE(m_file.data() + sizeof(uint32_t));
+  uint32_t startupCodeSize = readUInt32LE(m_file.data() + 2 * sizeof(uint32_t));
+
+  size_t tableEnd = kHeaderSize + static_cast<size_t>(m_entryCount) * kEntrySize;
+  if (tableEnd > m_file.size()) {
+    throw std::runtime_error("RAM bundle offset table is truncated");
+  }
+
+  m_table = m_file.data() + kHeaderSize;
+  m_codeBase = m_file.data() + tableEnd;
+  m_codeSize = m_file.size() - tableEnd;
+  m_startupCode = readCode(0, startupCodeSize);
+}
+
+RAMBundle::Code RAMBundle::getModule(uint32_t moduleId) const {
+  if (moduleId >= m_entryCount) {
+    throw std::runtime_error("Module ID out of range: " +
+                             std::to_string(moduleId));
+  }
+
+  const char *entry = m_table + static_cast<size_t>(moduleId) * kEntrySize;
+  uint32_t offset = readUInt32LE(entry);
+  uint32_t length = readUInt32LE(entry + sizeof(uint32_t));
+  if (length == 0) {
+    throw std::runtime_error("Module not found in RAM bundle: " +
+                             std::to_string(moduleId));
+  }
+  return readCode(offset, length);
+}
+
+RAMBundle::Code RAMBundle::readCode(uint32_t offset, uint32_t length) const {
+  // length 包含结尾 '\0'，保证代码可以直接当作 C 字符串交给引擎
+  if (length == 0 || static_cast<size_t>(offset) + length > m_codeSize ||
+      m_codeBase[offset + length - 1] != '\0') {
+    throw std::runtime_error("Malformed RAM bundle entry at offset " +
+                             std::to_string(offset));
+  }
+  return Code{m_codeBase + offset, length - 1};
+}
+
+}  // namespace bridge
+}  // namespace mini_rn
@@ -0,0 +1,83 @@
+#ifndef RAMBUNDLE_H
+#define RAMBUNDLE_H
+
+#include <cstdint>
+#include <string>
+
+#include "../utils/MappedFile.h"
+
+namespace mini_rn {
+namespace bridge {
+
+/**
+ * RAMBundle - 索引 RAM bundle 读取器
+ *
+ * 对齐 React Native 的 JSIndexedRAMBundle：bundle 由 startup code 和
+ * 逐个模块的代码组成，文件头带有按模块 ID 索引的偏移表。
+ * 启动时只执行 startup code，其余模块在 JS 第一次 require 时
+ * 通过 nativeRequire(moduleId) 从映射区按需取出执行。
+ *
+ * 文件格式（小端序，由 scripts/build-ram-bundle.js 生成）：
+ *   uint32 magic（0xFB0BD1E5）| uint32 entryCount | uint32 startupCodeSize
+ *   { uint32 offset, uint32 length } × entryCount
+ *   startup code '\0' | module code '\0' ...
+ * offset 相对于偏移表之后的代码区起点，length 包含结尾的 '\0'。
+ */
+class RAMBundle {
+ public:
+  static constexpr uint32_t kMagicNumber = 0xFB0BD1E5;
+
+  /**
+   * 一段以 '\0' 结尾的代码，直接指向映射区
+   */
+  struct Code {
+    const char *data;  // data[length] == '\0'
+    size_t length;     // 不含结尾 '\0'
+  };
+
+  /**
+   * 检查文件是否为索引 RAM bundle（只读取魔数）
+   */
+  static bool isRAMBundle(const mini_rn::utils::MappedFile &file);
+
+  /**
+   * 接管映射文件并校验文件头和偏移表
+   * @throws std::runtime_error 格式不合法时抛出异常
+   */
+  explicit RAMBundle(mini_rn::utils::MappedFile file);
+
+  // 禁用拷贝构造和赋值
+  RAMBundle(const RAMBundle &) = delete;
+  RAMBundle &operator=(const RAMBundle &) = delete;
+
+  /**
+   * 获取 startup code（模块系统 prelude + 入口模块 require）
+   */
+  Code getStartupCode() const { return m_startupCode; }
+
+  /**
+   * 获取指定模块的代码
+   * @throws std::runtime_error 模块 ID 越界或该表项为空时抛出异常
+   */
+  Code getModule(uint32_t moduleId) const;
+
+  size_t getModuleCount() const { return m_entryCount; }
+
+ private:
+  // 按表项读取一段代码并校验边界和结尾符
+  Code readCode(uint32_t offset, uint32_t length) const;
+
+  mini_rn::utils::MappedFile m_file;
+  uint32_t m_entryCount;
+  // 偏移表起点（位于映射区内）
+  const char *m_table;
+  // 代码区起点与长度
+  const char *m_codeBase;
+  size_t m_codeSize;
+  Code m_startupCode;
+};
+
+}  // namespace bridge
+}  // namespace mini_rn
+
+#endif  // RAMBUNDLE_H
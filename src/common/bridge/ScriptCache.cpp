@@ -0,0 +1,194 @@
+#include "ScriptCache.h"
+
+#include <sys/stat.h>
+
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <utility>
+
+namespace mini_rn {
+namespace bridge {
+
+namespace {
+
+/**
+ * 缓存文件头，后面紧跟 payloadSize 字节的序列化产物
+ */
+struct SerializedFileHeader {
+  uint32_t magic;
+  uint32_t version;
+  uint64_t payloadSize;
+  uint64_t checksum;  // 产物的 FNV-1a 哈希
+};
+
+constexpr uint32_t kSerializedFileMagic = 0x4353524D;  // "MRSC"
+constexpr uint32_t kSerializedFileVersion = 1;
+
+// 逐级创建目录（等价于 mkdir -p）
+bool createDirectories(const std::string &path) {
+  if (path.empty()) return false;
+
+  for (size_t pos = path.find('/', 1); ; pos = path.find('/', pos + 1)) {
+    std::string prefix = path.substr(0, pos);
+    if (mkdir(prefix.c_str(), 0755) != 0 && errno != EEXIST) {
+      return false;
+    }
+    if (pos == std::string::npos) break;
+  }
+  return true;
+}
+
+}  // namespace
+
+ScriptCache::ScriptCache(std::string cacheDirectory)
+    : m_cacheDirectory(std::move(cacheDirectory)) {
+  if (!m_cacheDirectory.empty() && !createDirectories(m_cacheDirectory)) {
+    std::cout << "[ScriptCache] Warning: Cannot create cache directory "
+              << m_cacheDirectory << ", using in-memory cache only"
+              << std::endl;
+    m_cacheDirectory.clear();
+  }
+}
+
+uint64_t ScriptCache::hashSource(const char *source, size_t length) {
+  uint64_t hash = 14695981039346656037ULL;
+  const unsigned char *bytes = reinterpret_cast<const unsigned char *>(source);
+  for (size_t i = 0; i < length; ++i) {
+    hash ^= bytes[i];
+    hash *= 1099511628211ULL;
+  }
+  return hash;
+}
+
+std::string ScriptCache::makeKey(const char *engineTag, const char *source,
+                                 size_t length) {
+  std::ostringstream key;
+  key << engineTag << '-' << std::hex << hashSource(source, length) << '-'
+      << std::dec << length;
+  return key.str();
+}
+
+std::shared_ptr<void> ScriptCache::findCompiledScript(const std::string &key) {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  auto it = m_compiledScripts.find(key);
+  if (it == m_compiledScripts.end()) {
+    m_stats.misses++;
+    return nullptr;
+  }
+  m_stats.hits++;
+  return it->second;
+}
+
+void ScriptCache::storeCompiledScript(const std::string &key,
+                                      std::shared_ptr<void> handle) {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_compiledScripts[key] = std::move(handle);
+}
+
+std::shared_ptr<void> ScriptCache::getEngineState(
+    const char *engineTag,
+    const std::function<std::shared_ptr<void>()> &create) {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  std::shared_ptr<void> &state = m_engineStates[engineTag];
+  if (!state) state = create();
+  return state;
+}
+
+std::shared_ptr<const std::string> ScriptCache::findSerializedScript(
+    const std::string &key) {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  auto it = m_serializedScripts.find(key);
+  if (it != m_serializedScripts.end()) {
+    m_stats.hits++;
+    return it->second;
+  }
+
+  if (!m_cacheDirectory.empty()) {
+    std::string path = pathForKey(key);
+    std::ifstream file(path, std::ios::binary);
+    if (file.is_open()) {
+      std::ostringstream buffer;
+      buffer << file.rdbuf();
+      std::string contents = buffer.str();
+
+      // 校验文件头：截断、损坏或旧格式的文件删除后按未命中处理
+      SerializedFileHeader header;
+      bool valid = contents.size() >= sizeof(header);
+      if (valid) {
+        std::memcpy(&header, contents.data(), sizeof(header));
+        valid = header.magic == kSerializedFileMagic &&
+                header.version == kSerializedFileVersion &&
+                header.payloadSize == contents.size() - sizeof(header) &&
+                header.checksum ==
+                    hashSource(contents.data() + sizeof(header),
+                               contents.size() - sizeof(header));
+      }
+      if (valid) {
+        auto data = std::make_shared<const std::string>(
+            contents.substr(sizeof(header)));
+        m_serializedScripts[key] = data;
+        m_stats.diskHits++;
+        return data;
+      }
+
+      file.close();
+      std::remove(path.c_str());
+      m_stats.diskRejects++;
+      std::cout << "[ScriptCache] Warning: Discarding corrupted cache file "
+                << path << std::endl;
+    }
+  }
+
+  m_stats.misses++;
+  return nullptr;
+}
+
+void ScriptCache::storeSerializedScript(const std::string &key,
+                                        std::string data) {
+  auto shared = std::make_shared<const std::string>(std::move(data));
+
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_serializedScripts[key] = shared;
+  if (m_cacheDirectory.empty()) return;
+
+  // 先写临时文件再 rename，避免其他进程读到写了一半的缓存
+  std::string path = pathForKey(key);
+  std::string tempPath = path + ".tmp";
+  std::ofstream file(tempPath, std::ios::binary | std::ios::trunc);
+  SerializedFileHeader header{kSerializedFileMagic, kSerializedFileVersion,
+                              shared->size(),
+                              hashSource(shared->data(), shared->size())};
+  file.write(reinterpret_cast<const char *>(&header), sizeof(header));
+  file.write(shared->data(), static_cast<std::streamsize>(shared->size()));
+  file.close();
+
+  if (!file || std::rename(tempPath.c_str(), path.c_str()) != 0) {
+    std::remove(tempPath.c_str());
+    std::cout << "[ScriptCache] Warning: Failed to write " << path
+              << std::endl;
+    return;
+  }
+  m_stats.diskWrites++;
+}
+
+void ScriptCache::clearMemory() {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  m_compiledScripts.clear();
+  m_serializedScripts.clear();
+}
+
+ScriptCache::Stats ScriptCache::getStats() const {
+  std::lock_guard<std::mutex> lock(m_mutex);
+  return m_stats;
+}
+
+std::string ScriptCache::pathForKey(const std::string &key) const {
+  return m_cacheDirectory + "/" + key + ".bin";
+}
+
+}  // namespace bridge
+}  // namespace mini_rn
@@ -0,0 +1,121 @@
+#ifndef SCRIPTCACHE_H
+#define SCRIPTCACHE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+namespace mini_rn {
+namespace bridge {
+
+/**
+ * ScriptCache - 引擎无关的预编译脚本缓存
+ *
+ * 以源码内容哈希为键，缓存引擎对脚本的编译结果，避免同一个 bundle
+ * 在每次启动时都重新解析。分两层：
+ * 1. 编译句柄（进程内）- 引擎可复用的已编译脚本对象，如 JSC 的
+ *    JSScriptRef，同一进程内重复执行时共享解析结果
+ * 2. 序列化形式（进程内 + 磁盘）- 引擎可导出的预编译产物，如 QuickJS
+ *    字节码，写入缓存目录后跨进程复用。磁盘文件带校验头（长度 + 校验和），
+ *    截断或损坏的文件在读取时删除，不会交给引擎反序列化；
+ *    引擎版本由调用方编码在键的引擎标签中
+ *
+ * 引擎后端决定使用哪一层，本类只负责存取和统计。编译句柄只能在创建它的
+ * 引擎实例内使用时（如 JSC 的上下文组），后端把该实例作为引擎状态保存在
+ * 缓存里，共享同一个缓存的执行器才共享它。
+ * 多个执行器可以共享同一个实例，所有方法都是线程安全的。
+ */
+class ScriptCache {
+ public:
+  /**
+   * 缓存命中统计
+   */
+  struct Stats {
+    size_t hits = 0;        // 进程内命中（编译句柄或序列化形式）
+    size_t diskHits = 0;    // 从缓存目录读取命中
+    size_t misses = 0;      // 未命中，需要从源码编译
+    size_t diskWrites = 0;  // 写入缓存目录的次数
+    size_t diskRejects = 0;  // 校验失败被删除的缓存文件数
+  };
+
+  /**
+   * @param cacheDirectory 持久化目录，为空时只使用进程内缓存
+   */
+  explicit ScriptCache(std::string cacheDirectory = "");
+
+  // 禁用拷贝构造和赋值
+  ScriptCache(const ScriptCache &) = delete;
+  ScriptCache &operator=(const ScriptCache &) = delete;
+
+  /**
+   * 计算源码内容哈希（64 位 FNV-1a）
+   */
+  static uint64_t hashSource(const char *source, size_t length);
+
+  /**
+   * 生成缓存键："<engineTag>-<哈希>-<长度>"
+   * 引擎标签区分不同引擎（以及同一引擎不兼容的编译产物格式）
+   */
+  static std::string makeKey(const char *engineTag, const char *source,
+                             size_t length);
+
+  /**
+   * 查找进程内的编译句柄，未命中返回 nullptr
+   */
+  std::shared_ptr<void> findCompiledScript(const std::string &key);
+
+  /**
+   * 保存编译句柄，句柄的释放方式由 shared_ptr 的删除器决定
+   */
+  void storeCompiledScript(const std::string &key,
+                           std::shared_ptr<void> handle);
+
+  /**
+   * 查找与本缓存绑定的引擎状态，不存在时调用 create 创建
+   * 状态随缓存释放；引用它的编译句柄应在删除器中持有其引用
+   * @param engineTag 引擎标签
+   */
+  std::shared_ptr<void> getEngineState(
+      const char *engineTag,
+      const std::function<std::shared_ptr<void>()> &create);
+
+  /**
+   * 查找序列化的预编译产物：先查进程内，再查缓存目录
+   * 未命中（或缓存文件校验失败）返回 nullptr
+   */
+  std::shared_ptr<const std::string> findSerializedScript(
+      const std::string &key);
+
+  /**
+   * 保存序列化的预编译产物（进程内，且在配置了目录时写入磁盘）
+   */
+  void storeSerializedScript(const std::string &key, std::string data);
+
+  /**
+   * 清空进程内缓存（不删除磁盘文件）
+   */
+  void clearMemory();
+
+  Stats getStats() const;
+  const std::string &getCacheDirectory() const { return m_cacheDirectory; }
+
+ private:
+  std::string pathForKey(const std::string &key) const;
+
+  std::string m_cacheDirectory;
+  mutable std::mutex m_mutex;
+  std::unordered_map<std::string, std::shared_ptr<void>> m_engineStates;
+  std::unordered_map<std::string, std::shared_ptr<void>> m_compiledScripts;
+  std::unordered_map<std::string, std::shared_ptr<const std::string>>
+      m_serializedScripts;
+  Stats m_stats;
+};
+
+}  // namespace bridge
+}  // namespace mini_rn
+
+#endif  // SCRIPTCACHE_H
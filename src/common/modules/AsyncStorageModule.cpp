@@ -0,0 +1,151 @@
+#include "AsyncStorageModule.h"
+
+#include <iostream>
+
+namespace mini_rn {
+namespace modules {
+
+AsyncStorageModule::AsyncStorageModule(const std::string& path)
+    : AsyncStorageModule(path, utils::LogStructuredStore::Options()) {}
+
+AsyncStorageModule::AsyncStorageModule(
+    const std::string& path, utils::LogStructuredStore::Options options)
+    : store_(path, options) {
+  if (store_.open()) {
+    utils::LogStructuredStore::Stats stats = store_.getStats();
+    std::cout << "[AsyncStorageModule] Opened " << path << " with "
+              << stats.keys << " keys (" << stats.fileBytes << " bytes)"
+              << std::endl;
+  }
+}
+
+std::vector<std::string> AsyncStorageModule::getMethods() const {
+  return {
+      "multiGet",     // methodId = 0
+      "multiSet",     // methodId = 1
+      "multiRemove",  // methodId = 2
+      "getAllKeys"    // methodId = 3
+  };
+}
+
+std::vector<std::string> AsyncStorageModule::getPromiseMethods() const {
+  return getMethods();
+}
+
+void AsyncStorageModule::invoke(const std::string& methodName,
+                                const std::string& args, int callId) {
+  if (!argsDocument_.parse(args)) {
+    sendErrorCallback(callId, "Invalid call: " + methodName + args);
+    return;
+  }
+  invokeWithArgs(methodName, argsDocument_.root(), callId);
+}
+
+void AsyncStorageModule::invokeWithArgs(const std::string& methodName,
+                                        const utils::JSONValue& args,
+                                        int callId) {
+  if (!store_.isOpen()) {
+    sendErrorCallback(callId, "AsyncStorage is not available: " +
+                                  store_.getPath());
+    return;
+  }
+
+  if (methodName == "getAllKeys") {
+    utils::Value result = utils::Value::array();
+    for (std::string& key : store_.keys()) {
+      result.push(std::move(key));
+    }
+    sendSuccessCallback(callId, result);
+    return;
+  }
+
+  utils::JSONValue entries = args[0];
+  if (methodName == "multiGet" && entries.isArray()) {
+    utils::Value result = utils::Value::array();
+    std::string value;
+    for (utils::JSONValue key : entries) {
+      if (!key.isString()) {
+        sendErrorCallback(callId, "Invalid key: " + std::string(key.raw()));
+        return;
+      }
+      utils::Value pair = utils::Value::array({std::string(key.asString())});
+      if (store_.get(key.asString(), value)) {
+        pair.push(value);
+      } else {
+        pair.push(nullptr);
+      }
+      result.push(std::move(pair));
+    }
+    stats_.reads += entries.size();
+    sendSuccessCallback(callId, result);
+    return;
+  }
+
+  if (methodName == "multiSet" || methodName == "multiRemove") {
+    utils::LogStructuredStore::WriteBatch batch;
+    if (!buildBatch(entries, methodName == "multiRemove", batch)) {
+      sendErrorCallback(callId,
+                        "Invalid call: " + methodName + std::string(args.raw()));
+      return;
+    }
+    stats_.writes += batch.size();
+    stats_.batches++;
+    // 落盘后在 onTick 中 resolve
+    uint64_t sequence = store_.write(std::move(batch));
+    if (callId >= 0) pendingCallbacks_[sequence] = callId;
+    return;
+  }
+
+  sendErrorCallback(callId,
+                    "Invalid call: " + methodName + std::string(args.raw()));
+}
+
+void AsyncStorageModule::onTick(double /* nowMs */) { deliverCompletions(); }
+
+void AsyncStorageModule::flush() {
+  store_.flush();
+  deliverCompletions();
+}
+
+void AsyncStorageModule::deliverCompletions() {
+  if (pendingCallbacks_.empty()) return;
+
+  for (const auto& completion : store_.takeCompletions()) {
+    auto it = pendingCallbacks_.find(completion.sequence);
+    if (it == pendingCallbacks_.end()) continue;
+    int callId = it->second;
+    pendingCallbacks_.erase(it);
+    if (completion.ok) {
+      sendSuccessCallback(callId, nullptr);
+    } else {
+      sendErrorCallback(callId, "Failed to write " + store_.getPath());
+    }
+  }
+}
+
+bool AsyncStorageModule::buildBatch(
+    const utils::JSONValue& entries, bool remove,
+    utils::LogStructuredStore::WriteBatch& batch) {
+  if (!entries.isArray()) return false;
+
+  batch.reserve(entries.size());
+  for (utils::JSONValue entry : entries) {
+    if (remove) {
+      if (!entry.isString()) return false;
+      batch.push_back({std::string(entry.asString()), std::nullopt});
+      continue;
+    }
+    // multiSet 的每一项是 [key, value]，value 必须是字符串（与 RN 一致）
+    utils::JSONValue key = entry[0];
+    utils::JSONValue value = entry[1];
+    if (entry.size() != 2 || !key.isString() || !value.isString()) {
+      return false;
+    }
+    batch.push_back(
+        {std::string(key.asString()), std::string(value.asString())});
+  }
+  return true;
+}
+
+}  // namespace modules
+}  // namespace mini_rn
@@ -0,0 +1,99 @@
+#ifndef ASYNCSTORAGEMODULE_H
+#define ASYNCSTORAGEMODULE_H
+
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "../utils/LogStructuredStore.h"
+#include "NativeModule.h"
+
+namespace mini_rn {
+namespace modules {
+
+/**
+ * AsyncStorageModule - 持久化键值存储
+ *
+ * 对应 React Native 的 AsyncStorage（RNCAsyncStorage）。RN 在 iOS 上把较大的
+ * value 各存成一个文件，再加一个 manifest JSON，每次写入都要重写 manifest；
+ * 这里改用 utils::LogStructuredStore：所有数据追加到一个日志文件，
+ * 内存中的哈希索引指向 value 在只读映射中的位置。
+ *
+ * 调用语义：
+ * - 所有方法都是 Promise 方法，每个 multi* 调用是一次 Bridge 调用
+ * - multiGet / getAllKeys 在 JS 线程上直接从索引和映射读取，立即返回；
+ *   尚未落盘的写入也能读到
+ * - multiSet / multiRemove 的所有 key 作为一个批次交给 I/O 线程，
+ *   原子地生效；同一轮的多个批次合并为一次 write + 一次 fsync，
+ *   落盘后在下一个 tick（onTick）resolve
+ *
+ * JavaScript 侧方法：
+ * - multiGet(keys) → [[key, value | null], ...]
+ * - multiSet([[key, value], ...]) → null
+ * - multiRemove(keys) → null
+ * - getAllKeys() → [key, ...]
+ */
+class AsyncStorageModule : public NativeModule {
+ public:
+  /**
+   * 调用统计
+   */
+  struct Stats {
+    size_t reads = 0;    // multiGet 读取的 key 数
+    size_t writes = 0;   // multiSet / multiRemove 写入的 key 数
+    size_t batches = 0;  // multiSet / multiRemove 调用数
+  };
+
+  /**
+   * @param path 数据文件路径，不存在时创建
+   */
+  explicit AsyncStorageModule(const std::string& path);
+  AsyncStorageModule(const std::string& path,
+                     utils::LogStructuredStore::Options options);
+  ~AsyncStorageModule() override = default;
+
+  // NativeModule 接口实现
+  std::string getName() const override { return "AsyncStorage"; }
+  std::vector<std::string> getMethods() const override;
+  std::vector<std::string> getPromiseMethods() const override;
+  void invoke(const std::string& methodName, const std::string& args,
+              int callId) override;
+  void invokeWithArgs(const std::string& methodName,
+                      const utils::JSONValue& args, int callId) override;
+  void onTick(double nowMs) override;
+
+  /**
+   * 等待所有写入落盘并投递回调（用于退出前或测试中）
+   */
+  void flush();
+
+  bool isAvailable() const { return store_.isOpen(); }
+  const utils::LogStructuredStore& getStore() const { return store_; }
+  const Stats& getStats() const { return stats_; }
+
+ private:
+  /**
+   * 投递已完成批次的回调
+   */
+  void deliverCompletions();
+
+  /**
+   * 把 keys 数组（或 multiSet 的 [key, value] 数组）转换为写入批次
+   * @return 参数类型不符时返回 false
+   */
+  static bool buildBatch(const utils::JSONValue& entries, bool remove,
+                         utils::LogStructuredStore::WriteBatch& batch);
+
+  // 参数文本（直接 invoke）的解析文档，复用存储
+  utils::JSONDocument argsDocument_;
+  utils::LogStructuredStore store_;
+  // 批次序号 → 等待落盘的 callId
+  std::unordered_map<uint64_t, int> pendingCallbacks_;
+  Stats stats_;
+};
+
+}  // namespace modules
+}  // namespace mini_rn
+
+#endif  // ASYNCSTORAGEMODULE_H
@@ -0,0 +1,145 @@
+#include "BlobModule.h"
+
+#include <cstring>
+#include <iostream>
+
+namespace mini_rn {
+namespace modules {
+
+BlobModule::BlobModule(std::shared_ptr<utils::BlobManager> blobs)
+    : blobs_(std::move(blobs)) {}
+
+std::vector<std::string> BlobModule::getMethods() const {
+  return {
+      "createFromParts",    // methodId = 0
+      "readAsArrayBuffer",  // methodId = 1
+      "readAsText",         // methodId = 2
+      "release"             // methodId = 3
+  };
+}
+
+std::vector<std::string> BlobModule::getPromiseMethods() const {
+  return {"readAsArrayBuffer", "readAsText"};
+}
+
+void BlobModule::invoke(const std::string& methodName,
+                        const std::string& args, int callId) {
+  if (!argsDocument_.parse(args)) {
+    sendErrorCallback(callId, "Invalid call: " + methodName + args);
+    return;
+  }
+  invokeWithArgs(methodName, argsDocument_.root(), callId);
+}
+
+void BlobModule::invokeWithArgs(const std::string& methodName,
+                                const utils::JSONValue& args, int callId) {
+  if (methodName == "createFromParts") {
+    utils::JSONValue blobId = args[1];
+    std::shared_ptr<utils::ByteBuffer> buffer = buildFromParts(args[0]);
+    if (!blobId.isString() || !buffer ||
+        !blobs_->store(std::string(blobId.asString()), std::move(buffer))) {
+      // JS 侧已经同步返回了 Blob，这里只能记录错误
+      std::cout << "[BlobModule] Error: Invalid call: createFromParts"
+                << args.raw() << std::endl;
+    }
+    return;
+  }
+
+  if (methodName == "release") {
+    if (args[0].isString()) blobs_->release(std::string(args[0].asString()));
+    return;
+  }
+
+  Handle handle;
+  if (!parseHandle(args[0], handle)) {
+    sendErrorCallback(callId,
+                      "Invalid call: " + methodName + std::string(args.raw()));
+    return;
+  }
+  std::shared_ptr<utils::ByteBuffer> buffer =
+      blobs_->resolve(handle.blobId, handle.offset, handle.size);
+  if (!buffer) {
+    sendErrorCallback(callId, "Blob not found: " + handle.blobId);
+    return;
+  }
+
+  if (methodName == "readAsArrayBuffer") {
+    // JS 对 ArrayBuffer 的修改不能影响 blob：文件映射的 blob 建立新的
+    // 写时复制映射（不拷贝），其他 blob 拷贝一份
+    sendSuccessCallback(callId,
+                        utils::Value(utils::ByteBuffer::copyOnWrite(buffer)));
+  } else if (methodName == "readAsText") {
+    sendSuccessCallback(callId, std::string(buffer->view()));
+  } else {
+    sendErrorCallback(callId, "Invalid call: " + methodName);
+  }
+}
+
+utils::Value BlobModule::handleToValue(const Handle& handle) {
+  utils::Value value = utils::Value::object();
+  value.set("blobId", handle.blobId);
+  value.set("offset", static_cast<double>(handle.offset));
+  value.set("size", static_cast<double>(handle.size));
+  return value;
+}
+
+bool BlobModule::parseHandle(const utils::JSONValue& value, Handle& handle) {
+  utils::JSONValue blobId = value.get("blobId");
+  utils::JSONValue offset = value.get("offset");
+  utils::JSONValue size = value.get("size");
+  if (!blobId.isString() || !offset.isNumber() || !size.isNumber() ||
+      offset.asNumber() < 0 || size.asNumber() < 0) {
+    return false;
+  }
+  handle.blobId = std::string(blobId.asString());
+  handle.offset = static_cast<size_t>(offset.asNumber());
+  handle.size = static_cast<size_t>(size.asNumber());
+  return true;
+}
+
+std::shared_ptr<utils::ByteBuffer> BlobModule::buildFromParts(
+    const utils::JSONValue& parts) const {
+  if (!parts.isArray()) return nullptr;
+
+  // 先解析所有部分并计算总长度
+  std::vector<std::shared_ptr<utils::ByteBuffer>> blobParts;
+  std::vector<std::string_view> stringParts;
+  std::vector<bool> isBlob;
+  size_t total = 0;
+  for (utils::JSONValue part : parts) {
+    std::string_view type = part.get("type").asString();
+    if (type == "string" && part.get("data").isString()) {
+      stringParts.push_back(part.get("data").asString());
+      isBlob.push_back(false);
+      total += stringParts.back().size();
+    } else if (type == "blob") {
+      Handle handle;
+      if (!parseHandle(part, handle)) return nullptr;
+      auto buffer = blobs_->resolve(handle.blobId, handle.offset, handle.size);
+      if (!buffer) return nullptr;
+      blobParts.push_back(std::move(buffer));
+      isBlob.push_back(true);
+      total += blobParts.back()->size();
+    } else {
+      return nullptr;
+    }
+  }
+
+  // 只有一个 blob 部分：与原 blob 共享内存
+  if (isBlob.size() == 1 && isBlob[0]) return blobParts[0];
+
+  std::string joined;
+  joined.reserve(total);
+  size_t blobIndex = 0, stringIndex = 0;
+  for (bool blob : isBlob) {
+    if (blob) {
+      joined.append(blobParts[blobIndex++]->view());
+    } else {
+      joined.append(stringParts[stringIndex++]);
+    }
+  }
+  return utils::ByteBuffer::copy(joined.data(), joined.size());
+}
+
+}  // namespace modules
+}  // namespace mini_rn
@@ -0,0 +1,86 @@
+#ifndef BLOBMODULE_H
+#define BLOBMODULE_H
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "../utils/BlobManager.h"
+#include "NativeModule.h"
+
+namespace mini_rn {
+namespace modules {
+
+/**
+ * BlobModule - JS 侧 Blob 的 Native 存储
+ *
+ * 对应 React Native 的 BlobModule。Blob 的数据保存在 utils::BlobManager 中，
+ * Bridge 上只传递句柄对象 {blobId, offset, size}：
+ * - JS 的 Blob.slice 只生成新的句柄，不经过 Native
+ * - 其他模块（如 FileSystemModule）接受和返回句柄，数据在 Native 之间按引用传递
+ * - readAsArrayBuffer 把 blob 的区间作为独立的 ArrayBuffer 交给 JS（JS 可以写
+ *   ArrayBuffer，blob 的内存还被其他句柄和模块共享，不能直接交出去）：
+ *   文件映射的 blob（readFileAsBlob 的大文件）对同一区间建立新的写时复制
+ *   映射，不拷贝；其他 blob（字符串拼接、小文件）拷贝一份
+ *
+ * 同一个 BlobManager 由 BlobModule 和其他使用 blob 的模块共享，
+ * 在注册模块前创建并分别传入。
+ *
+ * JavaScript 侧方法：
+ * - createFromParts(parts, blobId)：parts 的每一项是 {type: 'string', data}
+ *   或 {type: 'blob', blobId, offset, size}；只有一个 blob 部分时与原 blob
+ *   共享内存，否则拼接为新的缓冲区。blobId 由 JS 生成，JS 可以立即使用
+ * - readAsArrayBuffer(handle) → ArrayBuffer（Promise，写入不影响 blob）
+ * - readAsText(handle) → string（Promise，按 UTF-8 解释）
+ * - release(blobId)：JS 侧不再引用该 blob
+ */
+class BlobModule : public NativeModule {
+ public:
+  /**
+   * Bridge 上的 blob 句柄
+   */
+  struct Handle {
+    std::string blobId;
+    size_t offset = 0;
+    size_t size = 0;
+  };
+
+  explicit BlobModule(std::shared_ptr<utils::BlobManager> blobs);
+  ~BlobModule() override = default;
+
+  // NativeModule 接口实现
+  std::string getName() const override { return "BlobModule"; }
+  std::vector<std::string> getMethods() const override;
+  std::vector<std::string> getPromiseMethods() const override;
+  void invoke(const std::string& methodName, const std::string& args,
+              int callId) override;
+  void invokeWithArgs(const std::string& methodName,
+                      const utils::JSONValue& args, int callId) override;
+
+  /**
+   * 句柄与 JSON 对象之间的转换（供其他模块使用）
+   */
+  static utils::Value handleToValue(const Handle& handle);
+  static bool parseHandle(const utils::JSONValue& value, Handle& handle);
+
+  const std::shared_ptr<utils::BlobManager>& getBlobManager() const {
+    return blobs_;
+  }
+
+ private:
+  /**
+   * 按 parts 构造 blob 的数据
+   * @return parts 格式错误或引用的 blob 不存在时返回 nullptr
+   */
+  std::shared_ptr<utils::ByteBuffer> buildFromParts(
+      const utils::JSONValue& parts) const;
+
+  // 参数文本（直接 invoke）的解析文档，复用存储
+  utils::JSONDocument argsDocument_;
+  std::shared_ptr<utils::BlobManager> blobs_;
+};
+
+}  // namespace modules
+}  // namespace mini_rn
+
+#endif  // BLOBMODULE_H
@@ -56,6 +56,15 @@ class DeviceInfoModule : public NativeModule {
   //   std::map<std::string, std::string> getConstants() const override;
   void invoke(const std::string& methodName, const std::string& args,
               int callId) override;
+  std::vector<std::string> getPromiseMethods() const override;
+  std::vector<std::string> getSyncMethods() const override;
+  std::string invokeSync(const std::string& methodName,
+                         const std::string& args) override;
+
+  /**
+   * 设备信息在进程生命周期内不变，所有 getter 的结果都缓存
+   */
+  std::map<std::string, double> getCacheableMethods() const override;
 
   /**
    * 平台特定的设备信息获取接口
@@ -0,0 +1,146 @@
+#include "EventEmitterModule.h"
+
+#include <iostream>
+#include <utility>
+
+#include "../utils/JSONParser.h"
+
+namespace mini_rn {
+namespace modules {
+
+std::vector<std::string> EventEmitterModule::getMethods() const {
+  return {
+      "addListener",     // methodId = 0
+      "removeListeners"  // methodId = 1
+  };
+}
+
+void EventEmitterModule::invoke(const std::string& methodName,
+                                const std::string& args, int callId) {
+  std::string eventName = parseEventName(args);
+  if (eventName.empty()) {
+    sendErrorCallback(callId, "Missing event name for " + methodName);
+    return;
+  }
+
+  EventTypeState& state = eventTypes_[eventName];
+  if (methodName == "addListener") {
+    state.listenerCount++;
+  } else if (methodName == "removeListeners") {
+    if (state.listenerCount > 0) state.listenerCount--;
+  } else {
+    sendErrorCallback(callId, "Unknown method: " + methodName);
+    return;
+  }
+
+  std::cout << "[EventEmitterModule] " << methodName << "(" << eventName
+            << "), listeners: " << state.listenerCount << std::endl;
+}
+
+bool EventEmitterModule::emit(const std::string& eventName,
+                              const std::string& bodyJson, int target,
+                              bool coalesce) {
+  stats_.emitted++;
+
+  auto typeIt = eventTypes_.find(eventName);
+  if (typeIt == eventTypes_.end() || typeIt->second.listenerCount == 0) {
+    stats_.dropped++;
+    return false;
+  }
+
+  std::string body = bodyJson.empty() ? "null" : bodyJson;
+  std::string key = makeCoalescingKey(eventName, target);
+
+  if (coalesce) {
+    auto it = pendingIndex_.find(key);
+    if (it != pendingIndex_.end() && pending_[it->second].coalesce) {
+      // 覆盖尚未投递的旧事件，保留它在队列中的位置
+      pending_[it->second].bodyJson = std::move(body);
+      stats_.coalesced++;
+      return true;
+    }
+  }
+
+  pendingIndex_[key] = pending_.size();
+  pending_.push_back({eventName, target, std::move(body), coalesce});
+  return true;
+}
+
+void EventEmitterModule::setRateLimit(const std::string& eventName,
+                                      double minIntervalMs) {
+  eventTypes_[eventName].minIntervalMs = minIntervalMs > 0 ? minIntervalMs : 0;
+}
+
+int EventEmitterModule::getListenerCount(const std::string& eventName) const {
+  auto it = eventTypes_.find(eventName);
+  return it == eventTypes_.end() ? 0 : it->second.listenerCount;
+}
+
+void EventEmitterModule::onTick(double nowMs) {
+  if (pending_.empty()) return;
+
+  std::vector<PendingEvent> held;
+  std::vector<EventTypeState*> deliveredTypes;
+  std::string batch = "[";
+  size_t batchSize = 0;
+
+  for (auto& event : pending_) {
+    EventTypeState& state = eventTypes_[event.name];
+    if (state.minIntervalMs > 0 && state.delivered &&
+        nowMs - state.lastDeliveryMs < state.minIntervalMs) {
+      // 未到最小投递间隔，留到后续 tick（期间仍可被新事件覆盖）
+      held.push_back(std::move(event));
+      continue;
+    }
+
+    if (batchSize > 0) batch += ",";
+    batch += "[" + utils::quoteJSONString(event.name) + "," +
+             std::to_string(event.target) + "," + event.bodyJson + "]";
+    batchSize++;
+    deliveredTypes.push_back(&state);
+  }
+  batch += "]";
+
+  // 循环结束后再更新投递时间，同一 tick 内同类型的多个事件一起投递
+  for (EventTypeState* state : deliveredTypes) {
+    state->lastDeliveryMs = nowMs;
+    state->delivered = true;
+  }
+
+  // 先整理好队列再调用 JS，JS 监听器中可能再次 emit
+  pending_ = std::move(held);
+  pendingIndex_.clear();
+  for (size_t i = 0; i < pending_.size(); ++i) {
+    pendingIndex_[makeCoalescingKey(pending_[i].name, pending_[i].target)] = i;
+  }
+
+  if (batchSize == 0) return;
+
+  stats_.delivered += batchSize;
+  stats_.batches++;
+  callJSFunction("RCTDeviceEventEmitter", "receiveEvents", "[" + batch + "]");
+}
+
+std::string EventEmitterModule::makeCoalescingKey(const std::string& eventName,
+                                                  int target) {
+  std::string key = eventName;
+  key += '\0';
+  key += std::to_string(target);
+  return key;
+}
+
+std::string EventEmitterModule::parseEventName(const std::string& args) {
+  size_t start = args.find('"');
+  if (start == std::string::npos) return "";
+
+  size_t end = start + 1;
+  while (end < args.size() && args[end] != '"') {
+    if (args[end] == '\\') end++;
+    end++;
+  }
+  if (end >= args.size()) return "";
+  return args.substr(start + 1, end - start - 1);
+}
+
+}  // namespace modules
+}  // namespace mini_rn
@@ -0,0 +1,129 @@
+#ifndef EVENTEMITTERMODULE_H
+#define EVENTEMITTERMODULE_H
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "NativeModule.h"
+
+namespace mini_rn {
+namespace modules {
+
+/**
+ * EventEmitterModule - Native → JS 事件推送模块
+ *
+ * 对应 React Native 的 RCTEventEmitter / RCTDeviceEventEmitter 链路：
+ * Native 侧调用 emit() 产生事件，每个 tick 把积攒的事件合并成一次
+ * callFunction("RCTDeviceEventEmitter", "receiveEvents", [events]) 投递，
+ * 由 src/js/EventEmitter.js 分发给 JS 监听器。
+ *
+ * 减少跨 Bridge 调用的三种手段：
+ * 1. 监听计数 - JS 没有监听某个事件名时，emit() 直接丢弃
+ * 2. 合并 - 事件以 (name, target) 为键，同一 tick 内新事件覆盖尚未投递的
+ *    旧事件（如滚动、传感器、进度），只保留最新值
+ * 3. 限频 - 可按事件名设置最小投递间隔，未到间隔的事件留到后续 tick
+ *
+ * JavaScript 侧方法：
+ * - addListener(eventName): 事件名的监听数 +1
+ * - removeListeners(eventName): 事件名的监听数 -1
+ */
+class EventEmitterModule : public NativeModule {
+ public:
+  /**
+   * 广播事件的 target（不针对具体视图）
+   */
+  static constexpr int kNoTarget = -1;
+
+  EventEmitterModule() = default;
+  ~EventEmitterModule() override = default;
+
+  // NativeModule 接口实现
+  std::string getName() const override { return "EventEmitter"; }
+  std::vector<std::string> getMethods() const override;
+  void invoke(const std::string& methodName, const std::string& args,
+              int callId) override;
+  void onTick(double nowMs) override;
+
+  /**
+   * 发送事件，在下一次 tick 时投递
+   *
+   * @param eventName 事件名称
+   * @param bodyJson 事件数据的 JSON 文本
+   * @param target 事件目标（如视图 tag），kNoTarget 表示广播
+   * @param coalesce 是否允许被同键的后续事件覆盖（离散事件如点击应传 false）
+   * @return 没有 JS 监听器而被丢弃时返回 false
+   */
+  bool emit(const std::string& eventName, const std::string& bodyJson,
+            int target = kNoTarget, bool coalesce = true);
+
+  /**
+   * 设置事件的最小投递间隔，0 表示不限频
+   * @param eventName 事件名称
+   * @param minIntervalMs 两次投递之间的最小间隔（毫秒）
+   */
+  void setRateLimit(const std::string& eventName, double minIntervalMs);
+
+  /**
+   * 获取 JS 侧对某个事件名的监听数
+   */
+  int getListenerCount(const std::string& eventName) const;
+
+  /**
+   * 获取尚未投递的事件数
+   */
+  size_t getPendingEventCount() const { return pending_.size(); }
+
+  /**
+   * 投递统计
+   */
+  struct Stats {
+    size_t emitted = 0;    // emit() 被调用的次数
+    size_t dropped = 0;    // 没有监听器而丢弃的事件数
+    size_t coalesced = 0;  // 被后续事件覆盖的事件数
+    size_t delivered = 0;  // 实际投递到 JS 的事件数
+    size_t batches = 0;    // callFunction 调用次数
+  };
+
+  const Stats& getStats() const { return stats_; }
+
+ private:
+  /**
+   * 等待投递的事件
+   */
+  struct PendingEvent {
+    std::string name;
+    int target;
+    std::string bodyJson;
+    bool coalesce;
+  };
+
+  /**
+   * 每个事件名的投递状态
+   */
+  struct EventTypeState {
+    int listenerCount = 0;
+    double minIntervalMs = 0;
+    double lastDeliveryMs = 0;
+    bool delivered = false;  // 是否投递过（首次投递不受限频约束）
+  };
+
+  // 合并键：name + '\0' + target
+  static std::string makeCoalescingKey(const std::string& eventName,
+                                       int target);
+
+  // 从参数数组中取出第一个字符串参数，如 ["progress"] → progress
+  static std::string parseEventName(const std::string& args);
+
+  // 按到达顺序排列的待投递事件
+  std::vector<PendingEvent> pending_;
+  // 合并键 → pending_ 中的下标
+  std::unordered_map<std::string, size_t> pendingIndex_;
+  std::unordered_map<std::string, EventTypeState> eventTypes_;
+  Stats stats_;
+};
+
+}  // namespace modules
+}  // namespace mini_rn
+
+#endif  // EVENTEMITTERMODULE_H
@@ -0,0 +1,335 @@
+#include "FileSystemModule.h"
+
+#include "BlobModule.h"
+
+#include <dirent.h>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstring>
+#include <utility>
+
+namespace mini_rn {
+namespace modules {
+
+namespace {
+
+std::string describeError(const std::string& path) {
+  return path + ": " + std::strerror(errno);
+}
+
+}  // namespace
+
+FileSystemModule::FileSystemModule(size_t ioThreads,
+                                   std::shared_ptr<utils::BlobManager> blobs)
+    : blobs_(std::move(blobs)), workers_(ioThreads) {}
+
+std::vector<std::string> FileSystemModule::getMethods() const {
+  return {
+      "stat",       // methodId = 0
+      "readDir",    // methodId = 1
+      "readFile",   // methodId = 2
+      "writeFile",      // methodId = 3
+      "readFileAsBlob"  // methodId = 4
+  };
+}
+
+std::vector<std::string> FileSystemModule::getPromiseMethods() const {
+  return getMethods();
+}
+
+void FileSystemModule::invoke(const std::string& methodName,
+                              const std::string& args, int callId) {
+  if (!argsDocument_.parse(args)) {
+    sendErrorCallback(callId, "Invalid call: " + methodName + args);
+    return;
+  }
+  invokeWithArgs(methodName, argsDocument_.root(), callId);
+}
+
+void FileSystemModule::invokeWithArgs(const std::string& methodName,
+                                      const utils::JSONValue& args,
+                                      int callId) {
+  utils::JSONValue path = args[0];
+  if (!path.isString()) {
+    sendErrorCallback(callId,
+                      "Invalid call: " + methodName + std::string(args.raw()));
+    return;
+  }
+  // 参数只在本次调用期间有效，交给 I/O 线程前复制
+  std::string pathString(path.asString());
+
+  if (methodName == "stat") {
+    post(callId, [pathString] { return stat(pathString); });
+    return;
+  }
+
+  if (methodName == "readDir") {
+    post(callId, [pathString] { return readDir(pathString); });
+    return;
+  }
+
+  if (methodName == "readFile" || methodName == "readFileAsBlob") {
+    if (methodName == "readFileAsBlob" && !blobs_) {
+      sendErrorCallback(callId, "Blob support is not available");
+      return;
+    }
+    utils::JSONValue offset = args[1];
+    utils::JSONValue length = args[2];
+    uint64_t offsetValue =
+        offset.isNumber() && offset.asNumber() > 0
+            ? static_cast<uint64_t>(offset.asNumber())
+            : 0;
+    int64_t lengthValue = length.isNumber()
+                              ? static_cast<int64_t>(length.asNumber())
+                              : -1;
+    if (methodName == "readFileAsBlob") {
+      post(callId, [this, pathString, offsetValue, lengthValue] {
+        return readFileAsBlob(pathString, offsetValue, lengthValue);
+      });
+    } else {
+      post(callId, [this, pathString, offsetValue, lengthValue] {
+        return readFile(pathString, offsetValue, lengthValue);
+      });
+    }
+    return;
+  }
+
+  if (methodName == "writeFile") {
+    utils::JSONValue contents = args[1];
+    bool append = args[2].isBool() && args[2].asBool();
+    if (contents.isString()) {
+      post(callId, [pathString, text = std::string(contents.asString()),
+                    append] { return writeFile(pathString, text, append); });
+      return;
+    }
+
+    // blob 句柄：在 JS 线程上解析，I/O 线程直接写出 blob 的内存
+    BlobModule::Handle handle;
+    if (!BlobModule::parseHandle(contents, handle)) {
+      sendErrorCallback(callId, "Invalid call: " + methodName +
+                                    std::string(args.raw()));
+      return;
+    }
+    if (!blobs_) {
+      sendErrorCallback(callId, "Blob support is not available");
+      return;
+    }
+    std::shared_ptr<utils::ByteBuffer> buffer =
+        blobs_->resolve(handle.blobId, handle.offset, handle.size);
+    if (!buffer) {
+      sendErrorCallback(callId, "Blob not found: " + handle.blobId);
+      return;
+    }
+    post(callId, [pathString, buffer = std::move(buffer), append] {
+      return writeFile(pathString, buffer->view(), append);
+    });
+    return;
+  }
+
+  sendErrorCallback(callId,
+                    "Invalid call: " + methodName + std::string(args.raw()));
+}
+
+void FileSystemModule::onTick(double /* nowMs */) { deliverCompletions(); }
+
+void FileSystemModule::onMemoryPressure(MemoryPressureLevel /* level */) {
+  bufferPool_.trim();
+}
+
+void FileSystemModule::flush() {
+  workers_.waitIdle();
+  deliverCompletions();
+}
+
+template <typename Operation>
+void FileSystemModule::post(int callId, Operation operation) {
+  workers_.post([this, callId, operation = std::move(operation)] {
+    Completion completion = operation();
+    completion.callId = callId;
+    std::lock_guard<std::mutex> lock(mutex_);
+    completions_.push_back(std::move(completion));
+  });
+}
+
+void FileSystemModule::deliverCompletions() {
+  std::vector<Completion> completions;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (completions_.empty()) return;
+    completions.swap(completions_);
+  }
+
+  for (Completion& completion : completions) {
+    if (!completion.ok) {
+      stats_.failures++;
+      sendErrorCallback(completion.callId, completion.error);
+      continue;
+    }
+    if (completion.read) {
+      stats_.reads++;
+      if (completion.mapped) stats_.mappedReads++;
+      stats_.bytesRead += completion.bytes;
+    } else if (completion.result.isNull()) {  // 只有 writeFile 返回 null
+      stats_.writes++;
+    }
+    sendSuccessCallback(completion.callId, completion.result);
+  }
+}
+
+FileSystemModule::Completion FileSystemModule::stat(const std::string& path) {
+  Completion completion;
+  struct stat info;
+  if (::stat(path.c_str(), &info) != 0) {
+    completion.error = describeError(path);
+    return completion;
+  }
+
+#ifdef __APPLE__
+  double modifiedMs = info.st_mtimespec.tv_sec * 1000.0 +
+                      info.st_mtimespec.tv_nsec / 1000000.0;
+#else
+  double modifiedMs =
+      info.st_mtim.tv_sec * 1000.0 + info.st_mtim.tv_nsec / 1000000.0;
+#endif
+
+  utils::Value result = utils::Value::object();
+  result.set("size", static_cast<double>(info.st_size));
+  result.set("isFile", S_ISREG(info.st_mode) != 0);
+  result.set("isDirectory", S_ISDIR(info.st_mode) != 0);
+  result.set("modified", modifiedMs);
+  completion.ok = true;
+  completion.result = std::move(result);
+  return completion;
+}
+
+FileSystemModule::Completion FileSystemModule::readDir(
+    const std::string& path) {
+  Completion completion;
+  DIR* directory = opendir(path.c_str());
+  if (!directory) {
+    completion.error = describeError(path);
+    return completion;
+  }
+
+  utils::Value result = utils::Value::array();
+  while (struct dirent* entry = readdir(directory)) {
+    if (std::strcmp(entry->d_name, ".") == 0 ||
+        std::strcmp(entry->d_name, "..") == 0) {
+      continue;
+    }
+    result.push(std::string(entry->d_name));
+  }
+  closedir(directory);
+
+  completion.ok = true;
+  completion.result = std::move(result);
+  return completion;
+}
+
+FileSystemModule::Completion FileSystemModule::readFile(
+    const std::string& path, uint64_t offset, int64_t length, bool keepFile) {
+  Completion completion;
+  int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+  if (fd < 0) {
+    completion.error = describeError(path);
+    return completion;
+  }
+
+  struct stat info;
+  if (fstat(fd, &info) != 0) {
+    completion.error = describeError(path);
+    ::close(fd);
+    return completion;
+  }
+  if (!S_ISREG(info.st_mode)) {
+    completion.error = path + ": Not a regular file";
+    ::close(fd);
+    return completion;
+  }
+
+  uint64_t fileSize = static_cast<uint64_t>(info.st_size);
+  if (offset > fileSize) offset = fileSize;
+  uint64_t available = fileSize - offset;
+  size_t size = static_cast<size_t>(
+      length < 0 || static_cast<uint64_t>(length) > available ? available
+                                                              : length);
+
+  std::shared_ptr<utils::ByteBuffer> buffer;
+  if (size >= kMapThreshold) {
+    buffer = utils::ByteBuffer::mapFile(fd, offset, size, keepFile);
+    completion.mapped = buffer != nullptr;
+  }
+  if (!buffer) {
+    buffer = bufferPool_.acquire(size);
+    size_t done = 0;
+    while (done < size) {
+      ssize_t n = pread(fd, buffer->data() + done, size - done,
+                        static_cast<off_t>(offset + done));
+      if (n < 0 && errno == EINTR) continue;
+      if (n < 0) {
+        completion.error = describeError(path);
+        ::close(fd);
+        return completion;
+      }
+      if (n == 0) break;  // 文件在读取期间被截短
+      done += static_cast<size_t>(n);
+    }
+    buffer->truncate(done);
+  }
+  ::close(fd);
+
+  completion.ok = true;
+  completion.read = true;
+  completion.bytes = buffer->size();
+  completion.result = utils::Value(std::move(buffer));
+  return completion;
+}
+
+FileSystemModule::Completion FileSystemModule::readFileAsBlob(
+    const std::string& path, uint64_t offset, int64_t length) {
+  Completion completion = readFile(path, offset, length, true);
+  if (!completion.ok) return completion;
+
+  // 读到的缓冲区直接成为 blob 的内容，JS 只拿到句柄
+  BlobModule::Handle handle;
+  handle.size = completion.bytes;
+  handle.blobId = blobs_->store(completion.result.asArrayBuffer());
+  completion.result = BlobModule::handleToValue(handle);
+  return completion;
+}
+
+FileSystemModule::Completion FileSystemModule::writeFile(
+    const std::string& path, std::string_view contents, bool append) {
+  Completion completion;
+  int flags = O_WRONLY | O_CREAT | O_CLOEXEC | (append ? O_APPEND : O_TRUNC);
+  int fd = ::open(path.c_str(), flags, 0644);
+  if (fd < 0) {
+    completion.error = describeError(path);
+    return completion;
+  }
+
+  size_t done = 0;
+  while (done < contents.size()) {
+    ssize_t n = ::write(fd, contents.data() + done, contents.size() - done);
+    if (n < 0 && errno == EINTR) continue;
+    if (n < 0) {
+      completion.error = describeError(path);
+      ::close(fd);
+      return completion;
+    }
+    done += static_cast<size_t>(n);
+  }
+  if (::close(fd) != 0) {
+    completion.error = describeError(path);
+    return completion;
+  }
+
+  completion.ok = true;
+  return completion;
+}
+
+}  // namespace modules
+}  // namespace mini_rn
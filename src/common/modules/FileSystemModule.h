@@ -0,0 +1,146 @@
+#ifndef FILESYSTEMMODULE_H
+#define FILESYSTEMMODULE_H
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "../utils/BlobManager.h"
+#include "../utils/ByteBuffer.h"
+#include "../utils/WorkerPool.h"
+#include "NativeModule.h"
+
+namespace mini_rn {
+namespace modules {
+
+/**
+ * FileSystemModule - 文件系统访问
+ *
+ * 读取的文件内容以 ArrayBuffer 交给 JS：回调结果是 ArrayBuffer 类型的
+ * utils::Value，执行器直接把 Native 内存包装成 JS ArrayBuffer，
+ * 文件字节不会变成 base64 或 JSON 文本：
+ * - 较大的读取（不小于 kMapThreshold）使用写时复制的文件映射，
+ *   只有 JS 实际访问到的页才会从磁盘读入；映射期间文件不应被其他进程截短
+ *   （访问截掉的部分会触发 SIGBUS），适用于资源、缓存等只读文件
+ * - 较小的读取（如流式读取的分块）读入 BufferPool 中的缓冲区，
+ *   ArrayBuffer 被回收后缓冲区放回池中复用
+ *
+ * 所有操作都在专门的 I/O 线程池上执行，同时进行的操作数不超过线程数；
+ * 结果放进完成队列，在下一个 tick（onTick）投递给 JS。
+ *
+ * JavaScript 侧方法（都是 Promise 方法）：
+ * - stat(path) → {size, isFile, isDirectory, modified}
+ * - readDir(path) → [name, ...]（不含 . 和 ..，顺序不确定）
+ * - readFile(path, offset, length) → ArrayBuffer（length 为 -1 时读到文件末尾，
+ *   offset 超过文件末尾时返回空 ArrayBuffer；流式读取由 JS 按块调用）
+ * - writeFile(path, contents, append) → null（contents 为 UTF-8 文本或 blob 句柄）
+ * - readFileAsBlob(path, offset, length) → blob 句柄 {blobId, offset, size}
+ *   （参数同 readFile；内容保存在 BlobManager 中，可以直接交给 writeFile
+ *   或其他接受 blob 的模块，不经过 JS）
+ *
+ * blob 相关方法需要在构造时传入与 BlobModule 共享的 BlobManager，
+ * 否则调用时 reject。
+ */
+class FileSystemModule : public NativeModule {
+ public:
+  // 不小于此长度的读取使用文件映射
+  static constexpr size_t kMapThreshold = 256 * 1024;
+
+  /**
+   * 调用统计
+   */
+  struct Stats {
+    size_t reads = 0;        // 成功的 readFile 次数
+    size_t mappedReads = 0;  // 其中使用文件映射的次数
+    size_t bytesRead = 0;    // 交给 JS 的字节数
+    size_t writes = 0;       // 成功的 writeFile 次数
+    size_t failures = 0;     // 失败（reject）的调用数
+  };
+
+  /**
+   * @param ioThreads I/O 线程数，即同时进行的文件操作数上限
+   * @param blobs 与 BlobModule 共享的 blob 存储，为空时不支持 blob
+   */
+  explicit FileSystemModule(size_t ioThreads = 2,
+                            std::shared_ptr<utils::BlobManager> blobs = nullptr);
+  ~FileSystemModule() override = default;
+
+  // NativeModule 接口实现
+  std::string getName() const override { return "FileSystem"; }
+  std::vector<std::string> getMethods() const override;
+  std::vector<std::string> getPromiseMethods() const override;
+  void invoke(const std::string& methodName, const std::string& args,
+              int callId) override;
+  void invokeWithArgs(const std::string& methodName,
+                      const utils::JSONValue& args, int callId) override;
+  void onTick(double nowMs) override;
+  // 释放缓冲池中的空闲缓冲区
+  void onMemoryPressure(MemoryPressureLevel level) override;
+
+  /**
+   * 等待已提交的操作全部完成并投递回调（用于测试或退出前）
+   */
+  void flush();
+
+  const Stats& getStats() const { return stats_; }
+  const utils::BufferPool& getBufferPool() const { return bufferPool_; }
+  const utils::WorkerPool& getWorkerPool() const { return workers_; }
+
+ private:
+  /**
+   * 一次文件操作的结果，由 I/O 线程产生
+   */
+  struct Completion {
+    int callId = -1;
+    bool ok = false;
+    utils::Value result;
+    std::string error;
+    bool read = false;    // 是否是读取操作（readFile / readFileAsBlob）
+    bool mapped = false;  // 读取是否使用了文件映射
+    size_t bytes = 0;     // 读取的字节数
+  };
+
+  // 以下函数在 I/O 线程上执行
+  static Completion stat(const std::string& path);
+  static Completion readDir(const std::string& path);
+  // keepFile：映射时保留文件描述符（blob 的内容），
+  // 之后交给 JS 时可以建立新的写时复制映射而不拷贝
+  Completion readFile(const std::string& path, uint64_t offset,
+                      int64_t length, bool keepFile = false);
+  Completion readFileAsBlob(const std::string& path, uint64_t offset,
+                            int64_t length);
+  static Completion writeFile(const std::string& path,
+                              std::string_view contents, bool append);
+
+  /**
+   * 把操作交给 I/O 线程，完成后放进完成队列
+   */
+  template <typename Operation>
+  void post(int callId, Operation operation);
+
+  /**
+   * 投递已完成操作的回调
+   */
+  void deliverCompletions();
+
+  // 参数文本（直接 invoke）的解析文档，复用存储
+  utils::JSONDocument argsDocument_;
+  utils::BufferPool bufferPool_;
+  std::shared_ptr<utils::BlobManager> blobs_;
+  Stats stats_;
+
+  std::mutex mutex_;
+  std::vector<Completion> completions_;  // 受 mutex_ 保护
+
+  // 放在最后：析构时最先执行完队列中的任务并停止线程，
+  // 任务用到的其他成员此时都还有效
+  utils::WorkerPool workers_;
+};
+
+}  // namespace modules
+}  // namespace mini_rn
+
+#endif  // FILESYSTEMMODULE_H
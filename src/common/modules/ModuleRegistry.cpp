@@ -1,13 +1,41 @@
 #include "ModuleRegistry.h"
 
+#include <algorithm>
+#include <chrono>
 #include <iostream>
 #include <stdexcept>
 
-#include "DeviceInfoModule.h"
+#include "../utils/JSONParser.h"
+#include "../utils/Logging.h"
 
 namespace mini_rn {
 namespace modules {
 
+namespace {
+
+// 方法名 → 在 getMethods 中的下标组成的 JSON 数组，如 [1,2]
+std::string methodIdList(const std::vector<std::string>& methods,
+                         const std::vector<std::string>& subset) {
+  std::string ids = "[";
+  for (const auto& name : subset) {
+    for (size_t i = 0; i < methods.size(); ++i) {
+      if (methods[i] != name) continue;
+      if (ids.size() > 1) ids += ",";
+      ids += std::to_string(i);
+      break;
+    }
+  }
+  return ids + "]";
+}
+
+// 与 JSExecutor::tick() 相同的时间基准
+double steadyNowMs() {
+  auto now = std::chrono::steady_clock::now().time_since_epoch();
+  return std::chrono::duration<double, std::milli>(now).count();
+}
+
+}  // namespace
+
 ModuleRegistry::ModuleRegistry(
     std::vector<std::unique_ptr<NativeModule>> modules)
     : modules_(std::move(modules)) {
@@ -21,8 +49,8 @@ ModuleRegistry::ModuleRegistry(
   // 初始化模块名称映射
   updateModuleNamesFromIndex(0);
 
-  std::cout << "[ModuleRegistry] Initialized with " << modules_.size()
-            << " modules" << std::endl;
+  MINI_RN_LOG(INFO, "[ModuleRegistry] Initialized with " << modules_.size()
+              << " modules");
 }
 
 void ModuleRegistry::registerModules(
@@ -55,8 +83,9 @@ void ModuleRegistry::registerModules(
   // 更新模块名称映射
   updateModuleNamesFromIndex(startIndex);
 
-  std::cout << "[ModuleRegistry] Registered " << (modules_.size() - startIndex)
-            << " new modules, total: " << modules_.size() << std::endl;
+  MINI_RN_LOG(INFO, "[ModuleRegistry] Registered "
+              << (modules_.size() - startIndex) << " new modules, total: "
+              << modules_.size());
 }
 
 std::vector<std::string> ModuleRegistry::moduleNames() {
@@ -72,12 +101,14 @@ std::vector<std::string> ModuleRegistry::moduleNames() {
   return names;
 }
 
-void ModuleRegistry::callNativeMethod(unsigned int moduleId,
-                                      unsigned int methodId,
-                                      const std::string& params, int callId) {
-  std::cout << "[ModuleRegistry] Calling method - Module ID: " << moduleId
-            << ", Method ID: " << methodId << ", Call ID: " << callId
-            << std::endl;
+template <typename Invoke>
+void ModuleRegistry::dispatchNativeMethod(unsigned int moduleId,
+                                          unsigned int methodId,
+                                          std::string_view args, int callId,
+                                          Invoke&& invoke) {
+  MINI_RN_LOG(DEBUG, "[ModuleRegistry] Calling method - Module ID: "
+              << moduleId << ", Method ID: " << methodId << ", Call ID: "
+              << callId);
 
   // 验证模块和方法 ID
   if (!validateIds(moduleId, methodId)) {
@@ -90,23 +121,22 @@ void ModuleRegistry::callNativeMethod(unsigned int moduleId,
 
   try {
     NativeModule* module = modules_[moduleId].get();
-    std::vector<std::string> methods = module->getMethods();
-
-    if (methodId >= methods.size()) {
-      std::string error = "Method ID " + std::to_string(methodId) +
-                          " out of range for module '" + module->getName() +
-                          "'";
-      std::cout << "[ModuleRegistry] Error: " << error << std::endl;
-      sendErrorCallback(callId, error);
+    const MethodTable& table = methodTables_[moduleId];
+    const std::string& methodName = table.methods[methodId];
+    MINI_RN_LOG(DEBUG, "[ModuleRegistry] Invoking method '" << methodName
+                << "' on module '" << table.moduleName << "'");
+
+    // 先记录再调用：模块可能在 invoke 中同步回调
+    trackCall(moduleId, methodId, callId, args.size());
+
+    // 可缓存方法命中缓存或合并到在途调用时，不再调用模块
+    if (table.cacheTtlMs[methodId] > 0 &&
+        serveFromCache(moduleId, methodId, args, callId)) {
       return;
     }
 
-    std::string methodName = methods[methodId];
-    std::cout << "[ModuleRegistry] Invoking method '" << methodName
-              << "' on module '" << module->getName() << "'" << std::endl;
-
     // 调用模块方法
-    module->invoke(methodName, params, callId);
+    invoke(module, methodName);
 
   } catch (const std::exception& e) {
     std::string error = "Exception in module method: " + std::string(e.what());
@@ -119,6 +149,25 @@ void ModuleRegistry::callNativeMethod(unsigned int moduleId,
   }
 }
 
+void ModuleRegistry::callNativeMethod(unsigned int moduleId,
+                                      unsigned int methodId,
+                                      const std::string& params, int callId) {
+  dispatchNativeMethod(moduleId, methodId, params, callId,
+                       [&](NativeModule* module, const std::string& methodName) {
+                         module->invoke(methodName, params, callId);
+                       });
+}
+
+void ModuleRegistry::callNativeMethod(unsigned int moduleId,
+                                      unsigned int methodId,
+                                      const utils::JSONValue& params,
+                                      int callId) {
+  dispatchNativeMethod(moduleId, methodId, params.raw(), callId,
+                       [&](NativeModule* module, const std::string& methodName) {
+                         module->invokeWithArgs(methodName, params, callId);
+                       });
+}
+
 bool ModuleRegistry::setCallbackHandler(CallbackHandler handler) {
   if (callbackHandlerSet_) {
     std::cout << "[ModuleRegistry] Warning: Callback handler already set, "
@@ -129,8 +178,19 @@ bool ModuleRegistry::setCallbackHandler(CallbackHandler handler) {
 
   callbackHandler_ = std::move(handler);
   callbackHandlerSet_ = true;
-  std::cout << "[ModuleRegistry] Callback handler set successfully"
-            << std::endl;
+  MINI_RN_LOG(DEBUG, "[ModuleRegistry] Callback handler set successfully");
+  return true;
+}
+
+bool ModuleRegistry::setJSCallHandler(JSCallHandler handler) {
+  if (jsCallHandler_) {
+    std::cout << "[ModuleRegistry] Warning: JS call handler already set, "
+                 "ignoring duplicate call"
+              << std::endl;
+    return false;
+  }
+
+  jsCallHandler_ = std::move(handler);
   return true;
 }
 
@@ -142,14 +202,14 @@ std::string ModuleRegistry::getModuleName(unsigned int moduleId) const {
   if (!hasModule(moduleId)) {
     return "";
   }
-  return modules_[moduleId]->getName();
+  return methodTables_[moduleId].moduleName;
 }
 
 size_t ModuleRegistry::getModuleMethodCount(unsigned int moduleId) const {
   if (!hasModule(moduleId)) {
     return 0;
   }
-  return modules_[moduleId]->getMethods().size();
+  return methodTables_[moduleId].methods.size();
 }
 
 std::vector<std::string> ModuleRegistry::getMethodNames(
@@ -157,15 +217,14 @@ std::vector<std::string> ModuleRegistry::getMethodNames(
   if (!hasModule(moduleId)) {
     return {};
   }
-  return modules_[moduleId]->getMethods();
+  return methodTables_[moduleId].methods;
 }
 
 std::string ModuleRegistry::callSerializableNativeHook(
     unsigned int moduleId, unsigned int methodId, const std::string& params) {
-  // 避免未使用参数的警告
-  (void)params;
-  std::cout << "[ModuleRegistry] Calling serializable native hook - Module ID: "
-            << moduleId << ", Method ID: " << methodId << std::endl;
+  MINI_RN_LOG(DEBUG,
+              "[ModuleRegistry] Calling serializable native hook - Module ID: "
+                  << moduleId << ", Method ID: " << methodId);
 
   // 验证模块和方法 ID
   if (!validateIds(moduleId, methodId)) {
@@ -177,34 +236,33 @@ std::string ModuleRegistry::callSerializableNativeHook(
 
   try {
     NativeModule* module = modules_[moduleId].get();
-    std::vector<std::string> methods = module->getMethods();
-    std::string methodName = methods[methodId];
-    std::string moduleName = module->getName();
-
-    std::cout << "[ModuleRegistry] Sync calling method '" << methodName
-              << "' on module '" << moduleName << "'" << std::endl;
-
-    // 特殊处理已知的同步方法
-    if (moduleName == "DeviceInfo") {
-      // 将 DeviceInfoModule 转换为具体类型以访问实现方法
-      // 注意：这里使用动态转换，在实际项目中可能需要更安全的类型检查
-      auto* deviceInfoModule =
-          dynamic_cast<mini_rn::modules::DeviceInfoModule*>(module);
-      if (!deviceInfoModule) {
-        std::cout
-            << "[ModuleRegistry] Error: Failed to cast to DeviceInfoModule"
-            << std::endl;
-        return "";
+    const std::string& methodName = methodTables_[moduleId].methods[methodId];
+    const std::string& moduleName = methodTables_[moduleId].moduleName;
+
+    MINI_RN_LOG(DEBUG, "[ModuleRegistry] Sync calling method '" << methodName
+                << "' on module '" << moduleName << "'");
+
+    // 可缓存的同步方法：有效期内直接返回上次的结果
+    double ttlMs = methodTables_[moduleId].cacheTtlMs[methodId];
+    std::string key;
+    if (ttlMs > 0) {
+      key = cacheKey(moduleId, methodId, params);
+      if (const CachedResult* cached = findCachedResult(key, steadyNowMs())) {
+        cacheStats_.hits++;
+        return cached->syncResult;
       }
+      cacheStats_.misses++;
+    }
 
-      if (methodName == "getSystemVersion") {
-        return deviceInfoModule->getSystemVersionImpl();
-      } else if (methodName == "getDeviceId") {
-        return deviceInfoModule->getDeviceIdImpl();
+    std::string result = module->invokeSync(methodName, params);
+    if (!result.empty()) {
+      if (ttlMs > 0) {
+        storeCachedResult(key, ttlMs, steadyNowMs()).syncResult = result;
       }
+      return result;
     }
 
-    // 对于其他模块或方法，返回错误
+    // 方法不支持同步调用或调用失败
     std::cout << "[ModuleRegistry] Warning: Sync call not supported for "
               << moduleName << "." << methodName << std::endl;
     return "";
@@ -222,13 +280,28 @@ std::string ModuleRegistry::callSerializableNativeHook(
 }
 
 void ModuleRegistry::updateModuleNamesFromIndex(size_t startIndex) {
+  methodTables_.resize(modules_.size());
   for (size_t i = startIndex; i < modules_.size(); ++i) {
     if (modules_[i]) {
       std::string moduleName = modules_[i]->getName();
       modulesByName_[moduleName] = i;
+      methodTables_[i] = MethodTable{moduleName, modules_[i]->getMethods(), {}, {}, {}};
+      methodTables_[i].timeoutsMs.assign(methodTables_[i].methods.size(), 0);
+      methodTables_[i].cacheTtlMs.assign(methodTables_[i].methods.size(), 0);
+      for (const auto& entry : modules_[i]->getCacheableMethods()) {
+        const std::vector<std::string>& methods = methodTables_[i].methods;
+        auto method = std::find(methods.begin(), methods.end(), entry.first);
+        if (method == methods.end() || entry.second <= 0) continue;
+        methodTables_[i].cacheTtlMs[method - methods.begin()] = entry.second;
+      }
+      methodTables_[i].priorities.assign(methodTables_[i].methods.size(),
+                                         CallPriority::Normal);
+      for (const auto& entry : modules_[i]->getMethodPriorities()) {
+        setMethodPriority(moduleName, entry.first, entry.second);
+      }
 
-      std::cout << "[ModuleRegistry] Mapped module '" << moduleName
-                << "' to ID " << i << std::endl;
+      MINI_RN_LOG(DEBUG, "[ModuleRegistry] Mapped module '" << moduleName
+                  << "' to ID " << i);
     }
   }
 }
@@ -241,13 +314,34 @@ bool ModuleRegistry::validateIds(unsigned int moduleId,
   }
 
   // 检查方法 ID 是否有效
-  std::vector<std::string> methods = modules_[moduleId]->getMethods();
-  return methodId < methods.size();
+  return methodId < methodTables_[moduleId].methods.size();
 }
 
 void ModuleRegistry::sendErrorCallback(int callId, const std::string& error) {
+  // 合并的调用一起失败，错误不缓存
+  InflightCall inflight;
+  if (!inflightCalls_.empty()) takeInflightCall(callId, &inflight);
+
+  deliverErrorToCall(callId, error);
+  for (int waiter : inflight.waiters) {
+    deliverErrorToCall(waiter, error);
+  }
+}
+
+void ModuleRegistry::deliverErrorToCall(int callId, const std::string& error) {
+  if (!completeCall(callId)) {
+    std::cout << "[ModuleRegistry] Dropping late error for timed-out call "
+              << callId << std::endl;
+    return;
+  }
+  deliverError(callId, error);
+}
+
+void ModuleRegistry::deliverError(int callId, const std::string& error) {
   if (callbackHandler_) {
-    callbackHandler_(callId, error, true);
+    utils::Value errorData = utils::Value::object();
+    errorData.set("message", error);
+    callbackHandler_(callId, errorData, true);
   } else {
     std::cout << "[ModuleRegistry] Warning: No callback handler set, cannot "
                  "send error: "
@@ -256,27 +350,358 @@ void ModuleRegistry::sendErrorCallback(int callId, const std::string& error) {
 }
 
 void ModuleRegistry::sendSuccessCallback(int callId,
-                                         const std::string& result) {
+                                         const utils::Value& result) {
+  // 可缓存方法的结果：先写入缓存，再分发给合并到这次调用上的所有 callId
+  InflightCall inflight;
+  if (!inflightCalls_.empty() && takeInflightCall(callId, &inflight)) {
+    storeCachedResult(inflight.key, inflight.ttlMs, steadyNowMs()).value =
+        result;
+  }
+
+  deliverSuccessToCall(callId, result);
+  for (int waiter : inflight.waiters) {
+    deliverSuccessToCall(waiter, result);
+  }
+}
+
+void ModuleRegistry::deliverSuccessToCall(int callId,
+                                          const utils::Value& result) {
+  if (!completeCall(callId)) {
+    std::cout << "[ModuleRegistry] Dropping late result for timed-out call "
+              << callId << std::endl;
+    return;
+  }
   if (callbackHandler_) {
     callbackHandler_(callId, result, false);
   } else {
     std::cout << "[ModuleRegistry] Warning: No callback handler set, cannot "
                  "send result: "
-              << result << std::endl;
+              << result.toJSON() << std::endl;
+  }
+}
+
+void ModuleRegistry::callJSFunction(const std::string& module,
+                                    const std::string& method,
+                                    const std::string& argsJson) {
+  if (jsCallHandler_) {
+    jsCallHandler_(module, method, argsJson);
+  } else {
+    std::cout << "[ModuleRegistry] Warning: No JS call handler set, cannot "
+                 "call "
+              << module << "." << method << std::endl;
+  }
+}
+
+void ModuleRegistry::onTick(double nowMs) {
+  for (auto& module : modules_) {
+    if (module) {
+      module->onTick(nowMs);
+    }
+  }
+  // 模块在本次 tick 中投递的回调优先于超时
+  expireTimedOutCalls(nowMs);
+}
+
+bool ModuleRegistry::setMethodTimeout(const std::string& moduleName,
+                                      const std::string& methodName,
+                                      double timeoutMs) {
+  auto it = modulesByName_.find(moduleName);
+  if (it == modulesByName_.end()) return false;
+  MethodTable& table = methodTables_[it->second];
+  for (size_t i = 0; i < table.methods.size(); ++i) {
+    if (table.methods[i] != methodName) continue;
+    table.timeoutsMs[i] = timeoutMs > 0 ? timeoutMs : 0;
+    return true;
+  }
+  return false;
+}
+
+CallPriority ModuleRegistry::getMethodPriority(unsigned int moduleId,
+                                              unsigned int methodId) const {
+  if (!validateIds(moduleId, methodId)) return CallPriority::Normal;
+  return methodTables_[moduleId].priorities[methodId];
+}
+
+bool ModuleRegistry::setMethodPriority(const std::string& moduleName,
+                                       const std::string& methodName,
+                                       CallPriority priority) {
+  auto it = modulesByName_.find(moduleName);
+  if (it == modulesByName_.end()) return false;
+  MethodTable& table = methodTables_[it->second];
+  for (size_t i = 0; i < table.methods.size(); ++i) {
+    if (table.methods[i] != methodName) continue;
+    if (table.priorities[i] != CallPriority::Normal) prioritizedMethods_--;
+    if (priority != CallPriority::Normal) prioritizedMethods_++;
+    table.priorities[i] = priority;
+    return true;
+  }
+  return false;
+}
+
+void ModuleRegistry::trackCall(unsigned int moduleId, unsigned int methodId,
+                               int callId, size_t argBytes) {
+  if (callId < 0) return;
+
+  PendingCall call;
+  call.moduleId = moduleId;
+  call.methodId = methodId;
+  call.startMs = steadyNowMs();
+  call.argBytes = argBytes;
+  double timeoutMs = methodTables_[moduleId].timeoutsMs[methodId];
+  if (timeoutMs > 0) {
+    call.deadlineMs = call.startMs + timeoutMs;
+    pendingDeadlines_++;
+  }
+
+  // JS 复用了一个仍在等待的 callId（槽位代数回绕），旧调用视为已结束
+  auto result = pendingCalls_.emplace(callId, call);
+  if (!result.second) {
+    if (result.first->second.deadlineMs > 0) pendingDeadlines_--;
+    pendingBytes_ -= result.first->second.argBytes;
+    result.first->second = call;
+  }
+  pendingBytes_ += argBytes;
+  expiredCallIds_.erase(callId);
+  callTrackingStats_.tracked++;
+}
+
+bool ModuleRegistry::completeCall(int callId) {
+  auto it = pendingCalls_.find(callId);
+  if (it != pendingCalls_.end()) {
+    if (it->second.deadlineMs > 0) pendingDeadlines_--;
+    pendingBytes_ -= it->second.argBytes;
+    pendingCalls_.erase(it);
+    callTrackingStats_.completed++;
+    return true;
+  }
+  if (expiredCallIds_.erase(callId) > 0) {
+    callTrackingStats_.lateReplies++;
+    return false;
+  }
+  // 未经过 callNativeMethod 的回调（如模块自行构造的 callId）照常发送
+  return true;
+}
+
+size_t ModuleRegistry::expireTimedOutCalls(double nowMs) {
+  if (pendingDeadlines_ == 0) return 0;
+
+  // 错误回调会进入 JS 并可能派发新调用（修改 pendingCalls_），先收集再结束
+  std::vector<int> expired;
+  for (const auto& entry : pendingCalls_) {
+    double deadlineMs = entry.second.deadlineMs;
+    if (deadlineMs > 0 && deadlineMs <= nowMs) expired.push_back(entry.first);
+  }
+
+  size_t count = 0;
+  for (int callId : expired) {
+    auto it = pendingCalls_.find(callId);
+    if (it == pendingCalls_.end() || it->second.deadlineMs > nowMs) continue;
+    count++;
+    const PendingCall call = it->second;
+    retireExpiredCall(callId);
+
+    // 超时的调用如果是合并调用的 primary，合并在它上面的调用一起以超时结束
+    // （模块可能永远不回调），之后参数相同的调用重新调用模块
+    InflightCall inflight;
+    if (!inflightCalls_.empty()) takeInflightCall(callId, &inflight);
+
+    const MethodTable& table = methodTables_[call.moduleId];
+    std::string error = "Timeout: " + table.moduleName + "." +
+                        table.methods[call.methodId] +
+                        " did not respond within " +
+                        std::to_string(static_cast<long long>(
+                            table.timeoutsMs[call.methodId])) +
+                        " ms";
+    std::cout << "[ModuleRegistry] " << error << " (Call ID: " << callId << ")"
+              << std::endl;
+    deliverError(callId, error);
+    for (int waiter : inflight.waiters) {
+      // 同一轮里自己先超时的 waiter 已经收到过错误
+      if (pendingCalls_.count(waiter) == 0) continue;
+      count++;
+      retireExpiredCall(waiter);
+      deliverError(waiter, error);
+    }
+  }
+  return count;
+}
+
+void ModuleRegistry::retireExpiredCall(int callId) {
+  auto it = pendingCalls_.find(callId);
+  if (it == pendingCalls_.end()) return;
+  if (it->second.deadlineMs > 0) pendingDeadlines_--;
+  pendingBytes_ -= it->second.argBytes;
+  pendingCalls_.erase(it);
+  callTrackingStats_.timedOut++;
+
+  expiredCallIds_.insert(callId);
+  expiredCallOrder_.push_back(callId);
+  if (expiredCallOrder_.size() > kMaxExpiredCallIds) {
+    expiredCallIds_.erase(expiredCallOrder_.front());
+    expiredCallOrder_.pop_front();
+  }
+}
+
+size_t ModuleRegistry::getPendingCallCount(unsigned int moduleId) const {
+  size_t count = 0;
+  for (const auto& entry : pendingCalls_) {
+    if (entry.second.moduleId == moduleId) count++;
+  }
+  return count;
+}
+
+std::vector<ModuleRegistry::PendingCallInfo>
+ModuleRegistry::getOldestPendingCalls(size_t limit, double nowMs) const {
+  std::vector<std::pair<double, int>> byStart;
+  byStart.reserve(pendingCalls_.size());
+  for (const auto& entry : pendingCalls_) {
+    byStart.emplace_back(entry.second.startMs, entry.first);
+  }
+  limit = std::min(limit, byStart.size());
+  std::partial_sort(byStart.begin(), byStart.begin() + limit, byStart.end());
+
+  std::vector<PendingCallInfo> oldest;
+  oldest.reserve(limit);
+  for (size_t i = 0; i < limit; ++i) {
+    const PendingCall& call = pendingCalls_.at(byStart[i].second);
+    const MethodTable& table = methodTables_[call.moduleId];
+    PendingCallInfo info;
+    info.callId = byStart[i].second;
+    info.moduleName = table.moduleName;
+    info.methodName = table.methods[call.methodId];
+    info.ageMs = nowMs - call.startMs;
+    oldest.push_back(std::move(info));
+  }
+  return oldest;
+}
+
+std::string ModuleRegistry::cacheKey(unsigned int moduleId,
+                                     unsigned int methodId,
+                                     std::string_view args) {
+  std::string key = std::to_string(moduleId);
+  key += ':';
+  key += std::to_string(methodId);
+  key += ':';
+  key.append(args.data(), args.size());
+  return key;
+}
+
+bool ModuleRegistry::serveFromCache(unsigned int moduleId,
+                                    unsigned int methodId,
+                                    std::string_view args, int callId) {
+  // 没有回调的调用无处返回结果，照常调用模块
+  if (callId < 0) return false;
+
+  // JS 复用了一个仍在途的 callId（槽位代数回绕），旧的合并关系作废
+  InflightCall stale;
+  if (takeInflightCall(callId, &stale)) {
+    for (int waiter : stale.waiters) {
+      deliverErrorToCall(waiter, "Call superseded before completion");
+    }
+  }
+
+  std::string key = cacheKey(moduleId, methodId, args);
+  if (const CachedResult* cached = findCachedResult(key, steadyNowMs())) {
+    cacheStats_.hits++;
+    // 回调会进入 JS 并可能修改缓存，先复制结果
+    utils::Value result = cached->value;
+    deliverSuccessToCall(callId, result);
+    return true;
+  }
+
+  auto primary = inflightCallIds_.find(key);
+  if (primary != inflightCallIds_.end()) {
+    inflightCalls_[primary->second].waiters.push_back(callId);
+    cacheStats_.collapsed++;
+    return true;
+  }
+
+  cacheStats_.misses++;
+  InflightCall call;
+  call.key = key;
+  call.ttlMs = methodTables_[moduleId].cacheTtlMs[methodId];
+  inflightCallIds_.emplace(std::move(key), callId);
+  inflightCalls_.emplace(callId, std::move(call));
+  return false;
+}
+
+const ModuleRegistry::CachedResult* ModuleRegistry::findCachedResult(
+    const std::string& key, double nowMs) {
+  auto it = resultCache_.find(key);
+  if (it == resultCache_.end()) return nullptr;
+  if (it->second.expiresMs <= nowMs) {
+    resultCache_.erase(it);
+    return nullptr;
+  }
+  return &it->second;
+}
+
+ModuleRegistry::CachedResult& ModuleRegistry::storeCachedResult(
+    const std::string& key, double ttlMs, double nowMs) {
+  if (resultCache_.size() >= kMaxCachedResults &&
+      resultCache_.find(key) == resultCache_.end()) {
+    // 先删除过期的结果，仍然满时整体清空（可缓存方法的参数组合通常很少）
+    for (auto it = resultCache_.begin(); it != resultCache_.end();) {
+      if (it->second.expiresMs <= nowMs) {
+        it = resultCache_.erase(it);
+      } else {
+        ++it;
+      }
+    }
+    if (resultCache_.size() >= kMaxCachedResults) resultCache_.clear();
+  }
+
+  CachedResult& entry = resultCache_[key];
+  entry.expiresMs = nowMs + ttlMs;
+  return entry;
+}
+
+bool ModuleRegistry::takeInflightCall(int callId, InflightCall* call) {
+  auto it = inflightCalls_.find(callId);
+  if (it == inflightCalls_.end()) return false;
+  *call = std::move(it->second);
+  inflightCalls_.erase(it);
+  auto primary = inflightCallIds_.find(call->key);
+  if (primary != inflightCallIds_.end() && primary->second == callId) {
+    inflightCallIds_.erase(primary);
+  }
+  return true;
+}
+
+ModuleRegistry::CacheStats ModuleRegistry::getCacheStats() const {
+  CacheStats stats = cacheStats_;
+  stats.entries = resultCache_.size();
+  return stats;
+}
+
+void ModuleRegistry::clearResultCache() { resultCache_.clear(); }
+
+void ModuleRegistry::onBatchComplete() {
+  for (auto& module : modules_) {
+    if (module) {
+      module->onBatchComplete();
+    }
   }
 }
 
-ModuleConfig ModuleRegistry::getConfig(const std::string& name,
-                                       JSContextRef context) {
-  std::cout << "[ModuleRegistry] Getting config for module: " << name
-            << std::endl;
+void ModuleRegistry::onMemoryPressure(MemoryPressureLevel level) {
+  for (auto& module : modules_) {
+    if (module) {
+      module->onMemoryPressure(level);
+    }
+  }
+  clearResultCache();
+}
+
+ModuleConfig ModuleRegistry::getConfig(const std::string& name) {
+  MINI_RN_LOG(DEBUG, "[ModuleRegistry] Getting config for module: " << name);
 
   // 查找模块
   auto it = modulesByName_.find(name);
   if (it == modulesByName_.end()) {
     std::cout << "[ModuleRegistry] Module '" << name << "' not found"
               << std::endl;
-    return {SIZE_MAX, nullptr};
+    return {SIZE_MAX, ""};
   }
 
   size_t moduleIndex = it->second;
@@ -285,80 +710,51 @@ ModuleConfig ModuleRegistry::getConfig(const std::string& name,
   if (!module) {
     std::cout << "[ModuleRegistry] Module at index " << moduleIndex
               << " is null" << std::endl;
-    return {SIZE_MAX, nullptr};
+    return {SIZE_MAX, ""};
   }
 
   try {
     // 创建模块配置数组：[moduleName, constants, methods, promiseMethods,
     // syncMethods]
-    std::vector<JSValueRef> moduleConfigElements;
-    moduleConfigElements.reserve(5);
+    std::string config = "[";
 
     // 1. 模块名称
-    JSStringRef moduleNameStr = JSStringCreateWithUTF8CString(name.c_str());
-    moduleConfigElements.push_back(JSValueMakeString(context, moduleNameStr));
-    JSStringRelease(moduleNameStr);
+    config += utils::quoteJSONString(name);
 
     // 2. 常量 (目前设为 null)
-    moduleConfigElements.push_back(JSValueMakeNull(context));
+    config += ",null";
 
     // 3. 方法名数组
-    auto methodNames = module->getMethods();
-    std::vector<JSValueRef> methodNameValues;
-    methodNameValues.reserve(methodNames.size());
-
-    for (const auto& methodName : methodNames) {
-      JSStringRef methodNameStr =
-          JSStringCreateWithUTF8CString(methodName.c_str());
-      methodNameValues.push_back(JSValueMakeString(context, methodNameStr));
-      JSStringRelease(methodNameStr);
+    const std::vector<std::string>& methodNames =
+        methodTables_[moduleIndex].methods;
+    config += ",[";
+    for (size_t i = 0; i < methodNames.size(); ++i) {
+      if (i > 0) config += ",";
+      config += utils::quoteJSONString(methodNames[i]);
     }
+    config += "]";
 
-    JSValueRef methodsArray = JSObjectMakeArray(
-        context, methodNameValues.size(),
-        methodNameValues.empty() ? nullptr : methodNameValues.data(), nullptr);
-    moduleConfigElements.push_back(methodsArray);
+    // 4. Promise 方法ID数组
+    config += "," + methodIdList(methodNames, module->getPromiseMethods());
 
-    // 4. Promise 方法ID数组 (硬编码 DeviceInfo 模块)
-    std::vector<JSValueRef> promiseMethodIds;
-    if (name == "DeviceInfo") {
-      promiseMethodIds.push_back(JSValueMakeNumber(context, 0));  // getUniqueId
-    }
-    JSValueRef promiseMethodsArray = JSObjectMakeArray(
-        context, promiseMethodIds.size(),
-        promiseMethodIds.empty() ? nullptr : promiseMethodIds.data(), nullptr);
-    moduleConfigElements.push_back(promiseMethodsArray);
-
-    // 5. 同步方法ID数组 (硬编码 DeviceInfo 模块)
-    std::vector<JSValueRef> syncMethodIds;
-    if (name == "DeviceInfo") {
-      syncMethodIds.push_back(
-          JSValueMakeNumber(context, 1));  // getSystemVersion
-      syncMethodIds.push_back(JSValueMakeNumber(context, 2));  // getDeviceId
-    }
-    JSValueRef syncMethodsArray = JSObjectMakeArray(
-        context, syncMethodIds.size(),
-        syncMethodIds.empty() ? nullptr : syncMethodIds.data(), nullptr);
-    moduleConfigElements.push_back(syncMethodsArray);
+    // 5. 同步方法ID数组
+    config += "," + methodIdList(methodNames, module->getSyncMethods());
 
-    // 创建模块配置数组
-    JSValueRef moduleConfigArray =
-        JSObjectMakeArray(context, moduleConfigElements.size(),
-                          moduleConfigElements.data(), nullptr);
+    config += "]";
 
-    std::cout << "[ModuleRegistry] Created config for module: " << name
-              << " with " << methodNames.size() << " methods" << std::endl;
+    MINI_RN_LOG(DEBUG, "[ModuleRegistry] Created config for module: " << name
+                << " with " << methodNames.size() << " methods");
 
-    return {moduleIndex, moduleConfigArray};
+    return {moduleIndex, config};
 
   } catch (const std::exception& e) {
     std::cout << "[ModuleRegistry] Error creating config for module '" << name
               << "': " << e.what() << std::endl;
-    return {SIZE_MAX, nullptr};
+    return {SIZE_MAX, ""};
   } catch (...) {
     std::cout << "[ModuleRegistry] Unknown error creating config for module '"
               << name << "'" << std::endl;
-    return {SIZE_MAX, nullptr};
+    return {SIZE_MAX, ""};
   }
 }
 
@@ -1,14 +1,17 @@
 #ifndef MODULEREGISTRY_H
 #define MODULEREGISTRY_H
 
+#include <deque>
 #include <functional>
 #include <memory>
 #include <string>
+#include <string_view>
 #include <unordered_map>
+#include <unordered_set>
 #include <vector>
 
-#include <JavaScriptCore/JavaScriptCore.h>
-
+#include "../utils/JSONDocument.h"
+#include "../utils/Value.h"
 #include "NativeModule.h"
 
 namespace mini_rn {
@@ -20,7 +23,7 @@ namespace modules {
  */
 struct ModuleConfig {
   size_t index;        // 模块索引（在 modules_ 数组中的位置）
-  JSValueRef config;   // 模块配置的 JSValue，格式为 [moduleName, constants, methods, promiseMethods, syncMethods]
+  std::string config;  // 模块配置的 JSON 文本，格式为 [moduleName, constants, methods, promiseMethods, syncMethods]
 };
 
 /**
@@ -42,6 +45,21 @@ struct ModuleConfig {
  * - modules_: 存储所有注册的模块实例
  * - modulesByName_: 模块名称到索引的映射，用于快速查找
  * - callbackHandler_: 回调处理器，用于将结果返回给 JavaScript
+ * - pendingCalls_: 已派发、尚未回调的调用（callId → 模块、方法、派发时间）
+ *
+ * 未完成调用跟踪：模块一直不回调时，JS 侧 MessageQueue 中的回调永远不会释放。
+ * 注册器记录每个带回调的调用，回调时移除；可以按方法设置超时，
+ * 超时的调用以错误回调结束（JS 的 Promise reject），之后模块迟到的回调被丢弃。
+ * getOldestPendingCalls 列出等待最久的调用，用于定位泄漏的模块。
+ *
+ * 结果缓存：模块通过 NativeModule::getCacheableMethods 声明可缓存的方法，
+ * 注册器按 (模块, 方法, 参数 JSON) 缓存成功结果，并把参数相同的在途调用
+ * 合并为一次调用。合并的调用各自参与未完成调用跟踪和超时；被合并的调用
+ * 超时时，合并在它上面的调用一起以超时错误结束。
+ * 内存压力时清空缓存。
+ *
+ * 优先级通道：方法的默认通道来自 NativeModule::getMethodPriorities，
+ * 宿主可以用 setMethodPriority 覆盖；按通道派发由 JSExecutor 完成。
  */
 class ModuleRegistry {
  public:
@@ -50,11 +68,53 @@ class ModuleRegistry {
    * 用于将 Native 方法的执行结果返回给 JavaScript
    *
    * @param callId 调用标识符，与 JavaScript 调用时的 callId 对应
-   * @param result 执行结果，JSON 格式的字符串
+   * @param result 执行结果；错误时为 {message} 对象
    * @param isError 是否为错误结果，true 表示调用失败，false 表示调用成功
    */
-  using CallbackHandler =
-      std::function<void(int callId, const std::string& result, bool isError)>;
+  using CallbackHandler = std::function<void(
+      int callId, const utils::Value& result, bool isError)>;
+
+  /**
+   * JS 函数调用处理器类型定义
+   * 用于 Native 主动调用 JavaScript 模块方法（事件推送等）
+   *
+   * @param module JS 可调用模块名称
+   * @param method 方法名称
+   * @param argsJson 参数数组的 JSON 文本
+   */
+  using JSCallHandler =
+      std::function<void(const std::string& module, const std::string& method,
+                         const std::string& argsJson)>;
+
+  /**
+   * 一个未完成的调用
+   */
+  struct PendingCallInfo {
+    int callId = -1;
+    std::string moduleName;
+    std::string methodName;
+    double ageMs = 0;  // 自派发以来的时间
+  };
+
+  /**
+   * 回调跟踪统计
+   */
+  struct CallTrackingStats {
+    size_t tracked = 0;      // 跟踪过的带回调调用数
+    size_t completed = 0;    // 模块已回调的调用数
+    size_t timedOut = 0;     // 超时后以错误结束的调用数
+    size_t lateReplies = 0;  // 超时之后才到达、被丢弃的回调数
+  };
+
+  /**
+   * 结果缓存统计
+   */
+  struct CacheStats {
+    size_t hits = 0;       // 由缓存直接返回的调用数
+    size_t misses = 0;     // 调用了模块的可缓存调用数
+    size_t collapsed = 0;  // 合并到在途调用上的调用数
+    size_t entries = 0;    // 当前缓存的结果数
+  };
 
   /**
    * 构造函数
@@ -86,7 +146,7 @@ class ModuleRegistry {
    * 基于 React Native ModuleRegistry::callNativeMethod API
    *
    * 这是模块调用的核心入口点。当 JavaScript 通过 Bridge 调用 Native 方法时，
-   * JSCExecutor 会解析消息并调用这个方法来执行具体的模块方法。
+   * JSExecutor 会解析消息并调用这个方法来执行具体的模块方法。
    *
    * @param moduleId 模块 ID（对应 modules_ 数组的索引）
    * @param methodId 方法 ID（对应模块方法列表的索引）
@@ -96,6 +156,16 @@ class ModuleRegistry {
   void callNativeMethod(unsigned int moduleId, unsigned int methodId,
                         const std::string& params, int callId);
 
+  /**
+   * 以已解析的参数调用 Native 方法（异步）
+   * Bridge 刷新队列时使用：参数来自整个队列的一次解析，转发给
+   * NativeModule::invokeWithArgs，模块不需要再解析 JSON
+   *
+   * @param params 参数数组，仅在本次调用期间有效
+   */
+  void callNativeMethod(unsigned int moduleId, unsigned int methodId,
+                        const utils::JSONValue& params, int callId);
+
   /**
    * 设置回调处理器
    * 设置用于将 Native 方法执行结果返回给 JavaScript 的回调函数
@@ -106,6 +176,15 @@ class ModuleRegistry {
    */
   bool setCallbackHandler(CallbackHandler handler);
 
+  /**
+   * 设置 JS 函数调用处理器
+   * 与回调处理器相同，只能设置一次
+   *
+   * @param handler JS 函数调用处理器
+   * @return 如果成功设置返回 true，如果已经设置过则返回 false
+   */
+  bool setJSCallHandler(JSCallHandler handler);
+
   /**
    * 获取模块数量
    * @return 当前注册的模块总数
@@ -145,12 +224,13 @@ class ModuleRegistry {
    * 基于 React Native callSerializableNativeHook API
    *
    * 这个方法用于同步调用 Native 模块方法，直接返回结果而不通过回调。
-   * 主要用于需要立即返回结果的场景，如同步获取设备信息等。
+   * 主要用于需要立即返回结果的场景，如同步获取设备信息、查询列表窗口等。
+   * 调用转发给模块的 NativeModule::invokeSync。
    *
    * @param moduleId 模块 ID（对应 modules_ 数组的索引）
    * @param methodId 方法 ID（对应模块方法列表的索引）
    * @param params JSON 格式的参数字符串
-   * @return 方法执行结果的字符串，如果失败返回空字符串
+   * @return 方法返回值的 JSON 文本，如果失败返回空字符串
    */
   std::string callSerializableNativeHook(unsigned int moduleId,
                                          unsigned int methodId,
@@ -163,29 +243,123 @@ class ModuleRegistry {
    * @param callId 调用标识符
    * @param result 执行结果
    */
-  void sendSuccessCallback(int callId, const std::string& result);
+  void sendSuccessCallback(int callId, const utils::Value& result);
 
   /**
    * 发送错误回调
    * 供 NativeModule 调用，将错误信息返回给 JavaScript
    *
    * @param callId 调用标识符
-   * @param error 错误信息
+   * @param error 错误信息，以 {message: error} 对象返回（与 RCTMakeError 一致）
    */
   void sendErrorCallback(int callId, const std::string& error);
 
+  /**
+   * 调用 JavaScript 模块方法
+   * 供 NativeModule 调用，通过 JS 函数调用处理器转发给 JSExecutor::callFunction
+   *
+   * @param module JS 可调用模块名称
+   * @param method 方法名称
+   * @param argsJson 参数数组的 JSON 文本
+   */
+  void callJSFunction(const std::string& module, const std::string& method,
+                      const std::string& argsJson);
+
+  /**
+   * 把一次事件循环 tick 分发给所有模块（按模块 ID 顺序），
+   * 然后结束已超时的调用
+   * @param nowMs 当前时间（毫秒，steady_clock）
+   */
+  void onTick(double nowMs);
+
+  /**
+   * 设置方法的回调超时：超过 timeoutMs 仍未回调的调用以错误回调结束
+   * 只影响之后派发的调用
+   *
+   * @param timeoutMs 超时时间（毫秒），0 表示不超时
+   * @return 模块或方法不存在时返回 false
+   */
+  bool setMethodTimeout(const std::string& moduleName,
+                        const std::string& methodName, double timeoutMs);
+
+  /**
+   * 方法的默认优先级通道（ID 无效时为 Normal）
+   */
+  CallPriority getMethodPriority(unsigned int moduleId,
+                                 unsigned int methodId) const;
+
+  /**
+   * 设置方法的默认优先级通道，覆盖模块的 getMethodPriorities
+   * @return 模块或方法不存在时返回 false
+   */
+  bool setMethodPriority(const std::string& moduleName,
+                         const std::string& methodName,
+                         CallPriority priority);
+
+  /**
+   * 是否有方法的默认通道不是 Normal（没有时 JSExecutor 按入队顺序直接派发）
+   */
+  bool hasMethodPriorities() const { return prioritizedMethods_ > 0; }
+
+  /**
+   * 以超时错误结束截止时间不晚于 nowMs 的调用
+   * @param nowMs 当前时间（毫秒，steady_clock）
+   * @return 结束的调用数
+   */
+  size_t expireTimedOutCalls(double nowMs);
+
+  /**
+   * 未完成的调用数（全部 / 指定模块）
+   */
+  size_t getPendingCallCount() const { return pendingCalls_.size(); }
+  size_t getPendingCallCount(unsigned int moduleId) const;
+
+  /**
+   * 未完成调用的参数 JSON 总字节数（用于背压判断）
+   */
+  size_t getPendingCallBytes() const { return pendingBytes_; }
+
+  /**
+   * 等待最久的 limit 个未完成调用，按等待时间从长到短排列
+   * @param nowMs 当前时间（毫秒，steady_clock）
+   */
+  std::vector<PendingCallInfo> getOldestPendingCalls(size_t limit,
+                                                     double nowMs) const;
+
+  const CallTrackingStats& getCallTrackingStats() const {
+    return callTrackingStats_;
+  }
+
+  CacheStats getCacheStats() const;
+
+  /**
+   * 清空所有缓存的结果（在途调用不受影响）
+   */
+  void clearResultCache();
+
+  /**
+   * 通知所有模块一个 Bridge 批次已执行完（按模块 ID 顺序）
+   */
+  void onBatchComplete();
+
+  /**
+   * 把内存压力通知分发给所有模块（按模块 ID 顺序），并清空结果缓存
+   */
+  void onMemoryPressure(MemoryPressureLevel level);
+
   /**
    * 获取模块配置
    * 基于 React Native ModuleRegistry::getConfig API
    *
-   * 返回指定模块的配置信息，包括模块索引和 JSValue 格式的配置数据。
+   * 返回指定模块的配置信息，包括模块索引和 JSON 格式的配置数据。
    * 配置数据格式为：[moduleName, constants, methods, promiseMethods, syncMethods]
+   * 配置以 JSON 文本返回，由 JSExecutor 交给具体引擎转换为 JS 值，
+   * 因此 ModuleRegistry 不依赖任何 JS 引擎类型。
    *
    * @param name 模块名称
-   * @param context JavaScript 上下文，用于创建 JSValue
-   * @return ModuleConfig 结构，如果模块不存在则 index 为 SIZE_MAX，config 为 nullptr
+   * @return ModuleConfig 结构，如果模块不存在则 index 为 SIZE_MAX，config 为空
    */
-  ModuleConfig getConfig(const std::string& name, JSContextRef context);
+  ModuleConfig getConfig(const std::string& name);
 
  private:
   /**
@@ -201,6 +375,68 @@ class ModuleRegistry {
    */
   std::unordered_map<std::string, size_t> modulesByName_;
 
+  /**
+   * 模块方法表
+   * 注册时缓存 getName / getMethods 的结果，下标即为模块 ID；
+   * 派发时按方法 ID 直接取名称，不再每次调用都构造一份方法列表
+   */
+  struct MethodTable {
+    std::string moduleName;
+    std::vector<std::string> methods;
+    std::vector<double> timeoutsMs;  // 方法 ID → 回调超时，0 表示不超时
+    std::vector<double> cacheTtlMs;  // 方法 ID → 结果有效期，0 表示不缓存
+    std::vector<CallPriority> priorities;  // 方法 ID → 默认优先级通道
+  };
+  std::vector<MethodTable> methodTables_;
+  // 默认通道不是 Normal 的方法数
+  size_t prioritizedMethods_ = 0;
+
+  /**
+   * 已派发、尚未回调的调用
+   */
+  struct PendingCall {
+    unsigned int moduleId = 0;
+    unsigned int methodId = 0;
+    double startMs = 0;
+    double deadlineMs = 0;  // 0 表示不超时
+    size_t argBytes = 0;    // 参数 JSON 的字节数
+  };
+  std::unordered_map<int, PendingCall> pendingCalls_;
+  size_t pendingBytes_ = 0;  // 所有未完成调用的 argBytes 之和
+  // 其中设置了截止时间的调用数，为 0 时 tick 不扫描
+  size_t pendingDeadlines_ = 0;
+
+  // 已超时的 callId：模块之后的回调直接丢弃（按超时顺序保留最近的一批）
+  static constexpr size_t kMaxExpiredCallIds = 1024;
+  std::unordered_set<int> expiredCallIds_;
+  std::deque<int> expiredCallOrder_;
+  CallTrackingStats callTrackingStats_;
+
+  /**
+   * 可缓存方法的结果，键为 cacheKey(moduleId, methodId, 参数 JSON)
+   * 异步方法保存结果值，同步方法保存返回的 JSON 文本
+   */
+  struct CachedResult {
+    utils::Value value;
+    std::string syncResult;
+    double expiresMs = 0;
+  };
+  static constexpr size_t kMaxCachedResults = 1024;
+  std::unordered_map<std::string, CachedResult> resultCache_;
+
+  /**
+   * 可缓存方法的在途调用：第一个调用（primary）真正调用模块，
+   * 之后参数相同的调用作为 waiters 等待它的结果
+   */
+  struct InflightCall {
+    std::string key;
+    double ttlMs = 0;
+    std::vector<int> waiters;
+  };
+  std::unordered_map<int, InflightCall> inflightCalls_;   // primary callId
+  std::unordered_map<std::string, int> inflightCallIds_;  // key → primary
+  CacheStats cacheStats_;
+
   /**
    * 回调处理器
    * 用于将 Native 方法的执行结果返回给 JavaScript
@@ -214,13 +450,70 @@ class ModuleRegistry {
   bool callbackHandlerSet_ = false;
 
   /**
-   * 更新模块名称映射
+   * JS 函数调用处理器
+   * 用于 Native 主动调用 JavaScript 模块方法
+   */
+  JSCallHandler jsCallHandler_;
+
+  /**
+   * 更新模块名称映射和方法表
    * 基于 React Native ModuleRegistry::updateModuleNamesFromIndex 的设计
    *
    * @param startIndex 开始更新的索引位置
    */
   void updateModuleNamesFromIndex(size_t startIndex);
 
+  /**
+   * 记录一次带回调的调用（callId 为 -1 表示没有回调，不记录）
+   */
+  void trackCall(unsigned int moduleId, unsigned int methodId, int callId,
+                 size_t argBytes);
+
+  /**
+   * 回调即将发送给 JS 时调用
+   * @return 该调用已经超时结束、回调应当丢弃时返回 false
+   */
+  bool completeCall(int callId);
+
+  /**
+   * 把未完成的调用作为超时结束：移出跟踪并记住 callId，迟到的回调会被丢弃
+   */
+  void retireExpiredCall(int callId);
+
+  /**
+   * 以 {message: error} 对象发送错误回调（不经过调用跟踪）
+   */
+  void deliverError(int callId, const std::string& error);
+
+  /**
+   * 经过调用跟踪发送回调（sendSuccessCallback / sendErrorCallback 对单个 callId
+   * 的部分）
+   */
+  void deliverSuccessToCall(int callId, const utils::Value& result);
+  void deliverErrorToCall(int callId, const std::string& error);
+
+  static std::string cacheKey(unsigned int moduleId, unsigned int methodId,
+                              std::string_view args);
+
+  /**
+   * 可缓存方法的调用在派发前经过这里
+   * @return 调用已由缓存或在途调用接管、不需要再调用模块时返回 true
+   */
+  bool serveFromCache(unsigned int moduleId, unsigned int methodId,
+                      std::string_view args, int callId);
+
+  /**
+   * 查找未过期的缓存结果，过期的顺便删除
+   */
+  const CachedResult* findCachedResult(const std::string& key, double nowMs);
+  CachedResult& storeCachedResult(const std::string& key, double ttlMs,
+                                  double nowMs);
+
+  /**
+   * 取出以 callId 为 primary 的在途调用（不存在时返回 false）
+   */
+  bool takeInflightCall(int callId, InflightCall* call);
+
   /**
    * 验证模块和方法 ID 的有效性
    * @param moduleId 模块 ID
@@ -228,6 +521,17 @@ class ModuleRegistry {
    * @return 如果有效返回 true，否则返回 false
    */
   bool validateIds(unsigned int moduleId, unsigned int methodId) const;
+
+  /**
+   * 校验 ID、查找方法名并调用 invoke(module, methodName)，
+   * 失败或抛出异常时向 JS 发送错误回调
+   *
+   * @param args 参数的 JSON 文本，可缓存方法以它为缓存键
+   */
+  template <typename Invoke>
+  void dispatchNativeMethod(unsigned int moduleId, unsigned int methodId,
+                            std::string_view args, int callId,
+                            Invoke&& invoke);
 };
 
 }  // namespace modules
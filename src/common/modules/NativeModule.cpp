@@ -9,14 +9,20 @@ void NativeModule::setModuleRegistry(ModuleRegistry* registry) {
   m_moduleRegistry = registry;
 }
 
-void NativeModule::sendSuccessCallback(int callId, const std::string& result) {
+void NativeModule::invokeWithArgs(const std::string& methodName,
+                                  const utils::JSONValue& args, int callId) {
+  invoke(methodName, std::string(args.raw()), callId);
+}
+
+void NativeModule::sendSuccessCallback(int callId,
+                                       const utils::Value& result) {
   if (m_moduleRegistry) {
     // 通过 ModuleRegistry 的公有方法发送成功回调
     // 我们需要在 ModuleRegistry 中添加公有的回调方法
     m_moduleRegistry->sendSuccessCallback(callId, result);
   } else {
     std::cout << "[NativeModule] Warning: No ModuleRegistry set, cannot send success callback for callId "
-              << callId << ", result: " << result << std::endl;
+              << callId << ", result: " << result.toJSON() << std::endl;
   }
 }
 
@@ -31,5 +37,16 @@ void NativeModule::sendErrorCallback(int callId, const std::string& error) {
   }
 }
 
+void NativeModule::callJSFunction(const std::string& module,
+                                  const std::string& method,
+                                  const std::string& argsJson) {
+  if (m_moduleRegistry) {
+    m_moduleRegistry->callJSFunction(module, method, argsJson);
+  } else {
+    std::cout << "[NativeModule] Warning: No ModuleRegistry set, cannot call JS function "
+              << module << "." << method << std::endl;
+  }
+}
+
 } // namespace modules
 } // namespace mini_rn
\ No newline at end of file
@@ -1,16 +1,44 @@
 #ifndef NATIVEMODULE_H
 #define NATIVEMODULE_H
 
+#include <limits>
 #include <map>
 #include <string>
 #include <vector>
 
+#include "../utils/JSONDocument.h"
+#include "../utils/Value.h"
+
 namespace mini_rn {
 namespace modules {
 
 // 前向声明
 class ModuleRegistry;
 
+/**
+ * 内存压力级别（对应平台的内存警告，如 didReceiveMemoryWarning / onTrimMemory）
+ */
+enum class MemoryPressureLevel {
+  Moderate,  // 释放可以按需重建的缓存
+  Critical,  // 尽可能释放内存，宿主随后会强制 GC
+};
+
+/**
+ * Bridge 调用的优先级通道（数值与 JS 侧 MessageQueue.Priority 一致）
+ *
+ * 同一次队列刷新中的调用按通道派发：Immediate → UserBlocking → Normal，
+ * 通道内保持入队顺序；Background 调用延后到之后的 tick 中派发，
+ * 积压超过上限时丢弃最旧的（以错误回调结束）
+ */
+enum class CallPriority {
+  Immediate = 0,     // 排在同一批次的所有调用之前
+  UserBlocking = 1,  // 用户交互正在等待结果的调用
+  Normal = 2,        // 默认
+  Background = 3,    // 可延后、可丢弃的调用（统计上报等）
+};
+
+constexpr size_t kCallPriorityCount = 4;
+
 /**
  * NativeModule - React Native 兼容的 Native 模块基类
  *
@@ -50,6 +78,7 @@ class NativeModule {
   /**
    * 获取模块导出的方法列表
    * @return 方法名称列表，这些方法可以从 JavaScript 调用
+   *         （注册时由 ModuleRegistry 缓存，注册后不应再变化）
    */
   virtual std::vector<std::string> getMethods() const = 0;
 
@@ -78,6 +107,73 @@ class NativeModule {
   virtual void invoke(const std::string& methodName, const std::string& args,
                       int callId) = 0;
 
+  /**
+   * 以已解析的参数调用模块方法
+   *
+   * Bridge 刷新队列时整个队列只解析一次，每次调用的参数以值树传入，
+   * 模块可以直接遍历而不必再解析 JSON。默认实现把参数的原始 JSON 文本
+   * 交给 invoke，高频调用的模块（如 UIManager）应当重写。
+   *
+   * @param args 参数数组，仅在本次调用期间有效，需要保留的数据必须复制
+   */
+  virtual void invokeWithArgs(const std::string& methodName,
+                              const utils::JSONValue& args, int callId);
+
+  /**
+   * 返回 Promise 的方法（getMethods 的子集）
+   * JS 侧调用时返回 Promise，结果同样通过 sendSuccessCallback /
+   * sendErrorCallback 返回，默认没有
+   */
+  virtual std::vector<std::string> getPromiseMethods() const { return {}; }
+
+  /**
+   * 同步方法（getMethods 的子集）
+   * JS 侧通过 nativeCallSyncHook 直接调用并立即得到返回值，不经过消息队列，
+   * 由 invokeSync 实现，默认没有
+   */
+  virtual std::vector<std::string> getSyncMethods() const { return {}; }
+
+  /**
+   * 同步调用模块方法（在 JS 线程上执行，应当足够快）
+   *
+   * @param methodName 方法名，属于 getSyncMethods
+   * @param args JSON 格式的参数数组
+   * @return 返回值的 JSON 文本；方法不存在或调用失败时返回空字符串
+   */
+  virtual std::string invokeSync(const std::string& /* methodName */,
+                                 const std::string& /* args */) {
+    return "";
+  }
+
+  /**
+   * 结果有效期：在进程生命周期内一直有效
+   */
+  static constexpr double kCacheForever =
+      std::numeric_limits<double>::infinity();
+
+  /**
+   * 可缓存的方法（getMethods 的子集）→ 结果有效期（毫秒）
+   *
+   * 结果只取决于参数的方法（如设备信息的 getter）可以声明为可缓存，
+   * ModuleRegistry 以参数的 JSON 文本为键缓存成功结果：
+   * - 有效期内参数相同的调用直接返回缓存，不再调用模块
+   * - 参数相同、尚未回调的调用合并为一次调用，结果分发给所有等待的 callId
+   * 同步方法只缓存，不需要合并。错误结果不缓存。默认没有
+   *
+   * 缓存的 ArrayBuffer 结果会被多次调用共享，返回 ArrayBuffer 的方法不应声明
+   */
+  virtual std::map<std::string, double> getCacheableMethods() const {
+    return {};
+  }
+
+  /**
+   * 方法（getMethods 的子集）的默认优先级通道，未列出的方法为 Normal
+   * JS 可以用 MessageQueue.withPriority 为单次调用显式指定，显式优先级优先
+   */
+  virtual std::map<std::string, CallPriority> getMethodPriorities() const {
+    return {};
+  }
+
   /**
    * 设置模块注册器引用
    * 由 ModuleRegistry 在注册模块时自动调用，模块无需手动调用
@@ -88,20 +184,57 @@ class NativeModule {
 
   /**
    * 发送成功回调到 JavaScript
+   * 结果由执行器直接转换为 JS 值，字符串结果原样到达 JS，不需要自行转义
    *
    * @param callId 调用标识符
    * @param result 执行结果
    */
-  void sendSuccessCallback(int callId, const std::string& result);
+  void sendSuccessCallback(int callId, const utils::Value& result);
 
   /**
    * 发送错误回调到 JavaScript
+   * JS 侧收到 {message: error} 对象，Promise 方法据此构造 Error
    *
    * @param callId 调用标识符
    * @param error 错误信息
    */
   void sendErrorCallback(int callId, const std::string& error);
 
+  /**
+   * 调用 JavaScript 模块方法（Native → JS 主动调用）
+   * 对应 React Native 的 callFunctionReturnFlushedQueue 通道，
+   * 用于向 JS 推送事件等不属于任何一次 JS 调用的消息
+   *
+   * @param module JS 侧通过 registerCallableModule 注册的模块名
+   * @param method 方法名
+   * @param argsJson 参数数组的 JSON 文本
+   */
+  void callJSFunction(const std::string& module, const std::string& method,
+                      const std::string& argsJson);
+
+  /**
+   * 每个事件循环 tick 调用一次（由 JSExecutor::tick 驱动）
+   * 需要批量向 JS 投递数据的模块在这里统一发送，默认不做任何事
+   *
+   * @param nowMs 当前时间（毫秒，单调时钟）
+   */
+  virtual void onTick(double /* nowMs */) {}
+
+  /**
+   * 一个 Bridge 批次（一次队列刷新）中的所有调用执行完后调用
+   * 对应 React Native 的 batchDidComplete，需要按批次原子提交的模块
+   * （如 UIManager）在这里统一提交，默认不做任何事
+   */
+  virtual void onBatchComplete() {}
+
+  /**
+   * 宿主收到内存压力通知时调用（由 JSExecutor::handleMemoryPressure 驱动）
+   * 持有缓存（缓冲池、视图回收池……）的模块在这里释放，默认不做任何事
+   *
+   * @param level 压力级别
+   */
+  virtual void onMemoryPressure(MemoryPressureLevel /* level */) {}
+
   /**
    * 虚析构函数
    * 确保派生类对象可以正确析构
@@ -0,0 +1,158 @@
+#include "TimingModule.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+
+namespace mini_rn {
+namespace modules {
+
+namespace {
+
+// 拆分扁平参数数组，如 [3,16.5,false] → {"3", "16.5", "false"}
+std::vector<std::string> splitArgs(const std::string& args) {
+  std::vector<std::string> values;
+  size_t begin = args.find('[');
+  size_t end = args.rfind(']');
+  if (begin == std::string::npos || end == std::string::npos || end <= begin) {
+    return values;
+  }
+
+  std::string current;
+  for (size_t i = begin + 1; i < end; ++i) {
+    char c = args[i];
+    if (c == ',') {
+      values.push_back(current);
+      current.clear();
+    } else if (c != ' ') {
+      current += c;
+    }
+  }
+  if (!current.empty() || !values.empty()) values.push_back(current);
+  return values;
+}
+
+}  // namespace
+
+TimingModule::TimingModule(double frameIntervalMs)
+    : frameIntervalMs_(frameIntervalMs > 0 ? frameIntervalMs : 1000.0 / 60.0) {}
+
+std::vector<std::string> TimingModule::getMethods() const {
+  return {
+      "createTimer",  // methodId = 0
+      "deleteTimer",  // methodId = 1
+      "requestFrame"  // methodId = 2
+  };
+}
+
+void TimingModule::invoke(const std::string& methodName,
+                          const std::string& args, int callId) {
+  std::vector<std::string> values = splitArgs(args);
+
+  if (methodName == "createTimer" && values.size() >= 3) {
+    createTimer(std::atoi(values[0].c_str()),
+                std::strtod(values[1].c_str(), nullptr), values[2] == "true");
+  } else if (methodName == "deleteTimer" && values.size() >= 1) {
+    // 惰性删除：堆中的调度项在出堆时跳过
+    timers_.erase(std::atoi(values[0].c_str()));
+    compactHeapIfNeeded();
+  } else if (methodName == "requestFrame") {
+    frameRequested_ = true;
+  } else {
+    sendErrorCallback(callId, "Invalid call: " + methodName + args);
+  }
+}
+
+void TimingModule::onTick(double nowMs) {
+  nowMs_ = nowMs;
+
+  std::vector<int> dueTimers;
+  std::vector<int> rescheduled;
+
+  while (!heap_.empty() && heap_.front().fireTimeMs <= nowMs) {
+    std::pop_heap(heap_.begin(), heap_.end(), laterThan);
+    HeapEntry entry = heap_.back();
+    heap_.pop_back();
+
+    auto it = timers_.find(entry.timerId);
+    if (it == timers_.end() || it->second.sequence != entry.sequence) {
+      continue;  // 已删除或已重新调度
+    }
+
+    dueTimers.push_back(entry.timerId);
+    if (it->second.repeats) {
+      // 出堆结束后再放回，保证间隔为 0 的重复定时器每个 tick 只触发一次
+      rescheduled.push_back(entry.timerId);
+    } else {
+      timers_.erase(it);
+    }
+  }
+
+  for (int timerId : rescheduled) {
+    schedule(timerId, nowMs + timers_[timerId].intervalMs);
+  }
+
+  // 帧回调对齐到帧边界：同一帧间隔内的多个 tick 只投递一次
+  bool deliverFrame = frameRequested_ && nowMs >= nextFrameMs_;
+  if (deliverFrame) {
+    frameRequested_ = false;
+    nextFrameMs_ = (std::floor(nowMs / frameIntervalMs_) + 1) * frameIntervalMs_;
+    stats_.frames++;
+  }
+
+  if (dueTimers.empty() && !deliverFrame) return;
+
+  std::string args = "[[";
+  for (size_t i = 0; i < dueTimers.size(); ++i) {
+    if (i > 0) args += ",";
+    args += std::to_string(dueTimers[i]);
+  }
+  args += "],";
+  args += deliverFrame ? std::to_string(nowMs) : "null";
+  args += "]";
+
+  stats_.fired += dueTimers.size();
+  stats_.batches++;
+  // JS 在回调中创建的定时器和帧请求会在这次调用内同步回到 invoke
+  callJSFunction("JSTimers", "callTimers", args);
+}
+
+void TimingModule::setFrameInterval(double frameIntervalMs) {
+  if (frameIntervalMs > 0) frameIntervalMs_ = frameIntervalMs;
+}
+
+bool TimingModule::laterThan(const HeapEntry& a, const HeapEntry& b) {
+  if (a.fireTimeMs != b.fireTimeMs) return a.fireTimeMs > b.fireTimeMs;
+  return a.sequence > b.sequence;
+}
+
+void TimingModule::createTimer(int timerId, double durationMs, bool repeats) {
+  if (durationMs < 0 || std::isnan(durationMs)) durationMs = 0;
+
+  timers_[timerId] = Timer{durationMs, repeats, 0};
+  schedule(timerId, nowMs_ + durationMs);
+  stats_.created++;
+}
+
+void TimingModule::schedule(int timerId, double fireTimeMs) {
+  uint64_t sequence = nextSequence_++;
+  timers_[timerId].sequence = sequence;
+  heap_.push_back({fireTimeMs, sequence, timerId});
+  std::push_heap(heap_.begin(), heap_.end(), laterThan);
+}
+
+void TimingModule::compactHeapIfNeeded() {
+  if (heap_.size() < 64 || heap_.size() < 2 * timers_.size()) return;
+
+  heap_.erase(std::remove_if(heap_.begin(), heap_.end(),
+                             [this](const HeapEntry& entry) {
+                               auto it = timers_.find(entry.timerId);
+                               return it == timers_.end() ||
+                                      it->second.sequence != entry.sequence;
+                             }),
+              heap_.end());
+  std::make_heap(heap_.begin(), heap_.end(), laterThan);
+}
+
+}  // namespace modules
+}  // namespace mini_rn
@@ -0,0 +1,117 @@
+#ifndef TIMINGMODULE_H
+#define TIMINGMODULE_H
+
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "NativeModule.h"
+
+namespace mini_rn {
+namespace modules {
+
+/**
+ * TimingModule - Native 定时器模块
+ *
+ * 对应 React Native 的 RCTTiming：JS 的 setTimeout / setInterval /
+ * requestAnimationFrame（src/js/JSTimers.js）只在 JS 侧保存回调，
+ * 定时器本身由 Native 管理，到期后回调 JSTimers.callTimers。
+ *
+ * 调度方式：
+ * - 所有定时器按到期时间放在最小堆中，删除采用惰性方式
+ *   （deleteTimer 只移除定时器表中的记录，堆顶出堆时再跳过）
+ * - 由 JSExecutor::tick 驱动，每个 tick 把所有到期定时器与帧回调
+ *   合并为一次 callFunction("JSTimers", "callTimers", [ids, frameTime])，
+ *   而不是每个定时器一次跨 Bridge 调用
+ * - 定时器时间以最近一次 tick 的时间为基准，与 RCTTiming 按帧检查
+ *   定时器的精度一致：定时器最多晚一个 tick 触发
+ * - 帧回调按帧间隔对齐：JS 请求帧后，在下一个帧边界所在的 tick 投递
+ *
+ * JavaScript 侧方法：
+ * - createTimer(timerId, durationMs, repeats)
+ * - deleteTimer(timerId)
+ * - requestFrame(): 请求下一帧的帧回调
+ */
+class TimingModule : public NativeModule {
+ public:
+  /**
+   * 定时器统计
+   */
+  struct Stats {
+    size_t created = 0;  // createTimer 次数
+    size_t fired = 0;    // 触发的定时器总数（重复定时器每次都计）
+    size_t frames = 0;   // 投递的帧回调次数
+    size_t batches = 0;  // callFunction 调用次数
+  };
+
+  /**
+   * @param frameIntervalMs 帧间隔（毫秒），默认 60Hz
+   */
+  explicit TimingModule(double frameIntervalMs = 1000.0 / 60.0);
+  ~TimingModule() override = default;
+
+  // NativeModule 接口实现
+  std::string getName() const override { return "Timing"; }
+  std::vector<std::string> getMethods() const override;
+  void invoke(const std::string& methodName, const std::string& args,
+              int callId) override;
+  void onTick(double nowMs) override;
+
+  /**
+   * 设置帧间隔（毫秒）
+   */
+  void setFrameInterval(double frameIntervalMs);
+
+  /**
+   * 获取活跃（未触发或重复）的定时器数量
+   */
+  size_t getActiveTimerCount() const { return timers_.size(); }
+
+  const Stats& getStats() const { return stats_; }
+
+ private:
+  /**
+   * 定时器状态
+   */
+  struct Timer {
+    double intervalMs;
+    bool repeats;
+    uint64_t sequence;  // 当前有效调度项的序号
+  };
+
+  /**
+   * 堆中的调度项，sequence 与定时器表不一致时视为过期项
+   * （定时器已删除、已重新调度或同一 ID 被重新创建）
+   */
+  struct HeapEntry {
+    double fireTimeMs;
+    uint64_t sequence;  // 调度序号，到期时间相同时按调度顺序触发
+    int timerId;
+  };
+
+  // 最小堆比较：到期时间早的在堆顶
+  static bool laterThan(const HeapEntry& a, const HeapEntry& b);
+
+  void createTimer(int timerId, double durationMs, bool repeats);
+  void schedule(int timerId, double fireTimeMs);
+
+  // 过期调度项过多时（频繁 clearTimeout + setTimeout）重建堆
+  void compactHeapIfNeeded();
+
+  std::vector<HeapEntry> heap_;
+  std::unordered_map<int, Timer> timers_;
+  uint64_t nextSequence_ = 0;
+
+  double frameIntervalMs_;
+  double nextFrameMs_ = 0;
+  bool frameRequested_ = false;
+  // 最近一次 tick 的时间，新定时器以此为基准
+  double nowMs_ = 0;
+  Stats stats_;
+};
+
+}  // namespace modules
+}  // namespace mini_rn
+
+#endif  // TIMINGMODULE_H
@@ -0,0 +1,220 @@
+#include "UIManagerModule.h"
+
+#include <iostream>
+#include <utility>
+
+namespace mini_rn {
+namespace modules {
+
+namespace {
+
+// 整数数组，null 视为空数组
+bool parseIntList(const utils::JSONValue& json, std::vector<int>& values) {
+  values.clear();
+  if (json.isNull()) return true;
+  if (!json.isArray()) return false;
+
+  values.reserve(json.size());
+  for (utils::JSONValue element : json) {
+    if (!element.isNumber()) return false;
+    values.push_back(element.asInt());
+  }
+  return true;
+}
+
+// 属性对象，null 视为没有属性；属性名驻留，属性值按类型保存
+bool parseProps(const utils::JSONValue& json, ui::Props& props) {
+  props.clear();
+  if (json.isNull()) return true;
+  if (!json.isObject()) return false;
+
+  props.reserve(json.size());
+  for (auto it = json.begin(); it != json.end(); ++it) {
+    props.set(ui::PropNames::intern(it.key()), ui::PropValue::fromJSON(*it));
+  }
+  return true;
+}
+
+bool parseTag(const utils::JSONValue& json, int& tag) {
+  if (!json.isNumber()) return false;
+  tag = json.asInt();
+  return true;
+}
+
+bool parseString(const utils::JSONValue& json, std::string& value) {
+  if (!json.isString()) return false;
+  value.assign(json.asString());
+  return true;
+}
+
+}  // namespace
+
+UIManagerModule::UIManagerModule(
+    std::shared_ptr<ui::MountingLayer> mountingLayer)
+    : mountingLayer_(std::move(mountingLayer)) {
+  instructions_.reserve(kInitialInstructionCapacity,
+                        kInitialInstructionCapacity * 2,
+                        kInitialInstructionCapacity * 64);
+}
+
+std::vector<std::string> UIManagerModule::getMethods() const {
+  return {
+      "createView",      // methodId = 0
+      "updateView",      // methodId = 1
+      "setChildren",     // methodId = 2
+      "manageChildren",  // methodId = 3
+      "removeView"       // methodId = 4
+  };
+}
+
+void UIManagerModule::invoke(const std::string& methodName,
+                             const std::string& args, int callId) {
+  // 不经过 Bridge 队列的调用：先解析参数文本
+  if (!argsDocument_.parse(args)) {
+    stats_.rejected++;
+    std::cout << "[UIManager] Error: Invalid arguments for " << methodName
+              << ": " << args << std::endl;
+    sendErrorCallback(callId, "Invalid arguments for " + methodName);
+    return;
+  }
+  invokeWithArgs(methodName, argsDocument_.root(), callId);
+}
+
+void UIManagerModule::invokeWithArgs(const std::string& methodName,
+                                     const utils::JSONValue& args,
+                                     int callId) {
+  ui::ViewMutation mutation;
+  if (!parseMutation(methodName, args, mutation)) {
+    stats_.rejected++;
+    std::cout << "[UIManager] Error: Invalid arguments for " << methodName
+              << ": " << args.raw() << std::endl;
+    sendErrorCallback(callId, "Invalid arguments for " + methodName);
+    return;
+  }
+
+  // 暂存到批次结束时统一应用
+  stageMutation(std::move(mutation));
+}
+
+void UIManagerModule::onBatchComplete() { commit(); }
+
+void UIManagerModule::onMemoryPressure(MemoryPressureLevel level) {
+  if (mountingLayer_) mountingLayer_->trimMemory();
+  if (level == MemoryPressureLevel::Critical) {
+    // 批次之间为空，只是保留的容量
+    std::vector<ui::ViewMutation>().swap(appliedMutations_);
+  }
+}
+
+bool UIManagerModule::addRootView(int rootTag, float width, float height) {
+  if (!tree_.addRootView(rootTag)) return false;
+  layout_.setRootSize(rootTag, width, height);
+  return true;
+}
+
+void UIManagerModule::setRootViewSize(int rootTag, float width, float height) {
+  layout_.setRootSize(rootTag, width, height);
+}
+
+void UIManagerModule::enqueueMutation(ui::ViewMutation mutation) {
+  stageMutation(std::move(mutation));
+}
+
+void UIManagerModule::stageMutation(ui::ViewMutation&& mutation) {
+  using Type = ui::ViewMutation::Type;
+
+  if (mutation.type == Type::UpdateView) {
+    // 同一视图在本批次已有 updateView：合并进去，只保留每个属性的最终值。
+    // 属性更新不影响其他变更能否成功，提前到第一次更新的位置应用是安全的
+    auto it = pendingUpdates_.find(mutation.tag);
+    if (it != pendingUpdates_.end()) {
+      pendingMutations_[it->second].props.merge(mutation.props);
+      stats_.coalesced++;
+      return;
+    }
+    pendingUpdates_.emplace(mutation.tag, pendingMutations_.size());
+  } else if (mutation.type == Type::CreateView ||
+             mutation.type == Type::RemoveView) {
+    // 之后的更新不能提前到视图创建之前或删除之前
+    pendingUpdates_.erase(mutation.tag);
+  }
+  pendingMutations_.push_back(std::move(mutation));
+}
+
+void UIManagerModule::commit() {
+  if (pendingMutations_.empty() && !layout_.needsLayout()) return;
+
+  appliedMutations_.clear();
+  for (auto& mutation : pendingMutations_) {
+    if (tree_.apply(mutation)) {
+      appliedMutations_.push_back(std::move(mutation));
+    } else {
+      stats_.rejected++;
+    }
+  }
+  pendingMutations_.clear();
+  pendingUpdates_.clear();
+
+  // 只重新布局变化的子树
+  layout_.computeLayout();
+  stats_.mutations += appliedMutations_.size();
+
+  // 与已挂载的视图比较，没有可见变化的批次不提交
+  differ_.diff(tree_, layout_, appliedMutations_, instructions_);
+  if (instructions_.empty()) return;
+
+  stats_.commits++;
+  stats_.instructions += instructions_.size();
+  if (mountingLayer_) {
+    mountingLayer_->commit(instructions_);
+  }
+}
+
+bool UIManagerModule::parseMutation(const std::string& methodName,
+                                    const utils::JSONValue& args,
+                                    ui::ViewMutation& mutation) {
+  if (!args.isArray() || args.size() == 0) return false;
+
+  // 参数按顺序取出，避免按下标重复跳过前面的元素
+  utils::JSONValue values[6];
+  size_t count = 0;
+  for (utils::JSONValue value : args) {
+    if (count == 6) return false;
+    values[count++] = value;
+  }
+  if (!parseTag(values[0], mutation.tag)) return false;
+
+  using Type = ui::ViewMutation::Type;
+  if (methodName == "createView") {
+    mutation.type = Type::CreateView;
+    return count == 4 && parseString(values[1], mutation.viewName) &&
+           parseTag(values[2], mutation.rootTag) &&
+           parseProps(values[3], mutation.props);
+  }
+  if (methodName == "updateView") {
+    mutation.type = Type::UpdateView;
+    return count == 3 && parseString(values[1], mutation.viewName) &&
+           parseProps(values[2], mutation.props);
+  }
+  if (methodName == "setChildren") {
+    mutation.type = Type::SetChildren;
+    return count == 2 && parseIntList(values[1], mutation.childTags);
+  }
+  if (methodName == "manageChildren") {
+    mutation.type = Type::ManageChildren;
+    return count == 6 &&
+           parseIntList(values[1], mutation.moveFromIndices) &&
+           parseIntList(values[2], mutation.moveToIndices) &&
+           parseIntList(values[3], mutation.childTags) &&
+           parseIntList(values[4], mutation.addAtIndices) &&
+           parseIntList(values[5], mutation.removeAtIndices);
+  }
+  if (methodName == "removeView") {
+    mutation.type = Type::RemoveView;
+    return count == 1;
+  }
+  return false;
+}
+
+}  // namespace modules
+}  // namespace mini_rn
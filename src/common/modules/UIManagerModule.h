@@ -0,0 +1,144 @@
+#ifndef UIMANAGERMODULE_H
+#define UIMANAGERMODULE_H
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "../ui/LayoutEngine.h"
+#include "../ui/MountInstruction.h"
+#include "../ui/MountingDiffer.h"
+#include "../ui/MountingLayer.h"
+#include "../ui/ShadowTree.h"
+#include "../ui/ViewMutation.h"
+#include "NativeModule.h"
+
+namespace mini_rn {
+namespace modules {
+
+/**
+ * UIManagerModule - 无界面的 UIManager
+ *
+ * 对应 React Native 的 UIManager：JS 渲染器通过它描述视图树的变化，
+ * Native 侧在 C++ shadow tree（ui::ShadowTree）中维护视图结构和属性，
+ * 再交给 mounting layer 落到平台视图上。
+ *
+ * 批次语义：
+ * - invoke 只解析参数并暂存变更，不修改 shadow tree
+ * - Bridge 批次结束（onBatchComplete）时按调用顺序统一应用，增量计算布局，
+ *   由 MountingDiffer 与已挂载的视图比较得到最少的挂载指令，然后调用一次
+ *   MountingLayer::commit，平台侧只会看到完整的批次
+ * - 同一批次内对同一视图的多次 updateView 在暂存时合并，每个属性只应用最终值
+ *   （动画每帧会对同一属性发送多次更新）
+ * - 校验失败的单条变更被丢弃并记录日志，不影响同批次的其他变更
+ *
+ * JavaScript 侧方法（参数与 React Native 一致）：
+ * - createView(tag, viewName, rootTag, props)
+ * - updateView(tag, viewName, props)
+ * - setChildren(containerTag, childTags)
+ * - manageChildren(containerTag, moveFromIndices, moveToIndices,
+ *                  addChildTags, addAtIndices, removeAtIndices)
+ * - removeView(tag)
+ */
+class UIManagerModule : public NativeModule {
+ public:
+  /**
+   * 提交统计
+   */
+  struct Stats {
+    size_t commits = 0;       // 提交给 mounting layer 的批次数
+    size_t mutations = 0;     // 成功应用的变更数
+    size_t rejected = 0;      // 参数或校验失败被丢弃的变更数
+    size_t instructions = 0;  // 输出的挂载指令数
+    size_t coalesced = 0;     // 合并到同批次前一次 updateView 的更新数
+  };
+
+  /**
+   * @param mountingLayer 接收提交的 mounting layer，可为空（只维护 shadow tree）
+   */
+  explicit UIManagerModule(
+      std::shared_ptr<ui::MountingLayer> mountingLayer = nullptr);
+  ~UIManagerModule() override = default;
+
+  // NativeModule 接口实现
+  std::string getName() const override { return "UIManager"; }
+  std::vector<std::string> getMethods() const override;
+  void invoke(const std::string& methodName, const std::string& args,
+              int callId) override;
+  void invokeWithArgs(const std::string& methodName,
+                      const utils::JSONValue& args, int callId) override;
+  void onBatchComplete() override;
+  // 让 mounting layer 释放缓存（如视图回收池）
+  void onMemoryPressure(MemoryPressureLevel level) override;
+
+  /**
+   * 注册根视图（Native 侧在运行 JS 应用之前调用）
+   * @param width / height 根视图尺寸，kUndefined 表示按内容决定
+   */
+  bool addRootView(int rootTag, float width = ui::kUndefined,
+                   float height = ui::kUndefined);
+
+  /**
+   * 根视图尺寸变化（如旋转屏幕），在下一次 commit 时重新布局
+   */
+  void setRootViewSize(int rootTag, float width, float height);
+
+  /**
+   * 直接暂存一条变更（不经过 JSON 解析，供 Native 侧和压测使用）
+   */
+  void enqueueMutation(ui::ViewMutation mutation);
+
+  /**
+   * 应用所有暂存的变更、重新布局并把挂载指令提交给 mounting layer
+   * 没有任何可见变化（没有指令）时不提交
+   */
+  void commit();
+
+  void setMountingLayer(std::shared_ptr<ui::MountingLayer> mountingLayer) {
+    mountingLayer_ = std::move(mountingLayer);
+  }
+
+  const ui::ShadowTree& getShadowTree() const { return tree_; }
+  ui::LayoutEngine& getLayoutEngine() { return layout_; }
+  const ui::LayoutEngine& getLayoutEngine() const { return layout_; }
+  size_t getPendingMutationCount() const { return pendingMutations_.size(); }
+  size_t getMountedViewCount() const { return differ_.getMountedViewCount(); }
+  const Stats& getStats() const { return stats_; }
+
+ private:
+  static constexpr size_t kInitialInstructionCapacity = 256;
+
+  /**
+   * 把一次 JS 调用解析为变更
+   * @return 参数格式错误时返回 false
+   */
+  static bool parseMutation(const std::string& methodName,
+                            const utils::JSONValue& args,
+                            ui::ViewMutation& mutation);
+
+  /**
+   * 暂存一条变更，合并同一视图的重复 updateView
+   */
+  void stageMutation(ui::ViewMutation&& mutation);
+
+  // invoke 直接收到参数文本时使用的解析文档（复用存储）
+  utils::JSONDocument argsDocument_;
+  ui::ShadowTree tree_;
+  ui::LayoutEngine layout_{tree_};  // 必须在 tree_ 之后声明
+  std::vector<ui::ViewMutation> pendingMutations_;
+  // tag → 该视图在 pendingMutations_ 中的 updateView 下标
+  std::unordered_map<int, size_t> pendingUpdates_;
+  // 本批次成功应用的变更（复用容量，避免每批次重新分配）
+  std::vector<ui::ViewMutation> appliedMutations_;
+  ui::MountingDiffer differ_;
+  // 每批次复用的指令 buffer
+  ui::MountInstructionBuffer instructions_;
+  std::shared_ptr<ui::MountingLayer> mountingLayer_;
+  Stats stats_;
+};
+
+}  // namespace modules
+}  // namespace mini_rn
+
+#endif  // UIMANAGERMODULE_H
@@ -0,0 +1,180 @@
+#include "VirtualizedListModule.h"
+
+#include <cmath>
+#include <iostream>
+
+namespace mini_rn {
+namespace modules {
+
+namespace {
+
+bool parseNumber(const utils::JSONValue& json, double& value) {
+  if (!json.isNumber()) return false;
+  value = json.asNumber();
+  return std::isfinite(value);
+}
+
+bool parseIndex(const utils::JSONValue& json, size_t& index) {
+  double value;
+  if (!parseNumber(json, value) || value < 0) return false;
+  index = static_cast<size_t>(value);
+  return true;
+}
+
+}  // namespace
+
+std::vector<std::string> VirtualizedListModule::getMethods() const {
+  return {
+      "configure",       // methodId = 0
+      "setItemHeights",  // methodId = 1
+      "setItemCount",    // methodId = 2
+      "getWindow",       // methodId = 3
+      "getItemOffset",   // methodId = 4
+      "release"          // methodId = 5
+  };
+}
+
+std::vector<std::string> VirtualizedListModule::getSyncMethods() const {
+  return getMethods();
+}
+
+void VirtualizedListModule::invoke(const std::string& methodName,
+                                   const std::string& args, int callId) {
+  if (!argsDocument_.parse(args)) {
+    sendErrorCallback(callId, "Invalid call: " + methodName + args);
+    return;
+  }
+  invokeWithArgs(methodName, argsDocument_.root(), callId);
+}
+
+void VirtualizedListModule::invokeWithArgs(const std::string& methodName,
+                                           const utils::JSONValue& args,
+                                           int callId) {
+  // 异步调用时结果通过回调返回
+  utils::Value result;
+  if (call(methodName, args, result)) {
+    sendSuccessCallback(callId, result);
+  } else {
+    sendErrorCallback(callId,
+                      "Invalid call: " + methodName + std::string(args.raw()));
+  }
+}
+
+std::string VirtualizedListModule::invokeSync(const std::string& methodName,
+                                              const std::string& args) {
+  utils::Value result;
+  if (!argsDocument_.parse(args) ||
+      !call(methodName, argsDocument_.root(), result)) {
+    return "";
+  }
+  return result.toJSON();
+}
+
+bool VirtualizedListModule::call(const std::string& methodName,
+                                 const utils::JSONValue& args,
+                                 utils::Value& result) {
+  // 参数最多 4 个，按顺序取出
+  utils::JSONValue values[4];
+  size_t count = 0;
+  for (utils::JSONValue value : args) {
+    if (count == 4) break;
+    values[count++] = value;
+  }
+  double listId;
+  if (!args.isArray() || count == 0 || !parseNumber(values[0], listId)) {
+    std::cout << "[VirtualizedListModule] Error: Invalid arguments for "
+              << methodName << ": " << args.raw() << std::endl;
+    return false;
+  }
+  int id = static_cast<int>(listId);
+
+  if (methodName == "configure" && count >= 3) {
+    size_t itemCount;
+    double estimatedItemHeight;
+    if (!parseIndex(values[1], itemCount) ||
+        !parseNumber(values[2], estimatedItemHeight)) {
+      return false;
+    }
+    ui::VirtualizedListLayout& list = lists_[id];
+    list.reset(itemCount, estimatedItemHeight);
+    result = list.getTotalHeight();
+    return true;
+  }
+
+  if (methodName == "release") {
+    lists_.erase(id);
+    result = true;
+    return true;
+  }
+
+  auto it = lists_.find(id);
+  if (it == lists_.end()) {
+    std::cout << "[VirtualizedListModule] Error: Unknown list " << id
+              << std::endl;
+    return false;
+  }
+  ui::VirtualizedListLayout& list = it->second;
+
+  if (methodName == "getWindow" && count >= 3) {
+    double offset, viewportLength, overscan = 0;
+    if (!parseNumber(values[1], offset) ||
+        !parseNumber(values[2], viewportLength) ||
+        (count >= 4 && !parseNumber(values[3], overscan))) {
+      return false;
+    }
+    ui::VirtualizedListLayout::Window window =
+        list.getWindow(offset, viewportLength, overscan);
+    stats_.windowQueries++;
+    result = utils::Value::object();
+    result.set("first", window.first);
+    result.set("last", window.last);
+    result.set("offset", window.offset);
+    result.set("end", window.end);
+    result.set("totalHeight", list.getTotalHeight());
+    return true;
+  }
+
+  if (methodName == "setItemHeights" && count >= 3) {
+    size_t index;
+    if (!parseIndex(values[1], index) || !values[2].isArray()) return false;
+    for (utils::JSONValue element : values[2]) {
+      double height;
+      if (index >= list.getItemCount()) break;
+      // null 表示尚未测量，保持原值
+      if (parseNumber(element, height) &&
+          height != list.getItemHeight(index)) {
+        list.setItemHeight(index, height);
+        stats_.heightUpdates++;
+      }
+      index++;
+    }
+    result = list.getTotalHeight();
+    return true;
+  }
+
+  if (methodName == "setItemCount" && count >= 2) {
+    size_t itemCount;
+    if (!parseIndex(values[1], itemCount)) return false;
+    list.setItemCount(itemCount);
+    result = list.getTotalHeight();
+    return true;
+  }
+
+  if (methodName == "getItemOffset" && count >= 2) {
+    size_t index;
+    if (!parseIndex(values[1], index)) return false;
+    result = list.getItemOffset(index);
+    return true;
+  }
+
+  return false;
+}
+
+const ui::VirtualizedListLayout* VirtualizedListModule::getList(
+    int listId) const {
+  auto it = lists_.find(listId);
+  return it == lists_.end() ? nullptr : &it->second;
+}
+
+}  // namespace modules
+}  // namespace mini_rn
@@ -0,0 +1,83 @@
+#ifndef VIRTUALIZEDLISTMODULE_H
+#define VIRTUALIZEDLISTMODULE_H
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "../ui/VirtualizedListLayout.h"
+#include "NativeModule.h"
+
+namespace mini_rn {
+namespace modules {
+
+/**
+ * VirtualizedListModule - 虚拟列表的 Native 窗口计算
+ *
+ * React Native 的 VirtualizedList 在 JS 中维护每个 item 的 frame，
+ * 滚动时线性扫描计算渲染窗口，item 高度变化后还要重算后续所有偏移。
+ * 这里把偏移表放在 Native 侧（ui::VirtualizedListLayout，树状数组），
+ * 高度更新和窗口查询都是 O(log n)。
+ *
+ * 所有方法都是同步方法（nativeCallSyncHook）：滚动回调中需要立即得到窗口，
+ * 而且同步调用保证了高度更新与随后的查询之间的顺序。
+ *
+ * JavaScript 侧方法（listId 由 JS 分配）：
+ * - configure(listId, itemCount, estimatedItemHeight) → totalHeight
+ * - setItemHeights(listId, startIndex, [heights]) → totalHeight
+ * - setItemCount(listId, itemCount) → totalHeight
+ * - getWindow(listId, offset, viewportLength, overscan)
+ *   → {first, last, offset, end, totalHeight}
+ * - getItemOffset(listId, index) → offset
+ * - release(listId) → true
+ */
+class VirtualizedListModule : public NativeModule {
+ public:
+  /**
+   * 调用统计
+   */
+  struct Stats {
+    size_t windowQueries = 0;  // getWindow 次数
+    size_t heightUpdates = 0;  // 实际变化的 item 高度数
+  };
+
+  VirtualizedListModule() = default;
+  ~VirtualizedListModule() override = default;
+
+  // NativeModule 接口实现
+  std::string getName() const override { return "VirtualizedList"; }
+  std::vector<std::string> getMethods() const override;
+  std::vector<std::string> getSyncMethods() const override;
+  void invoke(const std::string& methodName, const std::string& args,
+              int callId) override;
+  void invokeWithArgs(const std::string& methodName,
+                      const utils::JSONValue& args, int callId) override;
+  std::string invokeSync(const std::string& methodName,
+                         const std::string& args) override;
+
+  /**
+   * 获取列表的偏移索引，列表不存在时返回空指针
+   */
+  const ui::VirtualizedListLayout* getList(int listId) const;
+
+  size_t getListCount() const { return lists_.size(); }
+  const Stats& getStats() const { return stats_; }
+
+ private:
+  /**
+   * 执行一次调用（同步和异步调用共用）
+   * @return 参数错误或列表不存在时返回 false
+   */
+  bool call(const std::string& methodName, const utils::JSONValue& args,
+            utils::Value& result);
+
+  // 参数文本（同步调用、直接 invoke）的解析文档，复用存储
+  utils::JSONDocument argsDocument_;
+  std::unordered_map<int, ui::VirtualizedListLayout> lists_;
+  Stats stats_;
+};
+
+}  // namespace modules
+}  // namespace mini_rn
+
+#endif  // VIRTUALIZEDLISTMODULE_H
@@ -0,0 +1,748 @@
+#include "LayoutEngine.h"
+
+#include <algorithm>
+#include <functional>
+#include <utility>
+
+namespace mini_rn {
+namespace ui {
+
+namespace {
+
+bool isRow(FlexDirection direction) {
+  return direction == FlexDirection::Row ||
+         direction == FlexDirection::RowReverse;
+}
+
+bool isReverse(FlexDirection direction) {
+  return direction == FlexDirection::RowReverse ||
+         direction == FlexDirection::ColumnReverse;
+}
+
+// 主轴起始边（reverse 时为末端）
+Edge leadingEdge(FlexDirection direction) {
+  switch (direction) {
+    case FlexDirection::Row:
+      return kEdgeLeft;
+    case FlexDirection::RowReverse:
+      return kEdgeRight;
+    case FlexDirection::ColumnReverse:
+      return kEdgeBottom;
+    case FlexDirection::Column:
+      break;
+  }
+  return kEdgeTop;
+}
+
+Edge trailingEdge(FlexDirection direction) {
+  switch (leadingEdge(direction)) {
+    case kEdgeLeft:
+      return kEdgeRight;
+    case kEdgeRight:
+      return kEdgeLeft;
+    case kEdgeBottom:
+      return kEdgeTop;
+    case kEdgeTop:
+      break;
+  }
+  return kEdgeBottom;
+}
+
+float edgeSum(const std::array<float, 4> &edges, bool row) {
+  return row ? edges[kEdgeLeft] + edges[kEdgeRight]
+             : edges[kEdgeTop] + edges[kEdgeBottom];
+}
+
+float paddingAndBorder(const LayoutStyle &style, bool row) {
+  return edgeSum(style.padding, row) + edgeSum(style.border, row);
+}
+
+const LayoutLength &dimension(const LayoutStyle &style, bool row) {
+  return row ? style.width : style.height;
+}
+
+float minDimension(const LayoutStyle &style, bool row, float ownerSize) {
+  return (row ? style.minWidth : style.minHeight).resolve(ownerSize);
+}
+
+float maxDimension(const LayoutStyle &style, bool row, float ownerSize) {
+  return (row ? style.maxWidth : style.maxHeight).resolve(ownerSize);
+}
+
+// 按 min / max 约束尺寸，不小于 padding + border
+float boundAxis(const LayoutStyle &style, bool row, float value,
+                float ownerSize) {
+  float max = maxDimension(style, row, ownerSize);
+  float min = minDimension(style, row, ownerSize);
+  if (!isUndefined(max) && value > max) value = max;
+  if (!isUndefined(min) && value < min) value = min;
+  return std::max(value, paddingAndBorder(style, row));
+}
+
+Align alignOf(const LayoutStyle &child, const LayoutStyle &parent) {
+  return child.alignSelf == Align::Auto ? parent.alignItems : child.alignSelf;
+}
+
+bool sameFloat(float a, float b) {
+  return a == b || (isUndefined(a) && isUndefined(b));
+}
+
+// 缓存的约束能否满足本次请求（规则与 Yoga 的 YGNodeCanUseCachedMeasurement 一致）
+bool canUseCachedSize(MeasureMode mode, float size, MeasureMode cachedMode,
+                      float cachedSize, float cachedResult) {
+  if (mode == cachedMode && sameFloat(size, cachedSize)) return true;
+  // 要求的精确尺寸恰好等于上次按内容得到的尺寸
+  if (mode == MeasureMode::Exactly && size == cachedResult) return true;
+  // 上次不受限得到的尺寸放得进新的上限
+  if (mode == MeasureMode::AtMost && cachedMode == MeasureMode::Undefined &&
+      size >= cachedResult) {
+    return true;
+  }
+  // 上限收紧，但上次的结果仍不超过新的上限
+  return mode == MeasureMode::AtMost && cachedMode == MeasureMode::AtMost &&
+         cachedSize > size && cachedResult <= size;
+}
+
+// 测量函数的输入：除布局样式和只影响绘制的属性以外的所有属性
+size_t contentHash(const Props &props) {
+  size_t hash = 0;
+  for (const auto &prop : props) {
+    if (isPaintOnlyProp(prop.first)) continue;
+    hash = hash * 31 + prop.first;
+    hash = hash * 31 + prop.second.hash();
+  }
+  return hash;
+}
+
+}  // namespace
+
+LayoutEngine::LayoutEngine(ShadowTree &tree) : m_tree(tree) {}
+
+void LayoutEngine::setRootSize(int rootTag, float width, float height) {
+  RootSize &size = m_rootSizes[rootTag];
+  if (sameFloat(size.width, width) && sameFloat(size.height, height)) return;
+
+  size.width = width;
+  size.height = height;
+  m_rootSizeChanged = true;
+}
+
+void LayoutEngine::registerMeasureFunction(const std::string &viewName,
+                                           MeasureFunction measure) {
+  m_measureFunctions[viewName] = std::move(measure);
+}
+
+void LayoutEngine::markDirty(int tag) { m_manualDirtyTags.push_back(tag); }
+
+bool LayoutEngine::needsLayout() const {
+  return m_rootSizeChanged || !m_manualDirtyTags.empty() ||
+         m_tree.hasLayoutInvalidations();
+}
+
+size_t LayoutEngine::computeLayout() {
+  m_changedTags.clear();
+  m_pass = PassStats();
+  syncInvalidations();
+
+  for (int rootTag : m_tree.getRootTags()) {
+    uint32_t index = m_tree.indexOf(rootTag);
+    const LayoutStyle &style = m_nodes[index].style;
+
+    RootSize size;
+    auto it = m_rootSizes.find(rootTag);
+    if (it != m_rootSizes.end()) size = it->second;
+    float width = isUndefined(size.width) ? style.width.resolve(kUndefined)
+                                          : size.width;
+    float height = isUndefined(size.height)
+                       ? style.height.resolve(kUndefined)
+                       : size.height;
+
+    LayoutSize result = layoutNode(
+        index, width,
+        isUndefined(width) ? MeasureMode::Undefined : MeasureMode::Exactly,
+        height,
+        isUndefined(height) ? MeasureMode::Undefined : MeasureMode::Exactly,
+        width, height, true);
+    setFrame(index, 0, 0, result);
+  }
+
+  m_rootSizeChanged = false;
+  m_pass.framesChanged = m_changedTags.size();
+  return m_changedTags.size();
+}
+
+const LayoutFrame *LayoutEngine::getFrame(int tag) const {
+  uint32_t index = m_tree.indexOf(tag);
+  if (index == ShadowTree::kInvalidIndex || index >= m_nodes.size()) {
+    return nullptr;
+  }
+  const LayoutNode &node = m_nodes[index];
+  return node.tag == tag && node.hasFrame ? &node.frame : nullptr;
+}
+
+void LayoutEngine::syncInvalidations() {
+  m_tree.takeLayoutInvalidations(m_invalidations);
+  if (m_nodes.size() < m_tree.getCapacity()) {
+    m_nodes.resize(m_tree.getCapacity());
+  }
+
+  for (const auto &invalidation : m_invalidations) {
+    uint32_t index = m_tree.indexOf(invalidation.tag);
+    if (index == ShadowTree::kInvalidIndex) continue;  // 已被删除
+    if (syncNode(index, invalidation.propsOnly)) {
+      markDirtyAt(index);
+    }
+  }
+
+  for (int tag : m_manualDirtyTags) {
+    uint32_t index = m_tree.indexOf(tag);
+    if (index != ShadowTree::kInvalidIndex && m_nodes[index].tag == tag) {
+      markDirtyAt(index);
+    }
+  }
+  m_manualDirtyTags.clear();
+}
+
+bool LayoutEngine::syncNode(uint32_t index, bool propsOnly) {
+  const ShadowNode &shadow = m_tree.getNodeAt(index);
+  LayoutNode &node = m_nodes[index];
+
+  // 新节点，或槽位已被其他节点复用
+  if (node.tag != shadow.tag) {
+    node = LayoutNode();
+    node.tag = shadow.tag;
+    propsOnly = false;
+
+    auto it = m_measureFunctions.find(shadow.viewName);
+    node.measure = it == m_measureFunctions.end() ? nullptr : &it->second;
+  }
+
+  LayoutStyle style = parseLayoutStyle(shadow.props);
+  // 有测量函数的节点，布局样式以外的属性（如文本）也可能改变内容尺寸
+  size_t hash = node.measure ? contentHash(shadow.props) : 0;
+  if (propsOnly) {
+    if (style == node.style && hash == node.contentHash) return false;
+    node.style = std::move(style);
+    node.contentHash = hash;
+    return true;
+  }
+
+  node.contentHash = hash;
+
+  node.style = std::move(style);
+  node.children.clear();
+  node.children.reserve(shadow.children.size());
+  for (int childTag : shadow.children) {
+    node.children.push_back(m_tree.indexOf(childTag));
+  }
+  return true;
+}
+
+void LayoutEngine::markDirtyAt(uint32_t index) {
+  auto invalidate = [this](LayoutNode &node) {
+    node.dirty = true;
+    node.layoutCache.valid = false;
+    for (auto &entry : node.measureCache) entry.valid = false;
+    m_pass.dirtyNodes++;
+  };
+  invalidate(m_nodes[index]);
+
+  // 沿父链传播，遇到已经 dirty 的祖先即停止（其祖先必然也是 dirty）
+  int parentTag = m_tree.getNodeAt(index).parentTag;
+  while (parentTag != kNoTag) {
+    uint32_t parentIndex = m_tree.indexOf(parentTag);
+    if (parentIndex == ShadowTree::kInvalidIndex) break;
+
+    LayoutNode &parent = m_nodes[parentIndex];
+    if (parent.dirty && parent.tag == parentTag) break;
+    invalidate(parent);
+    parentTag = m_tree.getNodeAt(parentIndex).parentTag;
+  }
+}
+
+LayoutSize LayoutEngine::layoutNode(uint32_t index, float width,
+                                    MeasureMode widthMode, float height,
+                                    MeasureMode heightMode, float ownerWidth,
+                                    float ownerHeight, bool performLayout) {
+  LayoutNode &node = m_nodes[index];
+  m_pass.visits++;
+
+  auto matches = [&](const CacheEntry &entry) {
+    return entry.valid && sameFloat(entry.ownerWidth, ownerWidth) &&
+           sameFloat(entry.ownerHeight, ownerHeight) &&
+           canUseCachedSize(widthMode, width, entry.widthMode, entry.width,
+                            entry.result.width) &&
+           canUseCachedSize(heightMode, height, entry.heightMode,
+                            entry.height, entry.result.height);
+  };
+
+  // 最近一次布局的结果可用于布局和测量，测量结果只能用于测量
+  if (matches(node.layoutCache)) {
+    m_pass.cacheHits++;
+    return node.layoutCache.result;
+  }
+  if (!performLayout) {
+    for (const auto &entry : node.measureCache) {
+      if (matches(entry)) {
+        m_pass.cacheHits++;
+        return entry.result;
+      }
+    }
+  }
+
+  LayoutSize size =
+      node.measure && node.children.empty()
+          ? measureLeaf(index, width, widthMode, height, heightMode,
+                        ownerWidth, ownerHeight)
+          : layoutContainer(index, width, widthMode, height, heightMode,
+                            ownerWidth, ownerHeight, performLayout);
+
+  CacheEntry entry;
+  entry.valid = true;
+  entry.widthMode = widthMode;
+  entry.heightMode = heightMode;
+  entry.width = width;
+  entry.height = height;
+  entry.ownerWidth = ownerWidth;
+  entry.ownerHeight = ownerHeight;
+  entry.result = size;
+
+  if (performLayout) {
+    node.layoutCache = entry;
+    node.dirty = false;
+  } else {
+    node.measureCache[node.nextMeasureSlot] = entry;
+    node.nextMeasureSlot = (node.nextMeasureSlot + 1) % kMeasureCacheSize;
+  }
+  return size;
+}
+
+LayoutSize LayoutEngine::measureLeaf(uint32_t index, float width,
+                                     MeasureMode widthMode, float height,
+                                     MeasureMode heightMode, float ownerWidth,
+                                     float ownerHeight) {
+  const LayoutNode &node = m_nodes[index];
+  const LayoutStyle &style = node.style;
+  float paddingWidth = paddingAndBorder(style, true);
+  float paddingHeight = paddingAndBorder(style, false);
+
+  // 两个方向都已确定时不需要测量
+  if (widthMode == MeasureMode::Exactly && heightMode == MeasureMode::Exactly) {
+    return {width, height};
+  }
+
+  float innerWidth = widthMode == MeasureMode::Undefined
+                         ? kUndefined
+                         : std::max(0.0f, width - paddingWidth);
+  float innerHeight = heightMode == MeasureMode::Undefined
+                          ? kUndefined
+                          : std::max(0.0f, height - paddingHeight);
+
+  m_pass.measureCalls++;
+  LayoutSize content = (*node.measure)(m_tree.getNodeAt(index), innerWidth,
+                                       widthMode, innerHeight, heightMode);
+
+  auto resolve = [&](MeasureMode mode, float available, float measured,
+                     bool row, float ownerSize) {
+    if (mode == MeasureMode::Exactly) return available;
+    float size = boundAxis(style, row, measured, ownerSize);
+    return mode == MeasureMode::AtMost ? std::min(size, available) : size;
+  };
+  return {resolve(widthMode, width, content.width + paddingWidth, true,
+                  ownerWidth),
+          resolve(heightMode, height, content.height + paddingHeight, false,
+                  ownerHeight)};
+}
+
+LayoutSize LayoutEngine::layoutContainer(uint32_t index, float width,
+                                         MeasureMode widthMode, float height,
+                                         MeasureMode heightMode,
+                                         float ownerWidth, float ownerHeight,
+                                         bool performLayout) {
+  const LayoutNode &node = m_nodes[index];
+  const LayoutStyle &style = node.style;
+  const bool row = isRow(style.flexDirection);
+
+  const float mainAvailable = row ? width : height;
+  const MeasureMode mainMode = row ? widthMode : heightMode;
+  const float crossAvailable = row ? height : width;
+  const MeasureMode crossMode = row ? heightMode : widthMode;
+  const float mainOwner = row ? ownerWidth : ownerHeight;
+  const float crossOwner = row ? ownerHeight : ownerWidth;
+  const float paddingMain = paddingAndBorder(style, row);
+  const float paddingCross = paddingAndBorder(style, !row);
+
+  // content box 的可用空间（精确值或上限），也是子节点百分比的参照
+  auto innerLimit = [&](float available, MeasureMode mode, bool axisRow,
+                        float ownerSize, float padding) {
+    float limit = mode == MeasureMode::Undefined ? kUndefined : available;
+    float max = maxDimension(style, axisRow, ownerSize);
+    if (mode != MeasureMode::Exactly && !isUndefined(max)) {
+      limit = isUndefined(limit) ? max : std::min(limit, max);
+    }
+    return isUndefined(limit) ? kUndefined : std::max(0.0f, limit - padding);
+  };
+  const float innerMainLimit =
+      innerLimit(mainAvailable, mainMode, row, mainOwner, paddingMain);
+  const float innerCrossLimit =
+      innerLimit(crossAvailable, crossMode, !row, crossOwner, paddingCross);
+  const bool crossExact = crossMode == MeasureMode::Exactly;
+  const float innerWidthRef = row ? innerMainLimit : innerCrossLimit;
+  const float innerHeightRef = row ? innerCrossLimit : innerMainLimit;
+
+  // 子节点在交叉轴上的约束：有尺寸用尺寸，stretch 撑满，否则不超过可用空间
+  auto crossConstraint = [&](const LayoutStyle &childStyle, float &size,
+                             MeasureMode &mode) {
+    float marginCross = edgeSum(childStyle.margin, !row);
+    size = dimension(childStyle, !row).resolve(innerCrossLimit);
+    if (!isUndefined(size)) {
+      size = boundAxis(childStyle, !row, size, innerCrossLimit);
+      mode = MeasureMode::Exactly;
+    } else if (alignOf(childStyle, style) == Align::Stretch && crossExact) {
+      size = boundAxis(childStyle, !row,
+                       std::max(0.0f, innerCrossLimit - marginCross),
+                       innerCrossLimit);
+      mode = MeasureMode::Exactly;
+    } else if (!isUndefined(innerCrossLimit)) {
+      size = std::max(0.0f, innerCrossLimit - marginCross);
+      mode = MeasureMode::AtMost;
+    } else {
+      mode = MeasureMode::Undefined;
+    }
+  };
+
+  auto measureChild = [&](uint32_t child, float childMain,
+                          MeasureMode childMainMode, float childCross,
+                          MeasureMode childCrossMode) {
+    return row ? layoutNode(child, childMain, childMainMode, childCross,
+                            childCrossMode, innerWidthRef, innerHeightRef,
+                            false)
+               : layoutNode(child, childCross, childCrossMode, childMain,
+                            childMainMode, innerWidthRef, innerHeightRef,
+                            false);
+  };
+
+  // 1. 确定参与 flex 的子节点的 flex basis
+  float totalBasis = 0;
+  float totalGrow = 0;
+  float totalShrinkScaled = 0;
+  size_t flowCount = 0;
+  for (uint32_t childIndex : node.children) {
+    LayoutNode &child = m_nodes[childIndex];
+    const LayoutStyle &childStyle = child.style;
+    if (childStyle.displayNone ||
+        childStyle.positionType == PositionType::Absolute) {
+      continue;
+    }
+
+    float marginMain = edgeSum(childStyle.margin, row);
+    float basis = childStyle.flexBasis.resolve(innerMainLimit);
+    if (isUndefined(basis)) {
+      basis = dimension(childStyle, row).resolve(innerMainLimit);
+    }
+    if (isUndefined(basis)) {
+      // 按内容测量
+      float crossSize;
+      MeasureMode childCrossMode;
+      crossConstraint(childStyle, crossSize, childCrossMode);
+      LayoutSize measured = measureChild(
+          childIndex, std::max(0.0f, innerMainLimit - marginMain),
+          isUndefined(innerMainLimit) ? MeasureMode::Undefined
+                                      : MeasureMode::AtMost,
+          crossSize, childCrossMode);
+      basis = row ? measured.width : measured.height;
+    }
+    basis = boundAxis(childStyle, row, basis, innerMainLimit);
+
+    child.mainSize = basis;
+    totalBasis += basis + marginMain;
+    totalGrow += childStyle.flexGrow;
+    totalShrinkScaled += childStyle.flexShrink * basis;
+    flowCount++;
+  }
+
+  // 2. 确定主轴尺寸并分配剩余空间
+  float innerMain;
+  if (mainMode == MeasureMode::Exactly) {
+    innerMain = std::max(0.0f, mainAvailable - paddingMain);
+  } else {
+    innerMain = isUndefined(innerMainLimit)
+                    ? totalBasis
+                    : std::min(totalBasis, innerMainLimit);
+    innerMain =
+        boundAxis(style, row, innerMain + paddingMain, mainOwner) - paddingMain;
+  }
+
+  const float remaining = innerMain - totalBasis;
+  float usedMain = 0;
+  for (uint32_t childIndex : node.children) {
+    LayoutNode &child = m_nodes[childIndex];
+    const LayoutStyle &childStyle = child.style;
+    if (childStyle.displayNone ||
+        childStyle.positionType == PositionType::Absolute) {
+      continue;
+    }
+
+    float size = child.mainSize;
+    if (remaining > 0 && totalGrow > 0) {
+      size += remaining * childStyle.flexGrow / totalGrow;
+    } else if (remaining < 0 && totalShrinkScaled > 0) {
+      size += remaining * childStyle.flexShrink * child.mainSize /
+              totalShrinkScaled;
+    }
+    child.mainSize = boundAxis(childStyle, row, size, innerMainLimit);
+    usedMain += child.mainSize + edgeSum(childStyle.margin, row);
+  }
+
+  // 3. 确定子节点的交叉轴尺寸
+  float maxChildCross = 0;
+  for (uint32_t childIndex : node.children) {
+    LayoutNode &child = m_nodes[childIndex];
+    const LayoutStyle &childStyle = child.style;
+    if (childStyle.displayNone ||
+        childStyle.positionType == PositionType::Absolute) {
+      continue;
+    }
+
+    float crossSize;
+    MeasureMode childCrossMode;
+    crossConstraint(childStyle, crossSize, childCrossMode);
+    if (childCrossMode != MeasureMode::Exactly) {
+      LayoutSize measured = measureChild(childIndex, child.mainSize,
+                                         MeasureMode::Exactly, crossSize,
+                                         childCrossMode);
+      crossSize = row ? measured.height : measured.width;
+    }
+    child.crossSize = crossSize;
+    maxChildCross = std::max(maxChildCross,
+                             crossSize + edgeSum(childStyle.margin, !row));
+  }
+
+  float innerCross;
+  if (crossExact) {
+    innerCross = std::max(0.0f, crossAvailable - paddingCross);
+  } else {
+    innerCross = isUndefined(innerCrossLimit)
+                     ? maxChildCross
+                     : std::min(maxChildCross, innerCrossLimit);
+    innerCross = boundAxis(style, !row, innerCross + paddingCross, crossOwner) -
+                 paddingCross;
+
+    // 交叉轴由内容决定时，stretch 的子节点撑满整行
+    for (uint32_t childIndex : node.children) {
+      LayoutNode &child = m_nodes[childIndex];
+      const LayoutStyle &childStyle = child.style;
+      if (!childStyle.displayNone &&
+          childStyle.positionType == PositionType::Relative &&
+          alignOf(childStyle, style) == Align::Stretch &&
+          isUndefined(dimension(childStyle, !row).resolve(innerCross))) {
+        child.crossSize = boundAxis(
+            childStyle, !row,
+            std::max(0.0f, innerCross - edgeSum(childStyle.margin, !row)),
+            innerCross);
+      }
+    }
+  }
+
+  LayoutSize size = row ? LayoutSize{innerMain + paddingMain,
+                                     innerCross + paddingCross}
+                        : LayoutSize{innerCross + paddingCross,
+                                     innerMain + paddingMain};
+  if (!performLayout) return size;
+
+  // 4. 按 justifyContent / alignItems 放置子节点
+  const float freeSpace = innerMain - usedMain;
+  float leading = 0;
+  float between = 0;
+  switch (style.justifyContent) {
+    case Justify::Center:
+      leading = freeSpace / 2;
+      break;
+    case Justify::FlexEnd:
+      leading = freeSpace;
+      break;
+    case Justify::SpaceBetween:
+      if (freeSpace > 0 && flowCount > 1) between = freeSpace / (flowCount - 1);
+      break;
+    case Justify::SpaceAround:
+      if (freeSpace > 0 && flowCount > 0) {
+        between = freeSpace / flowCount;
+        leading = between / 2;
+      }
+      break;
+    case Justify::SpaceEvenly:
+      if (freeSpace > 0) {
+        between = freeSpace / (flowCount + 1);
+        leading = between;
+      }
+      break;
+    case Justify::FlexStart:
+      break;
+  }
+
+  const Edge mainLeading = leadingEdge(style.flexDirection);
+  const Edge mainTrailing = trailingEdge(style.flexDirection);
+  const Edge crossLeading = row ? kEdgeTop : kEdgeLeft;
+  const Edge crossTrailing = row ? kEdgeBottom : kEdgeRight;
+  const bool reverse = isReverse(style.flexDirection);
+  const float nodeMain = row ? size.width : size.height;
+
+  float position =
+      style.padding[mainLeading] + style.border[mainLeading] + leading;
+  for (uint32_t childIndex : node.children) {
+    LayoutNode &child = m_nodes[childIndex];
+    const LayoutStyle &childStyle = child.style;
+    if (childStyle.displayNone) {
+      hideSubtree(childIndex);
+      continue;
+    }
+    if (childStyle.positionType == PositionType::Absolute) continue;
+
+    const float childMain = child.mainSize;
+    const float childCross = child.crossSize;
+    LayoutSize childSize =
+        row ? layoutNode(childIndex, childMain, MeasureMode::Exactly,
+                         childCross, MeasureMode::Exactly, innerWidthRef,
+                         innerHeightRef, true)
+            : layoutNode(childIndex, childCross, MeasureMode::Exactly,
+                         childMain, MeasureMode::Exactly, innerWidthRef,
+                         innerHeightRef, true);
+
+    position += childStyle.margin[mainLeading];
+    float mainPosition =
+        reverse ? nodeMain - position - childMain : position;
+    position += childMain + childStyle.margin[mainTrailing] + between;
+
+    float crossPosition = style.padding[crossLeading] +
+                          style.border[crossLeading] +
+                          childStyle.margin[crossLeading];
+    float crossSlack = innerCross - childCross -
+                       childStyle.margin[crossLeading] -
+                       childStyle.margin[crossTrailing];
+    switch (alignOf(childStyle, style)) {
+      case Align::Center:
+        crossPosition += crossSlack / 2;
+        break;
+      case Align::FlexEnd:
+        crossPosition += crossSlack;
+        break;
+      default:
+        break;
+    }
+
+    float x = row ? mainPosition : crossPosition;
+    float y = row ? crossPosition : mainPosition;
+    // 相对定位的偏移
+    const auto &inset = childStyle.position;
+    if (!isUndefined(inset[kEdgeLeft])) {
+      x += inset[kEdgeLeft];
+    } else if (!isUndefined(inset[kEdgeRight])) {
+      x -= inset[kEdgeRight];
+    }
+    if (!isUndefined(inset[kEdgeTop])) {
+      y += inset[kEdgeTop];
+    } else if (!isUndefined(inset[kEdgeBottom])) {
+      y -= inset[kEdgeBottom];
+    }
+    setFrame(childIndex, x, y, childSize);
+  }
+
+  // 5. 绝对定位的子节点不参与 flex，相对 padding box 定位
+  for (uint32_t childIndex : node.children) {
+    const LayoutStyle &childStyle = m_nodes[childIndex].style;
+    if (!childStyle.displayNone &&
+        childStyle.positionType == PositionType::Absolute) {
+      layoutAbsoluteChild(childIndex, size.width, size.height, style);
+    }
+  }
+  return size;
+}
+
+void LayoutEngine::layoutAbsoluteChild(uint32_t index, float parentWidth,
+                                       float parentHeight,
+                                       const LayoutStyle &parentStyle) {
+  const LayoutStyle &style = m_nodes[index].style;
+  const auto &border = parentStyle.border;
+  const auto &inset = style.position;
+  const auto &margin = style.margin;
+  const float containerWidth =
+      std::max(0.0f, parentWidth - border[kEdgeLeft] - border[kEdgeRight]);
+  const float containerHeight =
+      std::max(0.0f, parentHeight - border[kEdgeTop] - border[kEdgeBottom]);
+
+  // 尺寸：显式尺寸 > 两侧 inset > 按内容测量
+  auto resolveSize = [&](bool row) {
+    float container = row ? containerWidth : containerHeight;
+    float size = dimension(style, row).resolve(container);
+    Edge leading = row ? kEdgeLeft : kEdgeTop;
+    Edge trailing = row ? kEdgeRight : kEdgeBottom;
+    if (isUndefined(size) && !isUndefined(inset[leading]) &&
+        !isUndefined(inset[trailing])) {
+      size = container - inset[leading] - inset[trailing] - margin[leading] -
+             margin[trailing];
+    }
+    return isUndefined(size) ? size
+                             : boundAxis(style, row, std::max(0.0f, size),
+                                         container);
+  };
+  float width = resolveSize(true);
+  float height = resolveSize(false);
+
+  if (isUndefined(width) || isUndefined(height)) {
+    LayoutSize measured = layoutNode(
+        index, width,
+        isUndefined(width) ? MeasureMode::Undefined : MeasureMode::Exactly,
+        height,
+        isUndefined(height) ? MeasureMode::Undefined : MeasureMode::Exactly,
+        containerWidth, containerHeight, false);
+    width = measured.width;
+    height = measured.height;
+  }
+  LayoutSize size =
+      layoutNode(index, width, MeasureMode::Exactly, height,
+                 MeasureMode::Exactly, containerWidth, containerHeight, true);
+
+  auto resolvePosition = [&](bool row) {
+    Edge leading = row ? kEdgeLeft : kEdgeTop;
+    Edge trailing = row ? kEdgeRight : kEdgeBottom;
+    float parentSize = row ? parentWidth : parentHeight;
+    float childSize = row ? size.width : size.height;
+    if (!isUndefined(inset[leading])) {
+      return border[leading] + inset[leading] + margin[leading];
+    }
+    if (!isUndefined(inset[trailing])) {
+      return parentSize - border[trailing] - inset[trailing] -
+             margin[trailing] - childSize;
+    }
+    return border[leading] + parentStyle.padding[leading] + margin[leading];
+  };
+  setFrame(index, resolvePosition(true), resolvePosition(false), size);
+}
+
+void LayoutEngine::hideSubtree(uint32_t index) {
+  std::vector<uint32_t> stack{index};
+  while (!stack.empty()) {
+    uint32_t current = stack.back();
+    stack.pop_back();
+
+    LayoutNode &node = m_nodes[current];
+    setFrame(current, 0, 0, LayoutSize());
+    node.dirty = false;
+    node.layoutCache.valid = false;
+    stack.insert(stack.end(), node.children.begin(), node.children.end());
+  }
+}
+
+void LayoutEngine::setFrame(uint32_t index, float x, float y,
+                            LayoutSize size) {
+  LayoutNode &node = m_nodes[index];
+  LayoutFrame frame{x, y, size.width, size.height};
+  if (node.hasFrame && node.frame == frame) return;
+
+  node.frame = frame;
+  node.hasFrame = true;
+  m_changedTags.push_back(node.tag);
+}
+
+}  // namespace ui
+}  // namespace mini_rn
@@ -0,0 +1,210 @@
+#ifndef LAYOUTENGINE_H
+#define LAYOUTENGINE_H
+
+#include <array>
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "LayoutStyle.h"
+#include "ShadowTree.h"
+
+namespace mini_rn {
+namespace ui {
+
+/**
+ * 尺寸约束的类型（与 Yoga 的 YGMeasureMode 一致）
+ * - Undefined: 不限制
+ * - Exactly: 必须等于给定值
+ * - AtMost: 不超过给定值
+ */
+enum class MeasureMode { Undefined, Exactly, AtMost };
+
+struct LayoutSize {
+  float width = 0;
+  float height = 0;
+};
+
+/**
+ * 布局结果：相对父节点的位置和尺寸（border box）
+ */
+struct LayoutFrame {
+  float x = 0;
+  float y = 0;
+  float width = 0;
+  float height = 0;
+
+  bool operator==(const LayoutFrame &other) const {
+    return x == other.x && y == other.y && width == other.width &&
+           height == other.height;
+  }
+  bool operator!=(const LayoutFrame &other) const { return !(*this == other); }
+};
+
+/**
+ * 叶子节点的内容测量函数（如文本）
+ * 参数为 content box 的约束，返回内容尺寸
+ */
+using MeasureFunction =
+    std::function<LayoutSize(const ShadowNode &node, float width,
+                             MeasureMode widthMode, float height,
+                             MeasureMode heightMode)>;
+
+/**
+ * LayoutEngine - 增量 flexbox 布局引擎
+ *
+ * 在 ShadowTree 之上计算每个节点的 frame，算法是 Yoga 的单行子集
+ * （支持的样式见 LayoutStyle）。布局数据按 ShadowTree 的存储下标保存在
+ * 平行数组中，不修改 ShadowNode。
+ *
+ * 增量策略（与 Yoga 相同）：
+ * - 消费 ShadowTree 记录的布局失效：新建、子节点变化或布局样式真正改变的节点
+ *   被标记为 dirty，并沿父链向上传播，遇到已经 dirty 的祖先即停止
+ * - 每个节点缓存最近一次布局和若干次测量的结果，以约束为键；
+ *   非 dirty 节点在约束不变时直接复用缓存，整棵子树都不会被访问
+ * - 因此只修改一个叶子时，只有它到根的路径和受影响的兄弟会重新计算
+ */
+class LayoutEngine {
+ public:
+  /**
+   * 单次 computeLayout 的统计
+   */
+  struct PassStats {
+    size_t dirtyNodes = 0;     // 本次被标记为 dirty 的节点数
+    size_t visits = 0;         // 布局 / 测量调用次数
+    size_t cacheHits = 0;      // 命中缓存、跳过计算的调用次数
+    size_t measureCalls = 0;   // 调用测量函数的次数
+    size_t framesChanged = 0;  // frame 发生变化的节点数
+  };
+
+  explicit LayoutEngine(ShadowTree &tree);
+
+  // 禁用拷贝构造和赋值
+  LayoutEngine(const LayoutEngine &) = delete;
+  LayoutEngine &operator=(const LayoutEngine &) = delete;
+
+  /**
+   * 设置根视图的尺寸，kUndefined 表示该方向按内容决定
+   */
+  void setRootSize(int rootTag, float width, float height);
+
+  /**
+   * 为某类视图注册内容测量函数，只对没有子节点的节点生效
+   * 应在创建该类视图之前注册
+   */
+  void registerMeasureFunction(const std::string &viewName,
+                               MeasureFunction measure);
+
+  /**
+   * 标记节点需要重新测量（内容变化但属性没有变化时由 Native 侧调用）
+   */
+  void markDirty(int tag);
+
+  /**
+   * 是否有待处理的变更（shadow tree 变化、根尺寸变化或手动标记）
+   */
+  bool needsLayout() const;
+
+  /**
+   * 处理 shadow tree 上的变更并重新布局所有根视图
+   * @return frame 发生变化的节点数
+   */
+  size_t computeLayout();
+
+  /**
+   * 节点的布局结果，节点不存在或尚未布局时返回 nullptr
+   */
+  const LayoutFrame *getFrame(int tag) const;
+
+  /**
+   * 最近一次 computeLayout 中 frame 发生变化的节点 tag
+   */
+  const std::vector<int> &getChangedTags() const { return m_changedTags; }
+
+  const PassStats &getLastPassStats() const { return m_pass; }
+
+ private:
+  static constexpr size_t kMeasureCacheSize = 4;
+
+  struct CacheEntry {
+    bool valid = false;
+    MeasureMode widthMode = MeasureMode::Undefined;
+    MeasureMode heightMode = MeasureMode::Undefined;
+    float width = 0;
+    float height = 0;
+    float ownerWidth = 0;
+    float ownerHeight = 0;
+    LayoutSize result;
+  };
+
+  struct LayoutNode {
+    int tag = kNoTag;
+    bool dirty = true;
+    bool hasFrame = false;
+    LayoutStyle style;
+    const MeasureFunction *measure = nullptr;
+    size_t contentHash = 0;  // 有测量函数时，可能影响内容尺寸的属性的哈希
+    std::vector<uint32_t> children;  // 子节点的存储下标
+    LayoutFrame frame;
+
+    // performLayout 的结果，子节点 frame 与之对应
+    CacheEntry layoutCache;
+    std::array<CacheEntry, kMeasureCacheSize> measureCache;
+    uint8_t nextMeasureSlot = 0;
+
+    // 父节点布局过程中的临时数据
+    float mainSize = 0;
+    float crossSize = 0;
+  };
+
+  struct RootSize {
+    float width = kUndefined;
+    float height = kUndefined;
+  };
+
+  void syncInvalidations();
+
+  /**
+   * 按 shadow tree 更新节点的样式和子节点
+   * @return 是否需要重新布局（只有属性变化且布局样式不变时返回 false）
+   */
+  bool syncNode(uint32_t index, bool propsOnly);
+  void markDirtyAt(uint32_t index);
+
+  /**
+   * 计算节点的 border box 尺寸
+   * @param performLayout 为 true 时同时确定子节点的 frame，否则只测量
+   */
+  LayoutSize layoutNode(uint32_t index, float width, MeasureMode widthMode,
+                        float height, MeasureMode heightMode, float ownerWidth,
+                        float ownerHeight, bool performLayout);
+  LayoutSize measureLeaf(uint32_t index, float width, MeasureMode widthMode,
+                         float height, MeasureMode heightMode,
+                         float ownerWidth, float ownerHeight);
+  LayoutSize layoutContainer(uint32_t index, float width,
+                             MeasureMode widthMode, float height,
+                             MeasureMode heightMode, float ownerWidth,
+                             float ownerHeight, bool performLayout);
+  void layoutAbsoluteChild(uint32_t index, float parentWidth,
+                           float parentHeight, const LayoutStyle &parentStyle);
+  void hideSubtree(uint32_t index);
+  void setFrame(uint32_t index, float x, float y, LayoutSize size);
+
+  ShadowTree &m_tree;
+  std::vector<LayoutNode> m_nodes;  // 按 ShadowTree 存储下标索引
+  std::unordered_map<int, RootSize> m_rootSizes;
+  std::unordered_map<std::string, MeasureFunction> m_measureFunctions;
+  std::vector<LayoutInvalidation> m_invalidations;
+  std::vector<int> m_manualDirtyTags;
+  bool m_rootSizeChanged = false;
+
+  std::vector<int> m_changedTags;
+  PassStats m_pass;
+};
+
+}  // namespace ui
+}  // namespace mini_rn
+
+#endif  // LAYOUTENGINE_H
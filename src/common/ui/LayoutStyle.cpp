@@ -0,0 +1,342 @@
+#include "LayoutStyle.h"
+
+#include <cstdlib>
+#include <initializer_list>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+
+namespace mini_rn {
+namespace ui {
+
+namespace {
+
+enum class StyleProp {
+  FlexDirection,
+  JustifyContent,
+  AlignItems,
+  AlignSelf,
+  Position,
+  Display,
+  Flex,
+  FlexGrow,
+  FlexShrink,
+  FlexBasis,
+  Width,
+  Height,
+  MinWidth,
+  MinHeight,
+  MaxWidth,
+  MaxHeight,
+  Margin,
+  Padding,
+  Border,
+  Inset,
+};
+
+// 四边属性的简写位置，按优先级从低到高解析
+enum EdgeSlot {
+  kSlotAll = 0,
+  kSlotHorizontal,
+  kSlotVertical,
+  kSlotStart,
+  kSlotEnd,
+  kSlotLeft,
+  kSlotTop,
+  kSlotRight,
+  kSlotBottom,
+  kSlotCount,
+};
+
+struct PropInfo {
+  StyleProp prop;
+  EdgeSlot slot;
+};
+
+// 按驻留后的 ID 查找，解析时不再比较字符串
+const std::unordered_map<PropId, PropInfo> &styleProps() {
+  static const std::unordered_map<PropId, PropInfo> props = [] {
+    std::unordered_map<std::string, PropInfo> byName = {
+        {"flexDirection", {StyleProp::FlexDirection, kSlotAll}},
+        {"justifyContent", {StyleProp::JustifyContent, kSlotAll}},
+        {"alignItems", {StyleProp::AlignItems, kSlotAll}},
+        {"alignSelf", {StyleProp::AlignSelf, kSlotAll}},
+        {"position", {StyleProp::Position, kSlotAll}},
+        {"display", {StyleProp::Display, kSlotAll}},
+        {"flex", {StyleProp::Flex, kSlotAll}},
+        {"flexGrow", {StyleProp::FlexGrow, kSlotAll}},
+        {"flexShrink", {StyleProp::FlexShrink, kSlotAll}},
+        {"flexBasis", {StyleProp::FlexBasis, kSlotAll}},
+        {"width", {StyleProp::Width, kSlotAll}},
+        {"height", {StyleProp::Height, kSlotAll}},
+        {"minWidth", {StyleProp::MinWidth, kSlotAll}},
+        {"minHeight", {StyleProp::MinHeight, kSlotAll}},
+        {"maxWidth", {StyleProp::MaxWidth, kSlotAll}},
+        {"maxHeight", {StyleProp::MaxHeight, kSlotAll}},
+        {"borderWidth", {StyleProp::Border, kSlotAll}},
+        {"borderStartWidth", {StyleProp::Border, kSlotStart}},
+        {"borderEndWidth", {StyleProp::Border, kSlotEnd}},
+        {"borderLeftWidth", {StyleProp::Border, kSlotLeft}},
+        {"borderTopWidth", {StyleProp::Border, kSlotTop}},
+        {"borderRightWidth", {StyleProp::Border, kSlotRight}},
+        {"borderBottomWidth", {StyleProp::Border, kSlotBottom}},
+        {"start", {StyleProp::Inset, kSlotStart}},
+        {"end", {StyleProp::Inset, kSlotEnd}},
+        {"left", {StyleProp::Inset, kSlotLeft}},
+        {"top", {StyleProp::Inset, kSlotTop}},
+        {"right", {StyleProp::Inset, kSlotRight}},
+        {"bottom", {StyleProp::Inset, kSlotBottom}},
+    };
+
+    // margin* / padding* 共用同一组后缀
+    const std::pair<const char *, EdgeSlot> suffixes[] = {
+        {"", kSlotAll},       {"Horizontal", kSlotHorizontal},
+        {"Vertical", kSlotVertical},
+        {"Start", kSlotStart}, {"End", kSlotEnd},
+        {"Left", kSlotLeft},  {"Top", kSlotTop},
+        {"Right", kSlotRight}, {"Bottom", kSlotBottom},
+    };
+    for (const auto &suffix : suffixes) {
+      byName[std::string("margin") + suffix.first] = {StyleProp::Margin,
+                                                      suffix.second};
+      byName[std::string("padding") + suffix.first] = {StyleProp::Padding,
+                                                       suffix.second};
+    }
+
+    std::unordered_map<PropId, PropInfo> map;
+    for (const auto &entry : byName) {
+      map[PropNames::intern(entry.first)] = entry.second;
+    }
+    return map;
+  }();
+  return props;
+}
+
+bool parseNumber(const PropValue &value, float &number) {
+  if (!value.isNumber()) return false;
+  number = static_cast<float>(value.asNumber());
+  return !isUndefined(number);
+}
+
+// 数字为点，"50%" 为百分比，"auto" 和无法识别的值为未设置
+LayoutLength parseLength(const PropValue &value) {
+  LayoutLength length;
+  float number;
+  if (parseNumber(value, number)) {
+    length.unit = LayoutLength::Unit::Point;
+    length.value = number;
+    return length;
+  }
+
+  const std::string &text = value.asString();
+  if (value.isString() && text.size() > 1 && text.back() == '%') {
+    char *end = nullptr;
+    number = std::strtof(text.c_str(), &end);
+    if (end == text.c_str() + text.size() - 1 && !isUndefined(number)) {
+      length.unit = LayoutLength::Unit::Percent;
+      length.value = number;
+    }
+  }
+  return length;
+}
+
+const std::string &parseKeyword(const PropValue &value) {
+  static const std::string empty;
+  return value.isString() ? value.asString() : empty;
+}
+
+FlexDirection parseFlexDirection(const std::string &keyword) {
+  if (keyword == "row") return FlexDirection::Row;
+  if (keyword == "row-reverse") return FlexDirection::RowReverse;
+  if (keyword == "column-reverse") return FlexDirection::ColumnReverse;
+  return FlexDirection::Column;
+}
+
+Justify parseJustify(const std::string &keyword) {
+  if (keyword == "center") return Justify::Center;
+  if (keyword == "flex-end") return Justify::FlexEnd;
+  if (keyword == "space-between") return Justify::SpaceBetween;
+  if (keyword == "space-around") return Justify::SpaceAround;
+  if (keyword == "space-evenly") return Justify::SpaceEvenly;
+  return Justify::FlexStart;
+}
+
+Align parseAlign(const std::string &keyword, Align fallback) {
+  if (keyword == "auto") return Align::Auto;
+  if (keyword == "flex-start") return Align::FlexStart;
+  if (keyword == "center") return Align::Center;
+  if (keyword == "flex-end") return Align::FlexEnd;
+  if (keyword == "stretch") return Align::Stretch;
+  return fallback;
+}
+
+// 按优先级展开：具体边 > start/end > horizontal/vertical > 全部
+std::array<float, 4> resolveEdges(const std::array<float, kSlotCount> &slots,
+                                  float fallback) {
+  auto pick = [&](std::initializer_list<EdgeSlot> order) {
+    for (EdgeSlot slot : order) {
+      if (!isUndefined(slots[slot])) return slots[slot];
+    }
+    return fallback;
+  };
+
+  std::array<float, 4> edges;
+  edges[kEdgeLeft] = pick({kSlotLeft, kSlotStart, kSlotHorizontal, kSlotAll});
+  edges[kEdgeTop] = pick({kSlotTop, kSlotVertical, kSlotAll});
+  edges[kEdgeRight] = pick({kSlotRight, kSlotEnd, kSlotHorizontal, kSlotAll});
+  edges[kEdgeBottom] = pick({kSlotBottom, kSlotVertical, kSlotAll});
+  return edges;
+}
+
+bool sameFloat(float a, float b) {
+  return a == b || (isUndefined(a) && isUndefined(b));
+}
+
+bool sameEdges(const std::array<float, 4> &a, const std::array<float, 4> &b) {
+  for (size_t i = 0; i < a.size(); ++i) {
+    if (!sameFloat(a[i], b[i])) return false;
+  }
+  return true;
+}
+
+}  // namespace
+
+bool LayoutStyle::operator==(const LayoutStyle &other) const {
+  return flexDirection == other.flexDirection &&
+         justifyContent == other.justifyContent &&
+         alignItems == other.alignItems && alignSelf == other.alignSelf &&
+         positionType == other.positionType &&
+         displayNone == other.displayNone && flexGrow == other.flexGrow &&
+         flexShrink == other.flexShrink && flexBasis == other.flexBasis &&
+         width == other.width && height == other.height &&
+         minWidth == other.minWidth && minHeight == other.minHeight &&
+         maxWidth == other.maxWidth && maxHeight == other.maxHeight &&
+         sameEdges(margin, other.margin) && sameEdges(padding, other.padding) &&
+         sameEdges(border, other.border) &&
+         sameEdges(position, other.position);
+}
+
+LayoutStyle parseLayoutStyle(const Props &props) {
+  LayoutStyle style;
+  std::array<float, kSlotCount> margin, padding, border, inset;
+  for (auto *slots : {&margin, &padding, &border, &inset}) {
+    slots->fill(kUndefined);
+  }
+  float flex = kUndefined;
+  float flexGrow = kUndefined;
+  float flexShrink = kUndefined;
+
+  const auto &known = styleProps();
+  for (const auto &prop : props) {
+    auto it = known.find(prop.first);
+    if (it == known.end()) continue;
+
+    const PropValue &value = prop.second;
+    float number = kUndefined;
+    switch (it->second.prop) {
+      case StyleProp::FlexDirection:
+        style.flexDirection = parseFlexDirection(parseKeyword(value));
+        break;
+      case StyleProp::JustifyContent:
+        style.justifyContent = parseJustify(parseKeyword(value));
+        break;
+      case StyleProp::AlignItems:
+        style.alignItems = parseAlign(parseKeyword(value), Align::Stretch);
+        break;
+      case StyleProp::AlignSelf:
+        style.alignSelf = parseAlign(parseKeyword(value), Align::Auto);
+        break;
+      case StyleProp::Position:
+        style.positionType = parseKeyword(value) == "absolute"
+                                 ? PositionType::Absolute
+                                 : PositionType::Relative;
+        break;
+      case StyleProp::Display:
+        style.displayNone = parseKeyword(value) == "none";
+        break;
+      case StyleProp::Flex:
+        parseNumber(value, flex);
+        break;
+      case StyleProp::FlexGrow:
+        parseNumber(value, flexGrow);
+        break;
+      case StyleProp::FlexShrink:
+        parseNumber(value, flexShrink);
+        break;
+      case StyleProp::FlexBasis:
+        style.flexBasis = parseLength(value);
+        break;
+      case StyleProp::Width:
+        style.width = parseLength(value);
+        break;
+      case StyleProp::Height:
+        style.height = parseLength(value);
+        break;
+      case StyleProp::MinWidth:
+        style.minWidth = parseLength(value);
+        break;
+      case StyleProp::MinHeight:
+        style.minHeight = parseLength(value);
+        break;
+      case StyleProp::MaxWidth:
+        style.maxWidth = parseLength(value);
+        break;
+      case StyleProp::MaxHeight:
+        style.maxHeight = parseLength(value);
+        break;
+      case StyleProp::Margin:
+      case StyleProp::Padding:
+      case StyleProp::Border:
+      case StyleProp::Inset: {
+        if (!parseNumber(value, number)) break;
+        auto &slots = it->second.prop == StyleProp::Margin    ? margin
+                      : it->second.prop == StyleProp::Padding ? padding
+                      : it->second.prop == StyleProp::Border  ? border
+                                                              : inset;
+        slots[it->second.slot] = number;
+        break;
+      }
+    }
+  }
+
+  // flex 简写与 Yoga（非 web 默认值）一致：flex > 0 时 grow = flex、basis = 0，
+  // flex < 0 时 shrink = -flex；单独设置的 flexGrow / flexShrink 优先
+  if (!isUndefined(flex) && flex > 0) {
+    style.flexGrow = flex;
+    if (style.flexBasis.unit == LayoutLength::Unit::Undefined) {
+      style.flexBasis.unit = LayoutLength::Unit::Point;
+      style.flexBasis.value = 0;
+    }
+  } else if (!isUndefined(flex) && flex < 0) {
+    style.flexShrink = -flex;
+  }
+  if (!isUndefined(flexGrow)) style.flexGrow = flexGrow;
+  if (!isUndefined(flexShrink)) style.flexShrink = flexShrink;
+
+  style.margin = resolveEdges(margin, 0);
+  style.padding = resolveEdges(padding, 0);
+  style.border = resolveEdges(border, 0);
+  style.position = resolveEdges(inset, kUndefined);
+  return style;
+}
+
+bool isPaintOnlyProp(PropId id) {
+  static const std::unordered_set<PropId> paintOnly = [] {
+    std::unordered_set<PropId> ids;
+    for (const char *name :
+         {"backgroundColor", "opacity", "color", "tintColor", "borderColor",
+          "borderLeftColor", "borderTopColor", "borderRightColor",
+          "borderBottomColor", "borderRadius", "borderStyle", "transform",
+          "shadowColor", "shadowOffset", "shadowOpacity", "shadowRadius",
+          "elevation", "zIndex", "testID", "nativeID", "accessibilityLabel",
+          "pointerEvents", "backfaceVisibility"}) {
+      ids.insert(PropNames::intern(name));
+    }
+    return ids;
+  }();
+  return paintOnly.count(id) != 0;
+}
+
+}  // namespace ui
+}  // namespace mini_rn
@@ -0,0 +1,123 @@
+#ifndef LAYOUTSTYLE_H
+#define LAYOUTSTYLE_H
+
+#include <array>
+#include <cmath>
+#include <limits>
+#include <string>
+
+#include "Props.h"
+
+namespace mini_rn {
+namespace ui {
+
+/**
+ * 未定义的长度（与 Yoga 一致，用 NaN 表示）
+ */
+constexpr float kUndefined = std::numeric_limits<float>::quiet_NaN();
+
+inline bool isUndefined(float value) { return std::isnan(value); }
+
+/**
+ * 长度值：点、百分比或未设置（auto）
+ */
+struct LayoutLength {
+  enum class Unit { Undefined, Point, Percent };
+
+  Unit unit = Unit::Undefined;
+  float value = 0;
+
+  /**
+   * 按参照尺寸解析为点，未设置或参照尺寸未定义时返回 kUndefined
+   */
+  float resolve(float ownerSize) const {
+    switch (unit) {
+      case Unit::Point:
+        return value;
+      case Unit::Percent:
+        return isUndefined(ownerSize) ? kUndefined : value * ownerSize / 100;
+      case Unit::Undefined:
+        break;
+    }
+    return kUndefined;
+  }
+
+  bool operator==(const LayoutLength &other) const {
+    return unit == other.unit && value == other.value;
+  }
+};
+
+enum class FlexDirection { Column, ColumnReverse, Row, RowReverse };
+enum class Justify {
+  FlexStart,
+  Center,
+  FlexEnd,
+  SpaceBetween,
+  SpaceAround,
+  SpaceEvenly,
+};
+enum class Align { Auto, FlexStart, Center, FlexEnd, Stretch };
+enum class PositionType { Relative, Absolute };
+
+/**
+ * 四条边的下标
+ */
+enum Edge { kEdgeLeft = 0, kEdgeTop = 1, kEdgeRight = 2, kEdgeBottom = 3 };
+
+/**
+ * LayoutStyle - 布局引擎使用的样式
+ *
+ * 支持的子集（名称和默认值与 React Native / Yoga 一致）：
+ * - flexDirection、justifyContent、alignItems、alignSelf
+ * - flex、flexGrow、flexShrink、flexBasis
+ * - width、height、min/max 尺寸（点或百分比）
+ * - margin、padding、borderWidth 系列（点，含 Horizontal / Vertical 简写）
+ * - position（relative / absolute）与 left、top、right、bottom（点）
+ * - display: none
+ *
+ * 不支持 flexWrap、aspectRatio、RTL 和像素取整。
+ */
+struct LayoutStyle {
+  FlexDirection flexDirection = FlexDirection::Column;
+  Justify justifyContent = Justify::FlexStart;
+  Align alignItems = Align::Stretch;
+  Align alignSelf = Align::Auto;
+  PositionType positionType = PositionType::Relative;
+  bool displayNone = false;
+
+  float flexGrow = 0;
+  float flexShrink = 0;
+  LayoutLength flexBasis;
+
+  LayoutLength width;
+  LayoutLength height;
+  LayoutLength minWidth;
+  LayoutLength minHeight;
+  LayoutLength maxWidth;
+  LayoutLength maxHeight;
+
+  // 按 Edge 下标排列，已展开简写
+  std::array<float, 4> margin{};
+  std::array<float, 4> padding{};
+  std::array<float, 4> border{};
+  std::array<float, 4> position{
+      {kUndefined, kUndefined, kUndefined, kUndefined}};
+
+  bool operator==(const LayoutStyle &other) const;
+  bool operator!=(const LayoutStyle &other) const { return !(*this == other); }
+};
+
+/**
+ * 从视图属性解析布局样式，类型不符或无法识别的值按未设置处理
+ */
+LayoutStyle parseLayoutStyle(const Props &props);
+
+/**
+ * 只影响绘制、既不影响布局也不影响内容测量的属性（如 backgroundColor、opacity）
+ */
+bool isPaintOnlyProp(PropId id);
+
+}  // namespace ui
+}  // namespace mini_rn
+
+#endif  // LAYOUTSTYLE_H
@@ -0,0 +1,105 @@
+#include "MountInstruction.h"
+
+namespace mini_rn {
+namespace ui {
+
+void MountInstructionBuffer::reserve(size_t instructions, size_t props,
+                                     size_t bytes) {
+  m_instructions.reserve(instructions);
+  m_props.reserve(props);
+  m_data.reserve(bytes);
+}
+
+void MountInstructionBuffer::clear() {
+  m_instructions.clear();
+  m_props.clear();
+  m_data.clear();
+}
+
+void MountInstructionBuffer::addCreate(int tag, const std::string &viewName,
+                                       const Props &props) {
+  MountInstruction &instruction = append(MountInstruction::Type::Create, tag);
+  instruction.viewNameLength = static_cast<uint32_t>(viewName.size());
+  instruction.viewNameOffset = appendString(viewName);
+  for (const auto &prop : props) {
+    addProp(prop.first, prop.second);
+  }
+}
+
+void MountInstructionBuffer::addDelete(int tag) {
+  append(MountInstruction::Type::Delete, tag);
+}
+
+void MountInstructionBuffer::addInsert(int parentTag, int tag, int index) {
+  MountInstruction &instruction = append(MountInstruction::Type::Insert, tag);
+  instruction.parentTag = parentTag;
+  instruction.index = index;
+}
+
+void MountInstructionBuffer::addRemove(int parentTag, int tag, int index) {
+  MountInstruction &instruction = append(MountInstruction::Type::Remove, tag);
+  instruction.parentTag = parentTag;
+  instruction.index = index;
+}
+
+void MountInstructionBuffer::beginUpdateProps(int tag) {
+  append(MountInstruction::Type::UpdateProps, tag);
+}
+
+void MountInstructionBuffer::addProp(PropId name, const PropValue &value) {
+  MountProp prop;
+  prop.name = name;
+  prop.type = value.getType();
+  prop.number = value.asNumber();
+  if (!value.asString().empty()) {
+    prop.textLength = static_cast<uint32_t>(value.asString().size());
+    prop.textOffset = appendString(value.asString());
+  }
+  m_props.push_back(prop);
+  m_instructions.back().propsCount++;
+}
+
+PropValue MountInstructionBuffer::getPropValue(const MountProp &prop) const {
+  switch (prop.type) {
+    case PropValue::Type::Null:
+      return PropValue();
+    case PropValue::Type::Bool:
+      return PropValue(prop.number != 0);
+    case PropValue::Type::Number:
+      return PropValue(prop.number);
+    case PropValue::Type::String:
+      return PropValue(std::string(getPropText(prop)));
+    case PropValue::Type::Json:
+      return PropValue::fromJSON(std::string(getPropText(prop)));
+  }
+  return PropValue();
+}
+
+void MountInstructionBuffer::addUpdateLayout(int tag,
+                                             const LayoutFrame &frame) {
+  append(MountInstruction::Type::UpdateLayout, tag).frame = frame;
+}
+
+size_t MountInstructionBuffer::getCapacityBytes() const {
+  return m_instructions.capacity() * sizeof(MountInstruction) +
+         m_props.capacity() * sizeof(MountProp) + m_data.capacity();
+}
+
+MountInstruction &MountInstructionBuffer::append(MountInstruction::Type type,
+                                                 int tag) {
+  m_instructions.emplace_back();
+  MountInstruction &instruction = m_instructions.back();
+  instruction.type = type;
+  instruction.tag = tag;
+  instruction.propsBegin = static_cast<uint32_t>(m_props.size());
+  return instruction;
+}
+
+uint32_t MountInstructionBuffer::appendString(std::string_view text) {
+  uint32_t offset = static_cast<uint32_t>(m_data.size());
+  m_data.append(text);
+  return offset;
+}
+
+}  // namespace ui
+}  // namespace mini_rn
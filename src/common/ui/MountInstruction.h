@@ -0,0 +1,163 @@
+#ifndef MOUNTINSTRUCTION_H
+#define MOUNTINSTRUCTION_H
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "LayoutEngine.h"
+#include "ViewMutation.h"
+
+namespace mini_rn {
+namespace ui {
+
+/**
+ * MountInstruction - 平台侧需要执行的一条视图操作
+ *
+ * 定长结构，不持有字符串：视图名和属性保存在所属 MountInstructionBuffer
+ * 的连续存储中，通过偏移访问。
+ */
+struct MountInstruction {
+  enum class Type : uint8_t {
+    Create,        // tag, viewName, props（完整属性）
+    Delete,        // tag
+    Insert,        // parentTag, tag, index
+    Remove,        // parentTag, tag, index
+    UpdateProps,   // tag, props（只包含变化的属性，删除的属性值为 null）
+    UpdateLayout,  // tag, frame
+  };
+
+  Type type = Type::Create;
+  int tag = kNoTag;
+  int parentTag = kNoTag;
+  int index = 0;
+  uint32_t viewNameOffset = 0;
+  uint32_t viewNameLength = 0;
+  uint32_t propsBegin = 0;  // 在 buffer 属性表中的起始下标
+  uint32_t propsCount = 0;
+  LayoutFrame frame;
+};
+
+/**
+ * 指令携带的一个属性：名称为驻留 ID，数值直接保存，
+ * 字符串（String / Json）指向 buffer 的字符存储
+ */
+struct MountProp {
+  PropId name = 0;
+  PropValue::Type type = PropValue::Type::Null;
+  double number = 0;  // Bool / Number
+  uint32_t textOffset = 0;
+  uint32_t textLength = 0;
+};
+
+constexpr size_t kMountInstructionTypeCount = 6;
+
+inline const char *getMountInstructionTypeName(MountInstruction::Type type) {
+  switch (type) {
+    case MountInstruction::Type::Create:
+      return "create";
+    case MountInstruction::Type::Delete:
+      return "delete";
+    case MountInstruction::Type::Insert:
+      return "insert";
+    case MountInstruction::Type::Remove:
+      return "remove";
+    case MountInstruction::Type::UpdateProps:
+      return "updateProps";
+    case MountInstruction::Type::UpdateLayout:
+      return "updateLayout";
+  }
+  return "unknown";
+}
+
+/**
+ * MountInstructionBuffer - 一个批次的扁平指令流
+ *
+ * 由三块连续存储组成：定长指令数组、属性表和字符数据。clear() 保留容量，
+ * 同一个 buffer 在每个批次复用，稳定状态下不再分配内存；整个 buffer 可以
+ * 整体移交给 UI 线程，消费方按顺序遍历一次即可。
+ *
+ * 指令顺序（平台按顺序执行即可保持下标有效）：
+ * Remove（同一父节点按下标从大到小）→ Delete → Create →
+ * Insert（同一父节点按下标从小到大）→ UpdateProps → UpdateLayout
+ */
+class MountInstructionBuffer {
+ public:
+  MountInstructionBuffer() = default;
+
+  /**
+   * 预分配容量
+   */
+  void reserve(size_t instructions, size_t props, size_t bytes);
+
+  /**
+   * 清空内容，保留已分配的容量
+   */
+  void clear();
+
+  void addCreate(int tag, const std::string &viewName, const Props &props);
+  void addDelete(int tag);
+  void addInsert(int parentTag, int tag, int index);
+  void addRemove(int parentTag, int tag, int index);
+
+  /**
+   * 开始一条 UpdateProps 指令，随后用 addProp 追加属性
+   */
+  void beginUpdateProps(int tag);
+  void addProp(PropId name, const PropValue &value);
+
+  void addUpdateLayout(int tag, const LayoutFrame &frame);
+
+  size_t size() const { return m_instructions.size(); }
+  bool empty() const { return m_instructions.empty(); }
+  const MountInstruction &operator[](size_t i) const {
+    return m_instructions[i];
+  }
+  std::vector<MountInstruction>::const_iterator begin() const {
+    return m_instructions.begin();
+  }
+  std::vector<MountInstruction>::const_iterator end() const {
+    return m_instructions.end();
+  }
+
+  std::string_view getViewName(const MountInstruction &instruction) const {
+    return view(instruction.viewNameOffset, instruction.viewNameLength);
+  }
+  const MountProp &getProp(const MountInstruction &instruction,
+                           uint32_t i) const {
+    return m_props[instruction.propsBegin + i];
+  }
+  const std::string &getPropName(const MountProp &prop) const {
+    return PropNames::getName(prop.name);
+  }
+  std::string_view getPropText(const MountProp &prop) const {
+    return view(prop.textOffset, prop.textLength);
+  }
+
+  /**
+   * 还原为 PropValue（会复制字符串，平台侧可直接读取 MountProp 避免复制）
+   */
+  PropValue getPropValue(const MountProp &prop) const;
+
+  /**
+   * 已分配的字节数（三块存储的容量之和）
+   */
+  size_t getCapacityBytes() const;
+
+ private:
+  MountInstruction &append(MountInstruction::Type type, int tag);
+  uint32_t appendString(std::string_view text);
+  std::string_view view(uint32_t offset, uint32_t length) const {
+    return std::string_view(m_data.data() + offset, length);
+  }
+
+  std::vector<MountInstruction> m_instructions;
+  std::vector<MountProp> m_props;
+  std::string m_data;
+};
+
+}  // namespace ui
+}  // namespace mini_rn
+
+#endif  // MOUNTINSTRUCTION_H
@@ -0,0 +1,210 @@
+#include "MountingDiffer.h"
+
+#include <algorithm>
+
+namespace mini_rn {
+namespace ui {
+
+void MountingDiffer::diff(const ShadowTree &tree, const LayoutEngine &layout,
+                          const std::vector<ViewMutation> &mutations,
+                          MountInstructionBuffer &buffer) {
+  buffer.clear();
+  m_touched.clear();
+  m_creates.clear();
+  m_updates.clear();
+  m_deletes.clear();
+  m_layouts.clear();
+  m_removes.clear();
+  m_inserts.clear();
+
+  // 1. 本批次涉及的节点；被删除节点的父节点需要从快照中找
+  for (const auto &mutation : mutations) {
+    m_touched.push_back(mutation.tag);
+    if (mutation.type == ViewMutation::Type::RemoveView) {
+      auto it = m_mounted.find(mutation.tag);
+      if (it != m_mounted.end() && it->second.parentTag != kNoTag) {
+        m_touched.push_back(it->second.parentTag);
+      }
+    }
+  }
+  std::sort(m_touched.begin(), m_touched.end());
+  m_touched.erase(std::unique(m_touched.begin(), m_touched.end()),
+                  m_touched.end());
+
+  // 2. 新视图先进入快照，保证子节点比较时所有子节点都已挂载
+  for (int tag : m_touched) {
+    const ShadowNode *node = tree.getNode(tag);
+    if (!node) continue;
+
+    auto it = m_mounted.find(tag);
+    if (it == m_mounted.end()) {
+      MountedView &view = m_mounted[tag];
+      if (node->tag == node->rootTag) {
+        view.props = node->props;  // 根视图由平台创建
+      } else {
+        m_creates.push_back(tag);
+      }
+    } else if (it->second.props != node->props) {
+      m_updates.push_back(tag);
+    }
+  }
+
+  // 3. 子节点变化
+  for (int tag : m_touched) {
+    const ShadowNode *node = tree.getNode(tag);
+    if (!node) continue;
+
+    MountedView &view = m_mounted[tag];
+    if (view.children == node->children) continue;
+
+    m_oldChildren.swap(view.children);
+    view.children = node->children;
+    diffChildren(tag, m_oldChildren, node->children, tree);
+  }
+
+  // 4. 父节点也已删除的视图（父节点的子节点比较不会处理它们）
+  for (int tag : m_touched) {
+    if (!tree.getNode(tag) && m_mounted.count(tag)) {
+      deleteSubtree(tag);
+    }
+  }
+
+  // 5. frame 变化
+  for (int tag : layout.getChangedTags()) {
+    auto it = m_mounted.find(tag);
+    const LayoutFrame *frame = layout.getFrame(tag);
+    if (it == m_mounted.end() || !frame) continue;
+
+    const ShadowNode *node = tree.getNode(tag);
+    if (!node || node->tag == node->rootTag) continue;
+
+    MountedView &view = it->second;
+    if (view.hasFrame && view.frame == *frame) continue;
+    view.frame = *frame;
+    view.hasFrame = true;
+    m_layouts.push_back(tag);
+  }
+
+  // 6. 按平台执行顺序写入 buffer
+  for (const auto &op : m_removes) {
+    buffer.addRemove(op.parentTag, op.tag, op.index);
+  }
+  for (int tag : m_deletes) {
+    buffer.addDelete(tag);
+  }
+  for (int tag : m_creates) {
+    const ShadowNode *node = tree.getNode(tag);
+    buffer.addCreate(tag, node->viewName, node->props);
+    m_mounted[tag].props = node->props;
+  }
+  for (const auto &op : m_inserts) {
+    buffer.addInsert(op.parentTag, op.tag, op.index);
+  }
+  for (int tag : m_updates) {
+    emitPropsUpdate(tag, tree.getNode(tag)->props, buffer);
+  }
+  for (int tag : m_layouts) {
+    buffer.addUpdateLayout(tag, m_mounted[tag].frame);
+  }
+}
+
+void MountingDiffer::diffChildren(int parentTag,
+                                  const std::vector<int> &oldChildren,
+                                  const std::vector<int> &newChildren,
+                                  const ShadowTree &tree) {
+  m_oldIndex.clear();
+  for (size_t i = 0; i < oldChildren.size(); ++i) {
+    m_oldIndex[oldChildren[i]] = static_cast<int>(i);
+  }
+
+  // 保留下来的子节点按新顺序排列的旧下标，其最长递增子序列保持不动
+  m_retained.clear();
+  for (int child : newChildren) {
+    auto it = m_oldIndex.find(child);
+    if (it != m_oldIndex.end()) m_retained.push_back(it->second);
+  }
+
+  // O(n log n) 最长递增子序列：m_tails[k] 是长度为 k+1 的子序列末尾在
+  // m_retained 中的位置，m_previous 记录前驱用于回溯
+  m_tails.clear();
+  m_previous.assign(m_retained.size(), -1);
+  for (size_t i = 0; i < m_retained.size(); ++i) {
+    auto pos = std::lower_bound(
+        m_tails.begin(), m_tails.end(), m_retained[i],
+        [this](int position, int value) { return m_retained[position] < value; });
+    if (pos != m_tails.begin()) m_previous[i] = *(pos - 1);
+    if (pos == m_tails.end()) {
+      m_tails.push_back(static_cast<int>(i));
+    } else {
+      *pos = static_cast<int>(i);
+    }
+  }
+  m_keep.assign(oldChildren.size(), 0);
+  for (int i = m_tails.empty() ? -1 : m_tails.back(); i != -1;
+       i = m_previous[i]) {
+    m_keep[m_retained[i]] = 1;
+  }
+
+  // 先从后往前移除，再从前往后插入，每条指令的下标都对应执行时的状态
+  for (int i = static_cast<int>(oldChildren.size()) - 1; i >= 0; --i) {
+    if (m_keep[i]) continue;
+    m_removes.push_back({parentTag, oldChildren[i], i});
+    if (!tree.getNode(oldChildren[i])) {
+      deleteSubtree(oldChildren[i]);
+    }
+  }
+  for (size_t i = 0; i < newChildren.size(); ++i) {
+    int child = newChildren[i];
+    auto it = m_oldIndex.find(child);
+    if (it == m_oldIndex.end() || !m_keep[it->second]) {
+      m_inserts.push_back({parentTag, child, static_cast<int>(i)});
+      m_mounted[child].parentTag = parentTag;
+    }
+  }
+}
+
+void MountingDiffer::deleteSubtree(int tag) {
+  std::vector<int> stack{tag};
+  while (!stack.empty()) {
+    int current = stack.back();
+    stack.pop_back();
+
+    auto it = m_mounted.find(current);
+    if (it == m_mounted.end()) continue;
+
+    stack.insert(stack.end(), it->second.children.begin(),
+                 it->second.children.end());
+    m_deletes.push_back(current);
+    m_mounted.erase(it);
+  }
+}
+
+void MountingDiffer::emitPropsUpdate(int tag, const Props &props,
+                                     MountInstructionBuffer &buffer) {
+  Props &mounted = m_mounted[tag].props;
+  buffer.beginUpdateProps(tag);
+
+  // 两个有序表归并：新增或变化的属性输出新值，删除的属性输出 null
+  auto oldIt = mounted.begin();
+  auto newIt = props.begin();
+  while (oldIt != mounted.end() || newIt != props.end()) {
+    if (newIt == props.end() ||
+        (oldIt != mounted.end() && oldIt->first < newIt->first)) {
+      buffer.addProp(oldIt->first, PropValue());
+      ++oldIt;
+    } else if (oldIt == mounted.end() || newIt->first < oldIt->first) {
+      buffer.addProp(newIt->first, newIt->second);
+      ++newIt;
+    } else {
+      if (oldIt->second != newIt->second) {
+        buffer.addProp(newIt->first, newIt->second);
+      }
+      ++oldIt;
+      ++newIt;
+    }
+  }
+  mounted = props;
+}
+
+}  // namespace ui
+}  // namespace mini_rn
@@ -0,0 +1,93 @@
+#ifndef MOUNTINGDIFFER_H
+#define MOUNTINGDIFFER_H
+
+#include <unordered_map>
+#include <vector>
+
+#include "LayoutEngine.h"
+#include "MountInstruction.h"
+#include "ShadowTree.h"
+#include "ViewMutation.h"
+
+namespace mini_rn {
+namespace ui {
+
+/**
+ * MountingDiffer - shadow tree 与已挂载视图之间的差异计算
+ *
+ * 保存平台侧当前视图状态的快照（属性、子节点、frame），每个批次结束后
+ * 只比较本批次涉及的节点，输出把平台视图更新到新状态所需的最少指令：
+ * - 同一批次内创建又删除的视图不产生指令
+ * - 属性值没有变化的 updateView 不产生指令，多次更新合并为一条
+ * - 子节点调整按最长递增子序列保留不动的子节点，只移动必要的节点
+ * - 删除子树时对每个节点输出 Delete，子树内部不再单独 Remove
+ * - 只输出 frame 真正变化的 UpdateLayout
+ *
+ * 根视图由平台创建，不输出 Create，也不输出它自身的 UpdateLayout。
+ * 与 React Native 一致，tag 在删除后不会被复用。
+ */
+class MountingDiffer {
+ public:
+  MountingDiffer() = default;
+
+  // 禁用拷贝构造和赋值
+  MountingDiffer(const MountingDiffer &) = delete;
+  MountingDiffer &operator=(const MountingDiffer &) = delete;
+
+  /**
+   * 计算本批次的指令（先清空 buffer）
+   * @param mutations 本批次成功应用的变更，用于确定需要比较的节点
+   */
+  void diff(const ShadowTree &tree, const LayoutEngine &layout,
+            const std::vector<ViewMutation> &mutations,
+            MountInstructionBuffer &buffer);
+
+  /**
+   * 已挂载（平台侧存在）的视图数量，包括根视图
+   */
+  size_t getMountedViewCount() const { return m_mounted.size(); }
+
+ private:
+  struct MountedView {
+    int parentTag = kNoTag;
+    Props props;
+    std::vector<int> children;
+    LayoutFrame frame;
+    bool hasFrame = false;
+  };
+
+  struct ChildOperation {
+    int parentTag;
+    int tag;
+    int index;
+  };
+
+  void diffChildren(int parentTag, const std::vector<int> &oldChildren,
+                    const std::vector<int> &newChildren,
+                    const ShadowTree &tree);
+  void deleteSubtree(int tag);
+  void emitPropsUpdate(int tag, const Props &props,
+                       MountInstructionBuffer &buffer);
+
+  std::unordered_map<int, MountedView> m_mounted;
+
+  // 每个批次复用的临时数据
+  std::vector<int> m_touched;
+  std::vector<int> m_creates;
+  std::vector<int> m_updates;
+  std::vector<int> m_deletes;
+  std::vector<int> m_layouts;
+  std::vector<ChildOperation> m_removes;
+  std::vector<ChildOperation> m_inserts;
+  std::vector<int> m_oldChildren;
+  std::unordered_map<int, int> m_oldIndex;
+  std::vector<int> m_retained;  // 保留下来的子节点的旧下标，按新顺序排列
+  std::vector<int> m_tails;
+  std::vector<int> m_previous;
+  std::vector<char> m_keep;
+};
+
+}  // namespace ui
+}  // namespace mini_rn
+
+#endif  // MOUNTINGDIFFER_H
@@ -0,0 +1,79 @@
+#include "MountingLayer.h"
+
+namespace mini_rn {
+namespace ui {
+
+namespace {
+
+std::string formatNumber(float value) {
+  std::string text = std::to_string(value);
+  text.erase(text.find_last_not_of('0') + 1);
+  if (!text.empty() && text.back() == '.') text.pop_back();
+  return text;
+}
+
+std::string describeInstruction(const MountInstructionBuffer &instructions,
+                                const MountInstruction &instruction) {
+  std::string line = getMountInstructionTypeName(instruction.type);
+  line += " " + std::to_string(instruction.tag);
+
+  switch (instruction.type) {
+    case MountInstruction::Type::Create:
+      line += " ";
+      line += instructions.getViewName(instruction);
+      break;
+    case MountInstruction::Type::Insert:
+      line += " into " + std::to_string(instruction.parentTag) + " at " +
+              std::to_string(instruction.index);
+      break;
+    case MountInstruction::Type::Remove:
+      line += " from " + std::to_string(instruction.parentTag) + " at " +
+              std::to_string(instruction.index);
+      break;
+    case MountInstruction::Type::UpdateLayout:
+      line += " " + formatNumber(instruction.frame.x) + "," +
+              formatNumber(instruction.frame.y) + " " +
+              formatNumber(instruction.frame.width) + "x" +
+              formatNumber(instruction.frame.height);
+      break;
+    case MountInstruction::Type::Delete:
+    case MountInstruction::Type::UpdateProps:
+      break;
+  }
+
+  for (uint32_t i = 0; i < instruction.propsCount; ++i) {
+    const MountProp &prop = instructions.getProp(instruction, i);
+    line += " ";
+    line += instructions.getPropName(prop);
+    line += "=";
+    line += instructions.getPropValue(prop).toJSON();
+  }
+  return line;
+}
+
+}  // namespace
+
+void RecordingMountingLayer::commit(const MountInstructionBuffer &instructions) {
+  m_commitCount++;
+  m_instructionCount += instructions.size();
+
+  for (const auto &instruction : instructions) {
+    m_countsByType[static_cast<size_t>(instruction.type)]++;
+    if (m_recordLog) {
+      m_log.push_back(describeInstruction(instructions, instruction));
+    }
+  }
+  if (m_recordLog) {
+    m_log.push_back("commit");
+  }
+}
+
+void RecordingMountingLayer::clear() {
+  m_commitCount = 0;
+  m_instructionCount = 0;
+  m_countsByType.fill(0);
+  m_log.clear();
+}
+
+}  // namespace ui
+}  // namespace mini_rn
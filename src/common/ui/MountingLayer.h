@@ -0,0 +1,87 @@
+#ifndef MOUNTINGLAYER_H
+#define MOUNTINGLAYER_H
+
+#include <array>
+#include <string>
+#include <vector>
+
+#include "MountInstruction.h"
+
+namespace mini_rn {
+namespace ui {
+
+/**
+ * MountingLayer - 把 shadow tree 的变更落到平台视图上的接口
+ *
+ * UIManager 每个 Bridge 批次结束时把本批次的变更应用到 shadow tree、
+ * 计算布局，再由 MountingDiffer 算出最少的挂载指令，调用一次 commit。
+ * 平台侧看到的始终是完整批次之后的状态，不会看到只执行了一半的更新；
+ * 没有任何可见变化的批次不会调用 commit。
+ */
+class MountingLayer {
+ public:
+  virtual ~MountingLayer() = default;
+
+  /**
+   * 提交一个批次
+   * @param instructions 本批次的挂载指令，按顺序执行一遍即可；
+   *                     buffer 只在调用期间有效
+   */
+  virtual void commit(const MountInstructionBuffer &instructions) = 0;
+
+  /**
+   * 释放可以重建的缓存（内存紧张时调用，与 commit 在同一线程），默认没有缓存
+   */
+  virtual void trimMemory() {}
+};
+
+/**
+ * RecordingMountingLayer - 只做记录的 mounting layer
+ *
+ * 不创建任何平台视图，用于无 UI 环境下的测试和视图树吞吐压测：
+ * 统计提交次数和各类指令数量，可选地按文本记录每条指令。
+ */
+class RecordingMountingLayer : public MountingLayer {
+ public:
+  /**
+   * @param recordLog 是否按文本记录每条指令（压测时应关闭）
+   */
+  explicit RecordingMountingLayer(bool recordLog = false)
+      : m_recordLog(recordLog) {}
+
+  void commit(const MountInstructionBuffer &instructions) override;
+
+  size_t getCommitCount() const { return m_commitCount; }
+  size_t getInstructionCount() const { return m_instructionCount; }
+  size_t getInstructionCount(MountInstruction::Type type) const {
+    return m_countsByType[static_cast<size_t>(type)];
+  }
+
+  /**
+   * 平台侧当前存在的视图数（Create 减去 Delete，不含根视图）
+   */
+  size_t getMountedViewCount() const {
+    return getInstructionCount(MountInstruction::Type::Create) -
+           getInstructionCount(MountInstruction::Type::Delete);
+  }
+
+  /**
+   * 文本记录，如 "create 3 RCTView text=\"a\""、"insert 3 into 1 at 0"，
+   * 每个批次以 "commit" 结尾
+   */
+  const std::vector<std::string> &getLog() const { return m_log; }
+
+  void clear();
+
+ private:
+  bool m_recordLog;
+  size_t m_commitCount = 0;
+  size_t m_instructionCount = 0;
+  std::array<size_t, kMountInstructionTypeCount> m_countsByType{};
+  std::vector<std::string> m_log;
+};
+
+}  // namespace ui
+}  // namespace mini_rn
+
+#endif  // MOUNTINGLAYER_H
@@ -0,0 +1,182 @@
+#include "Props.h"
+
+#include <algorithm>
+#include <cstdlib>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <unordered_map>
+
+#include "../utils/JSONParser.h"
+
+namespace mini_rn {
+namespace ui {
+
+namespace {
+
+struct NameTable {
+  std::mutex mutex;
+  std::deque<std::string> names;  // deque 追加时已有元素地址不变
+  std::unordered_map<std::string_view, PropId> ids;  // 键指向 names 中的字符串
+};
+
+NameTable &nameTable() {
+  static NameTable table;
+  return table;
+}
+
+bool lessById(const Props::Entry &entry, PropId id) { return entry.first < id; }
+
+}  // namespace
+
+PropId PropNames::intern(std::string_view name) {
+  NameTable &table = nameTable();
+  std::lock_guard<std::mutex> lock(table.mutex);
+
+  auto it = table.ids.find(name);
+  if (it != table.ids.end()) return it->second;
+
+  PropId id = static_cast<PropId>(table.names.size());
+  table.names.emplace_back(name);
+  table.ids.emplace(table.names.back(), id);
+  return id;
+}
+
+const std::string &PropNames::getName(PropId id) {
+  NameTable &table = nameTable();
+  std::lock_guard<std::mutex> lock(table.mutex);
+  return table.names[id];
+}
+
+size_t PropNames::size() {
+  NameTable &table = nameTable();
+  std::lock_guard<std::mutex> lock(table.mutex);
+  return table.names.size();
+}
+
+PropValue PropValue::fromJSON(const std::string &json) {
+  if (json == "null") return PropValue();
+  if (json == "true") return PropValue(true);
+  if (json == "false") return PropValue(false);
+
+  PropValue value;
+  if (!json.empty() && json[0] == '"' &&
+      utils::unquoteJSONString(json, value.m_text)) {
+    value.m_type = Type::String;
+    return value;
+  }
+
+  if (!json.empty() && json[0] != '{' && json[0] != '[') {
+    char *end = nullptr;
+    double number = std::strtod(json.c_str(), &end);
+    if (end != json.c_str() && *end == '\0') return PropValue(number);
+  }
+
+  value.m_type = Type::Json;
+  value.m_text = json;
+  return value;
+}
+
+PropValue PropValue::fromJSON(const utils::JSONValue &json) {
+  switch (json.getType()) {
+    case utils::JSONValue::Type::Null:
+      return PropValue();
+    case utils::JSONValue::Type::Bool:
+      return PropValue(json.asBool());
+    case utils::JSONValue::Type::Number:
+      return PropValue(json.asNumber());
+    case utils::JSONValue::Type::String:
+      return PropValue(std::string(json.asString()));
+    case utils::JSONValue::Type::Array:
+    case utils::JSONValue::Type::Object:
+    case utils::JSONValue::Type::ArrayBuffer:  // JSON 文本中不会出现
+      break;
+  }
+
+  PropValue value;
+  value.m_type = Type::Json;
+  value.m_text = std::string(json.raw());
+  return value;
+}
+
+std::string PropValue::toJSON() const {
+  switch (m_type) {
+    case Type::Null:
+      return "null";
+    case Type::Bool:
+      return asBool() ? "true" : "false";
+    case Type::Number:
+      return utils::formatJSONNumber(m_number);
+    case Type::String:
+      return utils::quoteJSONString(m_text);
+    case Type::Json:
+      return m_text;
+  }
+  return "null";
+}
+
+size_t PropValue::hash() const {
+  size_t hash = static_cast<size_t>(m_type);
+  hash = hash * 31 + std::hash<double>()(m_number);
+  hash = hash * 31 + std::hash<std::string>()(m_text);
+  return hash;
+}
+
+Props::Props(
+    std::initializer_list<std::pair<std::string_view, PropValue>> props) {
+  m_entries.reserve(props.size());
+  for (const auto &prop : props) {
+    set(PropNames::intern(prop.first), prop.second);
+  }
+}
+
+const PropValue *Props::get(PropId id) const {
+  auto it = std::lower_bound(m_entries.begin(), m_entries.end(), id, lessById);
+  return it != m_entries.end() && it->first == id ? &it->second : nullptr;
+}
+
+void Props::set(PropId id, PropValue value) {
+  auto it = lowerBound(id);
+  if (it != m_entries.end() && it->first == id) {
+    it->second = std::move(value);
+  } else {
+    m_entries.emplace(it, id, std::move(value));
+  }
+}
+
+bool Props::erase(PropId id) {
+  auto it = lowerBound(id);
+  if (it == m_entries.end() || it->first != id) return false;
+  m_entries.erase(it);
+  return true;
+}
+
+void Props::merge(const Props &update) {
+  for (const auto &entry : update) {
+    set(entry.first, entry.second);
+  }
+}
+
+void Props::apply(const Props &update) {
+  for (const auto &entry : update) {
+    if (entry.second.isNull()) {
+      erase(entry.first);
+    } else {
+      set(entry.first, entry.second);
+    }
+  }
+}
+
+void Props::eraseNulls() {
+  m_entries.erase(
+      std::remove_if(m_entries.begin(), m_entries.end(),
+                     [](const Entry &entry) { return entry.second.isNull(); }),
+      m_entries.end());
+}
+
+std::vector<Props::Entry>::iterator Props::lowerBound(PropId id) {
+  return std::lower_bound(m_entries.begin(), m_entries.end(), id, lessById);
+}
+
+}  // namespace ui
+}  // namespace mini_rn
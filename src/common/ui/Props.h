@@ -0,0 +1,175 @@
+#ifndef PROPS_H
+#define PROPS_H
+
+#include <cstdint>
+#include <initializer_list>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "../utils/JSONDocument.h"
+
+namespace mini_rn {
+namespace ui {
+
+/**
+ * 驻留后的属性名 ID
+ */
+using PropId = uint32_t;
+
+/**
+ * PropNames - 进程级属性名驻留表
+ *
+ * 视图属性名的集合很小且固定（width、backgroundColor……），每个名称只保存
+ * 一份，之后用整数 ID 比较和查找。ID 按首次出现的顺序分配，进程内不会变化；
+ * 名称字符串的地址也保持不变。线程安全。
+ */
+class PropNames {
+ public:
+  /**
+   * 返回名称对应的 ID，第一次出现时分配新 ID
+   */
+  static PropId intern(std::string_view name);
+
+  /**
+   * ID 对应的名称（ID 必须来自 intern）
+   */
+  static const std::string &getName(PropId id);
+
+  /**
+   * 已驻留的名称数量
+   */
+  static size_t size();
+};
+
+/**
+ * PropValue - 带类型标签的属性值
+ *
+ * 在 JSON 解析时确定类型，之后布局、比较和挂载都不再解析文本：
+ * - Null：用于 updateView 中表示“删除该属性”
+ * - Bool / Number：数值直接保存
+ * - String：保存反转义后的内容（颜色、关键字等短字符串不额外分配内存）
+ * - Json：对象和数组（如 transform、shadowOffset）保留原始 JSON 文本
+ */
+class PropValue {
+ public:
+  enum class Type : uint8_t { Null, Bool, Number, String, Json };
+
+  PropValue() = default;
+  PropValue(bool value) : m_type(Type::Bool), m_number(value ? 1 : 0) {}
+  PropValue(int value) : m_type(Type::Number), m_number(value) {}
+  PropValue(double value) : m_type(Type::Number), m_number(value) {}
+  PropValue(const char *value) : m_type(Type::String), m_text(value) {}
+  PropValue(std::string value)
+      : m_type(Type::String), m_text(std::move(value)) {}
+
+  /**
+   * 从一个 JSON 值的原始文本解析，无法识别的文本按 Json 类型原样保存
+   */
+  static PropValue fromJSON(const std::string &json);
+
+  /**
+   * 从已解析的 JSON 值构造，对象和数组按 Json 类型保存原始文本
+   */
+  static PropValue fromJSON(const utils::JSONValue &json);
+
+  Type getType() const { return m_type; }
+  bool isNull() const { return m_type == Type::Null; }
+  bool isNumber() const { return m_type == Type::Number; }
+  bool isString() const { return m_type == Type::String; }
+
+  bool asBool() const { return m_number != 0; }
+  double asNumber() const { return m_number; }
+
+  /**
+   * String 类型为字符串内容，Json 类型为原始 JSON 文本，其余为空
+   */
+  const std::string &asString() const { return m_text; }
+
+  /**
+   * 序列化为 JSON 文本
+   */
+  std::string toJSON() const;
+
+  size_t hash() const;
+
+  bool operator==(const PropValue &other) const {
+    return m_type == other.m_type && m_number == other.m_number &&
+           m_text == other.m_text;
+  }
+  bool operator!=(const PropValue &other) const { return !(*this == other); }
+
+ private:
+  Type m_type = Type::Null;
+  double m_number = 0;
+  std::string m_text;
+};
+
+/**
+ * Props - 一个视图的属性集合
+ *
+ * 按 PropId 排序的连续数组：视图属性通常只有几个到十几个，比 std::map
+ * 少了逐节点分配，二分查找和有序归并（比较、合并）都很快。
+ */
+class Props {
+ public:
+  using Entry = std::pair<PropId, PropValue>;
+  using const_iterator = std::vector<Entry>::const_iterator;
+
+  Props() = default;
+
+  /**
+   * 按名称构造，如 Props{{"flex", 1}, {"color", "red"}}
+   */
+  Props(std::initializer_list<std::pair<std::string_view, PropValue>> props);
+
+  const PropValue *get(PropId id) const;
+  const PropValue *get(std::string_view name) const {
+    return get(PropNames::intern(name));
+  }
+
+  /**
+   * 设置属性（已存在时覆盖）
+   */
+  void set(PropId id, PropValue value);
+  bool erase(PropId id);
+
+  /**
+   * 合并另一次更新：同名属性以后者为准，null 也保留
+   * （用于把同一批次内对同一视图的多次 updateView 合并为一次）
+   */
+  void merge(const Props &update);
+
+  /**
+   * 应用一次更新：值为 null 的属性被删除，其余覆盖
+   */
+  void apply(const Props &update);
+
+  /**
+   * 删除所有值为 null 的属性
+   */
+  void eraseNulls();
+
+  size_t size() const { return m_entries.size(); }
+  bool empty() const { return m_entries.empty(); }
+  void clear() { m_entries.clear(); }
+  void reserve(size_t size) { m_entries.reserve(size); }
+  const_iterator begin() const { return m_entries.begin(); }
+  const_iterator end() const { return m_entries.end(); }
+
+  bool operator==(const Props &other) const {
+    return m_entries == other.m_entries;
+  }
+  bool operator!=(const Props &other) const { return !(*this == other); }
+
+ private:
+  std::vector<Entry>::iterator lowerBound(PropId id);
+
+  std::vector<Entry> m_entries;  // 按 PropId 升序
+};
+
+}  // namespace ui
+}  // namespace mini_rn
+
+#endif  // PROPS_H
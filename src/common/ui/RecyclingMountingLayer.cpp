@@ -0,0 +1,164 @@
+#include "RecyclingMountingLayer.h"
+
+#include <iostream>
+#include <utility>
+
+namespace mini_rn {
+namespace ui {
+
+RecyclingMountingLayer::RecyclingMountingLayer(
+    std::shared_ptr<ViewFactory> factory)
+    : m_factory(std::move(factory)) {}
+
+RecyclingMountingLayer::~RecyclingMountingLayer() {
+  // 根视图由平台持有，其余视图都由本层创建
+  for (auto &entry : m_views) {
+    MountedView &mounted = entry.second;
+    if (mounted.pool) {
+      m_factory->destroyView(mounted.pool->viewName, mounted.view);
+    }
+  }
+  trimPools();
+}
+
+void RecyclingMountingLayer::commit(const MountInstructionBuffer &instructions) {
+  for (const auto &instruction : instructions) {
+    switch (instruction.type) {
+      case MountInstruction::Type::Create:
+        mountView(instruction.tag, instructions.getViewName(instruction));
+        if (instruction.propsCount > 0) {
+          m_factory->updateProps(m_views[instruction.tag].view, instructions,
+                                 instruction);
+        }
+        break;
+      case MountInstruction::Type::Delete:
+        unmountView(instruction.tag);
+        break;
+      case MountInstruction::Type::Insert:
+      case MountInstruction::Type::Remove: {
+        MountedView *parent = findView(instruction.parentTag);
+        MountedView *child = findView(instruction.tag);
+        if (!parent || !child) break;
+        if (instruction.type == MountInstruction::Type::Insert) {
+          m_factory->insertChild(parent->view, child->view, instruction.index);
+        } else {
+          m_factory->removeChild(parent->view, child->view, instruction.index);
+        }
+        break;
+      }
+      case MountInstruction::Type::UpdateProps:
+        if (MountedView *mounted = findView(instruction.tag)) {
+          m_factory->updateProps(mounted->view, instructions, instruction);
+        }
+        break;
+      case MountInstruction::Type::UpdateLayout:
+        if (MountedView *mounted = findView(instruction.tag)) {
+          m_factory->updateLayout(mounted->view, instruction.frame);
+        }
+        break;
+    }
+  }
+}
+
+void RecyclingMountingLayer::registerRootView(int rootTag, ViewHandle view) {
+  m_views[rootTag] = MountedView{view, nullptr};
+}
+
+void RecyclingMountingLayer::setPoolCapacity(const std::string &viewName,
+                                             size_t capacity) {
+  ViewPool &pool = getPool(viewName);
+  pool.capacity = capacity;
+  trimPool(pool, capacity);
+}
+
+void RecyclingMountingLayer::trimPools() {
+  for (auto &entry : m_pools) {
+    trimPool(entry.second, 0);
+  }
+}
+
+size_t RecyclingMountingLayer::getPooledViewCount(
+    const std::string &viewName) const {
+  auto it = m_pools.find(viewName);
+  return it == m_pools.end() ? 0 : it->second.views.size();
+}
+
+size_t RecyclingMountingLayer::getPooledViewCount() const {
+  size_t count = 0;
+  for (const auto &entry : m_pools) {
+    count += entry.second.views.size();
+  }
+  return count;
+}
+
+ViewHandle RecyclingMountingLayer::getView(int tag) const {
+  auto it = m_views.find(tag);
+  return it == m_views.end() ? nullptr : it->second.view;
+}
+
+RecyclingMountingLayer::ViewPool &RecyclingMountingLayer::getPool(
+    std::string_view viewName) {
+  // 视图类型名很短，构造 std::string 不会分配内存
+  std::string key(viewName);
+  auto it = m_pools.find(key);
+  if (it == m_pools.end()) {
+    it = m_pools.emplace(key, ViewPool()).first;
+    it->second.viewName = std::move(key);
+    it->second.capacity = m_defaultPoolCapacity;
+  }
+  return it->second;
+}
+
+RecyclingMountingLayer::MountedView *RecyclingMountingLayer::findView(
+    int tag) {
+  auto it = m_views.find(tag);
+  if (it == m_views.end()) {
+    std::cout << "[RecyclingMountingLayer] Error: Unknown view tag " << tag
+              << std::endl;
+    return nullptr;
+  }
+  return &it->second;
+}
+
+void RecyclingMountingLayer::mountView(int tag, std::string_view viewName) {
+  ViewPool &pool = getPool(viewName);
+  ViewHandle view;
+  if (!pool.views.empty()) {
+    view = pool.views.back();
+    pool.views.pop_back();
+    m_stats.hits++;
+  } else {
+    view = m_factory->createView(pool.viewName);
+    m_stats.misses++;
+  }
+  m_views[tag] = MountedView{view, &pool};
+}
+
+void RecyclingMountingLayer::unmountView(int tag) {
+  auto it = m_views.find(tag);
+  if (it == m_views.end() || !it->second.pool) return;
+
+  ViewPool &pool = *it->second.pool;
+  ViewHandle view = it->second.view;
+  m_views.erase(it);
+
+  if (pool.views.size() < pool.capacity) {
+    m_factory->resetView(pool.viewName, view);
+    pool.views.push_back(view);
+    m_stats.recycled++;
+  } else {
+    m_factory->destroyView(pool.viewName, view);
+    m_stats.destroyed++;
+  }
+}
+
+void RecyclingMountingLayer::trimPool(ViewPool &pool, size_t capacity) {
+  while (pool.views.size() > capacity) {
+    m_factory->destroyView(pool.viewName, pool.views.back());
+    pool.views.pop_back();
+    m_stats.destroyed++;
+  }
+}
+
+}  // namespace ui
+}  // namespace mini_rn
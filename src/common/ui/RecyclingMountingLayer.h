@@ -0,0 +1,142 @@
+#ifndef RECYCLINGMOUNTINGLAYER_H
+#define RECYCLINGMOUNTINGLAYER_H
+
+#include <memory>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+#include "MountingLayer.h"
+
+namespace mini_rn {
+namespace ui {
+
+/**
+ * 平台视图句柄（如 NSView *），只由 ViewFactory 解释
+ */
+using ViewHandle = void *;
+
+/**
+ * ViewFactory - 平台视图的创建和操作
+ *
+ * 由各平台实现（macOS 上创建 NSView），RecyclingMountingLayer 只负责
+ * 按挂载指令调用，不关心视图的具体类型。所有方法都在挂载线程调用。
+ */
+class ViewFactory {
+ public:
+  virtual ~ViewFactory() = default;
+
+  virtual ViewHandle createView(const std::string &viewName) = 0;
+  virtual void destroyView(const std::string &viewName, ViewHandle view) = 0;
+
+  /**
+   * 把视图恢复到刚创建时的状态，供回收复用：
+   * 清空属性和 frame，移出父视图，移除所有子视图
+   */
+  virtual void resetView(const std::string &viewName, ViewHandle view) = 0;
+
+  /**
+   * 应用 Create / UpdateProps 指令携带的属性（值为 null 表示恢复默认值）
+   */
+  virtual void updateProps(ViewHandle view,
+                           const MountInstructionBuffer &instructions,
+                           const MountInstruction &instruction) = 0;
+  virtual void insertChild(ViewHandle parent, ViewHandle child, int index) = 0;
+  virtual void removeChild(ViewHandle parent, ViewHandle child, int index) = 0;
+  virtual void updateLayout(ViewHandle view, const LayoutFrame &frame) = 0;
+};
+
+/**
+ * RecyclingMountingLayer - 带视图回收池的 mounting layer
+ *
+ * 列表滚动时不断有行被删除、新行被创建，而它们的视图类型相同。
+ * 被删除的视图重置后放入按视图类型划分的回收池，之后的 Create 优先从池中
+ * 取出复用，省去平台视图的销毁和重新创建。挂载指令中 Delete 排在 Create
+ * 之前，同一批次内移出可视区的行可以直接被新行复用。
+ *
+ * 每种视图类型的池有容量上限（默认 kDefaultPoolCapacity，0 表示不回收），
+ * 超出上限的视图直接销毁。trimPools() 销毁所有池中的视图（内存紧张时调用）。
+ */
+class RecyclingMountingLayer : public MountingLayer {
+ public:
+  static constexpr size_t kDefaultPoolCapacity = 64;
+
+  /**
+   * 回收统计
+   */
+  struct Stats {
+    size_t hits = 0;       // 从池中复用的视图数
+    size_t misses = 0;     // 池为空而新建的视图数
+    size_t recycled = 0;   // 删除后放回池中的视图数
+    size_t destroyed = 0;  // 池已满或被清空而销毁的视图数
+  };
+
+  explicit RecyclingMountingLayer(std::shared_ptr<ViewFactory> factory);
+  ~RecyclingMountingLayer() override;
+
+  // 禁用拷贝构造和赋值
+  RecyclingMountingLayer(const RecyclingMountingLayer &) = delete;
+  RecyclingMountingLayer &operator=(const RecyclingMountingLayer &) = delete;
+
+  void commit(const MountInstructionBuffer &instructions) override;
+  void trimMemory() override { trimPools(); }
+
+  /**
+   * 注册平台创建的根视图，之后的 Insert 可以把子视图挂到它上面
+   */
+  void registerRootView(int rootTag, ViewHandle view);
+
+  /**
+   * 设置未单独配置的视图类型的池容量（只影响之后创建的池）
+   */
+  void setDefaultPoolCapacity(size_t capacity) {
+    m_defaultPoolCapacity = capacity;
+  }
+
+  /**
+   * 设置某种视图类型的池容量，池中超出部分立即销毁
+   */
+  void setPoolCapacity(const std::string &viewName, size_t capacity);
+
+  /**
+   * 销毁所有池中的视图
+   */
+  void trimPools();
+
+  size_t getPooledViewCount(const std::string &viewName) const;
+  size_t getPooledViewCount() const;
+  size_t getMountedViewCount() const { return m_views.size(); }
+  ViewHandle getView(int tag) const;
+  const Stats &getStats() const { return m_stats; }
+
+ private:
+  struct ViewPool {
+    std::string viewName;
+    size_t capacity = 0;
+    std::vector<ViewHandle> views;
+  };
+
+  struct MountedView {
+    ViewHandle view = nullptr;
+    ViewPool *pool = nullptr;  // 根视图为空（不由本层创建和回收）
+  };
+
+  ViewPool &getPool(std::string_view viewName);
+  MountedView *findView(int tag);
+  void mountView(int tag, std::string_view viewName);
+  void unmountView(int tag);
+  void trimPool(ViewPool &pool, size_t capacity);
+
+  std::shared_ptr<ViewFactory> m_factory;
+  size_t m_defaultPoolCapacity = kDefaultPoolCapacity;
+  // unordered_map 的元素地址在插入后保持不变，MountedView 可以直接指向池
+  std::unordered_map<std::string, ViewPool> m_pools;
+  std::unordered_map<int, MountedView> m_views;
+  Stats m_stats;
+};
+
+}  // namespace ui
+}  // namespace mini_rn
+
+#endif  // RECYCLINGMOUNTINGLAYER_H
@@ -0,0 +1,319 @@
+#include "ShadowTree.h"
+
+#include <algorithm>
+#include <iostream>
+#include <utility>
+
+namespace mini_rn {
+namespace ui {
+
+namespace {
+
+bool reportError(const std::string &message) {
+  std::cout << "[ShadowTree] Error: " << message << std::endl;
+  return false;
+}
+
+}  // namespace
+
+bool ShadowTree::addRootView(int rootTag) {
+  if (rootTag == kNoTag || findNode(rootTag)) {
+    return reportError("Invalid or duplicate root tag " +
+                       std::to_string(rootTag));
+  }
+
+  ShadowNode &root = allocateNode(rootTag);
+  root.rootTag = rootTag;
+  root.viewName = "RootView";
+  m_rootTags.push_back(rootTag);
+  invalidateLayout(rootTag);
+  return true;
+}
+
+bool ShadowTree::createView(int tag, const std::string &viewName, int rootTag,
+                            Props props) {
+  if (tag == kNoTag || findNode(tag)) {
+    return reportError("createView: invalid or duplicate tag " +
+                       std::to_string(tag));
+  }
+  if (!findNode(rootTag)) {
+    return reportError("createView: unknown root tag " +
+                       std::to_string(rootTag));
+  }
+
+  ShadowNode &node = allocateNode(tag);
+  node.rootTag = rootTag;
+  node.viewName = viewName;
+  node.props = std::move(props);
+  node.props.eraseNulls();
+  invalidateLayout(tag);
+  return true;
+}
+
+bool ShadowTree::updateView(int tag, const Props &props) {
+  ShadowNode *node = findNode(tag);
+  if (!node) {
+    return reportError("updateView: unknown tag " + std::to_string(tag));
+  }
+
+  node->props.apply(props);
+  invalidateLayout(tag, true);
+  return true;
+}
+
+bool ShadowTree::setChildren(int tag, const std::vector<int> &childTags) {
+  ShadowNode *parent = findNode(tag);
+  if (!parent) {
+    return reportError("setChildren: unknown tag " + std::to_string(tag));
+  }
+  if (!parent->children.empty()) {
+    return reportError("setChildren: view " + std::to_string(tag) +
+                       " already has children, use manageChildren");
+  }
+
+  // 校验：子节点存在、没有父节点、不重复、不是自身的祖先
+  for (size_t i = 0; i < childTags.size(); ++i) {
+    const ShadowNode *child = findNode(childTags[i]);
+    if (!child || child->parentTag != kNoTag || child->tag == child->rootTag) {
+      return reportError("setChildren: child " + std::to_string(childTags[i]) +
+                         " is unknown, a root or already attached");
+    }
+    if (std::find(childTags.begin(), childTags.begin() + i, childTags[i]) !=
+        childTags.begin() + i) {
+      return reportError("setChildren: duplicate child " +
+                         std::to_string(childTags[i]));
+    }
+  }
+  for (int ancestor = tag; ancestor != kNoTag;
+       ancestor = findNode(ancestor)->parentTag) {
+    if (std::find(childTags.begin(), childTags.end(), ancestor) !=
+        childTags.end()) {
+      return reportError("setChildren: adding " + std::to_string(ancestor) +
+                         " would create a cycle");
+    }
+  }
+
+  parent->children = childTags;
+  for (int childTag : childTags) {
+    findNode(childTag)->parentTag = tag;
+  }
+  invalidateLayout(tag);
+  return true;
+}
+
+bool ShadowTree::manageChildren(int tag,
+                                const std::vector<int> &moveFromIndices,
+                                const std::vector<int> &moveToIndices,
+                                const std::vector<int> &addChildTags,
+                                const std::vector<int> &addAtIndices,
+                                const std::vector<int> &removeAtIndices) {
+  ShadowNode *parent = findNode(tag);
+  if (!parent) {
+    return reportError("manageChildren: unknown tag " + std::to_string(tag));
+  }
+  if (moveFromIndices.size() != moveToIndices.size() ||
+      addChildTags.size() != addAtIndices.size()) {
+    return reportError("manageChildren: mismatched index arrays for view " +
+                       std::to_string(tag));
+  }
+
+  // 校验待移除的下标：在范围内且不重复
+  const size_t childCount = parent->children.size();
+  std::vector<bool> removed(childCount, false);
+  for (const std::vector<int> *indices : {&moveFromIndices, &removeAtIndices}) {
+    for (int index : *indices) {
+      if (index < 0 || static_cast<size_t>(index) >= childCount ||
+          removed[index]) {
+        return reportError("manageChildren: invalid index " +
+                           std::to_string(index) + " for view " +
+                           std::to_string(tag));
+      }
+      removed[index] = true;
+    }
+  }
+
+  // 校验新增的子节点：存在、没有父节点、不是自身的祖先
+  for (size_t i = 0; i < addChildTags.size(); ++i) {
+    const ShadowNode *child = findNode(addChildTags[i]);
+    if (!child || child->parentTag != kNoTag || child->tag == child->rootTag ||
+        std::find(addChildTags.begin(), addChildTags.begin() + i,
+                  addChildTags[i]) != addChildTags.begin() + i) {
+      return reportError("manageChildren: child " +
+                         std::to_string(addChildTags[i]) +
+                         " is unknown, a root or already attached");
+    }
+  }
+  for (int ancestor = tag; ancestor != kNoTag;
+       ancestor = findNode(ancestor)->parentTag) {
+    if (std::find(addChildTags.begin(), addChildTags.end(), ancestor) !=
+        addChildTags.end()) {
+      return reportError("manageChildren: adding " + std::to_string(ancestor) +
+                         " would create a cycle");
+    }
+  }
+
+  // 校验插入位置：落在最终子节点范围内且不重复
+  std::vector<std::pair<int, int>> inserts;  // (下标, tag)
+  inserts.reserve(moveToIndices.size() + addAtIndices.size());
+  for (size_t i = 0; i < moveToIndices.size(); ++i) {
+    inserts.emplace_back(moveToIndices[i],
+                         parent->children[moveFromIndices[i]]);
+  }
+  for (size_t i = 0; i < addAtIndices.size(); ++i) {
+    inserts.emplace_back(addAtIndices[i], addChildTags[i]);
+  }
+  std::sort(inserts.begin(), inserts.end());
+
+  const size_t finalCount =
+      childCount - moveFromIndices.size() - removeAtIndices.size() +
+      inserts.size();
+  for (size_t i = 0; i < inserts.size(); ++i) {
+    int index = inserts[i].first;
+    if (index < 0 || static_cast<size_t>(index) >= finalCount ||
+        (i > 0 && inserts[i - 1].first == index)) {
+      return reportError("manageChildren: invalid target index " +
+                         std::to_string(index) + " for view " +
+                         std::to_string(tag));
+    }
+  }
+
+  // 校验通过，开始修改
+  std::vector<int> removedTags;
+  removedTags.reserve(removeAtIndices.size());
+  for (int index : removeAtIndices) {
+    removedTags.push_back(parent->children[index]);
+  }
+
+  std::vector<int> children;
+  children.reserve(finalCount);
+  for (size_t i = 0; i < childCount; ++i) {
+    if (!removed[i]) children.push_back(parent->children[i]);
+  }
+  for (const auto &insert : inserts) {
+    children.insert(children.begin() + insert.first, insert.second);
+  }
+  parent->children = std::move(children);
+
+  for (int childTag : addChildTags) {
+    findNode(childTag)->parentTag = tag;
+  }
+  for (int childTag : removedTags) {
+    findNode(childTag)->parentTag = kNoTag;
+    deleteSubtree(childTag);
+  }
+  invalidateLayout(tag);
+  return true;
+}
+
+bool ShadowTree::removeView(int tag) {
+  ShadowNode *node = findNode(tag);
+  if (!node) {
+    return reportError("removeView: unknown tag " + std::to_string(tag));
+  }
+
+  if (node->parentTag != kNoTag) {
+    invalidateLayout(node->parentTag);
+  }
+  detachFromParent(*node);
+  deleteSubtree(tag);
+  return true;
+}
+
+bool ShadowTree::apply(const ViewMutation &mutation) {
+  switch (mutation.type) {
+    case ViewMutation::Type::CreateView:
+      return createView(mutation.tag, mutation.viewName, mutation.rootTag,
+                        mutation.props);
+    case ViewMutation::Type::UpdateView:
+      return updateView(mutation.tag, mutation.props);
+    case ViewMutation::Type::SetChildren:
+      return setChildren(mutation.tag, mutation.childTags);
+    case ViewMutation::Type::ManageChildren:
+      return manageChildren(mutation.tag, mutation.moveFromIndices,
+                            mutation.moveToIndices, mutation.childTags,
+                            mutation.addAtIndices, mutation.removeAtIndices);
+    case ViewMutation::Type::RemoveView:
+      return removeView(mutation.tag);
+  }
+  return false;
+}
+
+const ShadowNode *ShadowTree::getNode(int tag) const {
+  uint32_t index = indexOf(tag);
+  return index == kInvalidIndex ? nullptr : &m_nodes[index];
+}
+
+uint32_t ShadowTree::indexOf(int tag) const {
+  auto it = m_indexByTag.find(tag);
+  return it == m_indexByTag.end() ? kInvalidIndex : it->second;
+}
+
+void ShadowTree::takeLayoutInvalidations(
+    std::vector<LayoutInvalidation> &invalidations) {
+  invalidations.clear();
+  invalidations.swap(m_layoutInvalidations);
+}
+
+ShadowNode *ShadowTree::findNode(int tag) {
+  uint32_t index = indexOf(tag);
+  return index == kInvalidIndex ? nullptr : &m_nodes[index];
+}
+
+ShadowNode &ShadowTree::allocateNode(int tag) {
+  uint32_t index;
+  if (!m_freeSlots.empty()) {
+    index = m_freeSlots.back();
+    m_freeSlots.pop_back();
+  } else {
+    index = static_cast<uint32_t>(m_nodes.size());
+    m_nodes.emplace_back();
+  }
+
+  m_indexByTag[tag] = index;
+  ShadowNode &node = m_nodes[index];
+  node.tag = tag;
+  return node;
+}
+
+void ShadowTree::detachFromParent(ShadowNode &node) {
+  if (node.parentTag == kNoTag) return;
+
+  ShadowNode *parent = findNode(node.parentTag);
+  if (parent) {
+    auto &siblings = parent->children;
+    siblings.erase(std::remove(siblings.begin(), siblings.end(), node.tag),
+                   siblings.end());
+  }
+  node.parentTag = kNoTag;
+}
+
+void ShadowTree::deleteSubtree(int tag) {
+  std::vector<int> stack{tag};
+  while (!stack.empty()) {
+    int current = stack.back();
+    stack.pop_back();
+
+    auto it = m_indexByTag.find(current);
+    if (it == m_indexByTag.end()) continue;
+
+    uint32_t index = it->second;
+    ShadowNode &node = m_nodes[index];
+    stack.insert(stack.end(), node.children.begin(), node.children.end());
+    if (node.tag == node.rootTag) {
+      m_rootTags.erase(
+          std::remove(m_rootTags.begin(), m_rootTags.end(), node.tag),
+          m_rootTags.end());
+    }
+
+    node = ShadowNode();
+    m_indexByTag.erase(it);
+    m_freeSlots.push_back(index);
+  }
+}
+
+void ShadowTree::invalidateLayout(int tag, bool propsOnly) {
+  m_layoutInvalidations.push_back({tag, propsOnly});
+}
+
+}  // namespace ui
+}  // namespace mini_rn
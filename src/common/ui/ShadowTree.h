@@ -0,0 +1,158 @@
+#ifndef SHADOWTREE_H
+#define SHADOWTREE_H
+
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "ViewMutation.h"
+
+namespace mini_rn {
+namespace ui {
+
+/**
+ * ShadowNode - shadow tree 中的一个视图节点
+ * 父子关系用 tag 表示，节点在存储中移动或槽位复用时不会失效
+ */
+struct ShadowNode {
+  int tag = kNoTag;
+  int rootTag = kNoTag;
+  int parentTag = kNoTag;
+  std::string viewName;
+  Props props;
+  std::vector<int> children;  // 子节点 tag，按显示顺序排列
+};
+
+/**
+ * 可能影响布局的一次变更，由布局引擎消费（见 ShadowTree::takeLayoutInvalidations）
+ * propsOnly 为 true 时只有属性变化，由布局引擎判断布局样式是否真的改变
+ */
+struct LayoutInvalidation {
+  int tag = kNoTag;
+  bool propsOnly = false;
+};
+
+/**
+ * ShadowTree - 与平台无关的 C++ 视图树
+ *
+ * 对应 React Native 的 ShadowView 树，只保存视图结构和属性，不创建任何
+ * 平台视图，因此可以在没有 UI 的环境（服务器、CI）中运行和压测。
+ *
+ * 存储方式：
+ * - 所有节点连续存放在一个数组中，tag → 下标通过哈希表查找
+ * - 删除的节点槽位进入空闲栈，由后续创建的节点复用，数组不会出现空洞堆积
+ * - 子树删除使用显式栈，深度很大的树也不会递归溢出
+ *
+ * 所有修改方法都先校验再修改：校验失败时返回 false 并输出错误日志，
+ * 树保持不变，不会出现只执行了一半的变更。
+ *
+ * 每次成功的修改都会记录受影响的节点（新建、属性更新、子节点变化的容器、
+ * 被删除节点的父节点），供布局引擎只重新布局变化的子树。
+ */
+class ShadowTree {
+ public:
+  ShadowTree() = default;
+
+  // 禁用拷贝构造和赋值
+  ShadowTree(const ShadowTree &) = delete;
+  ShadowTree &operator=(const ShadowTree &) = delete;
+
+  /**
+   * 注册根视图（对应 UIManager.addRootView，由 Native 侧调用）
+   */
+  bool addRootView(int rootTag);
+
+  /**
+   * 创建视图，值为 null 的属性不保存
+   */
+  bool createView(int tag, const std::string &viewName, int rootTag,
+                  Props props);
+
+  /**
+   * 合并属性：值为 null 的属性被删除，其余覆盖
+   */
+  bool updateView(int tag, const Props &props);
+
+  /**
+   * 设置初始子节点（要求节点当前没有子节点，子节点没有父节点）
+   */
+  bool setChildren(int tag, const std::vector<int> &childTags);
+
+  /**
+   * 调整子节点，语义与 React Native UIManager.manageChildren 一致：
+   * 先移除 moveFromIndices 和 removeAtIndices 处的子节点，再按下标从小到大
+   * 插入移动的节点和新增的节点；removeAtIndices 处的子节点连同子树删除
+   */
+  bool manageChildren(int tag, const std::vector<int> &moveFromIndices,
+                      const std::vector<int> &moveToIndices,
+                      const std::vector<int> &addChildTags,
+                      const std::vector<int> &addAtIndices,
+                      const std::vector<int> &removeAtIndices);
+
+  /**
+   * 从父节点上摘下并删除整个子树
+   */
+  bool removeView(int tag);
+
+  /**
+   * 按变更类型分发到上面的方法
+   */
+  bool apply(const ViewMutation &mutation);
+
+  /**
+   * 按 tag 查找节点，不存在时返回 nullptr
+   */
+  const ShadowNode *getNode(int tag) const;
+
+  /**
+   * 按存储下标访问节点（下标来自 indexOf，必须有效）
+   */
+  const ShadowNode &getNodeAt(uint32_t index) const { return m_nodes[index]; }
+
+  /**
+   * 节点在连续存储中的下标，不存在时返回 kInvalidIndex
+   * 供按下标维护平行数据的组件（如布局引擎）使用
+   */
+  static constexpr uint32_t kInvalidIndex = UINT32_MAX;
+  uint32_t indexOf(int tag) const;
+
+  size_t getNodeCount() const { return m_indexByTag.size(); }
+
+  /**
+   * 存储槽位数量（含空闲槽位）
+   */
+  size_t getCapacity() const { return m_nodes.size(); }
+
+  /**
+   * 已注册的根视图
+   */
+  const std::vector<int> &getRootTags() const { return m_rootTags; }
+
+  /**
+   * 取走上次调用以来记录的布局失效（按发生顺序，可能重复，
+   * 其中的 tag 可能已被删除）
+   */
+  void takeLayoutInvalidations(std::vector<LayoutInvalidation> &invalidations);
+  bool hasLayoutInvalidations() const {
+    return !m_layoutInvalidations.empty();
+  }
+
+ private:
+  ShadowNode *findNode(int tag);
+  ShadowNode &allocateNode(int tag);
+  void detachFromParent(ShadowNode &node);
+  void deleteSubtree(int tag);
+  void invalidateLayout(int tag, bool propsOnly = false);
+
+  std::vector<ShadowNode> m_nodes;
+  std::unordered_map<int, uint32_t> m_indexByTag;
+  std::vector<uint32_t> m_freeSlots;
+  std::vector<int> m_rootTags;
+  std::vector<LayoutInvalidation> m_layoutInvalidations;
+};
+
+}  // namespace ui
+}  // namespace mini_rn
+
+#endif  // SHADOWTREE_H
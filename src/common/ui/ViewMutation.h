@@ -0,0 +1,71 @@
+#ifndef VIEWMUTATION_H
+#define VIEWMUTATION_H
+
+#include <string>
+#include <vector>
+
+#include "Props.h"
+
+namespace mini_rn {
+namespace ui {
+
+/**
+ * 没有对应视图的 tag（如根节点的父节点）
+ */
+constexpr int kNoTag = -1;
+
+/**
+ * ViewMutation - 一次 UIManager 调用对应的视图树变更
+ *
+ * 与 React Native UIManager 的方法一一对应，参数含义相同：
+ * - CreateView: tag, viewName, rootTag, props
+ * - UpdateView: tag, viewName, props（只包含变化的属性）
+ * - SetChildren: tag, childTags
+ * - ManageChildren: tag, moveFromIndices, moveToIndices, childTags
+ *   （即 addChildReactTags）, addAtIndices, removeAtIndices
+ * - RemoveView: tag（连同子树一起删除）
+ */
+struct ViewMutation {
+  enum class Type {
+    CreateView,
+    UpdateView,
+    SetChildren,
+    ManageChildren,
+    RemoveView,
+  };
+
+  Type type = Type::CreateView;
+  int tag = kNoTag;
+  int rootTag = kNoTag;
+  std::string viewName;
+  Props props;
+  std::vector<int> childTags;
+  std::vector<int> addAtIndices;
+  std::vector<int> moveFromIndices;
+  std::vector<int> moveToIndices;
+  std::vector<int> removeAtIndices;
+};
+
+/**
+ * 获取变更类型名称（与 UIManager 方法名一致）
+ */
+inline const char *getMutationTypeName(ViewMutation::Type type) {
+  switch (type) {
+    case ViewMutation::Type::CreateView:
+      return "createView";
+    case ViewMutation::Type::UpdateView:
+      return "updateView";
+    case ViewMutation::Type::SetChildren:
+      return "setChildren";
+    case ViewMutation::Type::ManageChildren:
+      return "manageChildren";
+    case ViewMutation::Type::RemoveView:
+      return "removeView";
+  }
+  return "unknown";
+}
+
+}  // namespace ui
+}  // namespace mini_rn
+
+#endif  // VIEWMUTATION_H
@@ -0,0 +1,120 @@
+#include "VirtualizedListLayout.h"
+
+#include <algorithm>
+
+namespace mini_rn {
+namespace ui {
+
+namespace {
+
+size_t lowBit(size_t i) { return i & (~i + 1); }
+
+}  // namespace
+
+void VirtualizedListLayout::reset(size_t itemCount,
+                                  double estimatedItemHeight) {
+  m_estimatedItemHeight = estimatedItemHeight;
+  m_heights.assign(itemCount, estimatedItemHeight);
+
+  // O(n) 建树：每个节点把自己的和累加到父节点
+  m_tree.assign(itemCount + 1, 0);
+  for (size_t i = 1; i <= itemCount; ++i) {
+    m_tree[i] += m_heights[i - 1];
+    size_t parent = i + lowBit(i);
+    if (parent <= itemCount) m_tree[parent] += m_tree[i];
+  }
+  m_totalHeight = getItemOffset(itemCount);
+}
+
+void VirtualizedListLayout::setItemCount(size_t itemCount) {
+  if (itemCount < m_heights.size()) {
+    // 树状数组的前 k 个节点只依赖前 k 个 item，截断后仍然有效
+    m_heights.resize(itemCount);
+    m_tree.resize(itemCount + 1);
+    m_totalHeight = getItemOffset(itemCount);
+    return;
+  }
+
+  m_heights.reserve(itemCount);
+  m_tree.reserve(itemCount + 1);
+  while (m_heights.size() < itemCount) {
+    appendItem(m_estimatedItemHeight);
+  }
+}
+
+void VirtualizedListLayout::setItemHeight(size_t index, double height) {
+  if (index >= m_heights.size()) return;
+
+  double delta = height - m_heights[index];
+  if (delta == 0) return;
+
+  m_heights[index] = height;
+  for (size_t i = index + 1; i < m_tree.size(); i += lowBit(i)) {
+    m_tree[i] += delta;
+  }
+  m_totalHeight += delta;
+}
+
+double VirtualizedListLayout::getItemOffset(size_t index) const {
+  double offset = 0;
+  for (size_t i = std::min(index, m_heights.size()); i > 0; i -= lowBit(i)) {
+    offset += m_tree[i];
+  }
+  return offset;
+}
+
+size_t VirtualizedListLayout::findItemAt(double offset) const {
+  if (m_heights.empty()) return 0;
+  return std::min(countItemsEndingBefore(offset, true), m_heights.size() - 1);
+}
+
+VirtualizedListLayout::Window VirtualizedListLayout::getWindow(
+    double offset, double viewportLength, double overscan) const {
+  Window window;
+  if (m_heights.empty()) return window;
+
+  size_t last = m_heights.size() - 1;
+  size_t first = std::min(countItemsEndingBefore(offset - overscan, true), last);
+  // 起始偏移小于窗口结束位置的最后一个 item
+  last = std::min(
+      countItemsEndingBefore(offset + viewportLength + overscan, false), last);
+  last = std::max(last, first);
+
+  window.first = static_cast<int>(first);
+  window.last = static_cast<int>(last);
+  window.offset = getItemOffset(first);
+  window.end = getItemOffset(last + 1);
+  return window;
+}
+
+size_t VirtualizedListLayout::countItemsEndingBefore(double offset,
+                                                     bool inclusive) const {
+  size_t count = m_heights.size();
+  size_t step = 1;
+  while (step * 2 <= count) step *= 2;
+
+  // 从高位到低位确定结果：每次尝试跨过一个完整的树状数组节点
+  size_t position = 0;
+  double remaining = offset;
+  for (; step > 0; step /= 2) {
+    size_t next = position + step;
+    if (next > count) continue;
+    if (inclusive ? m_tree[next] <= remaining : m_tree[next] < remaining) {
+      position = next;
+      remaining -= m_tree[next];
+    }
+  }
+  return position;
+}
+
+void VirtualizedListLayout::appendItem(double height) {
+  // 新节点 i 覆盖 (i - lowBit(i), i]，其余部分的和由前缀和相减得到
+  size_t i = m_heights.size() + 1;
+  double node = height + getItemOffset(i - 1) - getItemOffset(i - lowBit(i));
+  m_heights.push_back(height);
+  m_tree.push_back(node);
+  m_totalHeight += height;
+}
+
+}  // namespace ui
+}  // namespace mini_rn
@@ -0,0 +1,87 @@
+#ifndef VIRTUALIZEDLISTLAYOUT_H
+#define VIRTUALIZEDLISTLAYOUT_H
+
+#include <cstddef>
+#include <vector>
+
+namespace mini_rn {
+namespace ui {
+
+/**
+ * VirtualizedListLayout - 虚拟列表的 item 偏移索引
+ *
+ * 对应 React Native VirtualizedList 在 JS 中维护的 frame 表，但偏移量保存在
+ * 树状数组（Fenwick tree）中：
+ * - 修改一个 item 的高度：O(log n)，不需要重新计算后面所有 item 的偏移
+ * - 查询 item 偏移、按滚动位置查找 item、计算渲染窗口：O(log n)
+ * - 在末尾追加 item：每个 O(log n)；截断：O(1)
+ *
+ * 未测量的 item 使用估计高度，测量后用 setItemHeight 更新。
+ */
+class VirtualizedListLayout {
+ public:
+  /**
+   * 渲染窗口：[first, last] 内的 item 需要渲染，列表为空时 first > last
+   */
+  struct Window {
+    int first = 0;
+    int last = -1;
+    double offset = 0;  // first 的起始偏移
+    double end = 0;     // last 的结束偏移
+  };
+
+  VirtualizedListLayout() = default;
+
+  /**
+   * 重置为 itemCount 个估计高度的 item，O(n)
+   */
+  void reset(size_t itemCount, double estimatedItemHeight);
+
+  /**
+   * 调整 item 数量：新增的 item 使用估计高度，多出的 item 被截掉
+   */
+  void setItemCount(size_t itemCount);
+
+  void setItemHeight(size_t index, double height);
+
+  size_t getItemCount() const { return m_heights.size(); }
+  double getItemHeight(size_t index) const { return m_heights[index]; }
+  double getEstimatedItemHeight() const { return m_estimatedItemHeight; }
+
+  /**
+   * item 的起始偏移（index == getItemCount() 时为总高度）
+   */
+  double getItemOffset(size_t index) const;
+
+  double getTotalHeight() const { return m_totalHeight; }
+
+  /**
+   * 包含指定偏移的 item；偏移超出列表范围时返回第一个或最后一个 item
+   * 列表为空时返回 0
+   */
+  size_t findItemAt(double offset) const;
+
+  /**
+   * 与 [offset - overscan, offset + viewportLength + overscan) 相交的 item
+   */
+  Window getWindow(double offset, double viewportLength,
+                   double overscan = 0) const;
+
+ private:
+  /**
+   * 结束偏移满足条件的 item 个数：inclusive 为 true 时统计 end <= offset，
+   * 否则统计 end < offset
+   */
+  size_t countItemsEndingBefore(double offset, bool inclusive) const;
+  void appendItem(double height);
+
+  std::vector<double> m_heights;
+  std::vector<double> m_tree{0};  // 树状数组，下标从 1 开始
+  double m_totalHeight = 0;
+  double m_estimatedItemHeight = 0;
+};
+
+}  // namespace ui
+}  // namespace mini_rn
+
+#endif  // VIRTUALIZEDLISTLAYOUT_H
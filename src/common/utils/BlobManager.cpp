@@ -0,0 +1,77 @@
+#include "BlobManager.h"
+
+namespace mini_rn {
+namespace utils {
+
+std::string BlobManager::store(std::shared_ptr<ByteBuffer> buffer) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    // Native 分配的 ID 带前缀，不会与 JS 生成的 ID 冲突
+    std::string blobId = "native:" + std::to_string(m_nextId++);
+    m_stats.bytes += buffer->size();
+    m_stats.created++;
+    m_blobs.emplace(blobId, Entry{std::move(buffer), 1});
+    return blobId;
+}
+
+bool BlobManager::store(const std::string& blobId, std::shared_ptr<ByteBuffer> buffer) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    size_t size = buffer->size();
+    if (!m_blobs.emplace(blobId, Entry{std::move(buffer), 1}).second) return false;
+    m_stats.bytes += size;
+    m_stats.created++;
+    return true;
+}
+
+std::shared_ptr<ByteBuffer> BlobManager::resolve(const std::string& blobId, size_t offset,
+                                                 size_t size) const {
+    std::shared_ptr<ByteBuffer> buffer = resolve(blobId);
+    if (!buffer || offset > buffer->size() || size > buffer->size() - offset) {
+        return nullptr;
+    }
+    return ByteBuffer::slice(buffer, offset, size);
+}
+
+std::shared_ptr<ByteBuffer> BlobManager::resolve(const std::string& blobId) const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto it = m_blobs.find(blobId);
+    return it == m_blobs.end() ? nullptr : it->second.buffer;
+}
+
+bool BlobManager::retain(const std::string& blobId) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto it = m_blobs.find(blobId);
+    if (it == m_blobs.end()) return false;
+    it->second.refCount++;
+    return true;
+}
+
+void BlobManager::release(const std::string& blobId) {
+    std::shared_ptr<ByteBuffer> buffer;  // 在锁外释放数据
+    std::lock_guard<std::mutex> lock(m_mutex);
+    auto it = m_blobs.find(blobId);
+    if (it == m_blobs.end() || --it->second.refCount > 0) return;
+    buffer = std::move(it->second.buffer);
+    m_stats.bytes -= buffer->size();
+    m_stats.released++;
+    m_blobs.erase(it);
+}
+
+void BlobManager::clear() {
+    std::unordered_map<std::string, Entry> blobs;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stats.released += m_blobs.size();
+        m_stats.bytes = 0;
+        blobs.swap(m_blobs);
+    }
+}
+
+BlobManager::Stats BlobManager::getStats() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    Stats stats = m_stats;
+    stats.blobs = m_blobs.size();
+    return stats;
+}
+
+}  // namespace utils
+}  // namespace mini_rn
@@ -0,0 +1,102 @@
+#ifndef BLOBMANAGER_H
+#define BLOBMANAGER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include "ByteBuffer.h"
+
+namespace mini_rn {
+namespace utils {
+
+/**
+ * BlobManager - 按 ID 引用的不可变字节数据
+ *
+ * 对应 React Native 的 RCTBlobManager：大块二进制数据保存在 Native，
+ * Bridge 上只传递句柄 {blobId, offset, size}（见 BlobModule）。模块之间交换
+ * 句柄而不是数据本身，JS 对 Blob 的 slice 只修改 offset / size，
+ * 需要内容时按句柄取出对应区间（ByteBuffer::slice，不拷贝）。
+ *
+ * 引用计数：每个 blobId 有一个计数，store 时为 1，retain / release 增减，
+ * 减到 0 时移除。数据本身由 shared_ptr 持有，已经取出的区间
+ * （交给 JS 的 ArrayBuffer、正在写入文件的数据）在移除后仍然有效。
+ *
+ * 不可变约定：blob 的内容创建后不再修改。取出的区间与 blob 共享内存，
+ * 只在 Native 之间传递；交给 JS 的 ArrayBuffer 经过 ByteBuffer::copyOnWrite
+ * （见 BlobModule）。
+ *
+ * 线程安全：所有方法都可以在任意线程调用（如 I/O 线程读完文件后直接保存）。
+ */
+class BlobManager {
+public:
+    struct Stats {
+        size_t blobs = 0;     // 当前保存的 blob 数
+        size_t bytes = 0;     // 当前保存的 blob 总字节数（共享内存的 blob 分别计算）
+        size_t created = 0;   // 累计保存的 blob 数
+        size_t released = 0;  // 累计移除的 blob 数
+    };
+
+    BlobManager() = default;
+    BlobManager(const BlobManager&) = delete;
+    BlobManager& operator=(const BlobManager&) = delete;
+
+    /**
+     * 保存数据并分配新的 blobId
+     */
+    std::string store(std::shared_ptr<ByteBuffer> buffer);
+
+    /**
+     * 以调用方给定的 blobId 保存数据（JS 侧同步创建 Blob 时预先生成 ID）
+     * @return blobId 已存在时返回 false
+     */
+    bool store(const std::string& blobId, std::shared_ptr<ByteBuffer> buffer);
+
+    /**
+     * 取出 blob 的 [offset, offset + size) 区间，不拷贝
+     * @return blob 不存在或区间越界时返回 nullptr
+     */
+    std::shared_ptr<ByteBuffer> resolve(const std::string& blobId, size_t offset,
+                                        size_t size) const;
+
+    /**
+     * 整个 blob 的数据，不存在时返回 nullptr
+     */
+    std::shared_ptr<ByteBuffer> resolve(const std::string& blobId) const;
+
+    /**
+     * 增加引用计数，blob 不存在时返回 false
+     */
+    bool retain(const std::string& blobId);
+
+    /**
+     * 减少引用计数，减到 0 时移除
+     */
+    void release(const std::string& blobId);
+
+    /**
+     * 移除所有 blob（如重新加载 JS 时）
+     */
+    void clear();
+
+    Stats getStats() const;
+
+private:
+    struct Entry {
+        std::shared_ptr<ByteBuffer> buffer;
+        size_t refCount;
+    };
+
+    mutable std::mutex m_mutex;
+    std::unordered_map<std::string, Entry> m_blobs;
+    uint64_t m_nextId = 1;
+    Stats m_stats;
+};
+
+}  // namespace utils
+}  // namespace mini_rn
+
+#endif  // BLOBMANAGER_H
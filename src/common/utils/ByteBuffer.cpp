@@ -0,0 +1,220 @@
+#include "ByteBuffer.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include <cstring>
+
+namespace mini_rn {
+namespace utils {
+
+namespace {
+
+/**
+ * 堆上分配的缓冲区
+ */
+class HeapBuffer : public ByteBuffer {
+public:
+    explicit HeapBuffer(size_t size)
+        // 保证空缓冲区也有合法地址，部分引擎不接受空指针
+        : ByteBuffer(new uint8_t[size > 0 ? size : 1], size) {}
+    ~HeapBuffer() override { delete[] m_data; }
+};
+
+/**
+ * 写时复制的文件映射，m_data 指向映射区内 offset 对应的位置
+ */
+class MappedBuffer : public ByteBuffer {
+public:
+    MappedBuffer(void* mapping, size_t mappingSize, size_t delta, size_t size, int fd,
+                 uint64_t fileOffset)
+        : ByteBuffer(static_cast<uint8_t*>(mapping) + delta, size),
+          m_mapping(mapping),
+          m_mappingSize(mappingSize),
+          m_fd(fd),
+          m_fileOffset(fileOffset) {}
+    ~MappedBuffer() override {
+        munmap(m_mapping, m_mappingSize);
+        if (m_fd >= 0) ::close(m_fd);
+    }
+
+protected:
+    std::shared_ptr<ByteBuffer> remap(size_t offset, size_t length) const override {
+        if (m_fd < 0) return nullptr;
+        return ByteBuffer::mapFile(m_fd, m_fileOffset + offset, length);
+    }
+
+private:
+    void* m_mapping;
+    size_t m_mappingSize;
+    int m_fd;               // 保留的文件描述符，-1 表示不支持 remap
+    uint64_t m_fileOffset;  // m_data 对应的文件偏移
+};
+
+/**
+ * 另一个缓冲区的区间，持有其引用
+ */
+class SliceBuffer : public ByteBuffer {
+public:
+    SliceBuffer(std::shared_ptr<ByteBuffer> parent, size_t offset, size_t size)
+        : ByteBuffer(parent->data() + offset, size, false),
+          m_parent(std::move(parent)),
+          m_offset(offset) {}
+
+protected:
+    std::shared_ptr<ByteBuffer> remap(size_t offset, size_t length) const override {
+        return remapOf(*m_parent, m_offset + offset, length);
+    }
+
+private:
+    std::shared_ptr<ByteBuffer> m_parent;
+    size_t m_offset;
+};
+
+constexpr size_t kSizeClassCount = 13;  // 256 B ~ 1 MB
+
+size_t sizeClassOf(size_t size, size_t* capacity) {
+    size_t index = 0;
+    size_t classSize = BufferPool::kMinBufferSize;
+    while (classSize < size) {
+        classSize <<= 1;
+        index++;
+    }
+    *capacity = classSize;
+    return index;
+}
+
+}  // namespace
+
+std::shared_ptr<ByteBuffer> ByteBuffer::copy(const void* data, size_t size) {
+    auto buffer = std::make_shared<HeapBuffer>(size);
+    if (size > 0) std::memcpy(buffer->data(), data, size);
+    return buffer;
+}
+
+std::shared_ptr<ByteBuffer> ByteBuffer::mapFile(int fd, uint64_t offset, size_t length,
+                                                bool keepFile) {
+    if (length == 0) return nullptr;
+
+    static const uint64_t pageSize = static_cast<uint64_t>(sysconf(_SC_PAGESIZE));
+    uint64_t alignedOffset = offset - offset % pageSize;
+    size_t delta = static_cast<size_t>(offset - alignedOffset);
+    size_t mappingSize = length + delta;
+
+    // MAP_PRIVATE + PROT_WRITE：JS 写入时内核复制该页，不会修改文件
+    void* mapping = mmap(nullptr, mappingSize, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd,
+                         static_cast<off_t>(alignedOffset));
+    if (mapping == MAP_FAILED) return nullptr;
+
+    int keptFd = keepFile ? fcntl(fd, F_DUPFD_CLOEXEC, 0) : -1;
+    return std::make_shared<MappedBuffer>(mapping, mappingSize, delta, length, keptFd,
+                                          offset);
+}
+
+std::shared_ptr<ByteBuffer> ByteBuffer::copyOnWrite(const std::shared_ptr<ByteBuffer>& buffer) {
+    if (buffer->size() > 0) {
+        std::shared_ptr<ByteBuffer> mapping = buffer->remap(0, buffer->size());
+        if (mapping) return mapping;
+    }
+    return copy(buffer->data(), buffer->size());
+}
+
+std::shared_ptr<ByteBuffer> ByteBuffer::slice(const std::shared_ptr<ByteBuffer>& parent,
+                                              size_t offset, size_t length) {
+    if (offset > parent->size()) offset = parent->size();
+    if (length > parent->size() - offset) length = parent->size() - offset;
+    if (offset == 0 && length == parent->size()) return parent;
+    return std::make_shared<SliceBuffer>(parent, offset, length);
+}
+
+struct BufferPool::State {
+    explicit State(size_t cacheLimit) : maxCachedBytes(cacheLimit) {}
+
+    ~State() {
+        for (size_t i = 0; i < kSizeClassCount; ++i) {
+            for (uint8_t* data : freeLists[i]) delete[] data;
+        }
+    }
+
+    std::mutex mutex;
+    std::vector<uint8_t*> freeLists[kSizeClassCount];
+    size_t maxCachedBytes;
+    Stats stats;
+};
+
+/**
+ * 池中分配的缓冲区，析构时放回所属级别的空闲链表
+ */
+class BufferPool::PooledBuffer : public ByteBuffer {
+public:
+    PooledBuffer(std::shared_ptr<State> state, uint8_t* data, size_t size, size_t sizeClass,
+                 size_t capacity)
+        : ByteBuffer(data, size),
+          m_state(std::move(state)),
+          m_sizeClass(sizeClass),
+          m_capacity(capacity) {}
+
+    ~PooledBuffer() override {
+        std::lock_guard<std::mutex> lock(m_state->mutex);
+        m_state->stats.outstanding--;
+        if (m_state->stats.cachedBytes + m_capacity > m_state->maxCachedBytes) {
+            delete[] m_data;
+            return;
+        }
+        m_state->freeLists[m_sizeClass].push_back(m_data);
+        m_state->stats.cachedBytes += m_capacity;
+    }
+
+private:
+    std::shared_ptr<State> m_state;
+    size_t m_sizeClass;
+    size_t m_capacity;
+};
+
+BufferPool::BufferPool(size_t maxCachedBytes)
+    : m_state(std::make_shared<State>(maxCachedBytes)) {}
+
+std::shared_ptr<ByteBuffer> BufferPool::acquire(size_t size) {
+    if (size > kMaxBufferSize) {
+        std::lock_guard<std::mutex> lock(m_state->mutex);
+        m_state->stats.acquired++;
+        return std::make_shared<HeapBuffer>(size);
+    }
+
+    size_t capacity;
+    size_t sizeClass = sizeClassOf(size, &capacity);
+    uint8_t* data = nullptr;
+    {
+        std::lock_guard<std::mutex> lock(m_state->mutex);
+        m_state->stats.acquired++;
+        m_state->stats.outstanding++;
+        std::vector<uint8_t*>& freeList = m_state->freeLists[sizeClass];
+        if (!freeList.empty()) {
+            data = freeList.back();
+            freeList.pop_back();
+            m_state->stats.cachedBytes -= capacity;
+            m_state->stats.reused++;
+        }
+    }
+    if (!data) data = new uint8_t[capacity];
+
+    return std::make_shared<PooledBuffer>(m_state, data, size, sizeClass, capacity);
+}
+
+BufferPool::Stats BufferPool::getStats() const {
+    std::lock_guard<std::mutex> lock(m_state->mutex);
+    return m_state->stats;
+}
+
+void BufferPool::trim() {
+    std::lock_guard<std::mutex> lock(m_state->mutex);
+    for (size_t i = 0; i < kSizeClassCount; ++i) {
+        for (uint8_t* data : m_state->freeLists[i]) delete[] data;
+        m_state->freeLists[i].clear();
+    }
+    m_state->stats.cachedBytes = 0;
+}
+
+}  // namespace utils
+}  // namespace mini_rn
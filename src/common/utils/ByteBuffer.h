@@ -0,0 +1,157 @@
+#ifndef BYTEBUFFER_H
+#define BYTEBUFFER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string_view>
+#include <vector>
+
+namespace mini_rn {
+namespace utils {
+
+/**
+ * ByteBuffer - 交给 JS 的 Native 字节缓冲区
+ *
+ * 执行器把它直接包装成 JS ArrayBuffer（JSC 的
+ * JSObjectMakeArrayBufferWithBytesNoCopy、QuickJS 的 JS_NewArrayBuffer），
+ * 不拷贝内容；ArrayBuffer 被 GC 回收时释放引用，最后一个引用释放时
+ * 由具体实现归还内存（解除映射、放回缓冲池……）。
+ *
+ * JS 可以写 ArrayBuffer，所以内存必须可写：文件映射使用私有的写时复制映射，
+ * JS 的修改不会写回文件。交给 JS 之后 Native 侧不应再修改内容。
+ * 与其他缓冲区共享内存的缓冲区（slice、BlobManager 保存的 blob）不能直接
+ * 交给 JS，先用 copyOnWrite 得到独立的缓冲区。
+ *
+ * 释放可能发生在 GC 所在的任意线程，各实现的析构都是线程安全的。
+ */
+class ByteBuffer {
+public:
+    virtual ~ByteBuffer() = default;
+
+    ByteBuffer(const ByteBuffer&) = delete;
+    ByteBuffer& operator=(const ByteBuffer&) = delete;
+
+    uint8_t* data() const { return m_data; }
+    size_t size() const { return m_size; }
+    std::string_view view() const {
+        return std::string_view(reinterpret_cast<const char*>(m_data), m_size);
+    }
+
+    /**
+     * 内存是否归这个缓冲区独占（slice 与 parent 共享内存，返回 false）
+     */
+    bool ownsMemory() const { return m_ownsMemory; }
+
+    /**
+     * 截短到 size 字节（用于读到的字节数少于申请的情况），只能在交给 JS 之前调用
+     */
+    void truncate(size_t size) {
+        if (size < m_size) m_size = size;
+    }
+
+    /**
+     * 从堆上分配并拷贝一份数据
+     */
+    static std::shared_ptr<ByteBuffer> copy(const void* data, size_t size);
+
+    /**
+     * 以写时复制方式映射文件的 [offset, offset + length) 区间
+     * offset 不必按页对齐
+     * @param keepFile 为 true 时保留一份文件描述符（随缓冲区关闭），
+     *        copyOnWrite 可以为其中的区间建立新的私有映射而不拷贝
+     * @return 映射失败或区间为空时返回 nullptr
+     */
+    static std::shared_ptr<ByteBuffer> mapFile(int fd, uint64_t offset, size_t length,
+                                               bool keepFile = false);
+
+    /**
+     * 内容与 buffer 相同、互不影响的新缓冲区（ownsMemory() 为 true），
+     * 用于把共享的内存交给 JS（JS 可以写 ArrayBuffer）：
+     * - 保留了文件的映射及其 slice：对同一文件区间建立新的写时复制映射，
+     *   不拷贝，页面与原映射共享页缓存，只有 JS 写入的页才会被复制
+     * - 其他缓冲区：在堆上拷贝一份
+     */
+    static std::shared_ptr<ByteBuffer> copyOnWrite(const std::shared_ptr<ByteBuffer>& buffer);
+
+    /**
+     * parent 的 [offset, offset + length) 区间，与 parent 共享内存（不拷贝），
+     * 并持有 parent 的引用；区间超出 parent 时截到末尾
+     */
+    static std::shared_ptr<ByteBuffer> slice(const std::shared_ptr<ByteBuffer>& parent,
+                                             size_t offset, size_t length);
+
+protected:
+    ByteBuffer(uint8_t* data, size_t size, bool ownsMemory = true)
+        : m_data(data), m_size(size), m_ownsMemory(ownsMemory) {}
+
+    /**
+     * 为 [offset, offset + length) 建立新的写时复制映射，不支持时返回 nullptr
+     */
+    virtual std::shared_ptr<ByteBuffer> remap(size_t /* offset */, size_t /* length */) const {
+        return nullptr;
+    }
+    static std::shared_ptr<ByteBuffer> remapOf(const ByteBuffer& buffer, size_t offset,
+                                               size_t length) {
+        return buffer.remap(offset, length);
+    }
+
+    uint8_t* m_data;
+    size_t m_size;
+    bool m_ownsMemory;
+};
+
+/**
+ * BufferPool - 按 2 的幂分级复用的缓冲区池
+ *
+ * 文件分块读取等场景会反复申请大小相近的缓冲区，交给 JS 后由 GC 决定
+ * 何时释放。池把释放的缓冲区按容量分级缓存，下次申请同级别时直接复用，
+ * 避免每块都向系统申请和归还大块内存。缓存总量有上限，超出的直接释放。
+ *
+ * 已分配的缓冲区持有池内部状态的引用，池本身先于缓冲区销毁也是安全的。
+ */
+class BufferPool {
+public:
+    static constexpr size_t kMinBufferSize = 256;
+    static constexpr size_t kMaxBufferSize = 1 << 20;  // 更大的申请不进入池
+
+    struct Stats {
+        size_t acquired = 0;     // 申请次数
+        size_t reused = 0;       // 从缓存复用的次数
+        size_t outstanding = 0;  // 尚未释放的缓冲区数
+        size_t cachedBytes = 0;  // 缓存中空闲缓冲区的总容量
+    };
+
+    /**
+     * @param maxCachedBytes 缓存空闲缓冲区的总容量上限
+     */
+    explicit BufferPool(size_t maxCachedBytes = 8 << 20);
+
+    BufferPool(const BufferPool&) = delete;
+    BufferPool& operator=(const BufferPool&) = delete;
+
+    /**
+     * 申请至少 size 字节的缓冲区，size() 等于 size，内容未初始化
+     * 可以在任意线程调用
+     */
+    std::shared_ptr<ByteBuffer> acquire(size_t size);
+
+    Stats getStats() const;
+
+    /**
+     * 释放所有缓存的空闲缓冲区（内存紧张时调用）
+     */
+    void trim();
+
+private:
+    struct State;
+    class PooledBuffer;
+
+    std::shared_ptr<State> m_state;
+};
+
+}  // namespace utils
+}  // namespace mini_rn
+
+#endif  // BYTEBUFFER_H
@@ -0,0 +1,542 @@
+#include "JSONDocument.h"
+
+#include <array>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+
+#include "JSONParser.h"
+
+#if (defined(__x86_64__) || defined(__i386__)) && defined(__GNUC__)
+#define MINI_RN_JSON_X86 1
+#include <immintrin.h>
+#endif
+
+namespace mini_rn {
+namespace utils {
+
+namespace {
+
+// 嵌套层数上限，防止恶意输入耗尽栈
+constexpr int kMaxDepth = 512;
+constexpr size_t kBlockSize = 64;
+
+// 64 字节块中各类字符的位图，第 i 位对应块内第 i 个字节
+struct BlockMasks {
+    uint64_t quote;
+    uint64_t backslash;
+    uint64_t op;          // {}[],:
+    uint64_t whitespace;
+};
+
+enum CharClass : uint8_t {
+    kQuote = 1,
+    kBackslash = 2,
+    kOp = 4,
+    kWhitespace = 8,
+};
+
+constexpr std::array<uint8_t, 256> makeCharClasses() {
+    std::array<uint8_t, 256> classes{};
+    classes['"'] = kQuote;
+    classes['\\'] = kBackslash;
+    for (char c : {'{', '}', '[', ']', ',', ':'}) {
+        classes[static_cast<uint8_t>(c)] = kOp;
+    }
+    for (char c : {' ', '\t', '\n', '\r'}) {
+        classes[static_cast<uint8_t>(c)] = kWhitespace;
+    }
+    return classes;
+}
+
+constexpr std::array<uint8_t, 256> kCharClasses = makeCharClasses();
+
+void classifyScalar(const char* block, BlockMasks& masks) {
+    masks = {};
+    for (size_t i = 0; i < kBlockSize; ++i) {
+        uint64_t c = kCharClasses[static_cast<uint8_t>(block[i])];
+        masks.quote |= (c & 1) << i;
+        masks.backslash |= ((c >> 1) & 1) << i;
+        masks.op |= ((c >> 2) & 1) << i;
+        masks.whitespace |= ((c >> 3) & 1) << i;
+    }
+}
+
+#ifdef MINI_RN_JSON_X86
+
+__attribute__((target("sse2")))
+void classifySSE2(const char* block, BlockMasks& masks) {
+    const __m128i quote = _mm_set1_epi8('"');
+    const __m128i backslash = _mm_set1_epi8('\\');
+    const __m128i lowerBit = _mm_set1_epi8(0x20);
+    const __m128i openBrace = _mm_set1_epi8('{');
+    const __m128i closeBrace = _mm_set1_epi8('}');
+    const __m128i comma = _mm_set1_epi8(',');
+    const __m128i colon = _mm_set1_epi8(':');
+    const __m128i space = _mm_set1_epi8(' ');
+    const __m128i tab = _mm_set1_epi8('\t');
+    const __m128i newline = _mm_set1_epi8('\n');
+    const __m128i carriageReturn = _mm_set1_epi8('\r');
+
+    masks = {};
+    for (size_t i = 0; i < kBlockSize; i += 16) {
+        __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(block + i));
+        // '[' | 0x20 == '{'，']' | 0x20 == '}'，其余字符不会变成括号
+        __m128i folded = _mm_or_si128(v, lowerBit);
+        __m128i op = _mm_or_si128(
+            _mm_or_si128(_mm_cmpeq_epi8(folded, openBrace), _mm_cmpeq_epi8(folded, closeBrace)),
+            _mm_or_si128(_mm_cmpeq_epi8(v, comma), _mm_cmpeq_epi8(v, colon)));
+        __m128i whitespace = _mm_or_si128(
+            _mm_or_si128(_mm_cmpeq_epi8(v, space), _mm_cmpeq_epi8(v, tab)),
+            _mm_or_si128(_mm_cmpeq_epi8(v, newline), _mm_cmpeq_epi8(v, carriageReturn)));
+
+        masks.quote |= static_cast<uint64_t>(
+            static_cast<uint16_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(v, quote)))) << i;
+        masks.backslash |= static_cast<uint64_t>(
+            static_cast<uint16_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(v, backslash)))) << i;
+        masks.op |= static_cast<uint64_t>(static_cast<uint16_t>(_mm_movemask_epi8(op))) << i;
+        masks.whitespace |=
+            static_cast<uint64_t>(static_cast<uint16_t>(_mm_movemask_epi8(whitespace))) << i;
+    }
+}
+
+__attribute__((target("avx2")))
+void classifyAVX2(const char* block, BlockMasks& masks) {
+    const __m256i quote = _mm256_set1_epi8('"');
+    const __m256i backslash = _mm256_set1_epi8('\\');
+    const __m256i lowerBit = _mm256_set1_epi8(0x20);
+    const __m256i openBrace = _mm256_set1_epi8('{');
+    const __m256i closeBrace = _mm256_set1_epi8('}');
+    const __m256i comma = _mm256_set1_epi8(',');
+    const __m256i colon = _mm256_set1_epi8(':');
+    const __m256i space = _mm256_set1_epi8(' ');
+    const __m256i tab = _mm256_set1_epi8('\t');
+    const __m256i newline = _mm256_set1_epi8('\n');
+    const __m256i carriageReturn = _mm256_set1_epi8('\r');
+
+    masks = {};
+    for (size_t i = 0; i < kBlockSize; i += 32) {
+        __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(block + i));
+        __m256i folded = _mm256_or_si256(v, lowerBit);
+        __m256i op = _mm256_or_si256(
+            _mm256_or_si256(_mm256_cmpeq_epi8(folded, openBrace),
+                            _mm256_cmpeq_epi8(folded, closeBrace)),
+            _mm256_or_si256(_mm256_cmpeq_epi8(v, comma), _mm256_cmpeq_epi8(v, colon)));
+        __m256i whitespace = _mm256_or_si256(
+            _mm256_or_si256(_mm256_cmpeq_epi8(v, space), _mm256_cmpeq_epi8(v, tab)),
+            _mm256_or_si256(_mm256_cmpeq_epi8(v, newline),
+                            _mm256_cmpeq_epi8(v, carriageReturn)));
+
+        masks.quote |= static_cast<uint64_t>(
+            static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(v, quote)))) << i;
+        masks.backslash |= static_cast<uint64_t>(static_cast<uint32_t>(
+            _mm256_movemask_epi8(_mm256_cmpeq_epi8(v, backslash)))) << i;
+        masks.op |= static_cast<uint64_t>(static_cast<uint32_t>(_mm256_movemask_epi8(op))) << i;
+        masks.whitespace |=
+            static_cast<uint64_t>(static_cast<uint32_t>(_mm256_movemask_epi8(whitespace))) << i;
+    }
+}
+
+#endif  // MINI_RN_JSON_X86
+
+/**
+ * 被转义的字符位图
+ * 反斜杠在 Bridge 消息中很少见，逐个处理即可；carry 为上一块末尾未完成的转义
+ */
+uint64_t findEscaped(uint64_t backslash, uint64_t& carry) {
+    uint64_t escaped = carry;
+    carry = 0;
+    uint64_t pending = backslash & ~escaped;
+    while (pending) {
+        int bit = __builtin_ctzll(pending);
+        if (bit == 63) {
+            carry = 1;
+        } else {
+            escaped |= uint64_t(1) << (bit + 1);
+        }
+        // 被转义的反斜杠不再转义下一个字符
+        pending &= pending - 1;
+        pending &= ~escaped;
+    }
+    return escaped;
+}
+
+/**
+ * 前缀异或：第 i 位为第 0..i 位的异或，用引号位图得到“在字符串内”的位图
+ */
+uint64_t prefixXor(uint64_t bits) {
+    bits ^= bits << 1;
+    bits ^= bits << 2;
+    bits ^= bits << 4;
+    bits ^= bits << 8;
+    bits ^= bits << 16;
+    bits ^= bits << 32;
+    return bits;
+}
+
+void appendPositions(std::vector<uint32_t>& positions, uint32_t base, uint64_t bits) {
+    size_t count = static_cast<size_t>(__builtin_popcountll(bits));
+    size_t offset = positions.size();
+    positions.resize(offset + count);
+    uint32_t* out = positions.data() + offset;
+    while (bits) {
+        *out++ = base + static_cast<uint32_t>(__builtin_ctzll(bits));
+        bits &= bits - 1;
+    }
+}
+
+bool isDelimiter(char c) {
+    return kCharClasses[static_cast<uint8_t>(c)] != 0;
+}
+
+/**
+ * 解析数字 token；不含小数和指数的短整数走快速路径，其余交给 strtod
+ * token 之后紧跟分隔符或字符串结尾，strtod 不会越过 token
+ */
+bool parseNumber(std::string_view token, double& value) {
+    size_t i = 0;
+    bool negative = token[0] == '-';
+    if (negative) i = 1;
+
+    uint64_t integer = 0;
+    size_t digits = 0;
+    while (i < token.length() && token[i] >= '0' && token[i] <= '9') {
+        integer = integer * 10 + static_cast<uint64_t>(token[i] - '0');
+        ++i;
+        ++digits;
+    }
+    if (digits == 0) return false;
+    if (i == token.length() && digits <= 15) {
+        value = negative ? -static_cast<double>(integer) : static_cast<double>(integer);
+        return true;
+    }
+
+    char* end = nullptr;
+    value = std::strtod(token.data(), &end);
+    return end == token.data() + token.length();
+}
+
+}  // namespace
+
+// === 阶段一：结构索引 ===
+
+JSONDocument::Scanner JSONDocument::getScanner() {
+#ifdef MINI_RN_JSON_X86
+    static const Scanner scanner = [] {
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx2")) return Scanner::AVX2;
+        if (__builtin_cpu_supports("sse2")) return Scanner::SSE2;
+        return Scanner::Scalar;
+    }();
+    return scanner;
+#else
+    return Scanner::Scalar;
+#endif
+}
+
+const char* JSONDocument::getScannerName(Scanner scanner) {
+    switch (scanner) {
+        case Scanner::AVX2:   return "AVX2";
+        case Scanner::SSE2:   return "SSE2";
+        case Scanner::Scalar: return "scalar";
+    }
+    return "scalar";
+}
+
+void JSONDocument::indexStructurals(std::string_view json, std::vector<uint32_t>& positions,
+                                    Scanner scanner) {
+    // 请求的实现当前 CPU 不支持时退回可用的最快实现
+    if (scanner > getScanner()) scanner = getScanner();
+
+    void (*classify)(const char*, BlockMasks&) = classifyScalar;
+#ifdef MINI_RN_JSON_X86
+    if (scanner == Scanner::AVX2) classify = classifyAVX2;
+    if (scanner == Scanner::SSE2) classify = classifySSE2;
+#endif
+
+    positions.clear();
+    uint64_t escapeCarry = 0;  // 上一块以未完成的转义结束
+    uint64_t inStringCarry = 0;  // 上一块在字符串内结束时为全 1
+    uint64_t scalarCarry = 0;  // 上一块最后一个字节属于标量
+
+    for (size_t base = 0; base < json.length(); base += kBlockSize) {
+        const char* block = json.data() + base;
+        char padded[kBlockSize];
+        if (json.length() - base < kBlockSize) {
+            // 最后一块不足 64 字节，用空白补齐
+            std::memset(padded, ' ', kBlockSize);
+            std::memcpy(padded, block, json.length() - base);
+            block = padded;
+        }
+
+        BlockMasks masks;
+        classify(block, masks);
+
+        uint64_t escaped = findEscaped(masks.backslash, escapeCarry);
+        uint64_t quotes = masks.quote & ~escaped;
+        // 开始引号和字符串内容为 1，结束引号为 0
+        uint64_t inString = prefixXor(quotes) ^ inStringCarry;
+        inStringCarry = 0 - (inString >> 63);
+
+        uint64_t scalar = ~(masks.quote | masks.op | masks.whitespace | inString);
+        uint64_t scalarStarts = scalar & ~((scalar << 1) | scalarCarry);
+        scalarCarry = scalar >> 63;
+
+        appendPositions(positions, static_cast<uint32_t>(base),
+                        (masks.op & ~inString) | quotes | scalarStarts);
+    }
+}
+
+// === 阶段二：建树 ===
+
+bool JSONDocument::parse(std::string_view json) {
+    m_nodes.clear();
+    m_strings.clear();
+    m_error.clear();
+    m_cursor = 0;
+
+    if (json.length() >= std::numeric_limits<uint32_t>::max()) {
+        return fail("Document too large", 0);
+    }
+    m_source.assign(json.data(), json.length());
+    indexStructurals(m_source, m_structurals);
+    if (m_structurals.empty()) return fail("Empty document", 0);
+
+    // 每个值至少对应一个结构位置，预留后建树过程中不会重新分配
+    m_nodes.reserve(m_structurals.size());
+    if (!parseValue(0)) {
+        m_nodes.clear();
+        return false;
+    }
+    if (m_cursor != m_structurals.size()) {
+        fail("Unexpected content after root value", m_structurals[m_cursor]);
+        m_nodes.clear();
+        return false;
+    }
+    return true;
+}
+
+JSONValue JSONDocument::root() const {
+    return m_nodes.empty() ? JSONValue() : JSONValue(this, 0);
+}
+
+bool JSONDocument::fail(const char* message, uint32_t position) {
+    m_error = std::string(message) + " at position " + std::to_string(position);
+    return false;
+}
+
+bool JSONDocument::parseValue(int depth) {
+    uint32_t position;
+    if (!nextStructural(position)) {
+        return fail("Unexpected end of input", static_cast<uint32_t>(m_source.length()));
+    }
+
+    char c = m_source[position];
+    if (c == '"') return parseString(position);
+    if (c != '{' && c != '[') return parseScalar(position);
+
+    if (depth >= kMaxDepth) return fail("Nesting too deep", position);
+
+    bool object = c == '{';
+    char close = object ? '}' : ']';
+    uint32_t index = static_cast<uint32_t>(m_nodes.size());
+    m_nodes.emplace_back();
+    m_nodes[index].type = object ? Value::Type::Object : Value::Type::Array;
+    m_nodes[index].unescaped = false;
+    m_nodes[index].begin = position;
+
+    uint32_t count = 0;
+    uint32_t end;
+    if (m_cursor < m_structurals.size() && m_source[m_structurals[m_cursor]] == close) {
+        end = m_structurals[m_cursor++] + 1;
+    } else {
+        while (true) {
+            if (object) {
+                uint32_t keyPosition, colon;
+                if (!nextStructural(keyPosition) || m_source[keyPosition] != '"') {
+                    return fail("Expected object key", position);
+                }
+                if (!parseString(keyPosition)) return false;
+                if (!nextStructural(colon) || m_source[colon] != ':') {
+                    return fail("Expected ':'", keyPosition);
+                }
+            }
+            if (!parseValue(depth + 1)) return false;
+            count++;
+
+            uint32_t separator;
+            if (!nextStructural(separator)) {
+                return fail("Unexpected end of input", static_cast<uint32_t>(m_source.length()));
+            }
+            if (m_source[separator] == ',') continue;
+            if (m_source[separator] == close) {
+                end = separator + 1;
+                break;
+            }
+            return fail(object ? "Expected ',' or '}'" : "Expected ',' or ']'", separator);
+        }
+    }
+
+    Node& node = m_nodes[index];
+    node.count = count;
+    node.end = end;
+    node.next = static_cast<uint32_t>(m_nodes.size());
+    return true;
+}
+
+bool JSONDocument::parseString(uint32_t position) {
+    // 字符串内部不会出现在索引中，下一个位置就是结束引号
+    uint32_t close;
+    if (!nextStructural(close) || m_source[close] != '"') {
+        return fail("Unterminated string", position);
+    }
+
+    Node node;
+    node.type = Value::Type::String;
+    node.begin = position;
+    node.end = close + 1;
+    node.next = static_cast<uint32_t>(m_nodes.size() + 1);
+
+    std::string_view content(m_source.data() + position + 1, close - position - 1);
+    if (content.find('\\') == std::string_view::npos) {
+        node.unescaped = false;
+        node.string = {position + 1, static_cast<uint32_t>(content.length())};
+    } else {
+        size_t offset = m_strings.length();
+        if (!appendUnescapedJSONString(content, m_strings)) {
+            return fail("Invalid escape sequence", position);
+        }
+        node.unescaped = true;
+        node.string = {static_cast<uint32_t>(offset),
+                       static_cast<uint32_t>(m_strings.length() - offset)};
+    }
+    m_nodes.push_back(node);
+    return true;
+}
+
+bool JSONDocument::parseScalar(uint32_t position) {
+    uint32_t end = position;
+    while (end < m_source.length() && !isDelimiter(m_source[end])) end++;
+    std::string_view token(m_source.data() + position, end - position);
+
+    Node node;
+    node.unescaped = false;
+    node.begin = position;
+    node.end = end;
+    node.next = static_cast<uint32_t>(m_nodes.size() + 1);
+
+    if (token == "null") {
+        node.type = Value::Type::Null;
+        node.number = 0;
+    } else if (token == "true" || token == "false") {
+        node.type = Value::Type::Bool;
+        node.number = token == "true" ? 1 : 0;
+    } else if (!token.empty() && parseNumber(token, node.number)) {
+        node.type = Value::Type::Number;
+    } else {
+        return fail("Unexpected token", position);
+    }
+    m_nodes.push_back(node);
+    return true;
+}
+
+// === JSONValue ===
+
+JSONValue::Type JSONValue::getType() const {
+    return m_document ? m_document->m_nodes[m_index].type : Type::Null;
+}
+
+bool JSONValue::asBool() const {
+    return isBool() && m_document->m_nodes[m_index].number != 0;
+}
+
+double JSONValue::asNumber() const {
+    return isNumber() ? m_document->m_nodes[m_index].number : 0;
+}
+
+std::string_view JSONValue::asString() const {
+    return isString() ? m_document->stringAt(m_index) : std::string_view();
+}
+
+size_t JSONValue::size() const {
+    return isArray() || isObject() ? m_document->m_nodes[m_index].count : 0;
+}
+
+JSONValue JSONValue::operator[](size_t index) const {
+    if (!isArray() || index >= size()) return JSONValue();
+    uint32_t child = m_index + 1;
+    for (size_t i = 0; i < index; ++i) {
+        child = m_document->m_nodes[child].next;
+    }
+    return JSONValue(m_document, child);
+}
+
+JSONValue JSONValue::get(std::string_view key) const {
+    if (!isObject()) return JSONValue();
+    for (auto it = begin(); it != end(); ++it) {
+        if (it.key() == key) return *it;
+    }
+    return JSONValue();
+}
+
+std::string_view JSONValue::raw() const {
+    if (!m_document) return std::string_view();
+    const JSONDocument::Node& node = m_document->m_nodes[m_index];
+    return std::string_view(m_document->m_source.data() + node.begin, node.end - node.begin);
+}
+
+Value JSONValue::toValue() const {
+    switch (getType()) {
+        case Type::Null:
+            return Value();
+        case Type::Bool:
+            return Value(asBool());
+        case Type::Number:
+            return Value(asNumber());
+        case Type::String:
+            return Value(std::string(asString()));
+        case Type::Array: {
+            Value array = Value::array();
+            for (JSONValue element : *this) {
+                array.push(element.toValue());
+            }
+            return array;
+        }
+        case Type::Object: {
+            Value object = Value::object();
+            for (auto it = begin(); it != end(); ++it) {
+                object.set(std::string(it.key()), (*it).toValue());
+            }
+            return object;
+        }
+        case Type::ArrayBuffer:  // JSON 文本中不会出现
+            break;
+    }
+    return Value();
+}
+
+JSONValue::Iterator JSONValue::begin() const {
+    if (!isArray() && !isObject()) return end();
+    return Iterator(m_document, m_index + 1, isObject());
+}
+
+JSONValue::Iterator JSONValue::end() const {
+    uint32_t next = m_document ? m_document->m_nodes[m_index].next : 0;
+    return Iterator(m_document, next, isObject());
+}
+
+JSONValue JSONValue::Iterator::operator*() const {
+    return JSONValue(m_document, m_object ? m_index + 1 : m_index);
+}
+
+JSONValue::Iterator& JSONValue::Iterator::operator++() {
+    m_index = m_document->m_nodes[m_object ? m_index + 1 : m_index].next;
+    return *this;
+}
+
+std::string_view JSONValue::Iterator::key() const {
+    return m_object ? m_document->stringAt(m_index) : std::string_view();
+}
+
+}  // namespace utils
+}  // namespace mini_rn
@@ -0,0 +1,247 @@
+#ifndef JSONDOCUMENT_H
+#define JSONDOCUMENT_H
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "Value.h"
+
+namespace mini_rn {
+namespace utils {
+
+class JSONDocument;
+
+/**
+ * JSONValue - JSONDocument 中一个值的只读视图
+ *
+ * 只包含文档指针和节点下标，按值传递，不拷贝任何数据。
+ * 文档重新解析或销毁后失效；asString / raw 返回的 string_view 同样指向文档内部。
+ *
+ * 使用示例：
+ * ```cpp
+ * // args: [3, "RCTView", 1, {"flex": 1}]
+ * int tag = args[0].asInt();
+ * for (auto it = args[3].begin(); it != args[3].end(); ++it) {
+ *     handleProp(it.key(), *it);
+ * }
+ * ```
+ */
+class JSONValue {
+public:
+    using Type = Value::Type;
+
+    /**
+     * 遍历数组元素或对象字段
+     * 解引用得到元素（对象为字段值），对象字段名通过 key() 获取
+     */
+    class Iterator {
+    public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = JSONValue;
+        using difference_type = std::ptrdiff_t;
+        using pointer = void;
+        using reference = JSONValue;
+
+        JSONValue operator*() const;
+        Iterator& operator++();
+        bool operator==(const Iterator& other) const { return m_index == other.m_index; }
+        bool operator!=(const Iterator& other) const { return m_index != other.m_index; }
+
+        /**
+         * 当前字段名（仅对象）
+         */
+        std::string_view key() const;
+
+    private:
+        friend class JSONValue;
+        Iterator(const JSONDocument* document, uint32_t index, bool object)
+            : m_document(document), m_index(index), m_object(object) {}
+
+        const JSONDocument* m_document;
+        uint32_t m_index;  // 当前元素（对象为字段名）的节点下标
+        bool m_object;
+    };
+
+    JSONValue() = default;
+
+    /**
+     * 是否指向一个值；get 找不到字段、下标越界时返回无效值
+     */
+    bool isValid() const { return m_document != nullptr; }
+    explicit operator bool() const { return isValid(); }
+
+    /**
+     * 无效值视为 Null
+     */
+    Type getType() const;
+    bool isNull() const { return getType() == Type::Null; }
+    bool isBool() const { return getType() == Type::Bool; }
+    bool isNumber() const { return getType() == Type::Number; }
+    bool isString() const { return getType() == Type::String; }
+    bool isArray() const { return getType() == Type::Array; }
+    bool isObject() const { return getType() == Type::Object; }
+
+    /**
+     * 类型不符时返回 false / 0 / 空字符串
+     */
+    bool asBool() const;
+    double asNumber() const;
+    int asInt() const { return static_cast<int>(asNumber()); }
+    std::string_view asString() const;
+
+    /**
+     * 数组元素数 / 对象字段数，其他类型为 0
+     */
+    size_t size() const;
+
+    /**
+     * 数组第 index 个元素，越界或不是数组时返回无效值
+     * 需要跳过前面的元素（每个元素 O(1)），顺序访问请用迭代器
+     */
+    JSONValue operator[](size_t index) const;
+
+    /**
+     * 对象字段值（线性查找），不存在或不是对象时返回无效值
+     */
+    JSONValue get(std::string_view key) const;
+
+    /**
+     * 值在原始 JSON 文本中的片段，如 {"flex":1}，不重新序列化
+     */
+    std::string_view raw() const;
+
+    /**
+     * 转换为可修改的 Value 树
+     */
+    Value toValue() const;
+
+    Iterator begin() const;
+    Iterator end() const;
+
+private:
+    friend class JSONDocument;
+    JSONValue(const JSONDocument* document, uint32_t index)
+        : m_document(document), m_index(index) {}
+
+    const JSONDocument* m_document = nullptr;
+    uint32_t m_index = 0;
+};
+
+/**
+ * JSONDocument - 完整的 JSON 解析器，结果是存放在同一块存储中的紧凑值树
+ *
+ * 解析分两个阶段（思路来自 simdjson）：
+ * 1. 结构索引：按 64 字节分块，用 SIMD（x86 上为 AVX2 / SSE2，运行时选择）
+ *    得到引号、反斜杠、结构字符和空白的位图，再用位运算排除字符串内部的字符，
+ *    输出所有结构字符、引号和标量起始位置；其他平台使用逐字节查表的标量实现，
+ *    两者结果完全相同
+ * 2. 建树：沿结构索引递归下降，按先序把节点追加到一个数组中，
+ *    每个节点记录子树之后的下标，跳过整个子树是 O(1)
+ *
+ * 存储：
+ * - 节点数组、结构索引、原始文本和反转义后的字符串都由文档持有，
+ *   重新解析时复用已有容量，稳定状态下解析不分配内存
+ * - 不含转义的字符串直接指向原始文本，只有带转义的字符串才会复制
+ *
+ * Bridge 每次刷新队列解析一次，模块直接遍历参数的值树，不再各自重新解析。
+ */
+class JSONDocument {
+public:
+    /**
+     * 结构索引实现
+     */
+    enum class Scanner : uint8_t { Scalar, SSE2, AVX2 };
+
+    JSONDocument() = default;
+    JSONDocument(const JSONDocument&) = delete;
+    JSONDocument& operator=(const JSONDocument&) = delete;
+
+    /**
+     * 解析 JSON 文本（会复制一份），之前返回的 JSONValue 全部失效
+     * @return 格式错误时返回 false，错误信息见 getError
+     */
+    bool parse(std::string_view json);
+
+    /**
+     * 根值，解析失败时返回无效值
+     */
+    JSONValue root() const;
+
+    const std::string& getError() const { return m_error; }
+    size_t getNodeCount() const { return m_nodes.size(); }
+
+    /**
+     * 阶段一：输出结构字符（{}[],:）、引号（开始和结束）和标量起始位置，
+     * 字符串内部的字符不会出现在结果中
+     * @param scanner 使用的实现，不支持时退回标量实现
+     */
+    static void indexStructurals(std::string_view json, std::vector<uint32_t>& positions,
+                                 Scanner scanner);
+    static void indexStructurals(std::string_view json, std::vector<uint32_t>& positions) {
+        indexStructurals(json, positions, getScanner());
+    }
+
+    /**
+     * 当前 CPU 上最快的实现
+     */
+    static Scanner getScanner();
+    static const char* getScannerName(Scanner scanner);
+
+private:
+    friend class JSONValue;
+    friend class JSONValue::Iterator;
+
+    struct Span {
+        uint32_t offset;
+        uint32_t length;
+    };
+
+    struct Node {
+        Value::Type type;
+        bool unescaped;  // 字符串存放在 m_strings 中（含转义）而不是原始文本中
+        uint32_t next;   // 子树之后的第一个节点
+        uint32_t begin;  // 在原始文本中的范围 [begin, end)
+        uint32_t end;
+        union {
+            double number;   // Number / Bool
+            Span string;     // String
+            uint32_t count;  // Array / Object：元素数 / 字段数
+        };
+    };
+
+    bool parseValue(int depth);
+    bool parseString(uint32_t position);
+    bool parseScalar(uint32_t position);
+    bool fail(const char* message, uint32_t position);
+
+    /**
+     * 取下一个结构位置，没有时返回 false
+     */
+    bool nextStructural(uint32_t& position) {
+        if (m_cursor >= m_structurals.size()) return false;
+        position = m_structurals[m_cursor++];
+        return true;
+    }
+
+    std::string_view stringAt(uint32_t index) const {
+        const Node& node = m_nodes[index];
+        const std::string& storage = node.unescaped ? m_strings : m_source;
+        return std::string_view(storage.data() + node.string.offset, node.string.length);
+    }
+
+    std::string m_source;
+    std::string m_strings;
+    std::vector<uint32_t> m_structurals;
+    std::vector<Node> m_nodes;
+    size_t m_cursor = 0;
+    std::string m_error;
+};
+
+}  // namespace utils
+}  // namespace mini_rn
+
+#endif  // JSONDOCUMENT_H
@@ -1,7 +1,10 @@
 #include "JSONParser.h"
-#include "../bridge/JSCExecutor.h"  // 引入BridgeMessage定义
+#include "../bridge/JSExecutor.h"  // 引入BridgeMessage定义
 
 #include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
 #include <iostream>
 #include <sstream>
 #include <stdexcept>
@@ -10,14 +13,257 @@
 namespace mini_rn {
 namespace utils {
 
+// === JSON 编码工具 ===
+
+std::string quoteJSONString(const std::string& str) {
+    static const char kHexDigits[] = "0123456789abcdef";
+
+    std::string result;
+    result.reserve(str.length() + 2);
+    result.push_back('"');
+
+    for (unsigned char c : str) {
+        switch (c) {
+            case '"':  result += "\\\""; break;
+            case '\\': result += "\\\\"; break;
+            case '\b': result += "\\b"; break;
+            case '\f': result += "\\f"; break;
+            case '\n': result += "\\n"; break;
+            case '\r': result += "\\r"; break;
+            case '\t': result += "\\t"; break;
+            default:
+                if (c < 0x20) {
+                    // 其余控制字符使用 Unicode 转义（\\u00XX）形式
+                    result += "\\u00";
+                    result.push_back(kHexDigits[c >> 4]);
+                    result.push_back(kHexDigits[c & 0x0F]);
+                } else {
+                    result.push_back(static_cast<char>(c));
+                }
+                break;
+        }
+    }
+
+    result.push_back('"');
+    return result;
+}
+
+// === JSON 拆分工具 ===
+
+namespace {
+
+size_t skipWhitespace(const std::string& json, size_t pos) {
+    while (pos < json.length() &&
+           (json[pos] == ' ' || json[pos] == '\t' || json[pos] == '\n' || json[pos] == '\r')) {
+        pos++;
+    }
+    return pos;
+}
+
+// 跳过一个完整的 JSON 值，返回值之后的位置；格式错误时返回 npos
+size_t skipJSONValue(const std::string& json, size_t pos) {
+    if (pos >= json.length()) return std::string::npos;
+
+    if (json[pos] == '"') {
+        for (size_t i = pos + 1; i < json.length(); i++) {
+            if (json[i] == '\\') {
+                i++;
+            } else if (json[i] == '"') {
+                return i + 1;
+            }
+        }
+        return std::string::npos;
+    }
+
+    if (json[pos] == '[' || json[pos] == '{') {
+        int depth = 0;
+        for (size_t i = pos; i < json.length(); i++) {
+            char c = json[i];
+            if (c == '"') {
+                i = skipJSONValue(json, i);
+                if (i == std::string::npos) return std::string::npos;
+                i--;
+            } else if (c == '[' || c == '{') {
+                depth++;
+            } else if (c == ']' || c == '}') {
+                if (--depth == 0) return i + 1;
+            }
+        }
+        return std::string::npos;
+    }
+
+    // 数字、true、false、null：读到分隔符为止
+    size_t end = pos;
+    while (end < json.length() && json[end] != ',' && json[end] != ']' && json[end] != '}' &&
+           json[end] != ' ' && json[end] != '\n' && json[end] != '\r' && json[end] != '\t') {
+        end++;
+    }
+    return end == pos ? std::string::npos : end;
+}
+
+void appendUTF8(std::string& out, unsigned int codePoint) {
+    if (codePoint < 0x80) {
+        out.push_back(static_cast<char>(codePoint));
+    } else if (codePoint < 0x800) {
+        out.push_back(static_cast<char>(0xC0 | (codePoint >> 6)));
+        out.push_back(static_cast<char>(0x80 | (codePoint & 0x3F)));
+    } else if (codePoint < 0x10000) {
+        out.push_back(static_cast<char>(0xE0 | (codePoint >> 12)));
+        out.push_back(static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F)));
+        out.push_back(static_cast<char>(0x80 | (codePoint & 0x3F)));
+    } else {
+        out.push_back(static_cast<char>(0xF0 | (codePoint >> 18)));
+        out.push_back(static_cast<char>(0x80 | ((codePoint >> 12) & 0x3F)));
+        out.push_back(static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F)));
+        out.push_back(static_cast<char>(0x80 | (codePoint & 0x3F)));
+    }
+}
+
+bool parseHex4(std::string_view str, size_t pos, unsigned int& value) {
+    if (pos + 4 > str.length()) return false;
+    value = 0;
+    for (size_t i = pos; i < pos + 4; i++) {
+        char c = str[i];
+        value <<= 4;
+        if (c >= '0' && c <= '9') value |= static_cast<unsigned int>(c - '0');
+        else if (c >= 'a' && c <= 'f') value |= static_cast<unsigned int>(c - 'a' + 10);
+        else if (c >= 'A' && c <= 'F') value |= static_cast<unsigned int>(c - 'A' + 10);
+        else return false;
+    }
+    return true;
+}
+
+}  // namespace
+
+bool unquoteJSONString(const std::string& literal, std::string& result) {
+    size_t begin = skipWhitespace(literal, 0);
+    size_t end = literal.find_last_not_of(" \t\n\r");
+    if (begin >= literal.length() || end == std::string::npos || end <= begin ||
+        literal[begin] != '"' || literal[end] != '"') {
+        return false;
+    }
+
+    result.clear();
+    result.reserve(end - begin - 1);
+    return appendUnescapedJSONString(
+        std::string_view(literal).substr(begin + 1, end - begin - 1), result);
+}
+
+bool appendUnescapedJSONString(std::string_view content, std::string& out) {
+    size_t end = content.length();
+    for (size_t i = 0; i < end; i++) {
+        char c = content[i];
+        if (c != '\\') {
+            out.push_back(c);
+            continue;
+        }
+
+        if (++i >= end) return false;
+        switch (content[i]) {
+            case '"':  out.push_back('"'); break;
+            case '\\': out.push_back('\\'); break;
+            case '/':  out.push_back('/'); break;
+            case 'b':  out.push_back('\b'); break;
+            case 'f':  out.push_back('\f'); break;
+            case 'n':  out.push_back('\n'); break;
+            case 'r':  out.push_back('\r'); break;
+            case 't':  out.push_back('\t'); break;
+            case 'u': {
+                unsigned int codePoint;
+                if (!parseHex4(content, i + 1, codePoint)) return false;
+                i += 4;
+                // 代理对：\uD83D\uDE00
+                if (codePoint >= 0xD800 && codePoint <= 0xDBFF && i + 6 < end &&
+                    content[i + 1] == '\\' && content[i + 2] == 'u') {
+                    unsigned int low;
+                    if (parseHex4(content, i + 3, low) && low >= 0xDC00 && low <= 0xDFFF) {
+                        codePoint = 0x10000 + ((codePoint - 0xD800) << 10) + (low - 0xDC00);
+                        i += 6;
+                    }
+                }
+                appendUTF8(out, codePoint);
+                break;
+            }
+            default:
+                return false;
+        }
+    }
+    return true;
+}
+
+bool splitJSONArray(const std::string& json, std::vector<std::string>& elements) {
+    elements.clear();
+    size_t pos = skipWhitespace(json, 0);
+    if (pos >= json.length() || json[pos] != '[') return false;
+
+    pos = skipWhitespace(json, pos + 1);
+    if (pos < json.length() && json[pos] == ']') return true;
+
+    while (pos < json.length()) {
+        size_t end = skipJSONValue(json, pos);
+        if (end == std::string::npos) return false;
+        elements.push_back(json.substr(pos, end - pos));
+
+        pos = skipWhitespace(json, end);
+        if (pos >= json.length()) return false;
+        if (json[pos] == ']') return true;
+        if (json[pos] != ',') return false;
+        pos = skipWhitespace(json, pos + 1);
+    }
+    return false;
+}
+
+bool splitJSONObject(const std::string& json,
+                     std::vector<std::pair<std::string, std::string>>& fields) {
+    fields.clear();
+    size_t pos = skipWhitespace(json, 0);
+    if (pos >= json.length() || json[pos] != '{') return false;
+
+    pos = skipWhitespace(json, pos + 1);
+    if (pos < json.length() && json[pos] == '}') return true;
+
+    while (pos < json.length()) {
+        if (json[pos] != '"') return false;
+        size_t keyEnd = skipJSONValue(json, pos);
+        if (keyEnd == std::string::npos) return false;
+
+        std::string key;
+        if (!unquoteJSONString(json.substr(pos, keyEnd - pos), key)) return false;
+
+        pos = skipWhitespace(json, keyEnd);
+        if (pos >= json.length() || json[pos] != ':') return false;
+        pos = skipWhitespace(json, pos + 1);
+
+        size_t valueEnd = skipJSONValue(json, pos);
+        if (valueEnd == std::string::npos) return false;
+        fields.emplace_back(std::move(key), json.substr(pos, valueEnd - pos));
+
+        pos = skipWhitespace(json, valueEnd);
+        if (pos >= json.length()) return false;
+        if (json[pos] == '}') return true;
+        if (json[pos] != ',') return false;
+        pos = skipWhitespace(json, pos + 1);
+    }
+    return false;
+}
+
+std::string formatJSONNumber(double value) {
+    if (!std::isfinite(value)) return "null";
+    char buffer[32];
+    for (int precision = 15; precision <= 17; ++precision) {
+        std::snprintf(buffer, sizeof(buffer), "%.*g", precision, value);
+        if (std::strtod(buffer, nullptr) == value) break;
+    }
+    return buffer;
+}
+
 // === 核心解析方法 ===
 
-mini_rn::bridge::BridgeMessage SimpleBridgeJSONParser::parseBridgeQueue(const std::string& jsonStr) {
+void SimpleBridgeJSONParser::parseBridgeQueue(const std::string& jsonStr,
+                                              mini_rn::bridge::BridgeMessage& message) {
     std::cout << "[JSONParser] Parsing Bridge queue JSON: " << jsonStr.substr(0, 100)
               << (jsonStr.length() > 100 ? "..." : "") << std::endl;
 
-    mini_rn::bridge::BridgeMessage message;
-
     try {
         // 去除空白字符
         std::string trimmedStr = trim(jsonStr);
@@ -43,19 +289,26 @@ mini_rn::bridge::BridgeMessage SimpleBridgeJSONParser::parseBridgeQueue(const st
 
         // 解析每个数组
         // 数组0：moduleIds（整数数组）
-        message.moduleIds = parseIntArray(topLevelArrays[0]);
+        std::vector<int> moduleIds = parseIntArray(topLevelArrays[0]);
+        message.moduleIds.assign(moduleIds.begin(), moduleIds.end());
         std::cout << "[JSONParser] Parsed moduleIds: " << message.moduleIds.size() << " elements" << std::endl;
 
         // 数组1：methodIds（整数数组）
-        message.methodIds = parseIntArray(topLevelArrays[1]);
+        std::vector<int> methodIds = parseIntArray(topLevelArrays[1]);
+        message.methodIds.assign(methodIds.begin(), methodIds.end());
         std::cout << "[JSONParser] Parsed methodIds: " << message.methodIds.size() << " elements" << std::endl;
 
         // 数组2：params（字符串数组，可能包含嵌套结构）
-        message.params = parseStringArray(topLevelArrays[2]);
+        // 参数文本复制到消息的竞技场中
+        MonotonicArena& arena = *message.params.get_allocator().arena();
+        for (const auto& params : parseStringArray(topLevelArrays[2])) {
+            message.params.push_back(arena.copyString(params));
+        }
         std::cout << "[JSONParser] Parsed params: " << message.params.size() << " elements" << std::endl;
 
         // 数组3：callbackIds（整数数组，可能包含null/-1）
-        message.callbackIds = parseIntArray(topLevelArrays[3]);
+        std::vector<int> callbackIds = parseIntArray(topLevelArrays[3]);
+        message.callbackIds.assign(callbackIds.begin(), callbackIds.end());
         std::cout << "[JSONParser] Parsed callbackIds: " << message.callbackIds.size() << " elements" << std::endl;
 
         // 验证消息格式
@@ -66,8 +319,6 @@ mini_rn::bridge::BridgeMessage SimpleBridgeJSONParser::parseBridgeQueue(const st
         std::cout << "[JSONParser] Successfully parsed Bridge message with "
                   << message.getCallCount() << " calls" << std::endl;
 
-        return message;
-
     } catch (const std::exception& e) {
         std::cout << "[JSONParser] Error parsing JSON: " << e.what() << std::endl;
         throw;
@@ -339,7 +590,9 @@ long SimpleBridgeJSONParser::measureParsingTime(const std::string& jsonStr) {
     Timer timer;
 
     try {
-        parseBridgeQueue(jsonStr);
+        MonotonicArena arena;
+        mini_rn::bridge::BridgeMessage message(arena);
+        parseBridgeQueue(jsonStr, message);
         return timer.getElapsedMicroseconds();
     } catch (const std::exception& e) {
         std::cout << "[JSONParser] Performance test failed: " << e.what() << std::endl;
@@ -1,7 +1,10 @@
 #ifndef JSONPARSER_H
 #define JSONPARSER_H
 
+#include <chrono>
 #include <string>
+#include <string_view>
+#include <utility>
 #include <vector>
 
 // 前向声明Bridge消息结构（避免循环依赖）
@@ -14,6 +17,50 @@ struct BridgeMessage;
 namespace mini_rn {
 namespace utils {
 
+/**
+ * 将字符串编码为 JSON 字符串字面量（带引号，处理转义字符）
+ * @param str 原始字符串，如 hello "world"
+ * @return JSON 字符串字面量，如 "hello \"world\""
+ */
+std::string quoteJSONString(const std::string& str);
+
+/**
+ * 解析 JSON 字符串字面量（带引号，处理转义字符，\uXXXX 转为 UTF-8）
+ * @param literal JSON 字符串字面量，如 "hello \"world\""
+ * @param result 输出参数：原始字符串，如 hello "world"
+ * @return 不是合法的字符串字面量时返回 false
+ */
+bool unquoteJSONString(const std::string& literal, std::string& result);
+
+/**
+ * 反转义 JSON 字符串内容（不带引号），结果追加到 out 末尾
+ * @return 含有非法转义时返回 false
+ */
+bool appendUnescapedJSONString(std::string_view content, std::string& out);
+
+/**
+ * 拆分 JSON 数组的顶层元素，不解析元素内部
+ * @param json 数组文本，如 [3,"RCTView",{"flex":1}]
+ * @param elements 输出参数：每个元素的原始 JSON 文本，如 3、"RCTView"、{"flex":1}
+ * @return 不是合法的数组格式时返回 false
+ */
+bool splitJSONArray(const std::string& json, std::vector<std::string>& elements);
+
+/**
+ * 拆分 JSON 对象的顶层字段，不解析字段值内部
+ * @param json 对象文本，如 {"flex":1,"style":{"width":10}}
+ * @param fields 输出参数：（字段名, 字段值的原始 JSON 文本），字段名已反转义
+ * @return 不是合法的对象格式时返回 false
+ */
+bool splitJSONObject(const std::string& json,
+                     std::vector<std::pair<std::string, std::string>>& fields);
+
+/**
+ * 将数字编码为 JSON 数字（与 JSON.stringify 一致：整数不带小数点，
+ * 其余取能还原为同一 double 的最短表示，NaN / Infinity 编码为 null）
+ */
+std::string formatJSONNumber(double value);
+
 /**
  * SimpleBridgeJSONParser - 专门用于解析React Native Bridge消息的简化JSON解析器
  *
@@ -33,6 +80,9 @@ namespace utils {
  * - 嵌套对象：{key: value}
  * - 深层嵌套数组
  * - 特殊字符转义
+ *
+ * JSExecutor 刷新队列已改用完整的 JSONDocument（见 JSONDocument.h），
+ * 这里保留作为对照实现，供 benchmark_bridge 比较。
  */
 class SimpleBridgeJSONParser {
 public:
@@ -40,7 +90,7 @@ public:
      * 解析Bridge队列JSON字符串为BridgeMessage结构
      *
      * @param jsonStr JSON字符串，格式：[[1,2],[3,4],[["hello"],[]]],[100,-1]]
-     * @return BridgeMessage 解析后的Bridge消息结构
+     * @param message 输出参数：空的 BridgeMessage，参数文本复制到它的竞技场中
      * @throws std::runtime_error 解析失败时抛出异常
      *
      * 示例输入：
@@ -52,7 +102,8 @@ public:
      * - params: [["hello","world"], []]
      * - callbackIds: [100, -1]
      */
-    static mini_rn::bridge::BridgeMessage parseBridgeQueue(const std::string& jsonStr);
+    static void parseBridgeQueue(const std::string& jsonStr,
+                                 mini_rn::bridge::BridgeMessage& message);
 
     /**
      * 性能测量相关方法（学习用）
@@ -0,0 +1,502 @@
+#include "LogStructuredStore.h"
+
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstring>
+#include <iostream>
+#include <utility>
+
+namespace mini_rn {
+namespace utils {
+
+namespace {
+
+constexpr char kMagic[8] = {'M', 'R', 'N', 'K', 'V', 'L', 'G', '1'};
+constexpr size_t kFrameHeaderBytes = 8;   // 长度 + CRC32
+constexpr size_t kRecordHeaderBytes = 9;  // 类型 + key 长度 + value 长度
+// 压缩时每写满这么多字节就结束一帧并落盘，不在内存中拼出整个文件
+constexpr size_t kCompactionFrameBytes = 1 << 20;
+
+enum RecordType : uint8_t { kRecordSet = 1, kRecordRemove = 2 };
+
+uint32_t crc32(const char* data, size_t length) {
+    static const auto table = [] {
+        std::vector<uint32_t> values(256);
+        for (uint32_t i = 0; i < 256; ++i) {
+            uint32_t c = i;
+            for (int bit = 0; bit < 8; ++bit) {
+                c = (c & 1) ? 0xEDB88320u ^ (c >> 1) : c >> 1;
+            }
+            values[i] = c;
+        }
+        return values;
+    }();
+
+    uint32_t crc = 0xFFFFFFFFu;
+    for (size_t i = 0; i < length; ++i) {
+        crc = table[(crc ^ static_cast<uint8_t>(data[i])) & 0xFF] ^ (crc >> 8);
+    }
+    return crc ^ 0xFFFFFFFFu;
+}
+
+void appendU32(std::string& out, uint32_t value) {
+    out.append(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+uint32_t readU32(const char* data) {
+    uint32_t value;
+    std::memcpy(&value, data, sizeof(value));
+    return value;
+}
+
+/**
+ * 开始一帧：预留帧头，返回帧头位置
+ */
+size_t beginFrame(std::string& buffer) {
+    size_t start = buffer.size();
+    buffer.append(kFrameHeaderBytes, '\0');
+    return start;
+}
+
+/**
+ * 结束一帧：回填 payload 长度和 CRC32
+ */
+void endFrame(std::string& buffer, size_t start) {
+    const char* payload = buffer.data() + start + kFrameHeaderBytes;
+    uint32_t length = static_cast<uint32_t>(buffer.size() - start - kFrameHeaderBytes);
+    uint32_t crc = crc32(payload, length);
+    std::memcpy(&buffer[start], &length, sizeof(length));
+    std::memcpy(&buffer[start + 4], &crc, sizeof(crc));
+}
+
+/**
+ * 追加一条记录，返回 value 在 buffer 中的偏移
+ */
+size_t appendRecord(std::string& buffer, RecordType type, std::string_view key,
+                    std::string_view value) {
+    buffer.push_back(static_cast<char>(type));
+    appendU32(buffer, static_cast<uint32_t>(key.size()));
+    appendU32(buffer, static_cast<uint32_t>(value.size()));
+    buffer.append(key.data(), key.size());
+    size_t valueOffset = buffer.size();
+    buffer.append(value.data(), value.size());
+    return valueOffset;
+}
+
+bool writeAll(int fd, const std::string& buffer, uint64_t offset) {
+    size_t written = 0;
+    while (written < buffer.size()) {
+        ssize_t n = pwrite(fd, buffer.data() + written, buffer.size() - written,
+                           static_cast<off_t>(offset + written));
+        if (n < 0 && errno == EINTR) continue;
+        if (n <= 0) return false;
+        written += static_cast<size_t>(n);
+    }
+    return true;
+}
+
+/**
+ * 把文件内容刷到存储设备
+ * macOS 上 fsync 只保证交给磁盘，F_FULLFSYNC 才会刷掉磁盘自身的写缓存
+ */
+bool syncFile(int fd) {
+#ifdef __APPLE__
+    if (fcntl(fd, F_FULLFSYNC) == 0) return true;
+#endif
+    return fsync(fd) == 0;
+}
+
+/**
+ * rename 之后同步所在目录，保证目录项的替换也已落盘
+ */
+void syncDirectory(const std::string& path) {
+    size_t slash = path.rfind('/');
+    std::string directory = slash == std::string::npos ? "." : path.substr(0, slash);
+    if (directory.empty()) directory = "/";
+    int fd = ::open(directory.c_str(), O_RDONLY);
+    if (fd >= 0) {
+        fsync(fd);
+        ::close(fd);
+    }
+}
+
+/**
+ * 遍历一帧 payload 中的记录
+ * @return payload 格式错误时返回 false（此时可能已经回调了前面的记录，
+ *         调用方应先以空回调校验一遍）
+ */
+template <typename Visit>
+bool forEachRecord(const char* payload, size_t length, Visit&& visit) {
+    size_t pos = 0;
+    while (pos < length) {
+        if (length - pos < kRecordHeaderBytes) return false;
+        uint8_t type = static_cast<uint8_t>(payload[pos]);
+        uint32_t keyLength = readU32(payload + pos + 1);
+        uint32_t valueLength = readU32(payload + pos + 5);
+        size_t recordBytes = kRecordHeaderBytes + size_t(keyLength) + valueLength;
+        if ((type != kRecordSet && type != kRecordRemove) ||
+            (type == kRecordRemove && valueLength != 0) || length - pos < recordBytes) {
+            return false;
+        }
+        std::string_view key(payload + pos + kRecordHeaderBytes, keyLength);
+        visit(type == kRecordRemove, key, pos + kRecordHeaderBytes + keyLength,
+              valueLength, static_cast<uint32_t>(recordBytes));
+        pos += recordBytes;
+    }
+    return true;
+}
+
+}  // namespace
+
+LogStructuredStore::LogStructuredStore(std::string path)
+    : LogStructuredStore(std::move(path), Options()) {}
+
+LogStructuredStore::LogStructuredStore(std::string path, Options options)
+    : m_path(std::move(path)), m_options(options) {}
+
+LogStructuredStore::~LogStructuredStore() {
+    if (m_ioThread.joinable()) {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_stopping = true;
+        }
+        m_wakeIO.notify_one();
+        m_ioThread.join();
+    }
+    if (m_fd >= 0) {
+        ::close(m_fd);
+    }
+}
+
+bool LogStructuredStore::open() {
+    if (isOpen()) return true;
+
+    m_fd = ::open(m_path.c_str(), O_RDWR | O_CREAT, 0644);
+    if (m_fd < 0) {
+        std::cout << "[LogStructuredStore] Error: Cannot open " << m_path << ": "
+                  << std::strerror(errno) << std::endl;
+        return false;
+    }
+
+    struct stat st;
+    if (fstat(m_fd, &st) != 0) {
+        ::close(m_fd);
+        m_fd = -1;
+        return false;
+    }
+    if (st.st_size == 0) {
+        std::string header(kMagic, sizeof(kMagic));
+        if (!writeAll(m_fd, header, 0) || !syncFile(m_fd)) {
+            ::close(m_fd);
+            m_fd = -1;
+            return false;
+        }
+    }
+
+    if (!recover()) {
+        std::cout << "[LogStructuredStore] Error: " << m_path
+                  << " is not a key-value log" << std::endl;
+        ::close(m_fd);
+        m_fd = -1;
+        return false;
+    }
+
+    m_ioThread = std::thread(&LogStructuredStore::ioLoop, this);
+    return true;
+}
+
+bool LogStructuredStore::recover() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (!remap()) return false;
+
+    const char* data = m_mapping.data();
+    size_t size = m_mapping.size();
+    if (size < sizeof(kMagic) || std::memcmp(data, kMagic, sizeof(kMagic)) != 0) {
+        return false;
+    }
+
+    auto validate = [](bool, std::string_view, size_t, uint32_t, uint32_t) {};
+    size_t pos = sizeof(kMagic);
+    while (size - pos >= kFrameHeaderBytes) {
+        uint32_t length = readU32(data + pos);
+        uint32_t crc = readU32(data + pos + 4);
+        const char* payload = data + pos + kFrameHeaderBytes;
+        if (size - pos - kFrameHeaderBytes < length || crc32(payload, length) != crc ||
+            !forEachRecord(payload, length, validate)) {
+            break;
+        }
+
+        uint64_t payloadOffset = pos + kFrameHeaderBytes;
+        forEachRecord(payload, length,
+                      [&](bool remove, std::string_view key, size_t valueOffset,
+                          uint32_t valueLength, uint32_t recordBytes) {
+                          applyRecord(key, remove,
+                                      Location{payloadOffset + valueOffset, valueLength,
+                                               recordBytes});
+                      });
+        pos += kFrameHeaderBytes + length;
+    }
+
+    // 不完整的尾部：上次写入过程中崩溃，整帧丢弃
+    if (pos < size) {
+        m_stats.recoveredBytes = size - pos;
+        std::cout << "[LogStructuredStore] Discarding " << (size - pos)
+                  << " bytes of incomplete log tail in " << m_path << std::endl;
+        if (ftruncate(m_fd, static_cast<off_t>(pos)) != 0 || !remap()) {
+            return false;
+        }
+    }
+
+    m_fileSize = pos;
+    m_stats.fileBytes = pos;
+    return true;
+}
+
+bool LogStructuredStore::get(std::string_view key, std::string& value) const {
+    std::string keyString(key);
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    auto pending = m_pending.find(keyString);
+    if (pending != m_pending.end()) {
+        if (!pending->second.value->has_value()) return false;
+        value = **pending->second.value;
+        return true;
+    }
+
+    auto it = m_index.find(keyString);
+    if (it == m_index.end() ||
+        it->second.offset + it->second.length > m_mapping.size()) {
+        return false;
+    }
+    value.assign(m_mapping.data() + it->second.offset, it->second.length);
+    return true;
+}
+
+std::vector<std::string> LogStructuredStore::keys() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    std::vector<std::string> result;
+    result.reserve(m_index.size() + m_pending.size());
+    for (const auto& entry : m_index) {
+        auto pending = m_pending.find(entry.first);
+        if (pending == m_pending.end() || pending->second.value->has_value()) {
+            result.push_back(entry.first);
+        }
+    }
+    for (const auto& entry : m_pending) {
+        if (entry.second.value->has_value() && m_index.count(entry.first) == 0) {
+            result.push_back(entry.first);
+        }
+    }
+    return result;
+}
+
+uint64_t LogStructuredStore::write(WriteBatch batch) {
+    if (!isOpen()) return 0;
+
+    auto job = std::make_unique<Job>();
+    job->batch = std::move(batch);
+    uint64_t sequence;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        sequence = job->sequence = ++m_nextSequence;
+        for (const Write& write : job->batch) {
+            m_pending[write.key] = Pending{sequence, &write.value};
+        }
+        m_queue.push_back(std::move(job));
+    }
+    m_wakeIO.notify_one();
+    return sequence;
+}
+
+std::vector<LogStructuredStore::Completion> LogStructuredStore::takeCompletions() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    std::vector<Completion> completions;
+    completions.swap(m_completions);
+    return completions;
+}
+
+void LogStructuredStore::flush() {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    if (!m_ioThread.joinable()) return;
+    uint64_t target = m_nextSequence;
+    m_committed.wait(lock, [&] { return m_committedSequence >= target; });
+}
+
+LogStructuredStore::Stats LogStructuredStore::getStats() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    Stats stats = m_stats;
+    stats.keys = m_index.size();
+    return stats;
+}
+
+void LogStructuredStore::ioLoop() {
+    std::vector<std::unique_ptr<Job>> jobs;
+    while (true) {
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_wakeIO.wait(lock, [&] { return m_stopping || !m_queue.empty(); });
+            if (m_queue.empty()) break;
+            // 取出队列中的全部批次，合并为一次组提交
+            jobs.swap(m_queue);
+        }
+        commit(jobs);
+        jobs.clear();
+        compactIfNeeded();
+    }
+}
+
+void LogStructuredStore::commit(std::vector<std::unique_ptr<Job>>& jobs) {
+    // 每个批次一帧，所有帧一次写入、一次 fsync
+    m_writeBuffer.clear();
+    m_locations.clear();
+    for (const auto& job : jobs) {
+        size_t frame = beginFrame(m_writeBuffer);
+        for (const Write& write : job->batch) {
+            size_t before = m_writeBuffer.size();
+            std::string_view value = write.value ? std::string_view(*write.value)
+                                                 : std::string_view();
+            size_t valueOffset = appendRecord(
+                m_writeBuffer, write.value ? kRecordSet : kRecordRemove, write.key, value);
+            m_locations.push_back(Location{m_fileSize + valueOffset,
+                                           static_cast<uint32_t>(value.size()),
+                                           static_cast<uint32_t>(m_writeBuffer.size() - before)});
+        }
+        endFrame(m_writeBuffer, frame);
+    }
+
+    bool ok = writeAll(m_fd, m_writeBuffer, m_fileSize) &&
+              (!m_options.syncWrites || syncFile(m_fd));
+    if (ok) {
+        m_fileSize += m_writeBuffer.size();
+    } else {
+        std::cout << "[LogStructuredStore] Error: Write to " << m_path
+                  << " failed: " << std::strerror(errno) << std::endl;
+        // 丢弃可能写了一半的帧，保证下次追加从完整的帧边界开始
+        if (ftruncate(m_fd, static_cast<off_t>(m_fileSize)) != 0) {
+            std::cout << "[LogStructuredStore] Error: Cannot truncate " << m_path << std::endl;
+        }
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        ok = ok && remap();
+
+        size_t location = 0;
+        for (const auto& job : jobs) {
+            for (const Write& write : job->batch) {
+                if (ok) applyRecord(write.key, !write.value, m_locations[location++]);
+                // 之后又有新的写入时，待提交表中保留较新的那一条
+                auto pending = m_pending.find(write.key);
+                if (pending != m_pending.end() && pending->second.sequence == job->sequence) {
+                    m_pending.erase(pending);
+                }
+            }
+            m_completions.push_back(Completion{job->sequence, ok});
+        }
+
+        m_committedSequence = jobs.back()->sequence;
+        m_stats.batches += jobs.size();
+        m_stats.groupCommits++;
+        m_stats.fileBytes = m_fileSize;
+    }
+    m_committed.notify_all();
+}
+
+void LogStructuredStore::compactIfNeeded() {
+    // m_index、m_mapping 和 m_stats 只由本线程修改，读取不需要加锁
+    size_t garbage = m_fileSize - m_stats.liveBytes;
+    if (m_fileSize < m_options.compactionMinBytes ||
+        garbage < m_options.compactionGarbageRatio * m_fileSize) {
+        return;
+    }
+
+    std::string temporaryPath = m_path + ".compact";
+    int fd = ::open(temporaryPath.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+    if (fd < 0) return;
+
+    // 存活记录按索引的遍历顺序写入，新位置按同样的顺序记录
+    m_writeBuffer.assign(kMagic, sizeof(kMagic));
+    m_locations.clear();
+    uint64_t flushed = 0;
+    bool ok = true;
+    size_t frame = beginFrame(m_writeBuffer);
+    for (const auto& entry : m_index) {
+        std::string_view value(m_mapping.data() + entry.second.offset, entry.second.length);
+        size_t before = m_writeBuffer.size();
+        size_t valueOffset = appendRecord(m_writeBuffer, kRecordSet, entry.first, value);
+        m_locations.push_back(Location{flushed + valueOffset, entry.second.length,
+                                       static_cast<uint32_t>(m_writeBuffer.size() - before)});
+
+        if (m_writeBuffer.size() >= kCompactionFrameBytes) {
+            endFrame(m_writeBuffer, frame);
+            ok = ok && writeAll(fd, m_writeBuffer, flushed);
+            flushed += m_writeBuffer.size();
+            m_writeBuffer.clear();
+            frame = beginFrame(m_writeBuffer);
+        }
+    }
+    endFrame(m_writeBuffer, frame);
+    ok = ok && writeAll(fd, m_writeBuffer, flushed) && syncFile(fd);
+    flushed += m_writeBuffer.size();
+
+    if (!ok) {
+        ::close(fd);
+        unlink(temporaryPath.c_str());
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (rename(temporaryPath.c_str(), m_path.c_str()) != 0) {
+            ::close(fd);
+            unlink(temporaryPath.c_str());
+            return;
+        }
+        ::close(m_fd);
+        m_fd = fd;
+        m_fileSize = flushed;
+        remap();
+
+        size_t location = 0;
+        size_t liveBytes = 0;
+        for (auto& entry : m_index) {
+            entry.second = m_locations[location++];
+            liveBytes += entry.second.recordBytes;
+        }
+        m_stats.liveBytes = liveBytes;
+        m_stats.fileBytes = m_fileSize;
+        m_stats.compactions++;
+    }
+    syncDirectory(m_path);
+
+    std::cout << "[LogStructuredStore] Compacted " << m_path << " to " << m_fileSize
+              << " bytes" << std::endl;
+}
+
+bool LogStructuredStore::remap() {
+    return m_mapping.open(m_path, MappedFile::Access::Random);
+}
+
+void LogStructuredStore::applyRecord(std::string_view key, bool remove,
+                                     const Location& location) {
+    auto it = m_index.find(std::string(key));
+    if (it != m_index.end()) {
+        m_stats.liveBytes -= it->second.recordBytes;
+        if (remove) {
+            m_index.erase(it);
+        } else {
+            it->second = location;
+            m_stats.liveBytes += location.recordBytes;
+        }
+    } else if (!remove) {
+        m_index.emplace(std::string(key), location);
+        m_stats.liveBytes += location.recordBytes;
+    }
+}
+
+}  // namespace utils
+}  // namespace mini_rn
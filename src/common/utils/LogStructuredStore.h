@@ -0,0 +1,193 @@
+#ifndef LOGSTRUCTUREDSTORE_H
+#define LOGSTRUCTUREDSTORE_H
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include "MappedFile.h"
+
+namespace mini_rn {
+namespace utils {
+
+/**
+ * LogStructuredStore - 追加写日志 + 内存哈希索引的持久化键值存储
+ *
+ * 文件格式（单个数据文件，字节序与本机一致）：
+ * - 文件头：8 字节魔数
+ * - 之后是若干帧：[payload 长度 u32][payload 的 CRC32 u32][payload]
+ * - payload 是一批记录：[类型 u8][key 长度 u32][value 长度 u32][key][value]，
+ *   类型为写入或删除（删除没有 value）
+ * 一次 write() 的所有记录在同一帧中，整帧校验通过才生效，多键写入是原子的。
+ * 打开时顺序扫描重建索引，遇到不完整或校验失败的帧（写到一半时崩溃）
+ * 就从该处截断。
+ *
+ * 读写路径：
+ * - 索引记录每个 key 的 value 在文件中的位置，读取直接从只读映射中拷贝
+ * - 写入由专门的 I/O 线程完成：调用方线程只把批次放进队列；I/O 线程每轮取出
+ *   队列中的全部批次，一次 write + 一次 fsync 提交（组提交），再更新索引
+ * - 尚未提交的写入保存在待提交表中，读取优先查它，调用方总能读到自己的写入
+ * - 提交结果通过 takeCompletions 取回，由调用方线程投递（如 JS 线程的 tick）
+ *
+ * 压缩：被覆盖或删除的记录占文件的比例超过阈值时，I/O 线程把存活记录写入
+ * 新文件，fsync 后原子地 rename 替换旧文件。
+ *
+ * 线程安全：除 open 外的公有方法都可以在任意线程调用。
+ */
+class LogStructuredStore {
+public:
+    /**
+     * 一条写入，value 为空表示删除
+     */
+    struct Write {
+        std::string key;
+        std::optional<std::string> value;
+    };
+    using WriteBatch = std::vector<Write>;
+
+    /**
+     * 一次 write() 的提交结果
+     */
+    struct Completion {
+        uint64_t sequence;
+        bool ok;  // 写入或 fsync 失败时为 false，此时批次不生效
+    };
+
+    struct Options {
+        bool syncWrites = true;              // 每次组提交后 fsync
+        size_t compactionMinBytes = 1 << 20;  // 文件小于此大小时不压缩
+        double compactionGarbageRatio = 0.5;  // 无效记录占比超过此值时压缩
+    };
+
+    struct Stats {
+        size_t keys = 0;            // 已提交的 key 数
+        size_t fileBytes = 0;       // 数据文件大小
+        size_t liveBytes = 0;       // 存活记录的字节数
+        size_t batches = 0;         // 提交的 write() 批次数
+        size_t groupCommits = 0;    // 组提交次数（每次一个 fsync）
+        size_t compactions = 0;     // 压缩次数
+        size_t recoveredBytes = 0;  // 打开时截断的不完整尾部字节数
+    };
+
+    explicit LogStructuredStore(std::string path);
+    LogStructuredStore(std::string path, Options options);
+
+    /**
+     * 等待队列中的写入全部提交后停止 I/O 线程
+     */
+    ~LogStructuredStore();
+
+    LogStructuredStore(const LogStructuredStore&) = delete;
+    LogStructuredStore& operator=(const LogStructuredStore&) = delete;
+
+    /**
+     * 打开（不存在时创建）数据文件，重建索引并启动 I/O 线程
+     * @return 文件无法创建或不是本格式时返回 false
+     */
+    bool open();
+
+    bool isOpen() const { return m_ioThread.joinable(); }
+    const std::string& getPath() const { return m_path; }
+
+    /**
+     * 读取 key 的当前值（包括尚未提交的写入）
+     * @return key 不存在时返回 false
+     */
+    bool get(std::string_view key, std::string& value) const;
+
+    /**
+     * 当前所有 key（包括尚未提交的写入），顺序不确定
+     */
+    std::vector<std::string> keys() const;
+
+    /**
+     * 提交一个批次，立即返回；批次在一次组提交中原子地生效
+     * @return 批次序号，与 Completion::sequence 对应；未打开时返回 0
+     */
+    uint64_t write(WriteBatch batch);
+
+    /**
+     * 取出自上次调用以来完成的提交（按序号递增）
+     */
+    std::vector<Completion> takeCompletions();
+
+    /**
+     * 阻塞直到此前的所有写入都已提交
+     */
+    void flush();
+
+    Stats getStats() const;
+
+private:
+    struct Location {
+        uint64_t offset;       // value 在文件中的偏移
+        uint32_t length;       // value 长度
+        uint32_t recordBytes;  // 整条记录（含记录头和 key）的长度
+    };
+
+    /**
+     * 队列中的批次，提交前一直存活：待提交表中的 value 指向它
+     */
+    struct Job {
+        uint64_t sequence;
+        WriteBatch batch;
+    };
+
+    /**
+     * 尚未提交的写入
+     */
+    struct Pending {
+        uint64_t sequence;
+        const std::optional<std::string>* value;  // 指向 Job 中的 value
+    };
+
+    // === 以下只在 I/O 线程（或 open 时）调用 ===
+    void ioLoop();
+    bool recover();
+    void commit(std::vector<std::unique_ptr<Job>>& jobs);
+    void compactIfNeeded();
+    bool remap();
+    // 以下函数修改索引，要求持有 m_mutex
+    void applyRecord(std::string_view key, bool remove, const Location& location);
+
+    std::string m_path;
+    Options m_options;
+
+    mutable std::mutex m_mutex;
+    std::condition_variable m_wakeIO;
+    std::condition_variable m_committed;
+
+    // 受 m_mutex 保护；I/O 线程是唯一的修改者，自身读取时不需要加锁
+    std::unordered_map<std::string, Location> m_index;
+    MappedFile m_mapping;
+
+    // 受 m_mutex 保护
+    std::unordered_map<std::string, Pending> m_pending;
+    std::vector<std::unique_ptr<Job>> m_queue;
+    std::vector<Completion> m_completions;
+    uint64_t m_nextSequence = 0;
+    uint64_t m_committedSequence = 0;
+    bool m_stopping = false;
+    Stats m_stats;
+
+    // 只由 I/O 线程使用
+    int m_fd = -1;
+    uint64_t m_fileSize = 0;
+    std::string m_writeBuffer;
+    std::vector<Location> m_locations;
+
+    std::thread m_ioThread;
+};
+
+}  // namespace utils
+}  // namespace mini_rn
+
+#endif  // LOGSTRUCTUREDSTORE_H
@@ -0,0 +1,49 @@
+#ifndef LOGGING_H
+#define LOGGING_H
+
+#include <iostream>
+
+/**
+ * 构建模式与编译期日志级别
+ *
+ * MINI_RN_DEV：开发模式标志，决定注入 JS 的 __DEV__。CMake 按构建类型定义
+ * （Debug 或未指定构建类型为 1，其余为 0）；没有定义时跟随 NDEBUG。
+ *
+ * MINI_RN_LOG_LEVEL：编译期日志级别。低于该级别的 MINI_RN_LOG 在编译时被去掉，
+ * 消息表达式也不会求值，Bridge 每次调用打印的跟踪日志在发布构建中没有任何开销。
+ * 开发模式默认 DEBUG，发布模式默认 WARNING。
+ *
+ * 错误和警告直接写 std::cout，不经过这里，任何构建中都会输出。
+ *
+ * 使用示例：
+ *   MINI_RN_LOG(DEBUG, "[JSExecutor] Sync call - Module: " << moduleId);
+ */
+
+#define MINI_RN_LOG_LEVEL_DEBUG 0
+#define MINI_RN_LOG_LEVEL_INFO 1
+#define MINI_RN_LOG_LEVEL_WARNING 2
+
+#ifndef MINI_RN_DEV
+#ifdef NDEBUG
+#define MINI_RN_DEV 0
+#else
+#define MINI_RN_DEV 1
+#endif
+#endif
+
+#ifndef MINI_RN_LOG_LEVEL
+#if MINI_RN_DEV
+#define MINI_RN_LOG_LEVEL MINI_RN_LOG_LEVEL_DEBUG
+#else
+#define MINI_RN_LOG_LEVEL MINI_RN_LOG_LEVEL_WARNING
+#endif
+#endif
+
+#define MINI_RN_LOG(level, message)                             \
+    do {                                                        \
+        if (MINI_RN_LOG_LEVEL_##level >= MINI_RN_LOG_LEVEL) {   \
+            std::cout << message << std::endl;                  \
+        }                                                       \
+    } while (0)
+
+#endif  // LOGGING_H
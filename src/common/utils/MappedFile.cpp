@@ -0,0 +1,95 @@
+#include "MappedFile.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <utility>
+
+namespace mini_rn {
+namespace utils {
+
+MappedFile::~MappedFile() { close(); }
+
+MappedFile::MappedFile(MappedFile&& other) noexcept
+    : m_data(std::exchange(other.m_data, nullptr)),
+      m_size(std::exchange(other.m_size, 0)),
+      m_modifiedTimeNs(std::exchange(other.m_modifiedTimeNs, 0)),
+      m_isOpen(std::exchange(other.m_isOpen, false)) {}
+
+MappedFile& MappedFile::operator=(MappedFile&& other) noexcept {
+    if (this != &other) {
+        close();
+        m_data = std::exchange(other.m_data, nullptr);
+        m_size = std::exchange(other.m_size, 0);
+        m_modifiedTimeNs = std::exchange(other.m_modifiedTimeNs, 0);
+        m_isOpen = std::exchange(other.m_isOpen, false);
+    }
+    return *this;
+}
+
+bool MappedFile::open(const std::string& path, Access access) {
+    close();
+
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        return false;
+    }
+
+    struct stat st;
+    if (fstat(fd, &st) != 0 || !S_ISREG(st.st_mode)) {
+        ::close(fd);
+        return false;
+    }
+
+#ifdef __APPLE__
+    m_modifiedTimeNs = static_cast<long long>(st.st_mtimespec.tv_sec) *
+                           1000000000LL +
+                       st.st_mtimespec.tv_nsec;
+#else
+    m_modifiedTimeNs =
+        static_cast<long long>(st.st_mtim.tv_sec) * 1000000000LL +
+        st.st_mtim.tv_nsec;
+#endif
+
+    m_size = static_cast<size_t>(st.st_size);
+    if (m_size > 0) {
+        void* addr = mmap(nullptr, m_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (addr == MAP_FAILED) {
+            ::close(fd);
+            m_size = 0;
+            return false;
+        }
+        m_data = addr;
+        // bundle 会被引擎从头到尾顺序扫描一遍；随机读取时关闭预读
+        madvise(m_data, m_size,
+                access == Access::Sequential ? MADV_SEQUENTIAL : MADV_RANDOM);
+    }
+
+    // 映射建立后即可关闭文件描述符，映射本身保持有效
+    ::close(fd);
+    m_isOpen = true;
+    return true;
+}
+
+void MappedFile::close() {
+    if (m_data) {
+        munmap(m_data, m_size);
+    }
+    m_data = nullptr;
+    m_size = 0;
+    m_modifiedTimeNs = 0;
+    m_isOpen = false;
+}
+
+bool MappedFile::isNullTerminated() const {
+    if (!m_data) {
+        return false;
+    }
+    size_t pageSize = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    return m_size % pageSize != 0;
+}
+
+}  // namespace utils
+}  // namespace mini_rn
@@ -0,0 +1,78 @@
+#ifndef MAPPEDFILE_H
+#define MAPPEDFILE_H
+
+#include <cstddef>
+#include <string>
+
+namespace mini_rn {
+namespace utils {
+
+/**
+ * MappedFile - 只读内存映射文件（RAII）
+ *
+ * 用于加载 JS bundle 等大文件：内容直接映射到进程地址空间，
+ * 不经过 ifstream + ostringstream + std::string 的多次堆拷贝。
+ * 映射页由文件背书，内存紧张时内核可以直接丢弃再按需读回。
+ *
+ * 仅支持 POSIX 平台（macOS / iOS / Android）。
+ */
+class MappedFile {
+public:
+    MappedFile() = default;
+    ~MappedFile();
+
+    // 禁用拷贝，允许移动
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+    MappedFile(MappedFile&& other) noexcept;
+    MappedFile& operator=(MappedFile&& other) noexcept;
+
+    /**
+     * 访问方式提示（madvise），影响内核的预读策略
+     */
+    enum class Access {
+        Sequential,  // 从头到尾扫描一遍，如 JS bundle
+        Random,      // 按偏移随机读取，如键值存储的数据段
+    };
+
+    /**
+     * 以只读方式映射文件
+     * @param path 文件路径
+     * @param access 访问方式提示
+     * @return 成功返回 true；空文件也视为成功（data() 返回 nullptr）
+     */
+    bool open(const std::string& path, Access access = Access::Sequential);
+
+    /**
+     * 解除映射
+     */
+    void close();
+
+    bool isOpen() const { return m_isOpen; }
+    const char* data() const { return static_cast<const char*>(m_data); }
+    size_t size() const { return m_size; }
+
+    /**
+     * 映射区在文件内容之后是否紧跟 '\0'
+     *
+     * 文件长度不是页大小整数倍时，最后一页的剩余部分由内核补零，
+     * 此时 data() 可以直接当作 C 字符串使用，无需再拷贝一份补结尾符。
+     */
+    bool isNullTerminated() const;
+
+    /**
+     * 文件最后修改时间（纳秒），用于判断派生缓存是否过期
+     */
+    long long modifiedTimeNs() const { return m_modifiedTimeNs; }
+
+private:
+    void* m_data = nullptr;
+    size_t m_size = 0;
+    long long m_modifiedTimeNs = 0;
+    bool m_isOpen = false;
+};
+
+}  // namespace utils
+}  // namespace mini_rn
+
+#endif  // MAPPEDFILE_H
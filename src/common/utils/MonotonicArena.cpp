@@ -0,0 +1,68 @@
+#include "MonotonicArena.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace mini_rn {
+namespace utils {
+
+namespace {
+
+constexpr size_t kMinBlockSize = 4096;
+
+}  // namespace
+
+MonotonicArena::MonotonicArena(size_t initialCapacity) {
+    if (initialCapacity > 0) {
+        addBlock(initialCapacity);
+    }
+}
+
+void* MonotonicArena::allocate(size_t size, size_t alignment) {
+    auto current = reinterpret_cast<uintptr_t>(m_cursor);
+    uintptr_t aligned = (current + alignment - 1) & ~(uintptr_t(alignment) - 1);
+    if (m_cursor == nullptr || aligned + size > reinterpret_cast<uintptr_t>(m_end)) {
+        addBlock(size + alignment);
+        current = reinterpret_cast<uintptr_t>(m_cursor);
+        aligned = (current + alignment - 1) & ~(uintptr_t(alignment) - 1);
+    }
+
+    m_stats.used += aligned + size - current;
+    m_stats.peakUsed = std::max(m_stats.peakUsed, m_stats.used);
+    m_cursor = reinterpret_cast<unsigned char*>(aligned + size);
+    return reinterpret_cast<void*>(aligned);
+}
+
+std::string_view MonotonicArena::copyString(std::string_view text) {
+    if (text.empty()) return std::string_view();
+    char* data = static_cast<char*>(allocate(text.size(), 1));
+    std::memcpy(data, text.data(), text.size());
+    return std::string_view(data, text.size());
+}
+
+void MonotonicArena::reset() {
+    // 上一轮追加过块：合并成一个能容纳峰值用量的块，下一轮不再追加
+    if (m_blocks.size() > 1) {
+        size_t capacity = std::max(m_stats.capacity, m_stats.peakUsed);
+        m_blocks.clear();
+        m_stats.capacity = 0;
+        addBlock(capacity);
+    } else if (!m_blocks.empty()) {
+        m_cursor = m_blocks.front().data.get();
+        m_end = m_cursor + m_blocks.front().size;
+    }
+    m_stats.used = 0;
+}
+
+void MonotonicArena::addBlock(size_t minSize) {
+    // 块大小至少翻倍，一轮内追加的次数是对数级的
+    size_t size = std::max({minSize, m_stats.capacity, kMinBlockSize});
+    m_blocks.push_back(Block{std::unique_ptr<unsigned char[]>(new unsigned char[size]), size});
+    m_cursor = m_blocks.back().data.get();
+    m_end = m_cursor + size;
+    m_stats.capacity += size;
+    m_stats.blockAllocations++;
+}
+
+}  // namespace utils
+}  // namespace mini_rn
@@ -0,0 +1,122 @@
+#ifndef MONOTONICARENA_H
+#define MONOTONICARENA_H
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string_view>
+#include <vector>
+
+namespace mini_rn {
+namespace utils {
+
+/**
+ * MonotonicArena - 可复用的单调分配器
+ *
+ * 分配只移动指针，释放是空操作，reset() 一次性回收全部内存。
+ * 与 std::pmr::monotonic_buffer_resource 不同，reset 后保留已申请的块：
+ * 一次用量超过了当前容量时会追加新块，下次 reset 把它们合并成一个足够大的块，
+ * 之后同样规模的使用不再向系统申请内存。
+ *
+ * 典型用法是“每轮一次”的临时数据，例如 Bridge 每次刷新队列构造的 BridgeMessage：
+ * ```cpp
+ * {
+ *     ArenaVector<int> ids{ArenaAllocator<int>(arena)};
+ *     ids.reserve(callCount);
+ *     ...
+ * }
+ * arena.reset();  // 本轮分配的内存全部失效
+ * ```
+ *
+ * 非线程安全；reset 时不能还有存活的对象指向竞技场内存。
+ */
+class MonotonicArena {
+public:
+    /**
+     * 统计信息
+     */
+    struct Stats {
+        size_t blockAllocations = 0;  // 向系统申请块的累计次数
+        size_t capacity = 0;          // 当前持有的总字节数
+        size_t used = 0;              // 自上次 reset 以来分配的字节数（含对齐填充）
+        size_t peakUsed = 0;          // 历史最大单轮用量
+    };
+
+    /**
+     * @param initialCapacity 首个块的大小，0 表示第一次分配时再申请
+     */
+    explicit MonotonicArena(size_t initialCapacity = 0);
+
+    MonotonicArena(const MonotonicArena&) = delete;
+    MonotonicArena& operator=(const MonotonicArena&) = delete;
+
+    /**
+     * 分配 size 字节，按 alignment（2 的幂）对齐，不会返回空指针
+     */
+    void* allocate(size_t size, size_t alignment = alignof(std::max_align_t));
+
+    /**
+     * 把字符串复制到竞技场中，返回的视图在 reset 之前有效
+     */
+    std::string_view copyString(std::string_view text);
+
+    /**
+     * 回收本轮的全部分配，保留容量
+     */
+    void reset();
+
+    const Stats& getStats() const { return m_stats; }
+
+private:
+    struct Block {
+        std::unique_ptr<unsigned char[]> data;
+        size_t size;
+    };
+
+    /**
+     * 当前块放不下时追加一个至少 minSize 字节的新块
+     */
+    void addBlock(size_t minSize);
+
+    std::vector<Block> m_blocks;
+    unsigned char* m_cursor = nullptr;
+    unsigned char* m_end = nullptr;
+    Stats m_stats;
+};
+
+/**
+ * ArenaAllocator - 从 MonotonicArena 分配的标准库分配器
+ * deallocate 是空操作，容器扩容留下的旧缓冲区在 reset 时一起回收
+ */
+template <typename T>
+class ArenaAllocator {
+public:
+    using value_type = T;
+
+    explicit ArenaAllocator(MonotonicArena& arena) : m_arena(&arena) {}
+    template <typename U>
+    ArenaAllocator(const ArenaAllocator<U>& other) : m_arena(other.arena()) {}
+
+    T* allocate(size_t count) {
+        return static_cast<T*>(m_arena->allocate(count * sizeof(T), alignof(T)));
+    }
+    void deallocate(T*, size_t) {}
+
+    MonotonicArena* arena() const { return m_arena; }
+
+    template <typename U>
+    bool operator==(const ArenaAllocator<U>& other) const { return m_arena == other.arena(); }
+    template <typename U>
+    bool operator!=(const ArenaAllocator<U>& other) const { return m_arena != other.arena(); }
+
+private:
+    MonotonicArena* m_arena;
+};
+
+template <typename T>
+using ArenaVector = std::vector<T, ArenaAllocator<T>>;
+
+}  // namespace utils
+}  // namespace mini_rn
+
+#endif  // MONOTONICARENA_H
@@ -0,0 +1,118 @@
+#include "Value.h"
+
+#include "JSONParser.h"
+
+namespace mini_rn {
+namespace utils {
+
+Value Value::array(std::initializer_list<Value> elements) {
+    Value value;
+    value.m_type = Type::Array;
+    value.m_array.assign(elements.begin(), elements.end());
+    return value;
+}
+
+Value Value::object() {
+    Value value;
+    value.m_type = Type::Object;
+    return value;
+}
+
+size_t Value::size() const {
+    switch (m_type) {
+        case Type::Array:  return m_array.size();
+        case Type::Object: return m_object.size();
+        default:           return 0;
+    }
+}
+
+Value& Value::push(Value element) {
+    if (m_type == Type::Array) {
+        m_array.push_back(std::move(element));
+    }
+    return *this;
+}
+
+Value& Value::set(std::string key, Value value) {
+    if (m_type != Type::Object) return *this;
+
+    for (auto& field : m_object) {
+        if (field.first == key) {
+            field.second = std::move(value);
+            return *this;
+        }
+    }
+    m_object.emplace_back(std::move(key), std::move(value));
+    return *this;
+}
+
+const Value* Value::get(const std::string& key) const {
+    for (const auto& field : m_object) {
+        if (field.first == key) return &field.second;
+    }
+    return nullptr;
+}
+
+std::string Value::toJSON() const {
+    std::string json;
+    appendJSON(json);
+    return json;
+}
+
+void Value::appendJSON(std::string& out) const {
+    switch (m_type) {
+        case Type::Null:
+            out += "null";
+            break;
+        case Type::Bool:
+            out += asBool() ? "true" : "false";
+            break;
+        case Type::Number:
+            out += formatJSONNumber(m_number);
+            break;
+        case Type::String:
+            out += quoteJSONString(m_string);
+            break;
+        case Type::Array:
+            out.push_back('[');
+            for (size_t i = 0; i < m_array.size(); ++i) {
+                if (i > 0) out.push_back(',');
+                m_array[i].appendJSON(out);
+            }
+            out.push_back(']');
+            break;
+        case Type::Object:
+            out.push_back('{');
+            for (size_t i = 0; i < m_object.size(); ++i) {
+                if (i > 0) out.push_back(',');
+                out += quoteJSONString(m_object[i].first);
+                out.push_back(':');
+                m_object[i].second.appendJSON(out);
+            }
+            out.push_back('}');
+            break;
+        case Type::ArrayBuffer:
+            // 与 JSON.stringify(new ArrayBuffer(n)) 一致，不编码内容
+            out += "{}";
+            break;
+    }
+}
+
+bool Value::operator==(const Value& other) const {
+    if (m_type != other.m_type) return false;
+    switch (m_type) {
+        case Type::Null:   return true;
+        case Type::Bool:
+        case Type::Number: return m_number == other.m_number;
+        case Type::String: return m_string == other.m_string;
+        case Type::Array:  return m_array == other.m_array;
+        case Type::Object: return m_object == other.m_object;
+        case Type::ArrayBuffer:
+            if (!m_buffer || !other.m_buffer) return m_buffer == other.m_buffer;
+            return m_buffer->view() == other.m_buffer->view();
+    }
+    return false;
+}
+
+}  // namespace utils
+}  // namespace mini_rn
@@ -0,0 +1,115 @@
+#ifndef VALUE_H
+#define VALUE_H
+
+#include <cstdint>
+#include <initializer_list>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "ByteBuffer.h"
+
+namespace mini_rn {
+namespace utils {
+
+/**
+ * Value - Native 侧的类型化值树
+ *
+ * 对应 React Native 中 folly::dynamic 的角色：Native 模块的回调结果先构造成
+ * Value，再由执行器直接转换为引擎的 JS 值（JSValueMakeNumber、
+ * JSObjectMakeArray……），中间不生成也不解析 JSON 文本。
+ * 字符串内容原样保存，不存在转义问题；需要 JSON 文本时（日志、
+ * 没有直接转换的后端）用 toJSON 编码。
+ *
+ * ArrayBuffer 类型引用一个 ByteBuffer，执行器把它包装成 JS ArrayBuffer 而不拷贝
+ * 内容，大块二进制数据（文件内容等）不会变成 base64 或 JSON 文本；
+ * 拷贝 Value 只增加引用计数。
+ *
+ * 使用示例：
+ * ```cpp
+ * Value result = Value::object();
+ * result.set("first", 3);
+ * result.set("ids", Value::array({1, 2, 3}));
+ * sendSuccessCallback(callId, std::move(result));
+ * ```
+ */
+class Value {
+public:
+    enum class Type : uint8_t { Null, Bool, Number, String, Array, Object, ArrayBuffer };
+
+    using Array = std::vector<Value>;
+    // 字段按插入顺序保存，与 JSON.stringify 的输出顺序一致
+    using Object = std::vector<std::pair<std::string, Value>>;
+
+    Value() = default;
+    Value(std::nullptr_t) {}
+    Value(bool value) : m_type(Type::Bool), m_number(value ? 1 : 0) {}
+    Value(int value) : m_type(Type::Number), m_number(value) {}
+    Value(double value) : m_type(Type::Number), m_number(value) {}
+    Value(const char* value) : m_type(Type::String), m_string(value) {}
+    Value(std::string value) : m_type(Type::String), m_string(std::move(value)) {}
+    Value(std::shared_ptr<ByteBuffer> buffer)
+        : m_type(Type::ArrayBuffer), m_buffer(std::move(buffer)) {}
+
+    static Value array(std::initializer_list<Value> elements = {});
+    static Value object();
+
+    Type getType() const { return m_type; }
+    bool isNull() const { return m_type == Type::Null; }
+    bool isBool() const { return m_type == Type::Bool; }
+    bool isNumber() const { return m_type == Type::Number; }
+    bool isString() const { return m_type == Type::String; }
+    bool isArray() const { return m_type == Type::Array; }
+    bool isObject() const { return m_type == Type::Object; }
+    bool isArrayBuffer() const { return m_type == Type::ArrayBuffer; }
+
+    bool asBool() const { return m_number != 0; }
+    double asNumber() const { return m_number; }
+    const std::string& asString() const { return m_string; }
+    const Array& asArray() const { return m_array; }
+    const Object& asObject() const { return m_object; }
+    const std::shared_ptr<ByteBuffer>& asArrayBuffer() const { return m_buffer; }
+
+    /**
+     * 数组元素个数或对象字段个数，其余类型为 0
+     */
+    size_t size() const;
+
+    /**
+     * 追加数组元素（仅 Array 类型）
+     */
+    Value& push(Value element);
+
+    /**
+     * 设置对象字段，已存在时覆盖（仅 Object 类型）
+     */
+    Value& set(std::string key, Value value);
+
+    /**
+     * 对象字段，不存在或不是对象时返回空指针
+     */
+    const Value* get(const std::string& key) const;
+
+    /**
+     * 编码为 JSON 文本（与 JSON.stringify 一致，ArrayBuffer 编码为 {}）
+     */
+    std::string toJSON() const;
+    void appendJSON(std::string& out) const;
+
+    bool operator==(const Value& other) const;
+    bool operator!=(const Value& other) const { return !(*this == other); }
+
+private:
+    Type m_type = Type::Null;
+    double m_number = 0;
+    std::string m_string;
+    Array m_array;
+    Object m_object;
+    std::shared_ptr<ByteBuffer> m_buffer;
+};
+
+}  // namespace utils
+}  // namespace mini_rn
+
+#endif  // VALUE_H
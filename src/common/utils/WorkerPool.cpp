@@ -0,0 +1,71 @@
+#include "WorkerPool.h"
+
+#include <algorithm>
+
+namespace mini_rn {
+namespace utils {
+
+WorkerPool::WorkerPool(size_t threadCount) {
+    threadCount = std::max<size_t>(threadCount, 1);
+    m_threads.reserve(threadCount);
+    for (size_t i = 0; i < threadCount; ++i) {
+        m_threads.emplace_back(&WorkerPool::workerLoop, this);
+    }
+}
+
+WorkerPool::~WorkerPool() {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stopping = true;
+    }
+    m_wake.notify_all();
+    for (std::thread& thread : m_threads) {
+        thread.join();
+    }
+}
+
+void WorkerPool::post(std::function<void()> task) {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_tasks.push_back(std::move(task));
+        m_stats.posted++;
+    }
+    m_wake.notify_one();
+}
+
+void WorkerPool::waitIdle() {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_idle.wait(lock, [this] { return m_tasks.empty() && m_running == 0; });
+}
+
+WorkerPool::Stats WorkerPool::getStats() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_stats;
+}
+
+void WorkerPool::workerLoop() {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    while (true) {
+        m_wake.wait(lock, [this] { return m_stopping || !m_tasks.empty(); });
+        // 停止前先把队列中的任务执行完
+        if (m_tasks.empty()) return;
+
+        std::function<void()> task = std::move(m_tasks.front());
+        m_tasks.pop_front();
+        m_running++;
+        m_stats.maxConcurrent = std::max(m_stats.maxConcurrent, m_running);
+
+        lock.unlock();
+        task();
+        lock.lock();
+
+        m_running--;
+        m_stats.completed++;
+        if (m_tasks.empty() && m_running == 0) {
+            m_idle.notify_all();
+        }
+    }
+}
+
+}  // namespace utils
+}  // namespace mini_rn
@@ -0,0 +1,72 @@
+#ifndef WORKERPOOL_H
+#define WORKERPOOL_H
+
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace mini_rn {
+namespace utils {
+
+/**
+ * WorkerPool - 固定线程数的后台任务池
+ *
+ * 用于文件读写等阻塞操作：任务按提交顺序出队，同时执行的任务数不超过线程数，
+ * 磁盘不会被无限并发的请求压垮，JS 线程也不会被阻塞。
+ * 任务的结果由任务自己交回调用方线程（如放进完成队列，在 tick 中投递）。
+ */
+class WorkerPool {
+public:
+    struct Stats {
+        size_t posted = 0;         // 提交的任务数
+        size_t completed = 0;      // 执行完的任务数
+        size_t maxConcurrent = 0;  // 同时执行的任务数峰值
+    };
+
+    /**
+     * @param threadCount 线程数，至少为 1
+     */
+    explicit WorkerPool(size_t threadCount);
+
+    /**
+     * 执行完队列中的任务后停止所有线程
+     */
+    ~WorkerPool();
+
+    WorkerPool(const WorkerPool&) = delete;
+    WorkerPool& operator=(const WorkerPool&) = delete;
+
+    /**
+     * 提交任务，可以在任意线程调用
+     */
+    void post(std::function<void()> task);
+
+    /**
+     * 阻塞直到此前提交的任务都执行完
+     */
+    void waitIdle();
+
+    size_t getThreadCount() const { return m_threads.size(); }
+    Stats getStats() const;
+
+private:
+    void workerLoop();
+
+    mutable std::mutex m_mutex;
+    std::condition_variable m_wake;
+    std::condition_variable m_idle;
+    std::deque<std::function<void()>> m_tasks;
+    size_t m_running = 0;
+    bool m_stopping = false;
+    Stats m_stats;
+    std::vector<std::thread> m_threads;
+};
+
+}  // namespace utils
+}  // namespace mini_rn
+
+#endif  // WORKERPOOL_H
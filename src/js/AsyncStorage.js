@@ -0,0 +1,91 @@
+/**
+ * AsyncStorage.js - 持久化键值存储
+ *
+ * 与 Native 端的 AsyncStorageModule 对应，API 与 React Native 的 AsyncStorage
+ * 一致。Native 端把数据追加到单个日志文件并在内存中维护索引：
+ *
+ * - 读取（getItem / multiGet / getAllKeys）直接查索引，在当前批次返回
+ * - 写入（setItem / multiSet / removeItem / multiRemove）交给 I/O 线程，
+ *   同一帧内的多次写入合并为一次 fsync，落盘后 Promise 才 resolve
+ * - 写入未落盘时读取也能看到新值
+ *
+ * 一次 multiSet 的所有 key 原子地生效；需要同时修改多个 key 时应优先使用
+ * multiSet，而不是多次 setItem。
+ *
+ * 使用示例：
+ * ```javascript
+ * await AsyncStorage.setItem('token', 'abc')
+ * const token = await AsyncStorage.getItem('token')
+ * await AsyncStorage.multiSet([['a', '1'], ['b', '2']])
+ * ```
+ */
+
+'use strict'
+
+const NativeModules = require('./NativeModule')
+
+let AsyncStorageNative = null
+
+function getAsyncStorageNative() {
+  if (!AsyncStorageNative) {
+    AsyncStorageNative = NativeModules.get('AsyncStorage')
+
+    if (!AsyncStorageNative) {
+      throw new Error('AsyncStorage native module is not available')
+    }
+  }
+
+  return AsyncStorageNative
+}
+
+const AsyncStorage = {
+  /**
+   * @returns {Promise<string|null>} key 不存在时为 null
+   */
+  getItem(key) {
+    return getAsyncStorageNative().multiGet([key]).then(result => result[0][1])
+  },
+
+  /**
+   * @param {string} value 只能是字符串（对象需先 JSON.stringify）
+   * @returns {Promise<null>} 落盘后 resolve
+   */
+  setItem(key, value) {
+    return getAsyncStorageNative().multiSet([[key, value]])
+  },
+
+  removeItem(key) {
+    return getAsyncStorageNative().multiRemove([key])
+  },
+
+  /**
+   * @returns {Promise<Array<[string, string|null]>>}
+   */
+  multiGet(keys) {
+    return getAsyncStorageNative().multiGet(keys)
+  },
+
+  /**
+   * @param {Array<[string, string]>} keyValuePairs
+   */
+  multiSet(keyValuePairs) {
+    return getAsyncStorageNative().multiSet(keyValuePairs)
+  },
+
+  multiRemove(keys) {
+    return getAsyncStorageNative().multiRemove(keys)
+  },
+
+  /**
+   * @returns {Promise<string[]>}
+   */
+  getAllKeys() {
+    return getAsyncStorageNative().getAllKeys()
+  },
+
+  isAvailable() {
+    return !!NativeModules.get('AsyncStorage')
+  },
+}
+
+module.exports = AsyncStorage
@@ -14,7 +14,9 @@
 
 // 使用 CommonJS require 导入 MessageQueue
 const MessageQueue = require('./MessageQueue')
-console.log('[BatchedBridge] MessageQueue imported via require:', typeof MessageQueue)
+if (__DEV__) {
+  console.log('[BatchedBridge] MessageQueue imported via require:', typeof MessageQueue)
+}
 
 // 创建 MessageQueue 实例作为 BatchedBridge（官方 RN 方式）
 const BatchedBridge = new MessageQueue()
@@ -29,4 +31,6 @@ Object.defineProperty(global, '__fbBatchedBridge', {
 // 使用 CommonJS 导出
 module.exports = BatchedBridge
 
-console.log('[BatchedBridge] BatchedBridge.js loaded - CommonJS module')
+if (__DEV__) {
+  console.log('[BatchedBridge] BatchedBridge.js loaded - CommonJS module')
+}
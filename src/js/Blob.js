@@ -0,0 +1,184 @@
+/**
+ * Blob.js - Native 内存中的二进制数据
+ *
+ * 与 Native 端的 BlobModule 对应。Blob 的内容保存在 Native 的 BlobManager 中，
+ * JS 只持有句柄 {blobId, offset, size}：
+ * - slice 只在 JS 中生成新句柄，不拷贝也不调用 Native
+ * - 把 Blob 交给 FileSystem.writeFile 等接受 blob 的方法时，Bridge 上只传句柄，
+ *   数据在 Native 模块之间按引用传递
+ * - arrayBuffer() 返回的 ArrayBuffer 与 Blob 共享 Native 内存，应当只读
+ *
+ * 引用计数：同一个 blobId 的所有 Blob（包括 slice 出来的）共用一个计数，
+ * 全部 close() 后才通知 Native 释放内存。
+ *
+ * 使用示例：
+ * ```javascript
+ * const blob = BlobManager.createFromParts(['header\n', otherBlob])
+ * const head = blob.slice(0, 6)
+ * const text = await head.text()
+ * await FileSystem.writeFile(path, blob)
+ * blob.close()
+ * head.close()
+ * ```
+ */
+
+'use strict'
+
+const NativeModules = require('./NativeModule')
+
+let BlobNative = null
+
+function getBlobNative() {
+  if (!BlobNative) {
+    BlobNative = NativeModules.get('BlobModule')
+
+    if (!BlobNative) {
+      throw new Error('BlobModule native module is not available')
+    }
+  }
+
+  return BlobNative
+}
+
+/**
+ * JS 侧每个 blobId 的引用计数，归零时通知 Native 释放
+ */
+const BlobRegistry = {
+  counts: {},
+
+  register(blobId) {
+    this.counts[blobId] = (this.counts[blobId] || 0) + 1
+  },
+
+  unregister(blobId) {
+    const count = (this.counts[blobId] || 0) - 1
+    if (count > 0) {
+      this.counts[blobId] = count
+      return
+    }
+    delete this.counts[blobId]
+    getBlobNative().release(blobId)
+  },
+
+  has(blobId) {
+    return !!this.counts[blobId]
+  },
+}
+
+// JS 生成的 blobId，与 Native 生成的 "native:<n>" 不会冲突
+let nextBlobId = 1
+
+function utf8Length(string) {
+  let length = 0
+  for (let i = 0; i < string.length; i++) {
+    const code = string.charCodeAt(i)
+    if (code < 0x80) {
+      length += 1
+    } else if (code < 0x800) {
+      length += 2
+    } else if (code >= 0xd800 && code <= 0xdbff && i + 1 < string.length) {
+      // 代理对编码为 4 字节
+      length += 4
+      i++
+    } else {
+      length += 3
+    }
+  }
+  return length
+}
+
+class Blob {
+  /**
+   * 由句柄构造，调用方已经持有该 blobId 的一个引用
+   * （应用代码通过 BlobManager.createFromParts 或 Native 模块得到 Blob）
+   */
+  constructor(data) {
+    this.data = { blobId: data.blobId, offset: data.offset, size: data.size }
+    this.closed = false
+  }
+
+  get size() {
+    return this.data.size
+  }
+
+  /**
+   * 与 Web Blob.slice 相同，支持负数下标；返回的 Blob 需要单独 close
+   */
+  slice(start = 0, end = this.size) {
+    const size = this.size
+    const from = start < 0 ? Math.max(size + start, 0) : Math.min(start, size)
+    const to = end < 0 ? Math.max(size + end, 0) : Math.min(end, size)
+    BlobRegistry.register(this.data.blobId)
+    return new Blob({
+      blobId: this.data.blobId,
+      offset: this.data.offset + from,
+      size: Math.max(to - from, 0),
+    })
+  }
+
+  /**
+   * @returns {Promise<ArrayBuffer>} 修改它不影响 Blob（大文件 Blob 以写时复制映射交出，不拷贝）
+   */
+  arrayBuffer() {
+    return getBlobNative().readAsArrayBuffer(this.data)
+  }
+
+  /**
+   * @returns {Promise<string>} 按 UTF-8 解码
+   */
+  text() {
+    return getBlobNative().readAsText(this.data)
+  }
+
+  /**
+   * 不再使用这个 Blob，重复调用没有影响
+   */
+  close() {
+    if (this.closed) return
+    this.closed = true
+    BlobRegistry.unregister(this.data.blobId)
+  }
+}
+
+const BlobManager = {
+  /**
+   * 拼接字符串（UTF-8）和 Blob，同步返回新的 Blob
+   * 只有一个 Blob 部分时 Native 端与原 Blob 共享内存
+   *
+   * @param {Array<string|Blob>} parts
+   * @returns {Blob}
+   */
+  createFromParts(parts) {
+    const blobId = 'js:' + nextBlobId++
+    let size = 0
+    const items = parts.map((part) => {
+      if (part instanceof Blob) {
+        size += part.size
+        return { type: 'blob', ...part.data }
+      }
+      const data = String(part)
+      size += utf8Length(data)
+      return { type: 'string', data }
+    })
+
+    getBlobNative().createFromParts(items, blobId)
+    return this.createFromHandle({ blobId, offset: 0, size })
+  },
+
+  /**
+   * 包装 Native 模块返回的句柄（Native 已经为 JS 持有一个引用）
+   */
+  createFromHandle(handle) {
+    BlobRegistry.register(handle.blobId)
+    return new Blob(handle)
+  },
+
+  isAvailable() {
+    return !!NativeModules.get('BlobModule')
+  },
+
+  Blob,
+  BlobRegistry,
+}
+
+module.exports = BlobManager
@@ -19,7 +19,9 @@
 
 // 使用 CommonJS require 导入 NativeModules
 const NativeModules = require('./NativeModule')
-console.log('[DeviceInfo] NativeModules imported via require:', typeof NativeModules)
+if (__DEV__) {
+  console.log('[DeviceInfo] NativeModules imported via require:', typeof NativeModules)
+}
 
 // 获取 DeviceInfo 原生模块
 let DeviceInfoNative = null
@@ -34,7 +36,9 @@ function getDeviceInfoNative() {
       throw new Error('DeviceInfo native module is not available')
     }
 
-    console.log('[DeviceInfo] Native module loaded successfully')
+    if (__DEV__) {
+      console.log('[DeviceInfo] Native module loaded successfully')
+    }
   }
 
   return DeviceInfoNative
@@ -50,7 +54,9 @@ const DeviceInfo = {
    * @returns {Promise<string>} 设备唯一ID的Promise
    */
   getUniqueId() {
-    console.log('[DeviceInfo] Calling getUniqueId (Promise method)')
+    if (__DEV__) {
+      console.log('[DeviceInfo] Calling getUniqueId (Promise method)')
+    }
 
     const native = getDeviceInfoNative()
 
@@ -63,7 +69,9 @@ const DeviceInfo = {
    * @returns {string} 系统版本字符串
    */
   getSystemVersion() {
-    console.log('[DeviceInfo] Calling getSystemVersion (Sync method)')
+    if (__DEV__) {
+      console.log('[DeviceInfo] Calling getSystemVersion (Sync method)')
+    }
 
     const native = getDeviceInfoNative()
 
@@ -76,7 +84,9 @@ const DeviceInfo = {
    * @returns {string} 设备硬件型号标识 (如 "Mac16,7")
    */
   getDeviceId() {
-    console.log('[DeviceInfo] Calling getDeviceId (Sync method)')
+    if (__DEV__) {
+      console.log('[DeviceInfo] Calling getDeviceId (Sync method)')
+    }
 
     const native = getDeviceInfoNative()
 
@@ -112,4 +122,6 @@ Object.defineProperty(DeviceInfo, 'Constants', {
 // 使用 CommonJS 导出
 module.exports = DeviceInfo
 
-console.log('[DeviceInfo] DeviceInfo.js loaded - CommonJS module')
+if (__DEV__) {
+  console.log('[DeviceInfo] DeviceInfo.js loaded - CommonJS module')
+}
@@ -0,0 +1,173 @@
+/**
+ * EventEmitter.js - Native → JS 事件分发
+ *
+ * 对应 React Native 的 RCTDeviceEventEmitter：Native 侧的 EventEmitterModule
+ * 每个 tick 把积攒（并已合并、限频）的事件一次性交给 receiveEvents，
+ * 这里再分发给各个监听器。
+ *
+ * 与 Native 的约定：
+ * - 某个事件名出现第一个监听器时调用 Native addListener(eventName)，
+ *   最后一个监听器移除时调用 removeListeners(eventName)；
+ *   Native 侧据此丢弃没有人监听的事件，不产生跨 Bridge 调用
+ * - receiveEvents(events) 中每个事件为 [eventName, target, body]，
+ *   target 为 -1 表示广播
+ *
+ * 使用示例：
+ * ```javascript
+ * const subscription = DeviceEventEmitter.addListener('progress', (body) => {
+ *   console.log('progress:', body.loaded / body.total)
+ * })
+ * subscription.remove()
+ * ```
+ */
+
+'use strict'
+
+// 使用 CommonJS require 导入依赖
+const BatchedBridge = require('./BatchedBridge')
+const NativeModules = require('./NativeModule')
+
+// 广播事件的 target，与 EventEmitterModule::kNoTarget 对齐
+const NO_TARGET = -1
+
+class EventEmitter {
+  constructor() {
+    this._listeners = {} // eventName -> Array<{ listener, target }>
+    this._native = undefined // 延迟获取，undefined 表示尚未查找
+  }
+
+  /**
+   * 添加监听器
+   * @param {string} eventName 事件名称
+   * @param {function} listener 监听函数，参数为事件数据
+   * @param {number} [target] 只接收指定 target 的事件，省略时接收所有事件
+   * @returns {{remove: function}} 订阅对象
+   */
+  addListener(eventName, listener, target) {
+    if (typeof listener !== 'function') {
+      throw new Error(`[EventEmitter] Listener for '${eventName}' must be a function`)
+    }
+
+    let listeners = this._listeners[eventName]
+    if (!listeners) {
+      listeners = this._listeners[eventName] = []
+    }
+
+    const subscription = { listener, target: target === undefined ? null : target }
+    listeners.push(subscription)
+
+    if (listeners.length === 1) {
+      this._callNative('addListener', eventName)
+    }
+
+    return {
+      remove: () => this._removeSubscription(eventName, subscription),
+    }
+  }
+
+  /**
+   * 移除某个事件名的所有监听器
+   * @param {string} eventName 事件名称
+   */
+  removeAllListeners(eventName) {
+    const listeners = this._listeners[eventName]
+    if (listeners && listeners.length > 0) {
+      delete this._listeners[eventName]
+      this._callNative('removeListeners', eventName)
+    }
+  }
+
+  /**
+   * 获取某个事件名的监听器数量
+   * @param {string} eventName 事件名称
+   * @returns {number}
+   */
+  listenerCount(eventName) {
+    const listeners = this._listeners[eventName]
+    return listeners ? listeners.length : 0
+  }
+
+  /**
+   * 在 JS 内部直接触发事件（不经过 Native）
+   * @param {string} eventName 事件名称
+   * @param {*} body 事件数据
+   * @param {number} [target] 事件目标
+   */
+  emit(eventName, body, target) {
+    this._dispatch(eventName, target === undefined ? NO_TARGET : target, body)
+  }
+
+  /**
+   * Native 调用入口：一个 tick 内的所有事件
+   * 由 EventEmitterModule 通过 callFunction 调用
+   *
+   * @param {Array} events 事件数组，每项为 [eventName, target, body]
+   */
+  receiveEvents(events) {
+    for (let i = 0; i < events.length; i++) {
+      const event = events[i]
+      this._dispatch(event[0], event[1], event[2])
+    }
+  }
+
+  // === 私有方法 ===
+
+  _dispatch(eventName, target, body) {
+    const listeners = this._listeners[eventName]
+    if (!listeners) {
+      return
+    }
+
+    // 复制一份，允许监听器在回调中移除自己
+    const snapshot = listeners.slice()
+    for (let i = 0; i < snapshot.length; i++) {
+      const subscription = snapshot[i]
+      if (subscription.target !== null && target !== NO_TARGET && subscription.target !== target) {
+        continue
+      }
+
+      try {
+        subscription.listener(body)
+      } catch (error) {
+        console.error(`[EventEmitter] Error in '${eventName}' listener:`, error)
+      }
+    }
+  }
+
+  _removeSubscription(eventName, subscription) {
+    const listeners = this._listeners[eventName]
+    if (!listeners) {
+      return
+    }
+
+    const index = listeners.indexOf(subscription)
+    if (index === -1) {
+      return
+    }
+
+    listeners.splice(index, 1)
+    if (listeners.length === 0) {
+      delete this._listeners[eventName]
+      this._callNative('removeListeners', eventName)
+    }
+  }
+
+  _callNative(method, eventName) {
+    if (this._native === undefined) {
+      this._native = NativeModules.get('EventEmitter')
+    }
+
+    // 未注册 EventEmitter 模块时只在 JS 内部分发
+    if (this._native) {
+      this._native[method](eventName)
+    }
+  }
+}
+
+const DeviceEventEmitter = new EventEmitter()
+
+// 注册为可调用模块，Native 通过 callFunction('RCTDeviceEventEmitter', ...) 投递事件
+BatchedBridge.registerCallableModule('RCTDeviceEventEmitter', DeviceEventEmitter)
+
+// 使用 CommonJS 导出
+module.exports = DeviceEventEmitter
@@ -0,0 +1,158 @@
+/**
+ * FileSystem.js - 文件系统访问
+ *
+ * 与 Native 端的 FileSystemModule 对应。读取结果是 ArrayBuffer，
+ * 直接引用 Native 的映射区或缓冲池内存，不经过 base64 / JSON 字符串；
+ * 所有操作在 Native 的 I/O 线程池上执行，不阻塞 JS 线程。
+ *
+ * readFileAsBlob 返回 Blob：内容留在 Native，可以直接交给 writeFile 等方法，
+ * 整个过程文件字节都不进入 JS。
+ *
+ * 流式读取：createReadStream 按块调用 readFile，并保持 readAhead 个分块
+ * 在途，JS 处理当前分块时下一块已经在读取。
+ *
+ * 使用示例：
+ * ```javascript
+ * const info = await FileSystem.stat(path)
+ * const bytes = new Uint8Array(await FileSystem.readFile(path))
+ *
+ * const stream = FileSystem.createReadStream(path, { chunkSize: 64 * 1024 })
+ * for await (const chunk of stream) {
+ *   hash.update(new Uint8Array(chunk))
+ * }
+ * ```
+ */
+
+'use strict'
+
+const NativeModules = require('./NativeModule')
+const BlobManager = require('./Blob')
+
+let FileSystemNative = null
+
+function getFileSystemNative() {
+  if (!FileSystemNative) {
+    FileSystemNative = NativeModules.get('FileSystem')
+
+    if (!FileSystemNative) {
+      throw new Error('FileSystem native module is not available')
+    }
+  }
+
+  return FileSystemNative
+}
+
+/**
+ * 分块读取一个文件，read() 依次返回各分块，读完后返回 null
+ */
+class ReadStream {
+  constructor(path, options = {}) {
+    this.path = path
+    this.chunkSize = options.chunkSize || 64 * 1024
+    this.readAhead = options.readAhead || 2
+    this.offset = options.start || 0
+    this.pending = []
+    this.ended = false
+    this.closed = false
+  }
+
+  _fill() {
+    while (!this.ended && !this.closed && this.pending.length < this.readAhead) {
+      this.pending.push(getFileSystemNative().readFile(this.path, this.offset, this.chunkSize))
+      this.offset += this.chunkSize
+    }
+  }
+
+  /**
+   * @returns {Promise<ArrayBuffer|null>}
+   */
+  read() {
+    this._fill()
+    if (this.pending.length === 0) {
+      return Promise.resolve(null)
+    }
+    return this.pending.shift().then((chunk) => {
+      // 短块说明已到文件末尾，不再预读
+      if (chunk.byteLength < this.chunkSize) {
+        this.ended = true
+        this.pending = []
+      }
+      return chunk.byteLength > 0 ? chunk : null
+    })
+  }
+
+  close() {
+    this.closed = true
+    this.pending = []
+  }
+
+  [Symbol.asyncIterator]() {
+    return {
+      next: () => this.read().then((chunk) => (chunk ? { value: chunk, done: false } : { value: undefined, done: true })),
+      return: () => {
+        this.close()
+        return Promise.resolve({ value: undefined, done: true })
+      },
+    }
+  }
+}
+
+const FileSystem = {
+  /**
+   * @returns {Promise<{size: number, isFile: boolean, isDirectory: boolean, modified: number}>}
+   */
+  stat(path) {
+    return getFileSystemNative().stat(path)
+  },
+
+  /**
+   * @returns {Promise<string[]>}
+   */
+  readDir(path) {
+    return getFileSystemNative().readDir(path)
+  },
+
+  /**
+   * @param {{offset?: number, length?: number}} options 默认读取整个文件
+   * @returns {Promise<ArrayBuffer>}
+   */
+  readFile(path, options = {}) {
+    const offset = options.offset || 0
+    const length = options.length === undefined ? -1 : options.length
+    return getFileSystemNative().readFile(path, offset, length)
+  },
+
+  /**
+   * 参数同 readFile，内容保存在 Native 的 Blob 中
+   * @returns {Promise<Blob>}
+   */
+  readFileAsBlob(path, options = {}) {
+    const offset = options.offset || 0
+    const length = options.length === undefined ? -1 : options.length
+    return getFileSystemNative()
+      .readFileAsBlob(path, offset, length)
+      .then((handle) => BlobManager.createFromHandle(handle))
+  },
+
+  /**
+   * @param {string|Blob} contents UTF-8 文本或 Blob（只传句柄）
+   * @param {{append?: boolean}} options
+   */
+  writeFile(path, contents, options = {}) {
+    const data = contents instanceof BlobManager.Blob ? contents.data : contents
+    return getFileSystemNative().writeFile(path, data, !!options.append)
+  },
+
+  /**
+   * @param {{chunkSize?: number, readAhead?: number, start?: number}} options
+   */
+  createReadStream(path, options) {
+    return new ReadStream(path, options)
+  },
+
+  isAvailable() {
+    return !!NativeModules.get('FileSystem')
+  },
+}
+
+module.exports = FileSystem
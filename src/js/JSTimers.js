@@ -0,0 +1,186 @@
+/**
+ * JSTimers.js - setTimeout / setInterval / requestAnimationFrame
+ *
+ * 对应 React Native 的 JSTimers：JS 侧只保存回调，定时器由 Native 的
+ * TimingModule 管理（最小堆），到期后每个 tick 通过一次
+ * callTimers(timerIds, frameTime) 批量回调，而不是每个定时器一次跨 Bridge 调用。
+ *
+ * requestAnimationFrame 不占用定时器：同一帧内的所有帧回调共用一次
+ * requestFrame() 请求，Native 在下一个帧边界随 callTimers 一起投递帧时间。
+ */
+
+'use strict'
+
+// 使用 CommonJS require 导入依赖
+const BatchedBridge = require('./BatchedBridge')
+const NativeModules = require('./NativeModule')
+
+let TimingNative // 延迟获取，undefined 表示尚未查找
+
+function getTimingNative() {
+  if (TimingNative === undefined) {
+    TimingNative = NativeModules.get('Timing')
+    if (!TimingNative) {
+      console.error('[JSTimers] Timing native module is not available, timers will never fire')
+    }
+  }
+  return TimingNative
+}
+
+const JSTimers = {
+  _nextTimerID: 1,
+  _callbacks: {}, // timerID -> { callback, args, repeats }
+  _activeCount: 0,
+  _frameCallbacks: [], // 等待下一帧的回调 [frameID, callback]
+  _nextFrameID: 1,
+  _frameRequested: false,
+
+  _createTimer(callback, duration, args, repeats) {
+    if (typeof callback !== 'function') {
+      throw new TypeError('[JSTimers] Callback must be a function')
+    }
+
+    const timerID = this._nextTimerID++
+    this._callbacks[timerID] = { callback, args, repeats }
+    this._activeCount++
+
+    const native = getTimingNative()
+    if (native) {
+      native.createTimer(timerID, Math.max(0, Number(duration) || 0), repeats)
+    }
+    return timerID
+  },
+
+  _clearTimer(timerID) {
+    if (!this._callbacks[timerID]) {
+      return
+    }
+
+    delete this._callbacks[timerID]
+    this._activeCount--
+
+    const native = getTimingNative()
+    if (native) {
+      native.deleteTimer(timerID)
+    }
+  },
+
+  setTimeout(callback, duration, ...args) {
+    return this._createTimer(callback, duration, args, false)
+  },
+
+  setInterval(callback, duration, ...args) {
+    return this._createTimer(callback, duration, args, true)
+  },
+
+  clearTimeout(timerID) {
+    this._clearTimer(timerID)
+  },
+
+  clearInterval(timerID) {
+    this._clearTimer(timerID)
+  },
+
+  requestAnimationFrame(callback) {
+    if (typeof callback !== 'function') {
+      throw new TypeError('[JSTimers] Callback must be a function')
+    }
+
+    const frameID = this._nextFrameID++
+    this._frameCallbacks.push([frameID, callback])
+
+    if (!this._frameRequested) {
+      const native = getTimingNative()
+      if (native) {
+        this._frameRequested = true
+        native.requestFrame()
+      }
+    }
+    return frameID
+  },
+
+  cancelAnimationFrame(frameID) {
+    // 取消的回调保留在队列中，执行时跳过，避免为此再请求或取消帧
+    for (let i = 0; i < this._frameCallbacks.length; i++) {
+      if (this._frameCallbacks[i][0] === frameID) {
+        this._frameCallbacks[i][1] = null
+        return
+      }
+    }
+  },
+
+  /**
+   * Native 调用入口：一个 tick 内到期的所有定时器与帧回调
+   * 由 TimingModule 通过 callFunction 调用
+   *
+   * @param {Array<number>} timerIDs 到期的定时器ID（按到期时间排序）
+   * @param {number|null} frameTime 帧时间（毫秒），本 tick 没有帧时为 null
+   */
+  callTimers(timerIDs, frameTime) {
+    for (let i = 0; i < timerIDs.length; i++) {
+      const timerID = timerIDs[i]
+      const timer = this._callbacks[timerID]
+      if (!timer) {
+        continue // 已在前面的回调中被清除
+      }
+
+      if (!timer.repeats) {
+        delete this._callbacks[timerID]
+        this._activeCount--
+      }
+
+      try {
+        timer.callback.apply(undefined, timer.args)
+      } catch (error) {
+        console.error(`[JSTimers] Error in timer ${timerID}:`, error)
+      }
+    }
+
+    if (frameTime !== null && frameTime !== undefined) {
+      this._callFrameCallbacks(frameTime)
+    }
+  },
+
+  _callFrameCallbacks(frameTime) {
+    // 回调中新请求的帧属于下一帧
+    const callbacks = this._frameCallbacks
+    this._frameCallbacks = []
+    this._frameRequested = false
+
+    for (let i = 0; i < callbacks.length; i++) {
+      const callback = callbacks[i][1]
+      if (!callback) {
+        continue
+      }
+
+      try {
+        callback(frameTime)
+      } catch (error) {
+        console.error('[JSTimers] Error in animation frame callback:', error)
+      }
+    }
+  },
+
+  /**
+   * 获取活跃的定时器数量（便于测试）
+   */
+  getActiveTimerCount() {
+    return this._activeCount
+  },
+}
+
+// 注册为可调用模块，Native 通过 callFunction('JSTimers', 'callTimers', ...) 回调
+BatchedBridge.registerCallableModule('JSTimers', JSTimers)
+
+// 安装全局定时器函数（嵌入的 JS 引擎没有内置实现）
+if (typeof global !== 'undefined') {
+  global.setTimeout = JSTimers.setTimeout.bind(JSTimers)
+  global.setInterval = JSTimers.setInterval.bind(JSTimers)
+  global.clearTimeout = JSTimers.clearTimeout.bind(JSTimers)
+  global.clearInterval = JSTimers.clearInterval.bind(JSTimers)
+  global.requestAnimationFrame = JSTimers.requestAnimationFrame.bind(JSTimers)
+  global.cancelAnimationFrame = JSTimers.cancelAnimationFrame.bind(JSTimers)
+}
+
+// 使用 CommonJS 导出
+module.exports = JSTimers
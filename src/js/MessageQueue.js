@@ -9,14 +9,115 @@
  * 2. 回调管理 - 处理异步调用的成功/失败回调
  * 3. 模块注册 - 管理 Native 模块的延迟加载
  * 4. 批量处理 - 优化多个调用的批量传输
+ * 5. 背压 - 未完成的调用超过水位时，生产者可以等待排空（whenDrained），
+ *    Background 调用直接丢弃
  *
  * 严格的 RN 兼容性：
  * - 消息格式：[moduleIds, methodIds, params, callbackIds]
+ *   （用 withPriority 显式指定过优先级时附加第五个数组 priorities）
  * - 回调机制：双回调模式（onFail, onSucc）
  * - 模块注册：延迟加载机制
  * - 队列处理：批量刷新机制
  */
 
+// 回调ID = (generation << CALLBACK_SLOT_BITS) | slot
+// 需要保持为非负的 31 位整数，与 Native 端 int 类型的 callbackId 对齐
+const CALLBACK_SLOT_BITS = 20
+const CALLBACK_SLOT_MASK = (1 << CALLBACK_SLOT_BITS) - 1
+const CALLBACK_GENERATION_MASK = (1 << (31 - CALLBACK_SLOT_BITS)) - 1
+
+/**
+ * CallbackRegistry - 基于槽位数组的回调注册表
+ *
+ * 代替 `this._callbacks[id] = {onFail, onSucc}` + `delete` 的写法：
+ * - 成功/失败回调存放在两个平行数组中，注册时不再为每次调用分配包装对象
+ * - 释放的槽位进入空闲栈复用，数组只增不删，始终保持紧凑（packed）元素类型，
+ *   避免对象因频繁 delete 退化为字典模式
+ * - 每个槽位带代数（generation），槽位被复用后旧 ID 的代数不再匹配，
+ *   可以识别重复或过期的回调 ID
+ * - 待处理回调数量单独计数，查询为 O(1)
+ */
+class CallbackRegistry {
+  constructor() {
+    this._successCallbacks = [] // 槽位 -> 成功回调
+    this._failCallbacks = [] // 槽位 -> 失败回调
+    this._generations = [] // 槽位 -> 当前代数
+    this._pending = [] // 槽位 -> 是否有待执行的回调
+    this._freeSlots = [] // 空闲槽位栈
+    this._pendingCount = 0
+  }
+
+  /**
+   * 注册一对回调
+   * @returns {number} 回调ID
+   */
+  register(onFail, onSucc) {
+    let slot
+    if (this._freeSlots.length > 0) {
+      slot = this._freeSlots.pop()
+    } else {
+      slot = this._generations.length
+      if (slot > CALLBACK_SLOT_MASK) {
+        throw new Error(`[MessageQueue] Too many pending callbacks (${this._pendingCount})`)
+      }
+      this._successCallbacks.push(null)
+      this._failCallbacks.push(null)
+      this._generations.push(0)
+      this._pending.push(false)
+    }
+
+    this._successCallbacks[slot] = onSucc || null
+    this._failCallbacks[slot] = onFail || null
+    this._pending[slot] = true
+    this._pendingCount++
+
+    return (this._generations[slot] << CALLBACK_SLOT_BITS) | slot
+  }
+
+  /**
+   * 查找回调ID对应的槽位
+   * @returns {number} 槽位；ID 未注册、已执行或已过期时返回 -1
+   */
+  lookup(callbackID) {
+    if (typeof callbackID !== 'number' || callbackID < 0) {
+      return -1
+    }
+    const slot = callbackID & CALLBACK_SLOT_MASK
+    const generation = callbackID >>> CALLBACK_SLOT_BITS
+    if (slot >= this._generations.length || !this._pending[slot] || this._generations[slot] !== generation) {
+      return -1
+    }
+    return slot
+  }
+
+  getSuccessCallback(slot) {
+    return this._successCallbacks[slot]
+  }
+
+  getFailCallback(slot) {
+    return this._failCallbacks[slot]
+  }
+
+  /**
+   * 释放槽位：清理函数引用（避免内存泄漏），代数加一使旧 ID 失效
+   */
+  release(slot) {
+    this._successCallbacks[slot] = null
+    this._failCallbacks[slot] = null
+    this._pending[slot] = false
+    this._generations[slot] = (this._generations[slot] + 1) & CALLBACK_GENERATION_MASK
+    this._freeSlots.push(slot)
+    this._pendingCount--
+  }
+
+  /**
+   * 待执行回调数量（O(1)）
+   */
+  get pendingCount() {
+    return this._pendingCount
+  }
+}
+
 class MessageQueue {
   constructor() {
     // === 核心数据结构 ===
@@ -25,9 +126,8 @@ class MessageQueue {
     // 格式严格遵循 RN 标准：[moduleIds, methodIds, params, callbackIds]
     this._queue = [[], [], [], []] // [moduleIDs, methodIDs, params, callbackIDs]
 
-    // 回调管理
-    this._callbackID = 0 // 回调ID生成器
-    this._callbacks = {} // 存储所有待执行的回调函数
+    // 回调管理：槽位数组 + 空闲栈，回调ID由注册表分配
+    this._callbacks = new CallbackRegistry()
 
     // 模块注册表
     this._lazyCallableModules = {} // 延迟加载的模块
@@ -39,9 +139,88 @@ class MessageQueue {
 
     // 性能和调试
     this._isInCallback = false // 标记是否正在执行回调
-    this._debugEnabled = true // 调试模式标志
+    this._priority = null // withPriority 指定的当前优先级，null 表示方法的默认通道
+
+    // 背压：Native 通知的状态（未完成调用的个数 / 字节数超过 Native 水位），
+    // 以及本地水位（待回调数 + 队列中的调用数）
+    this._nativeBackpressure = false
+    this._localBackpressure = false
+    this._backpressureLimits = { highWatermark: 4096, lowWatermark: 2048, dropBackground: true }
+    this._drainWaiters = []
+    this._droppedCalls = 0
+    this._debugEnabled = __DEV__ // 调试日志开关，只在开发模式下生效
+
+    if (__DEV__) {
+      console.log('[MessageQueue] Initialized with RN-compatible structure')
+    }
+  }
+
+  /**
+   * 在指定的优先级下执行 fn，期间发起的 Native 调用都使用该优先级
+   * Native 端先派发 Immediate、UserBlocking，再派发 Normal；Background 调用
+   * 延后到之后的 tick 执行，积压过多时可能被丢弃（以错误回调结束）
+   * Immediate 调用即使在回调期间也立即刷新队列
+   *
+   * @param {number} priority MessageQueue.Priority 中的值
+   * @param {function} fn 同步执行的函数
+   * @returns fn 的返回值
+   */
+  withPriority(priority, fn) {
+    const previous = this._priority
+    this._priority = priority
+    try {
+      return fn()
+    } finally {
+      this._priority = previous
+    }
+  }
+
+  /**
+   * 设置本地背压水位
+   *
+   * @param {{highWatermark?: number, lowWatermark?: number, dropBackground?: boolean}} limits
+   *   待回调数与队列中的调用数之和达到 highWatermark 时进入背压，回落到 lowWatermark 时解除；
+   *   dropBackground 为 true 时背压期间的 Background 调用直接以错误结束
+   */
+  setBackpressureLimits(limits) {
+    Object.assign(this._backpressureLimits, limits)
+    this._updateLocalBackpressure()
+  }
+
+  /**
+   * Native 端背压状态变化时调用（JSExecutor::updateBackpressure）
+   *
+   * @param {boolean} active
+   */
+  setBackpressure(active) {
+    this._nativeBackpressure = !!active
+    this._notifyDrained()
+  }
+
+  /**
+   * @returns {boolean} Native 端或本地是否处于背压
+   */
+  isBackpressured() {
+    return this._nativeBackpressure || this._localBackpressure
+  }
 
-    console.log('[MessageQueue] Initialized with RN-compatible structure')
+  /**
+   * 等待背压解除，没有背压时立即 resolve
+   * 批量生产者在每批之间 await 它，速度自然降到 Native 的处理速度：
+   * ```javascript
+   * for (const item of items) {
+   *   await BatchedBridge.whenDrained()
+   *   Upload.send(item)
+   * }
+   * ```
+   *
+   * @returns {Promise<void>}
+   */
+  whenDrained() {
+    if (!this.isBackpressured()) {
+      return Promise.resolve()
+    }
+    return new Promise((resolve) => this._drainWaiters.push(resolve))
   }
 
   /**
@@ -54,7 +233,7 @@ class MessageQueue {
   registerLazyCallableModule(moduleName, factory) {
     this._lazyCallableModules[moduleName] = factory
 
-    if (this._debugEnabled) {
+    if (__DEV__ && this._debugEnabled) {
       console.log(`[MessageQueue] Registered lazy module: ${moduleName}`)
     }
   }
@@ -69,7 +248,7 @@ class MessageQueue {
   registerCallableModule(moduleName, module) {
     this._modules[moduleName] = module
 
-    if (this._debugEnabled) {
+    if (__DEV__ && this._debugEnabled) {
       console.log(`[MessageQueue] Registered direct module: ${moduleName}`)
     }
   }
@@ -85,7 +264,7 @@ class MessageQueue {
    * @param {function} onSucc 成功回调函数
    */
   enqueueNativeCall(moduleID, methodID, params, onFail, onSucc) {
-    if (this._debugEnabled) {
+    if (__DEV__ && this._debugEnabled) {
       console.log(`[MessageQueue] Calling native method - Module: ${moduleID}, Method: ${methodID}`)
     }
 
@@ -96,14 +275,22 @@ class MessageQueue {
       return
     }
 
+    // 背压期间的 Background 调用直接丢弃，不进入队列
+    const priority = this._priority
+    if (
+      priority === MessageQueue.Priority.Background &&
+      this._backpressureLimits.dropBackground &&
+      this.isBackpressured()
+    ) {
+      this._droppedCalls++
+      if (onFail) onFail({ message: 'Call dropped: backpressure' })
+      return
+    }
+
     // 生成回调ID并注册回调函数
     let callbackID = null
     if (onFail || onSucc) {
-      callbackID = this._callbackID++
-      this._callbacks[callbackID] = {
-        onFail: onFail,
-        onSucc: onSucc,
-      }
+      callbackID = this._callbacks.register(onFail, onSucc)
     }
 
     // 将调用添加到队列中
@@ -113,22 +300,37 @@ class MessageQueue {
     this._queue[2].push(params || []) // params
     this._queue[3].push(callbackID) // callbackIds
 
-    if (this._debugEnabled) {
+    // 第一次出现显式优先级时才附加 priorities 数组，之前的调用补 null
+    if (priority !== null && this._queue.length === 4) {
+      this._queue.push(new Array(this._queue[0].length - 1).fill(null))
+    }
+    if (this._queue.length === 5) {
+      this._queue[4].push(priority) // priorities
+    }
+
+    this._updateLocalBackpressure()
+
+    if (__DEV__ && this._debugEnabled) {
       console.log(`[MessageQueue] Queued call - Queue length: ${this._queue[0].length}`)
     }
 
-    // 立即刷新队列（简化版实现，实际 RN 会做批量优化）
-    this._flushQueue()
+    // Native 调入 JS 期间（callFunction / invokeCallback）只入队，
+    // 由 *ReturnFlushedQueue 随返回值整批带回，Native 按一个批次执行；
+    // 其余情况立即刷新（简化版实现，实际 RN 还会按时间间隔合并）；
+    // Immediate 调用不等批次结束
+    if (!this._isInCallback || priority === MessageQueue.Priority.Immediate) {
+      this._flushQueue()
+    }
   }
 
   /**
    * 获取并清空待处理队列
    * 这是 Native 端获取 JavaScript 待执行调用的标准接口
    *
-   * @returns {Array} 格式：[moduleIds, methodIds, params, callbackIds]
+   * @returns {Array} 格式：[moduleIds, methodIds, params, callbackIds(, priorities)]
    */
   flushedQueue() {
-    if (this._debugEnabled) {
+    if (__DEV__ && this._debugEnabled) {
       console.log(`[MessageQueue] Flushing queue with ${this._queue[0].length} calls`)
     }
 
@@ -136,6 +338,10 @@ class MessageQueue {
     const queue = this._queue
     this._queue = [[], [], [], []]
 
+    if (this._localBackpressure) {
+      this._updateLocalBackpressure()
+    }
+
     return queue
   }
 
@@ -149,10 +355,13 @@ class MessageQueue {
    * @returns {Array} 执行后的消息队列
    */
   callFunctionReturnFlushedQueue(module, method, args) {
-    if (this._debugEnabled) {
+    if (__DEV__ && this._debugEnabled) {
       console.log(`[MessageQueue] Calling JS function - Module: ${module}, Method: ${method}`)
     }
 
+    // 保存外层状态：Immediate 调用在回调中同步刷新时，Native 可能嵌套调入这里，
+    // 内层结束后外层仍在回调中，不能清掉外层的标记
+    const wasInCallback = this._isInCallback
     this._isInCallback = true
 
     try {
@@ -174,7 +383,7 @@ class MessageQueue {
     } catch (error) {
       console.error(`[MessageQueue] Error calling ${module}.${method}:`, error)
     } finally {
-      this._isInCallback = false
+      this._isInCallback = wasInCallback
     }
 
     // 返回在函数执行过程中可能产生的新调用
@@ -206,10 +415,11 @@ class MessageQueue {
    * @returns {Array} 新的消息队列（如果回调中产生了新的调用）
    */
   invokeCallbackAndReturnFlushedQueue(callbackID, args) {
-    if (this._debugEnabled) {
+    if (__DEV__ && this._debugEnabled) {
       console.log(`[MessageQueue] Invoking callback: ${callbackID}`)
     }
 
+    const wasInCallback = this._isInCallback
     this._isInCallback = true
 
     try {
@@ -217,7 +427,7 @@ class MessageQueue {
     } catch (error) {
       console.error('[MessageQueue] Error invoking callback:', error)
     } finally {
-      this._isInCallback = false
+      this._isInCallback = wasInCallback
     }
 
     // 返回在回调执行过程中可能产生的新调用
@@ -253,7 +463,7 @@ class MessageQueue {
       // 获取当前队列
       const queue = this.flushedQueue()
 
-      if (this._debugEnabled) {
+      if (__DEV__ && this._debugEnabled) {
         console.log('[MessageQueue] Flushing to native:', {
           moduleIds: queue[0],
           methodIds: queue[1],
@@ -270,6 +480,36 @@ class MessageQueue {
     }
   }
 
+  /**
+   * 按待回调数与队列中的调用数更新本地背压状态
+   *
+   * @private
+   */
+  _updateLocalBackpressure() {
+    const pending = this._callbacks.pendingCount + this._queue[0].length
+    const { highWatermark, lowWatermark } = this._backpressureLimits
+    if (!this._localBackpressure) {
+      this._localBackpressure = pending >= highWatermark
+    } else if (pending <= lowWatermark) {
+      this._localBackpressure = false
+      this._notifyDrained()
+    }
+  }
+
+  /**
+   * 背压完全解除时 resolve 所有 whenDrained 返回的 Promise
+   *
+   * @private
+   */
+  _notifyDrained() {
+    if (this.isBackpressured() || this._drainWaiters.length === 0) {
+      return
+    }
+    const waiters = this._drainWaiters
+    this._drainWaiters = []
+    waiters.forEach((resolve) => resolve())
+  }
+
   /**
    * 执行单个回调
    *
@@ -278,28 +518,35 @@ class MessageQueue {
    * @private
    */
   _invokeCallback(callbackID, args) {
-    const callback = this._callbacks[callbackID]
+    const slot = this._callbacks.lookup(callbackID)
 
-    if (!callback) {
+    if (slot < 0) {
+      // 未注册、已执行过（重复回调）或槽位已被复用（过期ID）
       console.error(`[MessageQueue] Callback ${callbackID} not found`)
       return
     }
 
-    // 清理回调引用，避免内存泄漏
-    delete this._callbacks[callbackID]
+    const onFail = this._callbacks.getFailCallback(slot)
+    const onSucc = this._callbacks.getSuccessCallback(slot)
+
+    // 先释放槽位再执行：回调内部发起的新调用可以立即复用该槽位
+    this._callbacks.release(slot)
+    if (this._localBackpressure) {
+      this._updateLocalBackpressure()
+    }
 
     try {
       // RN 的回调约定：第一个参数是错误，后续参数是结果
       if (args && args[0] != null) {
         // 有错误，调用失败回调
-        if (callback.onFail) {
-          callback.onFail(args[0])
+        if (onFail) {
+          onFail(args[0])
         }
       } else {
         // 成功，调用成功回调
-        if (callback.onSucc) {
+        if (onSucc) {
           const result = args ? args.slice(1) : []
-          callback.onSucc.apply(null, result)
+          onSucc.apply(null, result)
         }
       }
     } catch (error) {
@@ -324,7 +571,7 @@ class MessageQueue {
     const factory = this._lazyCallableModules[moduleName]
     if (factory) {
       this._modules[moduleName] = factory()
-      if (this._debugEnabled) {
+      if (__DEV__ && this._debugEnabled) {
         console.log(`[MessageQueue] Lazy loaded module: ${moduleName}`)
       }
       return this._modules[moduleName]
@@ -342,10 +589,12 @@ class MessageQueue {
   getQueueStatus() {
     return {
       queueLength: this._queue[0].length,
-      callbackCount: Object.keys(this._callbacks).length,
+      callbackCount: this._callbacks.pendingCount,
       moduleCount: Object.keys(this._modules).length,
       lazyModuleCount: Object.keys(this._lazyCallableModules).length,
       isInCallback: this._isInCallback,
+      backpressured: this.isBackpressured(),
+      droppedCalls: this._droppedCalls,
     }
   }
 
@@ -354,12 +603,28 @@ class MessageQueue {
    */
   clearAll() {
     this._queue = [[], [], [], []]
-    this._callbacks = {}
-    console.log('[MessageQueue] Cleared all queues and callbacks')
+    this._callbacks = new CallbackRegistry()
+    this._localBackpressure = false
+    this._notifyDrained()
+    if (__DEV__) {
+      console.log('[MessageQueue] Cleared all queues and callbacks')
+    }
   }
 }
 
+/**
+ * 调用优先级，与 Native 端 CallPriority 的数值一致
+ */
+MessageQueue.Priority = Object.freeze({
+  Immediate: 0,
+  UserBlocking: 1,
+  Normal: 2,
+  Background: 3,
+})
+
 // 使用 CommonJS 导出
 module.exports = MessageQueue
 
-console.log('[MessageQueue] MessageQueue.js loaded - CommonJS module')
+if (__DEV__) {
+  console.log('[MessageQueue] MessageQueue.js loaded - CommonJS module')
+}
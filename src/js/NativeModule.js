@@ -16,7 +16,9 @@
 
 // 使用 CommonJS require 导入 BatchedBridge
 const BatchedBridge = require('./BatchedBridge')
-console.log('[NativeModule] BatchedBridge imported via require:', typeof BatchedBridge)
+if (__DEV__) {
+  console.log('[NativeModule] BatchedBridge imported via require:', typeof BatchedBridge)
+}
 
 // 类型定义 (对应官方的 MethodType)
 const MethodType = {
@@ -167,7 +169,7 @@ function genModule(config, moduleID) {
   }
 
   // 在开发模式下创建调试信息
-  if (typeof global.__DEV__ !== 'undefined' && global.__DEV__) {
+  if (__DEV__) {
     // 简化版的调试信息记录
     console.log(`[NativeModule] Created module: ${moduleName} with methods:`, methods)
   }
@@ -219,7 +221,9 @@ function initializeNativeModules() {
     }
   })
 
-  console.log('[NativeModule] Initialized', remoteModuleConfig.length, 'native modules')
+  if (__DEV__) {
+    console.log('[NativeModule] Initialized', remoteModuleConfig.length, 'native modules')
+  }
 }
 
 // 导出全局函数供 Native 端调用 (对应官方的 global.__fbGenNativeModule)
@@ -274,4 +278,6 @@ const NativeModuleInterface = {
 // 使用 CommonJS 导出
 module.exports = NativeModuleInterface
 
-console.log('[NativeModule] NativeModule.js loaded - CommonJS module')
+if (__DEV__) {
+  console.log('[NativeModule] NativeModule.js loaded - CommonJS module')
+}
@@ -0,0 +1,103 @@
+/**
+ * VirtualizedList.js - 虚拟列表窗口计算
+ *
+ * 与 Native 端的 VirtualizedListModule 对应。React Native 的 VirtualizedList
+ * 在 JS 中保存每个 item 的 frame，滚动时线性计算渲染窗口；这里把偏移表交给
+ * Native（树状数组），JS 只上报测量到的高度并按滚动位置查询窗口，
+ * 两者都是 O(log n)。
+ *
+ * 所有 Native 方法都是同步方法，查询结果立即可用，不需要等待下一个批次。
+ *
+ * 使用示例：
+ * ```javascript
+ * const list = VirtualizedList.create(10000, 44)
+ * list.setItemHeights(0, [60, 44, 80])          // onLayout 测量结果
+ * const { first, last } = list.getWindow(scrollY, viewportHeight, 200)
+ * list.release()
+ * ```
+ */
+
+'use strict'
+
+const NativeModules = require('./NativeModule')
+
+let VirtualizedListNative = null
+let nextListId = 1
+
+function getVirtualizedListNative() {
+  if (!VirtualizedListNative) {
+    VirtualizedListNative = NativeModules.get('VirtualizedList')
+
+    if (!VirtualizedListNative) {
+      throw new Error('VirtualizedList native module is not available')
+    }
+  }
+
+  return VirtualizedListNative
+}
+
+/**
+ * 一个虚拟列表的偏移表句柄
+ */
+class ListLayout {
+  constructor(itemCount, estimatedItemHeight) {
+    this.listId = nextListId++
+    this.totalHeight = getVirtualizedListNative().configure(this.listId, itemCount, estimatedItemHeight)
+  }
+
+  /**
+   * 上报从 startIndex 开始的连续 item 高度（null 表示尚未测量）
+   * @returns {number} 列表总高度
+   */
+  setItemHeights(startIndex, heights) {
+    this.totalHeight = getVirtualizedListNative().setItemHeights(this.listId, startIndex, heights)
+    return this.totalHeight
+  }
+
+  /**
+   * 数据源长度变化，新增的 item 使用估计高度
+   * @returns {number} 列表总高度
+   */
+  setItemCount(itemCount) {
+    this.totalHeight = getVirtualizedListNative().setItemCount(this.listId, itemCount)
+    return this.totalHeight
+  }
+
+  /**
+   * 计算渲染窗口
+   * @returns {{first: number, last: number, offset: number, end: number, totalHeight: number}}
+   */
+  getWindow(offset, viewportLength, overscan = 0) {
+    const window = getVirtualizedListNative().getWindow(this.listId, offset, viewportLength, overscan)
+    this.totalHeight = window.totalHeight
+    return window
+  }
+
+  /**
+   * item 的起始偏移（用于 scrollToIndex）
+   */
+  getItemOffset(index) {
+    return getVirtualizedListNative().getItemOffset(this.listId, index)
+  }
+
+  release() {
+    getVirtualizedListNative().release(this.listId)
+  }
+}
+
+const VirtualizedList = {
+  /**
+   * 创建列表偏移表
+   * @param {number} itemCount item 数量
+   * @param {number} estimatedItemHeight 未测量 item 的估计高度
+   */
+  create(itemCount, estimatedItemHeight) {
+    return new ListLayout(itemCount, estimatedItemHeight)
+  },
+
+  isAvailable() {
+    return !!NativeModules.get('VirtualizedList')
+  },
+}
+
+module.exports = VirtualizedList
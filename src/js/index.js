@@ -4,34 +4,81 @@
  * 这是 Mini React Native 的 JavaScript 模块系统入口文件。
  * 负责按正确的顺序加载和初始化所有核心模块。
  *
- * 加载顺序至关重要：
+ * 启动时只加载 Bridge 核心（顺序至关重要）：
  * 0. Console - 控制台实现（必须最先加载）
  * 1. MessageQueue - 核心通信队列
  * 2. BatchedBridge - 桥接器（依赖 MessageQueue）
  * 3. NativeModule - 原生模块系统（依赖 BatchedBridge）
- * 4. DeviceInfo - 具体的原生模块（依赖 NativeModule）
+ *
+ * 其余模块（DeviceInfo、DeviceEventEmitter、JSTimers、VirtualizedList、
+ * AsyncStorage、FileSystem、BlobManager）在第一次使用时才 require：
+ * global 上的同名属性是惰性 getter；Native 调入的 RCTDeviceEventEmitter、
+ * JSTimers 注册为延迟可调用模块；setTimeout 等全局函数第一次访问时加载 JSTimers。
+ * 索引 RAM bundle 中这些模块直到被用到才经过 nativeRequire。
+ *
+ * 调试日志都写在 if (__DEV__) 中：开发构建的 __DEV__ 由 Native 按构建类型注入，
+ * 发布构建（npm run build:release）在打包时把 __DEV__ 替换为 false，
+ * 这些分支连同日志字符串一起被移除。
  */
 
 // 0. 首先加载 console 实现（在任何 console.log 调用之前）
 const console = require('./console')
 
-console.log('[MiniReactNative] Starting JavaScript module system initialization...')
+if (__DEV__) {
+  console.log('[MiniReactNative] Starting JavaScript module system initialization...')
+}
 
 // 1. 加载核心通信模块
 const MessageQueue = require('./MessageQueue')
-console.log('[MiniReactNative] MessageQueue loaded')
+if (__DEV__) {
+  console.log('[MiniReactNative] MessageQueue loaded')
+}
 
 // 2. 加载并初始化桥接器
 const BatchedBridge = require('./BatchedBridge')
-console.log('[MiniReactNative] BatchedBridge loaded and __fbBatchedBridge set')
+if (__DEV__) {
+  console.log('[MiniReactNative] BatchedBridge loaded and __fbBatchedBridge set')
+}
 
 // 3. 加载原生模块系统
 const NativeModules = require('./NativeModule')
-console.log('[MiniReactNative] NativeModule system loaded')
+if (__DEV__) {
+  console.log('[MiniReactNative] NativeModule system loaded')
+}
 
-// 4. 加载具体的模块
-const DeviceInfo = require('./DeviceInfo')
-console.log('[MiniReactNative] DeviceInfo module loaded')
+/**
+ * 在 global 上定义惰性属性：第一次读取时调用 load 并替换为普通属性，
+ * 赋值（如 JSTimers 加载时安装 setTimeout）同样替换为普通属性
+ */
+function defineLazyGlobal(name, load) {
+  const define = (value) => {
+    Object.defineProperty(global, name, { value, writable: true, enumerable: true, configurable: true })
+    return value
+  }
+  Object.defineProperty(global, name, {
+    get() {
+      return define(load())
+    },
+    set: define,
+    enumerable: true,
+    configurable: true,
+  })
+}
+
+// 按需加载的模块，require 推迟到第一次使用
+const lazyModules = {
+  DeviceInfo: () => require('./DeviceInfo'),
+  DeviceEventEmitter: () => require('./EventEmitter'),
+  JSTimers: () => require('./JSTimers'),
+  VirtualizedList: () => require('./VirtualizedList'),
+  AsyncStorage: () => require('./AsyncStorage'),
+  FileSystem: () => require('./FileSystem'),
+  BlobManager: () => require('./Blob'),
+}
+
+// Native 通过 callFunction 调入的模块：第一次被调用时才加载
+BatchedBridge.registerLazyCallableModule('RCTDeviceEventEmitter', lazyModules.DeviceEventEmitter)
+BatchedBridge.registerLazyCallableModule('JSTimers', lazyModules.JSTimers)
 
 // 将关键模块暴露到全局环境，保持与原有系统的兼容性
 // 这样 C++ 端可以继续使用 global.__fbBatchedBridge 等接口
@@ -47,10 +94,29 @@ if (typeof global !== 'undefined') {
   // 设置 NativeModules 为全局可访问
   global.NativeModules = NativeModules
 
-  // 设置 DeviceInfo 为全局可访问（便于测试）
-  global.DeviceInfo = DeviceInfo
+  // 其余模块为惰性属性
+  Object.keys(lazyModules).forEach((name) => defineLazyGlobal(name, lazyModules[name]))
 
-  console.log('[MiniReactNative] Global objects set up successfully')
+  // 嵌入的 JS 引擎没有内置定时器：第一次访问时加载 JSTimers，由它安装这些函数
+  const timerFunctions = [
+    'setTimeout',
+    'setInterval',
+    'clearTimeout',
+    'clearInterval',
+    'requestAnimationFrame',
+    'cancelAnimationFrame',
+  ]
+  timerFunctions.forEach((name) => {
+    defineLazyGlobal(name, () => {
+      delete global[name]
+      lazyModules.JSTimers()
+      return global[name]
+    })
+  })
+
+  if (__DEV__) {
+    console.log('[MiniReactNative] Global objects set up successfully')
+  }
 }
 
 // 导出主要接口供外部使用
@@ -58,22 +124,27 @@ module.exports = {
   MessageQueue,
   BatchedBridge,
   NativeModules,
-  DeviceInfo,
 
   // 提供版本信息
   version: '1.0.0',
 
-  // 提供状态查询方法
+  // 提供状态查询方法（不会触发按需模块的加载）
   getStatus() {
     return {
       messageQueueReady: !!MessageQueue,
       batchedBridgeReady: !!BatchedBridge && !!global.__fbBatchedBridge,
       nativeModulesReady: !!NativeModules,
-      deviceInfoReady: !!DeviceInfo,
-      bridgeConfigReady: !!global.__fbBatchedBridgeConfig
+      bridgeConfigReady: !!global.__fbBatchedBridgeConfig,
     }
-  }
+  },
 }
 
-console.log('[MiniReactNative] JavaScript bundle loaded successfully!')
-console.log('[MiniReactNative] System status:', module.exports.getStatus())
\ No newline at end of file
+// 按需模块同样以惰性属性导出
+Object.keys(lazyModules).forEach((name) => {
+  Object.defineProperty(module.exports, name, { get: lazyModules[name], enumerable: true })
+})
+
+if (__DEV__) {
+  console.log('[MiniReactNative] JavaScript bundle loaded successfully!')
+  console.log('[MiniReactNative] System status:', module.exports.getStatus())
+}
\ No newline at end of file
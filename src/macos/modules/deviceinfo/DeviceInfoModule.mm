@@ -36,6 +36,30 @@ void DeviceInfoModule::invoke(const std::string& methodName, const std::string&
   }
 }
 
+std::vector<std::string> DeviceInfoModule::getPromiseMethods() const {
+  return {"getUniqueId"};
+}
+
+std::vector<std::string> DeviceInfoModule::getSyncMethods() const {
+  return {"getSystemVersion", "getDeviceId"};
+}
+
+std::map<std::string, double> DeviceInfoModule::getCacheableMethods() const {
+  return {{"getUniqueId", kCacheForever},
+          {"getSystemVersion", kCacheForever},
+          {"getDeviceId", kCacheForever}};
+}
+
+std::string DeviceInfoModule::invokeSync(const std::string& methodName, const std::string& args) {
+  (void)args;
+  if (methodName == "getSystemVersion") {
+    return utils::quoteJSONString(getSystemVersionImpl());
+  } else if (methodName == "getDeviceId") {
+    return utils::quoteJSONString(getDeviceIdImpl());
+  }
+  return "";
+}
+
 // macOS 平台特定实现
 std::string DeviceInfoModule::getUniqueIdImpl() const {
   @autoreleasepool {